@@ -26,27 +26,31 @@
 #include "Mine.h"
 #include "MineAbout.h"
 #include "MineBestTimes.h"
+#include "MineDamage.h"
 #include "MineDebug.h"
+#include "MineFrontier.h"
+#include "MineMinimap.h"
 #include "MineMouse.h"
 #include "MineNewBest.h"
 #include "MineCustom.h"
 #include "MineMovement.h"
+#include "MineRender.h"
+#include "MineSim.h"
+#include "MineSprite.h"
 
 //Needed to link against proper version of comctl32.lib
 #pragma comment(linker, "/manifestdependency:\"type='win32' name='Microsoft.Windows.Common-Controls' version='6.0.0.0' processorArchitecture='*' publicKeyToken='6595b64144ccf1df' language='*'\"")
 
 // Global Variables:
 BOOLEAN              clockTimerCreated = FALSE;
-MINE_GAME_SETTINGS   gameData = {0};
+BOOLEAN              frameTimerCreated = FALSE;
 HCRYPTPROV           hCrypto = NULL;
 HINSTANCE            hInst = NULL;
 HWND                 hwnd = NULL;
-MINE_IMAGE_STORAGE   imageData = {0};
-MINE_GLOBAL_SETTINGS menuData = {0};
-BOOLEAN              movementTimerCreated = FALSE;
+BOOLEAN              scrollTimerCreated = FALSE;
+MINE_STARTUP_TIMES   startupTimes = {0};
 WCHAR                szTitle[MINE_LOADSTRING_MAX_CHARS] = {0};
 WCHAR                szWindowClass[MINE_LOADSTRING_MAX_CHARS] = {0};
-MINE_WINDOW_SETTINGS windowData = {0};
 
 /**
     wWinMain
@@ -65,15 +69,19 @@ wWinMain(_In_ HINSTANCE hInstance, _In_opt_ HINSTANCE hPrevInstance,
          _In_ PWSTR lpCmdLine, _In_ int nCmdShow)
 {
     BOOLEAN              bFalse = FALSE;
+    RECT                 frameSize = {0};
     HACCEL               hAccelTable;
     INITCOMMONCONTROLSEX icc;
     BOOL                 messageReturn = 1;
     MSG                  msg;
     MINE_ERROR           status = MINE_ERROR_SUCCESS;
+    RECT                 workArea = {0};
 
     UNREFERENCED_PARAMETER(hPrevInstance);
     UNREFERENCED_PARAMETER(lpCmdLine);
 
+    Mine_RecordProcessStart();
+
     do
     {
         hInst = hInstance;
@@ -96,12 +104,7 @@ wWinMain(_In_ HINSTANCE hInstance, _In_opt_ HINSTANCE hPrevInstance,
             break;
         }
 
-        status = Mine_SetupImageData();
-        if (MINE_ERROR_SUCCESS != status)
-        {
-            MineDebug_PrintError("In function Mine_SetupImageData: %i\n", (int) status);
-            break;
-        }
+        startupTimes.settingsTime = Mine_GetStartupTime();
 
         status = Mine_SetupGame();
         if (MINE_ERROR_SUCCESS != status)
@@ -110,6 +113,23 @@ wWinMain(_In_ HINSTANCE hInstance, _In_opt_ HINSTANCE hPrevInstance,
             break;
         }
 
+        //Boards that don't fit in the work area are shown through a scrolling view
+        if (0 == SystemParametersInfoW(SPI_GETWORKAREA, 0, &workArea, 0))
+        {
+            MineDebug_PrintWarning("Unable to get work area: %lu\n", GetLastError());
+        }
+        else if (0 == AdjustWindowRect(&frameSize, WS_OVERLAPPED|WS_CAPTION|WS_SYSMENU|WS_MINIMIZEBOX, TRUE))
+        {
+            MineDebug_PrintWarning("Unable to calculate window frame size: %lu\n", GetLastError());
+        }
+        else
+        {
+            windowData.maxViewWidth = (workArea.right - workArea.left) - (frameSize.right - frameSize.left) -
+                                      MINE_BASE_WIDTH_PIXELS;
+            windowData.maxViewHeight = (workArea.bottom - workArea.top) - (frameSize.bottom - frameSize.top) -
+                                       MINE_BASE_HEIGHT_PIXELS;
+        }
+
         Mine_SetupWindow();
 
         //Load strings defined in the resource file
@@ -143,6 +163,8 @@ wWinMain(_In_ HINSTANCE hInstance, _In_opt_ HINSTANCE hPrevInstance,
             break;
         }  
 
+        startupTimes.windowTime = Mine_GetStartupTime();
+
         /** Create the timer that updates the clock. */
         if (0 == SetTimer(hwnd, MINE_TIMER_CLOCK, MINE_CLOCK_UPDATE_TIME, NULL))
         {
@@ -153,17 +175,13 @@ wWinMain(_In_ HINSTANCE hInstance, _In_opt_ HINSTANCE hPrevInstance,
             clockTimerCreated = TRUE;
         }
 
-        if (menuData.useMovement)
+        /** Start the thread that moves mines, it waits until a game with movement starts. */
+        status = MineSim_Startup();
+        if (MINE_ERROR_SUCCESS != status)
         {
-            /** Create the timer that signals mine movement if needed. */
-            if (0 == SetTimer(hwnd, MINE_TIMER_MOVE, (UINT) menuData.movementFreq, NULL))
-            {
-                MineDebug_PrintWarning("Creating movement timer: %lu\n", GetLastError());
-            }
-            else
-            {
-                movementTimerCreated = TRUE;
-            }
+            //Play goes on without movement
+            MineDebug_PrintWarning("In function MineSim_Startup: %i\n", (int) status);
+            status = MINE_ERROR_SUCCESS;
         }
 
         hAccelTable = LoadAcceleratorsW(hInstance, MAKEINTRESOURCEW(IDA_ACCELERATORS));
@@ -212,139 +230,6 @@ wWinMain(_In_ HINSTANCE hInstance, _In_opt_ HINSTANCE hPrevInstance,
     return ((int) status);
 }
 
-/** 
-    Mine_AssignNumbers
-*//**
-    Count the number of mines surrounding the tiles in a region of the board.
-
-    @param[in] xGridMin - Minimum x coordinate for board region.
-    @param[in] xGridMax - Maximum x coordinate for board region.
-    @param[in] yGridMin - Minimum y coordinate for board region.
-    @param[in] yGridMax - Maximum y coordinate for board region.
-
-    @return Mine error code (MINE_ERROR_SUCCESS on success).
-*/
-MINE_ERROR
-Mine_AssignNumbers(LONG xGridMin, LONG xGridMax, LONG yGridMin, LONG yGridMax)
-{
-    BOOLEAN    bFalse = FALSE;
-    INT        ix = 0;
-    INT        jx = 0;
-    CHAR       mines = 0;
-    MINE_ERROR status = MINE_ERROR_SUCCESS;
-    LONG       xGridBase = 0;
-    LONG       xGridPos = 0;
-    LONG       yGridBase = 0;
-    LONG       yGridPos = 0;
-
-    do
-    {
-        xGridMin = max(0, min(xGridMin, (LONG) gameData.width - 1));
-        xGridMax = max(0, min(xGridMax, (LONG) gameData.width - 1));
-        yGridMin = max(0, min(yGridMin, (LONG) gameData.height - 1));
-        yGridMax = max(0, min(yGridMax, (LONG) gameData.height - 1));
-
-        if ((xGridMin > xGridMax) || (yGridMin > yGridMax))
-        {
-            status = MINE_ERROR_PARAMETER;
-            MineDebug_PrintError("Grid input min is greater than max\n");
-            break;
-        }
-
-        for (xGridBase = xGridMin; xGridBase <= xGridMax; xGridBase++)
-        {
-            for (yGridBase = yGridMin; yGridBase <= yGridMax; yGridBase++)
-            {
-                //Tiles that are bombs do not get a number
-                if (MINE_BOMB_VALUE == gameData.gameBoard[MINE_INDEX(xGridBase, yGridBase)])
-                {
-                    continue;
-                }
-
-                mines = 0;
-
-                /** For each non-mine tile, count number of mines in surrounding tiles. */
-
-                /** Allow wrapping for x coordinates if in wrap horizontal mode. */
-                for (ix = -1; ix <= 1; ix++)
-                {
-                    xGridPos = xGridBase + ix;
-
-                    if (xGridPos < 0)
-                    {
-                        if (menuData.wrapHorz)
-                        {
-                            xGridPos = (LONG) gameData.width - 1;
-                        }
-                        else
-                        {
-                            continue;
-                        }
-                    }
-                    else if  (xGridPos > ((LONG) (gameData.width - 1)))
-                    {
-                        if (menuData.wrapHorz)
-                        {
-                            xGridPos = 0;
-                        }
-                        else
-                        {
-                            continue;
-                        }
-                    }
-                
-                    /** Allow wrapping for y coordinate if in wrap vertical mode. */
-                    for (jx = -1; jx <= 1; jx++)
-                    {
-                        //Skip the check for the current tile itself
-                        if ((0 == ix) && (0 == jx))
-                        {
-                            continue;
-                        }
-
-                        yGridPos = yGridBase + jx;
-
-                        if (yGridPos < 0)
-                        {
-                            if (menuData.wrapVert)
-                            {
-                                yGridPos = (LONG) gameData.height - 1;
-                            }
-                            else
-                            {
-                                continue;
-                            }
-                        }
-                        else if (yGridPos > (LONG) (gameData.height - 1))
-                        {
-                            if (menuData.wrapVert)
-                            {
-                                yGridPos = 0;
-                            }
-                            else
-                            {
-                                continue;
-                            }
-                        }
-                        
-                        //Check for a mine
-                        if (MINE_BOMB_VALUE == gameData.gameBoard[MINE_INDEX(xGridPos, yGridPos)])
-                        {
-                            mines += 1;
-                        }
-                    }
-                }
-
-                gameData.gameBoard[MINE_INDEX(xGridBase, yGridBase)] = mines;
-            }
-        }
-
-        __assume(FALSE == bFalse);
-    } while (bFalse);
-
-    return status;
-}
-
 /**
     Mine_Cleanup
 *//**
@@ -354,7 +239,6 @@ VOID
 Mine_Cleanup(VOID)
 {
     HANDLE hHeap = NULL;
-    INT    ix = 0;
 
     hHeap = GetProcessHeap();
     if (NULL == hHeap)
@@ -390,189 +274,127 @@ Mine_Cleanup(VOID)
             }
             menuData.expertName = NULL;
         }
-
-        if (NULL != gameData.gameBoard)
-        {
-            if (0 == HeapFree(hHeap, 0, gameData.gameBoard))
-            {
-                MineDebug_PrintWarning("Unable to free game board: %lu\n", GetLastError());
-            }
-            gameData.gameBoard = NULL;
-        }
-
-        if (NULL != gameData.tileStatus)
-        {
-            if (0 == HeapFree(hHeap, 0, gameData.tileStatus))
-            {
-                MineDebug_PrintWarning("Unable to free tile status: %lu\n", GetLastError());
-            }
-            gameData.tileStatus = NULL;
-        }
     }
 
-    /** Delete stored image objects. */
-    for (ix = 0; ix < 10; ix++)
-    {
-        if (NULL != imageData.timer[ix])
-        {
-            if (0 == DeleteObject((HGDIOBJ) imageData.timer[ix]))
-            {
-                MineDebug_PrintWarning("Unable to delete timer %i object\n", ix);
-            }
-            imageData.timer[ix] = NULL;
-        }
-    }
+    /** Delete the board arena, the frame renderer pixels and the minimap. */
+    Mine_FreeBoard();
+    MineRender_Cleanup();
+    MineMinimap_Cleanup();
 
-    if (NULL != imageData.timerDash)
+    if (NULL != hCrypto)
     {
-        if (0 == DeleteObject((HGDIOBJ) imageData.timerDash))
+        if (0 == CryptReleaseContext(hCrypto, 0))
         {
-            MineDebug_PrintWarning("Unable to delete timer dash object\n");
+            MineDebug_PrintWarning("Unable to release crypt context: %lu\n", GetLastError());
         }
-        imageData.timerDash = NULL;
+        hCrypto = NULL;
     }
 
-    if (NULL != imageData.faceNormal)
-    {
-        if (0 == DeleteObject((HGDIOBJ) imageData.faceNormal))
-        {
-            MineDebug_PrintWarning("Unable to delete face normal object\n");
-        }
-        imageData.faceNormal = NULL;
-    }
+    return;
+}
 
-    if (NULL != imageData.faceClicked)
-    {
-        if (0 == DeleteObject((HGDIOBJ) imageData.faceClicked))
-        {
-            MineDebug_PrintWarning("Unable to delete face clicked object\n");
-        }
-        imageData.faceClicked = NULL;
-    }
+/**
+    Mine_FitWindowToClient
+*//**
+    Resize the main window so its client area matches the size stored in windowData.
 
-    if (NULL != imageData.faceWon)
-    {
-        if (0 == DeleteObject((HGDIOBJ) imageData.faceWon))
-        {
-            MineDebug_PrintWarning("Unable to delete face won object\n");
-        }
-        imageData.faceWon = NULL;
-    }
+    @return Mine error code (MINE_ERROR_SUCCESS on success).
+*/
+MINE_ERROR
+Mine_FitWindowToClient(VOID)
+{
+    BOOLEAN    bFalse = FALSE;
+    RECT       clientSize = {0};
+    MINE_ERROR status = MINE_ERROR_SUCCESS;
+    RECT       windowSize = {0};
 
-    if (NULL != imageData.faceLost)
+    do
     {
-        if (0 == DeleteObject((HGDIOBJ) imageData.faceLost))
+        if ((0 == GetWindowRect(hwnd, &windowSize)) || (0 == GetClientRect(hwnd, &clientSize)))
         {
-            MineDebug_PrintWarning("Unable to delete face lost object\n");
+            MineDebug_PrintError("Getting window rectangle: %lu\n", GetLastError());
+            status = MINE_ERROR_GET_DATA;
+            break;
         }
-        imageData.faceLost = NULL;
-    }
 
-    for (ix = 0; ix < 9; ix++)
-    {
-        if (NULL != imageData.numbers[ix])
-        {
-            if (0 == DeleteObject((HGDIOBJ) imageData.numbers[ix]))
-            {
-                MineDebug_PrintWarning("Unable to delete number %i object\n", ix);
-            }
-            imageData.numbers[ix] = NULL;
-        }
-    }
+        //Change in window size is the change in client area size
+        windowSize.right += (LONG) windowData.clientWidth - clientSize.right;
+        windowSize.bottom += (LONG) windowData.clientHeight - clientSize.bottom;
 
-    if (NULL != imageData.unclicked)
-    {
-        if (0 == DeleteObject((HGDIOBJ) imageData.unclicked))
+        if (0 == MoveWindow(hwnd, windowSize.left, windowSize.top,
+                            windowSize.right - windowSize.left,
+                            windowSize.bottom - windowSize.top, TRUE))
         {
-            MineDebug_PrintWarning("Unable to delete unclicked object\n");
+            MineDebug_PrintError("Moving the window: %lu\n", GetLastError());
+            status = MINE_ERROR_RESIZE;
+            break;
         }
-        imageData.unclicked = NULL;
-    }
 
-    if (NULL != imageData.held)
-    {
-        if (0 == DeleteObject((HGDIOBJ) imageData.held))
-        {
-            MineDebug_PrintWarning("Unable to delete held object\n");
-        }
-        imageData.held = NULL;
-    }
+        __assume(FALSE == bFalse);
+    } while (bFalse);
 
-    if (NULL != imageData.flag)
-    {
-        if (0 == DeleteObject((HGDIOBJ) imageData.flag))
-        {
-            MineDebug_PrintWarning("Unable to delete flag object\n");
-        }
-        imageData.flag = NULL;
-    }
+    return status;
+}
 
-    if (NULL != imageData.falseFlag)
-    {
-        if (0 == DeleteObject((HGDIOBJ) imageData.falseFlag))
-        {
-            MineDebug_PrintWarning("Unable to delete false flag object\n");
-        }
-        imageData.falseFlag = NULL;
-    }
+/**
+    Mine_FlushDamage
+*//**
+    Draw everything damaged since the last frame into the frame, and mark the
+    same areas of the window to be copied from the frame on the next paint.
 
-    if (NULL != imageData.mine)
-    {
-        if (0 == DeleteObject((HGDIOBJ) imageData.mine))
-        {
-            MineDebug_PrintWarning("Unable to delete mine object\n");
-        }
-        imageData.mine = NULL;
-    }
+    @return Mine error code (MINE_ERROR_SUCCESS on success).
+*/
+MINE_ERROR
+Mine_FlushDamage(VOID)
+{
+    BOOLEAN    bFalse = FALSE;
+    UINT       ix = 0;
+    UINT       numRects = 0;
+    RECT       rects[MINE_DAMAGE_MAX_RECTS] = {0};
+    MINE_ERROR status = MINE_ERROR_SUCCESS;
 
-    if (NULL != imageData.mineHit)
+    do
     {
-        if (0 == DeleteObject((HGDIOBJ) imageData.mineHit))
+        //The damage is all taken here, so the frame timer has nothing left to do
+        if (frameTimerCreated)
         {
-            MineDebug_PrintWarning("Unable to delete mine hit object\n");
+            if (0 == KillTimer(hwnd, MINE_TIMER_FRAME))
+            {
+                MineDebug_PrintWarning("Unable to kill frame timer: %lu\n", GetLastError());
+            }
+            frameTimerCreated = FALSE;
         }
-        imageData.mineHit = NULL;
-    }
 
-    if (NULL != hCrypto)
-    {
-        if (0 == CryptReleaseContext(hCrypto, 0))
+        //Frame follows the client area size whenever the level changes
+        status = MineRender_ResizeFrame();
+        if (MINE_ERROR_SUCCESS != status)
         {
-            MineDebug_PrintWarning("Unable to release crypt context: %lu\n", GetLastError());
+            MineDebug_PrintError("In function MineRender_ResizeFrame: %i\n", (int) status);
+            break;
         }
-        hCrypto = NULL;
-    }
-
-    return;
-}
 
-/**
-    Mine_DoRectOverlap
-*//**
-    Determine if two rectangles have any overlap. Mainly used to see
-    if an invalid rectangle includes parts of a region of the window.
+        /** Damaged rectangles never overlap, so each pixel is drawn at most once. */
+        numRects = MineDamage_Take(rects);
 
-    @param[in] pRect1 - Pointer to a RECT.
-    @param[in] pRect2 - Pointer to a RECT.
+        for (ix = 0; ix < numRects; ix++)
+        {
+            status = MineRender_DrawFrame(&(rects[ix]));
+            if (MINE_ERROR_SUCCESS != status)
+            {
+                MineDebug_PrintError("In function MineRender_DrawFrame: %i\n", (int) status);
+                break;
+            }
 
-    @return TRUE if rectangles overlap. FALSE otherwise.
-*/
-BOOLEAN 
-Mine_DoRectOverlap(_In_ PRECT pRect1, _In_ PRECT pRect2)
-{
-    BOOLEAN returnValue = FALSE;
-    RECT    temp = {0}; //Windows API requires temp RECT to hold actual intersection
+            if (0 == InvalidateRect(hwnd, &(rects[ix]), FALSE))
+            {
+                MineDebug_PrintWarning("Unable to invalidate rectangle\n");
+            }
+        }
 
-    if ((NULL == pRect1) || (NULL == pRect2))
-    {
-        MineDebug_PrintWarning("Input parameter to Mine_DoRectOverlap is NULL\n");
-    }
-    else
-    {
-        returnValue = (IntersectRect(&temp, pRect1, pRect2) ? (BOOLEAN) TRUE : (BOOLEAN) FALSE);
-    }
+        __assume(FALSE == bFalse);
+    } while (bFalse);
 
-    return returnValue;
+    return status;
 }
 
 /**
@@ -585,6 +407,7 @@ Mine_GameWon(VOID)
 {
     BOOLEAN    bFalse = FALSE;
     INT_PTR    dialogReturn = 0;
+    MINE_ERROR status = MINE_ERROR_SUCCESS;
 
     do
     {
@@ -594,9 +417,13 @@ Mine_GameWon(VOID)
         gameData.numFlagged = gameData.mines;
         gameData.gameOver = TRUE;
         gameData.gameWon = TRUE;
-        if (0 == InvalidateRect(hwnd, NULL, FALSE))
+        MineDamage_AddAll();
+
+        //The dialogs below run their own message loops, so the frame has to be scheduled now
+        status = Mine_ScheduleFrame(hwnd);
+        if (MINE_ERROR_SUCCESS != status)
         {
-            MineDebug_PrintWarning("Unable to invalidate rectangle\n");
+            MineDebug_PrintWarning("In function Mine_ScheduleFrame: %i\n", (int) status);
         }
 
         /** Check if the time is a new record for standard board sizes. */
@@ -633,6 +460,31 @@ Mine_GameWon(VOID)
     return;
 }
 
+/**
+    Mine_GetStartupTime
+*//**
+    Read the time since the process was created.
+
+    @return Time in microseconds.
+*/
+ULONGLONG
+Mine_GetStartupTime(VOID)
+{
+    LARGE_INTEGER now = {0};
+    ULONGLONG     time = 0;
+
+    if ((0 != startupTimes.frequency.QuadPart) && (0 != QueryPerformanceCounter(&now)))
+    {
+        now.QuadPart -= startupTimes.mainCounter.QuadPart;
+        time = startupTimes.mainTime +
+               (ULONGLONG) ((now.QuadPart/startupTimes.frequency.QuadPart)*1000000LL +
+                            ((now.QuadPart%startupTimes.frequency.QuadPart)*1000000LL)/
+                            startupTimes.frequency.QuadPart);
+    }
+
+    return time;
+}
+
 /**
     Mine_InitInstance
 *//**
@@ -694,750 +546,62 @@ Mine_InitInstance(int nCmdShow)
    return status;
 }
 
-/**
-    Mine_IsRectSubset
-*//**
-    Check if a rectangle is a subset of the boundary rectangle.
-
-    @param[in] pBoundary - Boundary rectangle.
-    @param[in] pRect     - Rectangle to check.
-
-    @return TRUE if rectangle is a subset. FALSE otherwise.
-*/
-BOOLEAN 
-Mine_IsRectSubset(_In_ PRECT pBoundary, _In_ PRECT pRect)
-{
-    BOOLEAN returnValue = FALSE;
-
-    if ((NULL == pBoundary) || (NULL == pRect))
-    {
-        MineDebug_PrintWarning("Input parameter to Mine_IsRectSubset is NULL\n");
-    }
-    else
-    {
-        returnValue = (((pBoundary->left <= pRect->left) && (pBoundary->top <= pRect->top) &&
-                        (pBoundary->bottom >= pRect->bottom) && (pBoundary->right >= pRect->right)) ? 
-                         (BOOLEAN) TRUE : (BOOLEAN) FALSE);
-    }
-
-    return returnValue;
-}
-
-/**
-    Mine_NewRandomBoard
-*//**
-    Assign the correct number of mines randomly to a new game board.
-
-    @return Mine error code (MINE_ERROR_SUCCESS on success).
-*/
-MINE_ERROR 
-Mine_NewRandomBoard(VOID)
-{
-    BOOLEAN    bFalse = FALSE;
-    INT        ix = 0;
-    DWORD      minesRemaining = gameData.mines;
-    UINT       rand = 0;
-    MINE_ERROR status = MINE_ERROR_SUCCESS;
-    DWORD      tilesRemaining = gameData.height * gameData.width;
-
-    do
-    {
-        /** For each tile, assign a mine with probability (num mines left)/(num tiles left).
-            This will produce a uniform distribution over all possible boards. */
-        for(ix = 0; (minesRemaining > 0) && (tilesRemaining > 0); ix++)
-        {
-            status = Mine_Random(tilesRemaining, &rand);
-            if (MINE_ERROR_SUCCESS != status)
-            {
-                MineDebug_PrintError("In function Mine_Random: %i\n", (int) status);
-                break;
-            }
-
-            if (rand < minesRemaining)
-            {
-                gameData.gameBoard[ix] = MINE_BOMB_VALUE;
-                minesRemaining--;
-            }
-
-            tilesRemaining--;
-        }
-        if (MINE_ERROR_SUCCESS != status)
-        {
-            break;
-        }
-
-        //All mines should be assigned. Tiles left starts greater than mines left. If mines left ever 
-        //equals tiles left then each remaining tile would be assigned a mine with probability one.
-
-        __assume(FALSE == bFalse);
-    } while (bFalse);
-
-    return status;
-}
-
 /**
     Mine_PaintScreen
 *//**
     Draw everything in the main window.
 
-    @param[in] hwnd - Handle to the main window.
-
-    @return Mine error code (MINE_ERROR_SUCCESS on success).
-*/
-MINE_ERROR 
-Mine_PaintScreen(_In_ HWND hwnd)
-{
-    BOOLEAN     bFalse = FALSE;
-    HPEN        greyPen = NULL;
-    HDC         hDC = NULL;
-    INT         index = 0;
-    INT         ix = 0;
-    INT         jx = 0;
-    HDC         memoryDC = NULL;
-    DWORD       minesLeft = 0;
-    HGDIOBJ     prevObject = NULL;
-    PAINTSTRUCT ps = {0};
-    MINE_ERROR  status = MINE_ERROR_SUCCESS;
-    HPEN        whitePen = NULL;
-
-    do
-    {
-        if(NULL == hwnd)
-        {
-            MineDebug_PrintError("Parameter hwnd is NULL\n");
-            status = MINE_ERROR_PARAMETER;
-            break;
-        }
-
-        hDC = BeginPaint(hwnd, &ps);
-        if (NULL == hDC)
-        {
-            MineDebug_PrintError("Starting paint\n");
-            status = MINE_ERROR_PAINT;
-            break;
-        }
-
-        /** If the invalid region is not restricted to either the game board
-            or the top banner, draw the decorative lines. */
-        if(!Mine_IsRectSubset(&windowData.topBannerRegion, &ps.rcPaint) &&
-           !Mine_IsRectSubset(&windowData.boardRegion, &ps.rcPaint))
-        {
-            whitePen = CreatePen(PS_SOLID, 0, RGB(255,255,255));
-            if (NULL == whitePen)
-            {
-                MineDebug_PrintError("Getting white pen\n");
-                status = MINE_ERROR_OBJECT;
-                break;
-            }
-
-            prevObject = SelectObject(hDC, (HGDIOBJ) whitePen);
-            if (NULL == prevObject)
-            {
-                MineDebug_PrintError("Selecting white pen\n");
-                status = MINE_ERROR_OBJECT;
-                break;
-            }
-
-            //Draw each of the white lines
-            for (ix = 0; ix < MINE_NUM_WHITE_LINES; ix++)
-            {
-                if (0 == MoveToEx(hDC, (int) windowData.whiteLines[ix].left, 
-                                  (int) windowData.whiteLines[ix].top, NULL))
-                {
-                    MineDebug_PrintError("Moving to new point x: %ld y: %ld\n", 
-                                         windowData.whiteLines[ix].left, 
-                                         windowData.whiteLines[ix].top);
-                    status = MINE_ERROR_PAINT;
-                    break;
-                }
-
-                if (0 == LineTo(hDC, (int) windowData.whiteLines[ix].right,
-                                (int) windowData.whiteLines[ix].bottom))
-                {
-                    MineDebug_PrintError("Drawing line to point x: %ld y: %ld\n",
-                                         windowData.whiteLines[ix].right, 
-                                         windowData.whiteLines[ix].bottom);
-                    status = MINE_ERROR_PAINT;
-                    break;
-                }
-            }
-            if (MINE_ERROR_SUCCESS != status)
-            {
-                break;
-            }
-
-            greyPen = CreatePen(PS_SOLID, 0, RGB(128,128,128));
-            if (NULL == greyPen)
-            {
-                MineDebug_PrintError("Getting grey pen\n");
-                status = MINE_ERROR_OBJECT;
-                break;
-            }
-
-            if (NULL == SelectObject(hDC, (HGDIOBJ) greyPen))
-            {
-                MineDebug_PrintError("Selecting grey pen\n");
-                status = MINE_ERROR_OBJECT;
-                break;
-            }
-
-            //Draw each of the grey lines
-            for (ix = 0; ix < MINE_NUM_GREY_LINES; ix++)
-            {
-                if (0 == MoveToEx(hDC, (int) windowData.greyLines[ix].left, 
-                                  (int) windowData.greyLines[ix].top, NULL))
-                {
-                    MineDebug_PrintError("Moving to new point x: %ld y: %ld\n", 
-                                         windowData.greyLines[ix].left,
-                                         windowData.greyLines[ix].top);
-                    status = MINE_ERROR_PAINT;
-                    break;
-                }
-
-                if (0 == LineTo(hDC, (int) windowData.greyLines[ix].right,
-                                (int) windowData.greyLines[ix].bottom))
-                {
-                    MineDebug_PrintError("Drawing line to point x: %ld y: %ld\n",
-                                         windowData.greyLines[ix].right,
-                                         windowData.greyLines[ix].bottom);
-                    status = MINE_ERROR_PAINT;
-                    break;
-                }
-            }
-            if (MINE_ERROR_SUCCESS != status)
-            {
-                break;
-            }
-
-            //Return previous pen to device context
-            if (NULL == SelectObject(hDC, prevObject))
-            {
-                MineDebug_PrintError("Selecting previous object\n");
-                status = MINE_ERROR_OBJECT;
-                break;
-            }
-        }
-
-        //Create memory device context to hold bitmap before tranfer to screen
-        memoryDC = CreateCompatibleDC(hDC);
-        if (NULL == memoryDC)
-        {
-            MineDebug_PrintError("Creating a compatible memory device context\n");
-            status = MINE_ERROR_DC;
-            break;
-        }
-
-        /** If invalid region overlaps timer, draw the timer. */
-        if (Mine_DoRectOverlap(&windowData.timerRegion, &ps.rcPaint))
-        {
-            //Timer has max value of 999, it will always be displayed with three digits
-            index = (((INT) gameData.time) / 100) % 10; //Hundreds digit
-            if (NULL == SelectObject(memoryDC, imageData.timer[index]))
-            {
-                MineDebug_PrintError("Selecting timer bitmap %i into memory DC\n", index);
-                status = MINE_ERROR_OBJECT;
-                break;
-            }
-
-            if (0 == BitBlt(hDC, windowData.timerRegion.left, windowData.timerRegion.top,
-                            MINE_TIMER_WIDTH, MINE_TIMER_HEIGHT, memoryDC, 0, 0, SRCCOPY))
-            {
-                MineDebug_PrintError("Copying timer bitmap %i to screen: %lu\n", index, GetLastError());
-                status = MINE_ERROR_PAINT;
-                break;
-            }
-
-            index = (((INT) gameData.time) / 10) % 10; //Tens digit
-            if (NULL == SelectObject(memoryDC, imageData.timer[index]))
-            {
-                MineDebug_PrintError("Selecting timer bitmap %i into memory DC\n", index);
-                status = MINE_ERROR_OBJECT;
-                break;
-            }
-
-            if (0 == BitBlt(hDC, windowData.timerRegion.left+MINE_TIMER_WIDTH, windowData.timerRegion.top,
-                            MINE_TIMER_WIDTH, MINE_TIMER_HEIGHT, memoryDC, 0, 0, SRCCOPY))
-            {
-                MineDebug_PrintError("Copying timer bitmap %i to screen: %lu\n", index, GetLastError());
-                status = MINE_ERROR_PAINT;
-                break;
-            }
-
-            index = ((INT) gameData.time) % 10; //Units digit
-            if (NULL == SelectObject(memoryDC, imageData.timer[index]))
-            {
-                MineDebug_PrintError("Selecting timer bitmap %i into memory DC\n", index);
-                status = MINE_ERROR_OBJECT;
-                break;
-            }
-
-            if (0 == BitBlt(hDC, windowData.timerRegion.left+(2*MINE_TIMER_WIDTH), windowData.timerRegion.top,
-                            MINE_TIMER_WIDTH, MINE_TIMER_HEIGHT, memoryDC, 0, 0, SRCCOPY))
-            {
-                MineDebug_PrintError("Copying timer bitmap %i to screen: %lu\n", index, GetLastError());
-                status = MINE_ERROR_PAINT;
-                break;
-            }
-        }
-
-        /** If invalid region overlaps the mine counter region, draw the mine counter. */ 
-        if (Mine_DoRectOverlap(&windowData.mineCountRegion, &ps.rcPaint))
-        {
-            /** Use a negative sign if more tiles flagged than there are mines. */
-            //Max number of mines in max size custom board is restricted to four digits
-            //Counter will wrap around to -000 if it reaches -1000 (consistent with Windows)
-            if (gameData.numFlagged > gameData.mines)
-            {
-                minesLeft = gameData.numFlagged - gameData.mines;
-
-                if (NULL == SelectObject(memoryDC, imageData.timerDash))
-                {
-                    MineDebug_PrintError("Selecting timer bitmap dash into memory DC\n");
-                    status = MINE_ERROR_OBJECT;
-                    break;
-                }
-
-                if (0 == BitBlt(hDC, windowData.mineCountRegion.left,
-                                windowData.mineCountRegion.top, MINE_TIMER_WIDTH, 
-                                MINE_TIMER_HEIGHT, memoryDC, 0, 0, SRCCOPY))
-                {
-                    MineDebug_PrintError("Copying timer bitmap dash to screen: %lu\n", GetLastError());
-                    status = MINE_ERROR_PAINT;
-                    break;
-                }
-            }
-            else 
-            {
-                minesLeft = gameData.mines - gameData.numFlagged;
-                index = (((INT) minesLeft) / 1000) % 10; //Thousands digit
-
-                if (NULL == SelectObject(memoryDC, imageData.timer[index]))
-                {
-                    MineDebug_PrintError("Selecting timer bitmap %i into memory DC\n", index);
-                    status = MINE_ERROR_OBJECT;
-                    break;
-                }
-
-                if (0 == BitBlt(hDC, windowData.mineCountRegion.left,
-                                windowData.mineCountRegion.top, MINE_TIMER_WIDTH, 
-                                MINE_TIMER_HEIGHT, memoryDC, 0, 0, SRCCOPY))
-                {
-                    MineDebug_PrintError("Copying timer bitmap %i to screen: %lu\n", index, GetLastError());
-                    status = MINE_ERROR_PAINT;
-                    break;
-                }
-            }
-
-            index = (((INT) minesLeft) / 100) % 10; //Hundreds digit
-
-            if (NULL == SelectObject(memoryDC, imageData.timer[index]))
-            {
-                MineDebug_PrintError("Selecting timer bitmap %i into memory DC\n", index);
-                status = MINE_ERROR_OBJECT;
-                break;
-            }
-
-            if (0 == BitBlt(hDC, windowData.mineCountRegion.left + MINE_TIMER_WIDTH,
-                            windowData.mineCountRegion.top, MINE_TIMER_WIDTH, 
-                            MINE_TIMER_HEIGHT, memoryDC, 0, 0, SRCCOPY))
-            {
-                MineDebug_PrintError("Copying timer bitmap %i to screen: %lu\n", index, GetLastError());
-                status = MINE_ERROR_PAINT;
-                break;
-            }
-
-            index = (((INT) minesLeft) / 10) % 10; //Tens digit
-
-            if (NULL == SelectObject(memoryDC, imageData.timer[index]))
-            {
-                MineDebug_PrintError("Selecting timer bitmap %i into memory DC\n", index);
-                status = MINE_ERROR_OBJECT;
-                break;
-            }
+    @param[in] hwnd - Handle to the main window.
 
-            if (0 == BitBlt(hDC, windowData.mineCountRegion.left + 2*MINE_TIMER_WIDTH,
-                            windowData.mineCountRegion.top, MINE_TIMER_WIDTH, 
-                            MINE_TIMER_HEIGHT, memoryDC, 0, 0, SRCCOPY))
-            {
-                MineDebug_PrintError("Copying timer bitmap %i to screen: %lu\n", index, GetLastError());
-                status = MINE_ERROR_PAINT;
-                break;
-            }
+    @return Mine error code (MINE_ERROR_SUCCESS on success).
+*/
+MINE_ERROR 
+Mine_PaintScreen(_In_ HWND hwnd)
+{
+    BOOLEAN     bFalse = FALSE;
+    HDC         hDC = NULL;
+    PAINTSTRUCT ps = {0};
+    MINE_ERROR  status = MINE_ERROR_SUCCESS;
 
-            index = ((INT) minesLeft) % 10; //Units digit
+    do
+    {
+        if(NULL == hwnd)
+        {
+            MineDebug_PrintError("Parameter hwnd is NULL\n");
+            status = MINE_ERROR_PARAMETER;
+            break;
+        }
 
-            if (NULL == SelectObject(memoryDC, imageData.timer[index]))
-            {
-                MineDebug_PrintError("Selecting timer bitmap %i into memory DC\n", index);
-                status = MINE_ERROR_OBJECT;
-                break;
-            }
+        /** Bring the frame up to date if the window is painted before the frame
+            timer fires. Everything else in the frame is already current, so
+            uncovered parts of the window are just copied. */
+        status = Mine_FlushDamage();
+        if (MINE_ERROR_SUCCESS != status)
+        {
+            MineDebug_PrintError("In function Mine_FlushDamage: %i\n", (int) status);
+            break;
+        }
 
-            if (0 == BitBlt(hDC, windowData.mineCountRegion.left + 3*MINE_TIMER_WIDTH,
-                            windowData.mineCountRegion.top, MINE_TIMER_WIDTH, 
-                            MINE_TIMER_HEIGHT, memoryDC, 0, 0, SRCCOPY))
-            {
-                MineDebug_PrintError("Copying timer bitmap %i to screen: %lu\n", index, GetLastError);
-                status = MINE_ERROR_PAINT;
-                break;
-            }
+        hDC = BeginPaint(hwnd, &ps);
+        if (NULL == hDC)
+        {
+            MineDebug_PrintError("Starting paint\n");
+            status = MINE_ERROR_PAINT;
+            break;
         }
 
-        /** If invalid regions overlaps face, draw the smiley face. */
-        if (Mine_DoRectOverlap(&windowData.faceRegion, &ps.rcPaint))
+        //Copy the frame to the window in one call, clipped to the invalid region
+        status = MineRender_Present(hDC);
+        if (MINE_ERROR_SUCCESS != status)
         {
-            if (gameData.gameOver)
-            {
-                if (gameData.gameWon)
-                {
-                    if (NULL == SelectObject(memoryDC, imageData.faceWon))
-                    {
-                        MineDebug_PrintError("Selecting face won into memory DC\n");
-                        status = MINE_ERROR_OBJECT;
-                        break;
-                    }
-
-                    if (0 == BitBlt(hDC, windowData.faceRegion.left,
-                                    windowData.faceRegion.top, MINE_FACE_WIDTH, 
-                                    MINE_FACE_HEIGHT, memoryDC, 0, 0, SRCCOPY))
-                    {
-                        MineDebug_PrintError("Copying face won to screen: %lu\n", GetLastError());
-                        status = MINE_ERROR_PAINT;
-                        break;
-                    }
-                }
-                else
-                {
-                    if (NULL == SelectObject(memoryDC, imageData.faceLost))
-                    {
-                        MineDebug_PrintError("Selecting face lost into memory DC\n");
-                        status = MINE_ERROR_OBJECT;
-                        break;
-                    }
-
-                    if (0 == BitBlt(hDC, windowData.faceRegion.left,
-                                    windowData.faceRegion.top, MINE_FACE_WIDTH, 
-                                    MINE_FACE_HEIGHT, memoryDC, 0, 0, SRCCOPY))
-                    {
-                        MineDebug_PrintError("Copying face lost to screen: %lu\n", GetLastError());
-                        status = MINE_ERROR_PAINT;
-                        break;
-                    }
-                }
-            }
-            else
-            {
-                if (gameData.leftDown) {
-                    if (NULL == SelectObject(memoryDC, imageData.faceClicked))
-                    {
-                        MineDebug_PrintError("Selecting face clicked into memory DC\n");
-                        status = MINE_ERROR_OBJECT;
-                        break;
-                    }
-
-                    if (0 == BitBlt(hDC, windowData.faceRegion.left,
-                                    windowData.faceRegion.top, MINE_FACE_WIDTH, 
-                                    MINE_FACE_HEIGHT, memoryDC, 0, 0, SRCCOPY))
-                    {
-                        MineDebug_PrintError("Copying face clicked to screen: %lu\n", GetLastError());
-                        status = MINE_ERROR_PAINT;
-                        break;
-                    }
-                }
-                else {
-                    if (NULL == SelectObject(memoryDC, imageData.faceNormal))
-                    {
-                        MineDebug_PrintError("Selecting face normal into memory DC\n");
-                        status = MINE_ERROR_OBJECT;
-                        break;
-                    }
-
-                    if (0 == BitBlt(hDC, windowData.faceRegion.left,
-                                    windowData.faceRegion.top, MINE_FACE_WIDTH, 
-                                    MINE_FACE_HEIGHT, memoryDC, 0, 0, SRCCOPY))
-                    {
-                        MineDebug_PrintError("Copying face normal to screen: %lu\n", GetLastError());
-                        status = MINE_ERROR_PAINT;
-                        break;
-                    }
-                }
-            }
+            MineDebug_PrintError("In function MineRender_Present: %i\n", (int) status);
+            break;
         }
 
-        /** If the invalid region overlaps the board, draw the overlapped tiles. */
-        if (Mine_DoRectOverlap(&windowData.boardRegion, &ps.rcPaint))
+        if (0 == startupTimes.firstFrameTime)
         {
-            for (ix = max(0, (ps.rcPaint.left-windowData.boardRegion.left)/MINE_TILE_PIXELS); 
-                 ix <= min((ps.rcPaint.right-windowData.boardRegion.left)/MINE_TILE_PIXELS,
-                           (int) gameData.width-1); 
-                 ix++)
-            {
-                for (jx = max(0, (ps.rcPaint.top-windowData.boardRegion.top)/MINE_TILE_PIXELS);
-                     jx <= min((ps.rcPaint.bottom-windowData.boardRegion.top)/MINE_TILE_PIXELS,
-                               (int) gameData.height-1);
-                     jx++)
-                {
-                    if (gameData.gameOver)
-                    {
-                        if (gameData.gameWon) //---------- Game won ----------
-                        {
-                            index = gameData.gameBoard[MINE_INDEX(ix, jx)];
-
-                            //If game won, all mines are shown as flags
-                            if (MINE_BOMB_VALUE == index)
-                            {
-                                if (NULL == SelectObject(memoryDC, imageData.flag))
-                                {
-                                    MineDebug_PrintError("Selecting flag into memory DC\n");
-                                    status = MINE_ERROR_OBJECT;
-                                    break;
-                                }
-
-                                if (0 == BitBlt(hDC, windowData.boardRegion.left+ix*MINE_TILE_PIXELS,
-                                                windowData.boardRegion.top+jx*MINE_TILE_PIXELS, MINE_TILE_PIXELS,
-                                                MINE_TILE_PIXELS, memoryDC, 0, 0, SRCCOPY))
-                                {
-                                    MineDebug_PrintError("Copying flag to screen: %lu\n", GetLastError());
-                                    status = MINE_ERROR_PAINT;
-                                    break;
-                                }
-                            }
-                            else
-                            {
-                                //If game is won, all non-mines must have been uncovered
-                                if (NULL == SelectObject(memoryDC, imageData.numbers[index]))
-                                {
-                                    MineDebug_PrintError("Selecting numbers %i into memory DC\n", index);
-                                    status = MINE_ERROR_OBJECT;
-                                    break;
-                                }
-
-                                if (0 == BitBlt(hDC, windowData.boardRegion.left+ix*MINE_TILE_PIXELS,
-                                                windowData.boardRegion.top+jx*MINE_TILE_PIXELS, MINE_TILE_PIXELS,
-                                                MINE_TILE_PIXELS, memoryDC, 0, 0, SRCCOPY))
-                                {
-                                    MineDebug_PrintError("Copying numbers %i to screen: %lu\n", 
-                                                         index, GetLastError());
-                                    status = MINE_ERROR_PAINT;
-                                    break;
-                                }
-                            }
-                        }
-                        else //---------- Game lost ----------
-                        {
-                            if (MINE_TILE_STATUS_REVEALED == gameData.tileStatus[MINE_INDEX(ix, jx)])
-                            {
-                                index = gameData.gameBoard[MINE_INDEX(ix, jx)];
-
-                                //A mine marked as revealed is shown as being hit
-                                if (MINE_BOMB_VALUE == index)
-                                {
-                                    if (NULL == SelectObject(memoryDC, imageData.mineHit))
-                                    {
-                                        MineDebug_PrintError("Selecting mine hit into memory DC\n");
-                                        status = MINE_ERROR_OBJECT;
-                                        break;
-                                    }
-
-                                    if (0 == BitBlt(hDC, windowData.boardRegion.left+ix*MINE_TILE_PIXELS,
-                                                    windowData.boardRegion.top+jx*MINE_TILE_PIXELS, 
-                                                    MINE_TILE_PIXELS, MINE_TILE_PIXELS, memoryDC, 0, 0, SRCCOPY))
-                                    {
-                                        MineDebug_PrintError("Copying mine hit to screen: %lu\n", GetLastError());
-                                        status = MINE_ERROR_PAINT;
-                                        break;
-                                    }
-                                }
-                                else
-                                {
-
-                                    if (NULL == SelectObject(memoryDC, imageData.numbers[index]))
-                                    {
-                                        MineDebug_PrintError("Selecting numbers %i into memory DC\n", index);
-                                        status = MINE_ERROR_OBJECT;
-                                        break;
-                                    }
-
-                                    if (0 == BitBlt(hDC, windowData.boardRegion.left+ix*MINE_TILE_PIXELS,
-                                                    windowData.boardRegion.top+jx*MINE_TILE_PIXELS,
-                                                    MINE_TILE_PIXELS, MINE_TILE_PIXELS, memoryDC, 0, 0, SRCCOPY))
-                                    {
-                                        MineDebug_PrintError("Copying numbers %i to screen: %lu\n", 
-                                                             index, GetLastError());
-                                        status = MINE_ERROR_PAINT;
-                                        break;
-                                    }
-                                }
-                            }
-                            else if (MINE_TILE_STATUS_FLAG == gameData.tileStatus[MINE_INDEX(ix, jx)])
-                            {
-                                if (MINE_BOMB_VALUE == gameData.gameBoard[MINE_INDEX(ix, jx)])
-                                {
-                                    if (NULL == SelectObject(memoryDC, imageData.flag))
-                                    {
-                                        MineDebug_PrintError("Selecting flag into memory DC\n");
-                                        status = MINE_ERROR_OBJECT;
-                                        break;
-                                    }
-
-                                    if (0 == BitBlt(hDC, windowData.boardRegion.left+ix*MINE_TILE_PIXELS,
-                                                    windowData.boardRegion.top+jx*MINE_TILE_PIXELS, 
-                                                    MINE_TILE_PIXELS, MINE_TILE_PIXELS, memoryDC, 0, 0, SRCCOPY))
-                                    {
-                                        MineDebug_PrintError("Copying flag to screen: %lu\n", GetLastError());
-                                        status = MINE_ERROR_PAINT;
-                                        break;
-                                    }
-                                }
-                                else 
-                                {
-                                    //Display locations of incorrectly flagged tiles
-                                    if (NULL == SelectObject(memoryDC, imageData.falseFlag))
-                                    {
-                                        MineDebug_PrintError("Selecting false flag into memory DC\n");
-                                        status = MINE_ERROR_OBJECT;
-                                        break;
-                                    }
-
-                                    if (0 == BitBlt(hDC, windowData.boardRegion.left+ix*MINE_TILE_PIXELS,
-                                                    windowData.boardRegion.top+jx*MINE_TILE_PIXELS, 
-                                                    MINE_TILE_PIXELS, MINE_TILE_PIXELS, memoryDC, 0, 0, SRCCOPY))
-                                    {
-                                        MineDebug_PrintError("Copying false flag to screen: %lu\n", GetLastError());
-                                        status = MINE_ERROR_PAINT;
-                                        break;
-                                    }
-                                }
-                            }
-                            else
-                            {
-                                //If game lost, display the location of all hidden mines
-                                if (MINE_BOMB_VALUE == gameData.gameBoard[MINE_INDEX(ix, jx)])
-                                {
-                                    if (NULL == SelectObject(memoryDC, imageData.mine))
-                                    {
-                                        MineDebug_PrintError("Selecting mine into memory DC\n");
-                                        status = MINE_ERROR_OBJECT;
-                                        break;
-                                    }
-
-                                    if (0 == BitBlt(hDC, windowData.boardRegion.left+ix*MINE_TILE_PIXELS,
-                                                    windowData.boardRegion.top+jx*MINE_TILE_PIXELS, 
-                                                    MINE_TILE_PIXELS, MINE_TILE_PIXELS, memoryDC, 0, 0, SRCCOPY))
-                                    {
-                                        MineDebug_PrintError("Copying mine to screen: %lu\n", GetLastError());
-                                        status = MINE_ERROR_PAINT;
-                                        break;
-                                    }
-                                }
-                                else 
-                                {
-                                    if (NULL == SelectObject(memoryDC, imageData.unclicked))
-                                    {
-                                        MineDebug_PrintError("Selecting unclicked into memory DC\n");
-                                        status = MINE_ERROR_OBJECT;
-                                        break;
-                                    }
-
-                                    if (0 == BitBlt(hDC, windowData.boardRegion.left+ix*MINE_TILE_PIXELS,
-                                                    windowData.boardRegion.top+jx*MINE_TILE_PIXELS, 
-                                                    MINE_TILE_PIXELS, MINE_TILE_PIXELS, memoryDC, 0, 0, SRCCOPY))
-                                    {
-                                        MineDebug_PrintError("Copying unclicked to screen: %lu\n", GetLastError());
-                                        status = MINE_ERROR_PAINT;
-                                        break;
-                                    }
-                                }
-                            }                         
-                        }
-                    }
-                    else //---------- Game still in progress ----------
-                    {
-                        if (MINE_TILE_STATUS_REVEALED == gameData.tileStatus[MINE_INDEX(ix, jx)])
-                        {
-                            index = gameData.gameBoard[MINE_INDEX(ix, jx)];
-
-                            if (NULL == SelectObject(memoryDC, imageData.numbers[index]))
-                            {
-                                MineDebug_PrintError("Selecting numbers %i into memory DC\n", index);
-                                status = MINE_ERROR_OBJECT;
-                                break;
-                            }
-
-                            if (0 == BitBlt(hDC, windowData.boardRegion.left+ix*MINE_TILE_PIXELS,
-                                            windowData.boardRegion.top+jx*MINE_TILE_PIXELS, MINE_TILE_PIXELS, 
-                                            MINE_TILE_PIXELS, memoryDC, 0, 0, SRCCOPY))
-                            {
-                                MineDebug_PrintError("Copying numbers %i to screen: %lu\n", index, GetLastError());
-                                status = MINE_ERROR_PAINT;
-                                break;
-                            }
-                        }
-                        else if (MINE_TILE_STATUS_FLAG == gameData.tileStatus[MINE_INDEX(ix, jx)])
-                        {
-                            if (NULL == SelectObject(memoryDC, imageData.flag))
-                            {
-                                MineDebug_PrintError("Selecting flag into memory DC\n");
-                                status = MINE_ERROR_OBJECT;
-                                break;
-                            }
-
-                            if (0 == BitBlt(hDC, windowData.boardRegion.left+ix*MINE_TILE_PIXELS,
-                                            windowData.boardRegion.top+jx*MINE_TILE_PIXELS, MINE_TILE_PIXELS,
-                                            MINE_TILE_PIXELS, memoryDC, 0, 0, SRCCOPY))
-                            {
-                                MineDebug_PrintError("Copying flag to screen: %lu\n", GetLastError());
-                                status = MINE_ERROR_PAINT;
-                                break;
-                            }
-                        }
-                        else if (MINE_TILE_STATUS_HELD == gameData.tileStatus[MINE_INDEX(ix, jx)])
-                        {
-                            if (NULL == SelectObject(memoryDC, imageData.held))
-                            {
-                                MineDebug_PrintError("Selecting held into memory DC\n");
-                                status = MINE_ERROR_OBJECT;
-                                break;
-                            }
-
-                            if (0 == BitBlt(hDC, windowData.boardRegion.left+ix*MINE_TILE_PIXELS,
-                                            windowData.boardRegion.top+jx*MINE_TILE_PIXELS, MINE_TILE_PIXELS, 
-                                            MINE_TILE_PIXELS, memoryDC, 0, 0, SRCCOPY))
-                            {
-                                MineDebug_PrintError("Copying held to screen: %lu\n", GetLastError());
-                                status = MINE_ERROR_PAINT;
-                                break;
-                            }
-                        }
-                        else
-                        {
-                            if (NULL == SelectObject(memoryDC, imageData.unclicked))
-                            {
-                                MineDebug_PrintError("Selecting unclicked into memory DC\n");
-                                status = MINE_ERROR_OBJECT;
-                                break;
-                            }
-
-                            if (0 == BitBlt(hDC, windowData.boardRegion.left+ix*MINE_TILE_PIXELS,
-                                            windowData.boardRegion.top+jx*MINE_TILE_PIXELS, MINE_TILE_PIXELS, 
-                                            MINE_TILE_PIXELS, memoryDC, 0, 0, SRCCOPY))
-                            {
-                                MineDebug_PrintError("Copying unclicked to screen: %lu\n", GetLastError());
-                                status = MINE_ERROR_PAINT;
-                                break;
-                            }
-                        }
-                    }
-                }
-                if (MINE_ERROR_SUCCESS != status)
-                {
-                    break;
-                }
-            }
-            if (MINE_ERROR_SUCCESS != status)
-            {
-                break;
-            }
+            startupTimes.firstFrameTime = Mine_GetStartupTime();
+            Mine_ReportStartup();
         }
 
         __assume(FALSE == bFalse);
@@ -1445,77 +609,52 @@ Mine_PaintScreen(_In_ HWND hwnd)
 
     //Clean up
 
-    if (NULL != memoryDC)
-    {
-        if (0 == DeleteDC(memoryDC))
-        {
-            MineDebug_PrintWarning("Unable to delete memory device context\n");
-        }
-        memoryDC = NULL;
-    }
-
     if (NULL != hDC)
     {
         (void) EndPaint(hwnd, &ps);
         hDC = NULL;
     }
 
-    if (NULL != whitePen)
-    {
-        if (0 == DeleteObject((HGDIOBJ) whitePen))
-        {
-            MineDebug_PrintWarning("Unable to delete white pen\n");
-        }
-        whitePen = NULL;
-    }
-
-    if (NULL != greyPen)
-    {
-        if (0 == DeleteObject((HGDIOBJ) greyPen))
-        {
-            MineDebug_PrintWarning("Unable to delete grey pen\n");
-        }
-        greyPen = NULL;
-    }
-
     return status;
 }
 
 /**
-    Mine_PointInRect
+    Mine_ProcessScroll
 *//**
-    Checks if a point is inside a given rectangle.
-
-    @param[in] x     - X coordinate of point.
-    @param[in] y     - Y coordinate of point.
-    @param[in] pRect - Pointer to boundary rectangle.
-
-    @return TRUE if point is in rectangle. FALSE otherwise.
+    Move the board one step closer to its scroll target and repaint it, stopping
+    the scroll timer once the target is reached.
 */
-BOOLEAN 
-Mine_PointInRect(short x, short y, _In_ PRECT pRect)
+VOID
+Mine_ProcessScroll(VOID)
 {
-    BOOLEAN returnValue = TRUE;
+    POINT cursor = {0};
 
-    if (NULL == pRect)
+    /** Once the board has reached its target, stop the timer. */
+    if ((!Mine_StepScroll()) && scrollTimerCreated)
     {
-        MineDebug_PrintWarning("Input parameter to Mine_PointInRect is NULL\n");
-        returnValue = FALSE;
-    }
-    else
-    {
-        if ((x < pRect->left) || (x >= pRect->right))
+        if (0 == KillTimer(hwnd, MINE_TIMER_SCROLL))
         {
-            returnValue = FALSE;
+            MineDebug_PrintWarning("Unable to kill scroll timer: %lu\n", GetLastError());
         }
+        scrollTimerCreated = FALSE;
+    }
 
-        if ((y < pRect->top) || (y >= pRect->bottom))
+    /** If a tile is held, move the hold to whichever tile has slid under the mouse. */
+    if ((-1 != gameData.prevGridX) && (-1 != gameData.prevGridY))
+    {
+        if ((0 != GetCursorPos(&cursor)) && (0 != ScreenToClient(hwnd, &cursor)))
         {
-            returnValue = FALSE;
+            (void) SendMessage(hwnd, WM_MOUSEMOVE, 0, MAKELPARAM(cursor.x, cursor.y));
         }
     }
 
-    return returnValue;
+    //Only the tiles that changed are redrawn, the rest of the board is copied from the ring
+    MineDamage_AddRect(&(windowData.boardRegion));
+
+    //Move the view outline on the minimap along with the view
+    MineDamage_AddRect(&(windowData.minimapRegion));
+
+    return;
 }
 
 /**
@@ -1543,10 +682,7 @@ Mine_ProcessTimer(VOID)
     if (gameData.time != ((UINT) currentTime))
     {
         gameData.time = ((UINT) currentTime);
-        if (0 == InvalidateRect(hwnd, &(windowData.timerRegion), FALSE))
-        {
-            MineDebug_PrintWarning("Unable to invalidate rectangle\n");
-        }
+        MineDamage_AddRect(&(windowData.timerRegion));
     }
 
     return;
@@ -1775,65 +911,49 @@ Mine_Random(UINT limit, _Out_ PUINT output)
 }
 
 /**
-    Mine_RandomPerm
+    Mine_RecordProcessStart
 *//**
-    Create a random ordered set of numPerm elements from a collection of numArray elements.
-
-    @param[inout] pArray   - Pointer to the array of elements.
-    @param[in]    numArray - Number of elements in the array.
-    @param[in]    numPerm  - Size of ordered set to create.
-
-    @return Mine error code (MINE_ERROR_SUCCESS upon success).
+    Start the clock read by Mine_GetStartupTime, counting the time the process
+    spent loading before wWinMain was entered.
 */
-MINE_ERROR
-Mine_RandomPerm(_Inout_updates_to_(numArray, numPerm) PUINT pArray, 
-                UINT numArray, UINT numPerm)
+VOID
+Mine_RecordProcessStart(VOID)
 {
-    BOOLEAN    bFalse = FALSE;
-    UINT       ix = 0;
-    UINT       limit = 0;
-    UINT       rand = 0;
-    MINE_ERROR status = MINE_ERROR_SUCCESS;
-    UINT       temp = 0;
-
-    do
+    FILETIME       createTime = {0};
+    FILETIME       exitTime = {0};
+    FILETIME       kernelTime = {0};
+    ULARGE_INTEGER now = {0};
+    FILETIME       nowTime = {0};
+    ULARGE_INTEGER start = {0};
+    FILETIME       userTime = {0};
+
+    if ((0 == QueryPerformanceFrequency(&startupTimes.frequency)) ||
+        (0 == QueryPerformanceCounter(&startupTimes.mainCounter)))
     {
-        if (NULL == pArray)
-        {
-            MineDebug_PrintError("Parameter pArray is NULL\n");
-            status = MINE_ERROR_PARAMETER;
-            break;
-        }
+        MineDebug_PrintWarning("Unable to read performance counter: %lu\n", GetLastError());
+        startupTimes.frequency.QuadPart = 0;
+    }
 
-        if (numPerm > numArray)
-        {
-            MineDebug_PrintError("Parameter numPerm must be less than or equal to numArray\n");
-            status = MINE_ERROR_PARAMETER;
-            break;
-        }
+    //File times count 100 nanosecond intervals
+    GetSystemTimeAsFileTime(&nowTime);
+    if (0 == GetProcessTimes(GetCurrentProcess(), &createTime, &exitTime, &kernelTime, &userTime))
+    {
+        MineDebug_PrintWarning("Unable to get process creation time: %lu\n", GetLastError());
+    }
+    else
+    {
+        now.LowPart = nowTime.dwLowDateTime;
+        now.HighPart = nowTime.dwHighDateTime;
+        start.LowPart = createTime.dwLowDateTime;
+        start.HighPart = createTime.dwHighDateTime;
 
-        /** Implement the Knuth shuffle to generate a random permutation. 
-            Stop after numPerm elements have been fixed. */
-        for (ix = 0; ix < numPerm; ix++)
+        if (now.QuadPart > start.QuadPart)
         {
-            limit = numArray - ix;
-
-            status = Mine_Random(limit, &rand);
-            if (MINE_ERROR_SUCCESS != status)
-            {
-                MineDebug_PrintError("In function Mine_Random: %i\n", (int) status);
-                break;
-            }
-
-            temp = pArray[numArray - 1 - rand];
-            pArray[numArray - 1 - rand] = pArray[ix];
-            pArray[ix] = temp;
+            startupTimes.mainTime = (now.QuadPart - start.QuadPart)/10;
         }
+    }
 
-        __assume(FALSE == bFalse);
-    } while (bFalse);
-
-    return status;
+    return;
 }
 
 /**
@@ -1923,6 +1043,63 @@ Mine_RegisterClass(VOID)
     return status;
 }
 
+/**
+    Mine_ReportStartup
+*//**
+    Log how long each step of starting the program took, warning if the first
+    frame was shown later than MINE_STARTUP_BUDGET.
+*/
+VOID
+Mine_ReportStartup(VOID)
+{
+    MineDebug_PrintInfo("Startup (us since process creation): main %llu, settings %llu, window %llu, "
+                        "first frame %llu\n", startupTimes.mainTime, startupTimes.settingsTime,
+                        startupTimes.windowTime, startupTimes.firstFrameTime);
+
+    if (MINE_STARTUP_BUDGET < startupTimes.firstFrameTime)
+    {
+        MineDebug_PrintWarning("First frame shown after %llu us, over the %u us budget\n",
+                               startupTimes.firstFrameTime, (UINT) MINE_STARTUP_BUDGET);
+    }
+
+    return;
+}
+
+/**
+    Mine_ScheduleFrame
+*//**
+    Start the frame timer if anything has been damaged and no frame is already
+    waiting to be drawn. Nothing is scheduled before the window exists, its
+    first WM_PAINT draws everything.
+
+    @param[in] hWnd - Handle to the main window, NULL while it is being created.
+
+    @return Mine error code (MINE_ERROR_SUCCESS on success).
+*/
+MINE_ERROR
+Mine_ScheduleFrame(_In_opt_ HWND hWnd)
+{
+    MINE_ERROR status = MINE_ERROR_SUCCESS;
+
+    /** Everything damaged before the timer fires is drawn together in one frame. */
+    if ((NULL != hWnd) && (0 != damageData.numRects) && (!frameTimerCreated))
+    {
+        if (0 == SetTimer(hWnd, MINE_TIMER_FRAME, MINE_FRAME_TIME, NULL))
+        {
+            MineDebug_PrintWarning("Creating frame timer: %lu\n", GetLastError());
+
+            //Without a timer, draw the frame straight away
+            status = Mine_FlushDamage();
+        }
+        else
+        {
+            frameTimerCreated = TRUE;
+        }
+    }
+
+    return status;
+}
+
 /**
     Mine_SetRegDword
 *//**
@@ -2086,38 +1263,10 @@ MINE_ERROR
 Mine_SetupGame(VOID)
 {
     BOOLEAN    bFalse = FALSE;
-    HANDLE     hHeap = NULL;
     MINE_ERROR status = MINE_ERROR_SUCCESS;
 
     do
     {
-        hHeap = GetProcessHeap();
-        if (NULL == hHeap)
-        {
-            MineDebug_PrintError("Getting process heap: %lu\n", GetLastError());
-            status = MINE_ERROR_HEAP;
-            break;
-        }
-
-        //Free memory for previous game board
-        if (NULL != gameData.gameBoard)
-        {
-            if (0 == HeapFree(hHeap, 0, gameData.gameBoard))
-            {
-                MineDebug_PrintWarning("Unable to free game board: %lu\n", GetLastError());
-            }
-            gameData.gameBoard = NULL;
-        }
-
-        if (NULL != gameData.tileStatus)
-        {
-            if (0 == HeapFree(hHeap, 0, gameData.tileStatus))
-            {
-                MineDebug_PrintWarning("Unable to free tile status: %lu\n", GetLastError());
-            }
-            gameData.tileStatus = NULL;
-        }
-
         gameData.gameStarted = FALSE;
         gameData.gameOver = FALSE;
         gameData.gameWon = FALSE;
@@ -2153,21 +1302,26 @@ Mine_SetupGame(VOID)
         gameData.numFlagged = 0;
         gameData.numUncovered = 0;
 
-        gameData.gameBoard = (CHAR *) HeapAlloc(hHeap, HEAP_ZERO_MEMORY,
-                                                gameData.height * gameData.width * sizeof(CHAR));
-        if (NULL == gameData.gameBoard)
+        /** Board arrays come from the arena, which only goes to the heap for a bigger board. */
+        status = Mine_AllocBoard(MineFrontier_ArenaBytes());
+        if (MINE_ERROR_SUCCESS != status)
         {
-            MineDebug_PrintError("Allocating memory for gameBoard\n");
-            status = MINE_ERROR_MEMORY;
+            MineDebug_PrintError("In function Mine_AllocBoard: %i\n", (int) status);
             break;
         }
 
-        gameData.tileStatus = (CHAR *) HeapAlloc(hHeap, HEAP_ZERO_MEMORY, 
-                                                 gameData.height * gameData.width * sizeof(CHAR));
-        if (NULL == gameData.tileStatus)
+        //Every tile starts hidden, so the minimap starts over as well
+        status = MineMinimap_Reset();
+        if (MINE_ERROR_SUCCESS != status)
         {
-            MineDebug_PrintError("Allocating memory for tileStatus\n");
-            status = MINE_ERROR_MEMORY;
+            MineDebug_PrintError("In function MineMinimap_Reset: %i\n", (int) status);
+            break;
+        }
+
+        status = MineFrontier_Reset();
+        if (MINE_ERROR_SUCCESS != status)
+        {
+            MineDebug_PrintError("In function MineFrontier_Reset: %i\n", (int) status);
             break;
         }
 
@@ -2179,8 +1333,10 @@ Mine_SetupGame(VOID)
         gameData.prevGridX = -1;
         gameData.prevGridY = -1;
 
-        gameData.horzShift = 0;
-        gameData.vertShift = 0;
+        windowData.scrollX = 0;
+        windowData.scrollY = 0;
+        windowData.targetX = 0;
+        windowData.targetY = 0;
 
         //Create a new board
         status = Mine_NewRandomBoard();
@@ -2190,40 +1346,22 @@ Mine_SetupGame(VOID)
             break;
         }
 
-        //If the number images should be random, pick a new set of images
-        if (MINE_NUMBER_IMAGE_RANDOM == menuData.numberImages)
+        /** Map tile numbers to sprites for the number image mode. Random mode
+            picks a new set of symbols for every game. */
+        status = Mine_SetupNumberImageData();
+        if (MINE_ERROR_SUCCESS != status)
         {
-            status = Mine_SetupNumberImageData();
-            if (MINE_ERROR_SUCCESS != status)
-            {
-                MineDebug_PrintError("In function Mine_SetupImageData: %i\n", (int) status);
-                break;
-            }
+            MineDebug_PrintError("In function Mine_SetupNumberImageData: %i\n", (int) status);
+            break;
         }
 
         __assume(FALSE == bFalse);
     } while (bFalse);
 
     //Clean up (upon error only)
-    if ((MINE_ERROR_SUCCESS != status) && (NULL != hHeap))
+    if (MINE_ERROR_SUCCESS != status)
     {
-        if (NULL != gameData.gameBoard)
-        {
-            if (0 == HeapFree(hHeap, 0, gameData.gameBoard))
-            {
-                MineDebug_PrintWarning("Unable to free game board: %lu\n", GetLastError());
-            }
-            gameData.gameBoard = NULL;
-        }
-
-        if (NULL != gameData.tileStatus)
-        {
-            if (0 == HeapFree(hHeap, 0, gameData.tileStatus))
-            {
-                MineDebug_PrintWarning("Unable to free tile status: %lu\n", GetLastError());
-            }
-            gameData.tileStatus = NULL;
-        }
+        Mine_FreeBoard();
     }
 
     return status;
@@ -2319,6 +1457,10 @@ Mine_SetupGlobal(VOID)
         menuData.useMovement = FALSE;
         menuData.movementFreq = MINE_SECOND;
         menuData.movementAggressive = MINE_MOVEMENT_DEFAULT_AGGRESSIVENESS;
+        menuData.movementBatch = MINE_MOVEMENT_DEFAULT_BATCH;
+        menuData.movementBatchPercent = FALSE;
+        menuData.movementPolicy = MINE_MOVEMENT_POLICY_WALK;
+        menuData.movementConsistent = FALSE;
             
         //Open a handle to the registry key
         lstatus = RegCreateKeyExW(HKEY_CURRENT_USER, L"Software\\Entropy\\MinesweeperDeluxe", 0,
@@ -2412,7 +1554,7 @@ Mine_SetupGlobal(VOID)
         lstatus = RegQueryValueExW(registryKey, L"CustomMines", NULL, &regType,
                                    (LPBYTE) &valueFromRegistry, &size);
         if ((ERROR_FILE_NOT_FOUND == lstatus) || (ERROR_SUCCESS == lstatus) &&
-            ((valueFromRegistry < MINE_BEGINNER_MINES) || 
+            ((valueFromRegistry < MINE_BEGINNER_MINES) || (valueFromRegistry > MINE_MAX_MINES) ||
              (valueFromRegistry > ((menuData.customHeight - 1)*(menuData.customWidth - 1)))))
         {
             lstatus = RegSetValueExW(registryKey, L"CustomMines", 0, REG_DWORD,
@@ -2690,7 +1832,7 @@ Mine_SetupGlobal(VOID)
         lstatus = RegQueryValueExW(registryKey, L"MovementFrequency", NULL, &regType,
                                    (LPBYTE) &valueFromRegistry, &size);
         if ((ERROR_FILE_NOT_FOUND == lstatus) || ((ERROR_SUCCESS == lstatus) &&
-            ((valueFromRegistry < MINE_QUARTER_SECOND) || (valueFromRegistry > MINE_MAX_TIME*MINE_SECOND))))
+            ((valueFromRegistry < MINE_MOVEMENT_MIN_FREQ) || (valueFromRegistry > MINE_MAX_TIME*MINE_SECOND))))
         {
             lstatus = RegSetValueExW(registryKey, L"MovementFrequency", 0, REG_DWORD,
                                      (BYTE *) &(menuData.movementFreq), sizeof(DWORD));
@@ -2734,572 +1876,127 @@ Mine_SetupGlobal(VOID)
             menuData.movementAggressive = valueFromRegistry;
         }
 
-        __assume(FALSE == bFalse);
-    } while (bFalse);
-
-    //Clean up
-
-    if (NULL != registryKey)
-    {
-        lstatus = RegCloseKey(registryKey);
-        if (ERROR_SUCCESS != lstatus)
-        {
-            MineDebug_PrintWarning("Unable to close registry key: %li\n", lstatus);
-        }
-        registryKey = NULL;
-    }
-
-    return status;
-}
-
-/**
-    Mine_SetupImageData
-*//**
-    Load handles to images needed to draw window.
-
-    @return Mine error code (MINE_ERROR_SUCCESS upon success).
-*/
-MINE_ERROR
-Mine_SetupImageData(VOID)
-{
-    BOOLEAN    bFalse = FALSE;
-    INT        ix = 0;
-    MINE_ERROR status = MINE_ERROR_SUCCESS;
-
-    do
-    {
-        //Obtain handle for numbers for timer and remaining mines counter
-        for (ix = 0; ix < 10; ix++)
-        {
-            imageData.timer[ix] = (HBITMAP) LoadImageW(hInst, MAKEINTRESOURCEW(IDB_TIMER0+ix),
-                                                       IMAGE_BITMAP, MINE_TIMER_WIDTH, MINE_TIMER_HEIGHT,
-                                                       LR_DEFAULTCOLOR);     
-            if (NULL == imageData.timer[ix])
-            {
-                MineDebug_PrintError("Loading timer %i bitmap: %lu\n", ix, GetLastError());
-                status = MINE_ERROR_BITMAP;
-                break;
-            }
-        }
-        if (MINE_ERROR_SUCCESS != status)
-        {
-            break;
-        }
-
-        //Obtain handle for dash for remaining mines counter
-        imageData.timerDash = (HBITMAP) LoadImageW(hInst, MAKEINTRESOURCEW(IDB_TIMERDASH),
-                                                   IMAGE_BITMAP, MINE_TIMER_WIDTH, MINE_TIMER_HEIGHT,
-                                                   LR_DEFAULTCOLOR);
-        if (NULL == imageData.timerDash)
-        {
-            MineDebug_PrintError("Loading timer dash bitmap: %i\n", GetLastError());
-            status = MINE_ERROR_BITMAP;
-            break;
-        }
-
-        //Obtain handle for normal smiley face
-        imageData.faceNormal = (HBITMAP) LoadImageW(hInst, MAKEINTRESOURCEW(IDB_FACENORMAL),
-                                                    IMAGE_BITMAP, MINE_FACE_WIDTH, MINE_FACE_HEIGHT,
-                                                    LR_DEFAULTCOLOR);
-        if (NULL == imageData.faceNormal)
-        {
-            MineDebug_PrintError("Loading face normal bitmap: %i\n", GetLastError());
-            status = MINE_ERROR_BITMAP;
-            break;
-        }
-
-        //Obtain handle for smiley face when button is clicked
-        imageData.faceClicked = (HBITMAP) LoadImageW(hInst, MAKEINTRESOURCEW(IDB_FACECLICKED),
-                                                     IMAGE_BITMAP, MINE_FACE_WIDTH, MINE_FACE_HEIGHT,
-                                                     LR_DEFAULTCOLOR);
-        if (NULL == imageData.faceClicked)
-        {
-            MineDebug_PrintError("Loading face clicked bitmap: %i\n", GetLastError());
-            status = MINE_ERROR_BITMAP;
-            break;
-        }
-
-        //Obtain handle for smiley face when a game is won
-        imageData.faceWon = (HBITMAP) LoadImageW(hInst, MAKEINTRESOURCEW(IDB_FACEWON),
-                                                 IMAGE_BITMAP, MINE_FACE_WIDTH, MINE_FACE_HEIGHT,
-                                                 LR_DEFAULTCOLOR);
-        if (NULL == imageData.faceWon)
+        ///////////////////////////////////////////////////////////////////////////////////////
+        /** Retrieve movement batch setting from registry. */
+        size = sizeof(DWORD);
+        lstatus = RegQueryValueExW(registryKey, L"MovementBatch", NULL, &regType,
+                                   (LPBYTE) &valueFromRegistry, &size);
+        if ((ERROR_FILE_NOT_FOUND == lstatus) || ((ERROR_SUCCESS == lstatus) &&
+            ((valueFromRegistry < 1) || (valueFromRegistry > MINE_MOVEMENT_MAX_BATCH))))
         {
-            MineDebug_PrintError("Loading face won bitmap: %i\n", GetLastError());
-            status = MINE_ERROR_BITMAP;
-            break;
+            lstatus = RegSetValueExW(registryKey, L"MovementBatch", 0, REG_DWORD,
+                                     (BYTE *) &(menuData.movementBatch), sizeof(DWORD));
+            if (ERROR_SUCCESS != lstatus)
+            {
+                MineDebug_PrintWarning("Setting MovementBatch registry value: %li\n", lstatus);
+            }
         }
-
-        //Obtain handle for smiley face when a game is lost
-        imageData.faceLost = (HBITMAP) LoadImageW(hInst, MAKEINTRESOURCEW(IDB_FACELOST),
-                                                  IMAGE_BITMAP, MINE_FACE_WIDTH, MINE_FACE_HEIGHT,
-                                                  LR_DEFAULTCOLOR);
-        if (NULL == imageData.faceLost)
+        else if ((REG_DWORD != regType) || (ERROR_SUCCESS != lstatus))
         {
-            MineDebug_PrintError("Loading face lost bitmap: %i\n", GetLastError());
-            status = MINE_ERROR_BITMAP;
-            break;
+            MineDebug_PrintWarning("Accessing MovementBatch registry value: %lu %li\n", 
+                                   regType, lstatus);
         }
-
-        //Obtain handle for an unclicked tile
-        imageData.unclicked = (HBITMAP) LoadImageW(hInst, MAKEINTRESOURCEW(IDB_UNCLICKED),
-                                                   IMAGE_BITMAP, MINE_TILE_PIXELS, MINE_TILE_PIXELS,
-                                                   LR_DEFAULTCOLOR);
-        if (NULL == imageData.unclicked)
+        else
         {
-            MineDebug_PrintError("Loading unclicked bitmap: %i\n", GetLastError());
-            status = MINE_ERROR_BITMAP;
-            break;
+            menuData.movementBatch = valueFromRegistry;
         }
 
-        //Obtain handle for a tile that is being held
-        imageData.held = (HBITMAP) LoadImageW(hInst, MAKEINTRESOURCEW(IDB_HELD),
-                                              IMAGE_BITMAP, MINE_TILE_PIXELS, MINE_TILE_PIXELS,
-                                              LR_DEFAULTCOLOR);
-        if (NULL == imageData.held)
+        ///////////////////////////////////////////////////////////////////////////////////////
+        /** Retrieve movement batch percentage setting from registry. */
+        size = sizeof(DWORD);
+        lstatus = RegQueryValueExW(registryKey, L"MovementBatchPercent", NULL, &regType,
+                                   (LPBYTE) &valueFromRegistry, &size);
+        if (ERROR_FILE_NOT_FOUND == lstatus)
         {
-            MineDebug_PrintError("Loading held bitmap: %i\n", GetLastError());
-            status = MINE_ERROR_BITMAP;
-            break;
+            lstatus = RegSetValueExW(registryKey, L"MovementBatchPercent", 0, REG_DWORD,
+                                     (BYTE *) &(menuData.movementBatchPercent), sizeof(DWORD));
+            if (ERROR_SUCCESS != lstatus)
+            {
+                MineDebug_PrintWarning("Setting MovementBatchPercent registry value: %li\n", lstatus);
+            }
         }
-
-        //Obtain handle for a tile with a flag
-        imageData.flag = (HBITMAP) LoadImageW(hInst, MAKEINTRESOURCEW(IDB_FLAG),
-                                              IMAGE_BITMAP, MINE_TILE_PIXELS, MINE_TILE_PIXELS,
-                                              LR_DEFAULTCOLOR);
-        if (NULL == imageData.flag)
+        else if ((REG_DWORD != regType) || (ERROR_SUCCESS != lstatus))
         {
-            MineDebug_PrintError("Loading flag bitmap: %i\n", GetLastError());
-            status = MINE_ERROR_BITMAP;
-            break;
+            MineDebug_PrintWarning("Accessing MovementBatchPercent registry value: %lu %li\n", 
+                                   regType, lstatus);
         }
-
-        //Obtain handle for a tile with an incorrectly placed flag, shown when game is lost
-        imageData.falseFlag = (HBITMAP) LoadImageW(hInst, MAKEINTRESOURCEW(IDB_FALSEFLAG),
-                                                   IMAGE_BITMAP, MINE_TILE_PIXELS, MINE_TILE_PIXELS,
-                                                   LR_DEFAULTCOLOR);
-        if (NULL == imageData.falseFlag)
+        else
         {
-            MineDebug_PrintError("Loading false flag bitmap: %i\n", GetLastError());
-            status = MINE_ERROR_BITMAP;
-            break;
+            menuData.movementBatchPercent = valueFromRegistry;
         }
 
-        //Obtain handle for a tile with a mine, shown when game is lost
-        imageData.mine = (HBITMAP) LoadImageW(hInst, MAKEINTRESOURCEW(IDB_MINE),
-                                              IMAGE_BITMAP, MINE_TILE_PIXELS, MINE_TILE_PIXELS,
-                                              LR_DEFAULTCOLOR);
-        if (NULL == imageData.mine)
+        ///////////////////////////////////////////////////////////////////////////////////////
+        /** Retrieve movement policy setting from registry. */
+        size = sizeof(DWORD);
+        lstatus = RegQueryValueExW(registryKey, L"MovementPolicy", NULL, &regType,
+                                   (LPBYTE) &valueFromRegistry, &size);
+        if ((ERROR_FILE_NOT_FOUND == lstatus) || ((ERROR_SUCCESS == lstatus) &&
+            (valueFromRegistry >= MINE_MOVEMENT_POLICIES)))
         {
-            MineDebug_PrintError("Loading mine bitmap: %i\n", GetLastError());
-            status = MINE_ERROR_BITMAP;
-            break;
+            lstatus = RegSetValueExW(registryKey, L"MovementPolicy", 0, REG_DWORD,
+                                     (BYTE *) &(menuData.movementPolicy), sizeof(DWORD));
+            if (ERROR_SUCCESS != lstatus)
+            {
+                MineDebug_PrintWarning("Setting MovementPolicy registry value: %li\n", lstatus);
+            }
         }
-
-        //Obtain handle for a tile with a mine that was clicked, shown when game is lost
-        imageData.mineHit = (HBITMAP) LoadImageW(hInst, MAKEINTRESOURCEW(IDB_MINEHIT),
-                                                 IMAGE_BITMAP, MINE_TILE_PIXELS, MINE_TILE_PIXELS,
-                                                 LR_DEFAULTCOLOR);
-        if (NULL == imageData.mineHit)
+        else if ((REG_DWORD != regType) || (ERROR_SUCCESS != lstatus))
         {
-            MineDebug_PrintError("Loading mine hit bitmap: %i\n", GetLastError());
-            status = MINE_ERROR_BITMAP;
-            break;
+            MineDebug_PrintWarning("Accessing MovementPolicy registry value: %lu %li\n", 
+                                   regType, lstatus);
         }
-
-        //Obtain handles for the tile numbers
-        status = Mine_SetupNumberImageData();
-        if (MINE_ERROR_SUCCESS != status)
+        else
         {
-            MineDebug_PrintError("In function Mine_SetupNumberImageData: %i\n", status);
-            break;
+            menuData.movementPolicy = valueFromRegistry;
         }
 
-        __assume(FALSE == bFalse);
-    } while (bFalse);
-    
-    return status;
-}
-
-/**
-    Mine_SetupNumberImageData
-*//**
-    Load handles to tile number images.
-
-    @return Mine error code (MINE_ERROR_SUCCESS upon success).
-*/
-MINE_ERROR
-Mine_SetupNumberImageData(VOID)
-{
-    BOOLEAN    bFalse = FALSE;
-    UINT       ix = 0;
-    UINT       randArray[MINE_NUM_RANDOM_TILES];
-    MINE_ERROR status = MINE_ERROR_SUCCESS;
-
-    do
-    {
-        //Delete previously obtained handles
-        for (ix = 0; ix < 9; ix++)
+        ///////////////////////////////////////////////////////////////////////////////////////
+        /** Retrieve consistent movement setting from registry. */
+        size = sizeof(DWORD);
+        lstatus = RegQueryValueExW(registryKey, L"MovementConsistent", NULL, &regType,
+                                   (LPBYTE) &valueFromRegistry, &size);
+        if ((ERROR_FILE_NOT_FOUND == lstatus) || ((ERROR_SUCCESS == lstatus) &&
+            (valueFromRegistry != TRUE) && (valueFromRegistry != FALSE)))
         {
-            if (NULL != imageData.numbers[ix])
+            lstatus = RegSetValueExW(registryKey, L"MovementConsistent", 0, REG_DWORD,
+                                     (BYTE *) &(menuData.movementConsistent), sizeof(DWORD));
+            if (ERROR_SUCCESS != lstatus)
             {
-                if (0 == DeleteObject((HGDIOBJ) imageData.numbers[ix]))
-                {
-                    MineDebug_PrintWarning("Unable to delete number %i object\n", ix);
-                }
-
-                imageData.numbers[ix] = NULL;
+                MineDebug_PrintWarning("Setting MovementConsistent registry value: %li\n", lstatus);
             }
         }
-
-        //For random images create a random permutation and use first 8 elements
-        if (MINE_NUMBER_IMAGE_RANDOM == menuData.numberImages)
+        else if ((REG_DWORD != regType) || (ERROR_SUCCESS != lstatus))
         {
-            for (ix = 0; ix < MINE_NUM_RANDOM_TILES; ix++)
-            {
-                randArray[ix] = ix;
-            }
-
-            status = Mine_RandomPerm(randArray, MINE_NUM_RANDOM_TILES, 8);
-            if (MINE_ERROR_SUCCESS != status)
-            {
-                MineDebug_PrintError("In function Mine_RandomPerm: %i\n", status);
-                break;
-            }
+            MineDebug_PrintWarning("Accessing MovementConsistent registry value: %lu %li\n", 
+                                   regType, lstatus);
         }
-
-        for (ix = 0; ix < 9; ix++)
+        else
         {
-            switch(menuData.numberImages)
-            {
-            //Load images for normal numbers
-            case MINE_NUMBER_IMAGE_NORMAL:
-                imageData.numbers[ix] = (HBITMAP) LoadImageW(hInst, MAKEINTRESOURCEW(IDB_CLICKED0 + ix),
-                                                             IMAGE_BITMAP, MINE_TILE_PIXELS, MINE_TILE_PIXELS,
-                                                             LR_DEFAULTCOLOR);     
-                if (NULL == imageData.numbers[ix])
-                {
-                    MineDebug_PrintError("Loading clicked %i bitmap: %i\n", ix, GetLastError());
-                    status = MINE_ERROR_BITMAP;
-                    break;
-                }
-                break;
-
-            //Load images for reversed numbers
-            case MINE_NUMBER_IMAGE_REVERSE:
-                imageData.numbers[ix] = (HBITMAP) LoadImageW(hInst, MAKEINTRESOURCEW(IDB_CLICKED8 - ix),
-                                                             IMAGE_BITMAP, MINE_TILE_PIXELS, MINE_TILE_PIXELS,
-                                                             LR_DEFAULTCOLOR);     
-                if (NULL == imageData.numbers[ix])
-                {
-                    MineDebug_PrintError("Loading clicked %i bitmap: %i\n", 8 - ix, GetLastError());
-                    status = MINE_ERROR_BITMAP;
-                    break;
-                }
-                break;
-
-            //Load images for solid color numbers
-            case MINE_NUMBER_IMAGE_SOLID:
-                imageData.numbers[ix] = (HBITMAP) LoadImageW(hInst, MAKEINTRESOURCEW(IDB_SOLID0+ix),
-                                                             IMAGE_BITMAP, MINE_TILE_PIXELS, MINE_TILE_PIXELS,
-                                                             LR_DEFAULTCOLOR);     
-                if (NULL == imageData.numbers[ix])
-                {
-                    MineDebug_PrintError("Loading solid %i bitmap: %i\n", ix, GetLastError());
-                    status = MINE_ERROR_BITMAP;
-                    break;
-                }
-                break;
-
-            //Load random symbols for numbers
-            case MINE_NUMBER_IMAGE_RANDOM:
-                //Still keep a blank tile as the image for zero mines
-                if (0 == ix)
-                {
-                    imageData.numbers[ix] = (HBITMAP) LoadImageW(hInst, MAKEINTRESOURCEW(IDB_CLICKED0),
-                                                                 IMAGE_BITMAP, MINE_TILE_PIXELS, MINE_TILE_PIXELS,
-                                                                 LR_DEFAULTCOLOR);     
-                    if (NULL == imageData.numbers[ix])
-                    {
-                        MineDebug_PrintError("Loading clicked 0 bitmap: %i\n", GetLastError());
-                        status = MINE_ERROR_BITMAP;
-                        break;
-                    }
-                }
-                else
-                {
-                    imageData.numbers[ix] = (HBITMAP) LoadImageW(hInst, 
-                                                                 MAKEINTRESOURCEW(IDB_RANDOM0+randArray[ix - 1]),
-                                                                 IMAGE_BITMAP, MINE_TILE_PIXELS, MINE_TILE_PIXELS,
-                                                                 LR_DEFAULTCOLOR);     
-                    if (NULL == imageData.numbers[ix])
-                    {
-                        MineDebug_PrintError("Loading random %i bitmap: %i\n", randArray[ix - 1], GetLastError());
-                        status = MINE_ERROR_BITMAP;
-                        break;
-                    }
-                }
-                break;
-                
-            //Load blank tile image for all numbers
-            case MINE_NUMBER_IMAGE_BLANK:
-                imageData.numbers[ix] = (HBITMAP) LoadImageW(hInst, MAKEINTRESOURCEW(IDB_CLICKED0),
-                                                             IMAGE_BITMAP, MINE_TILE_PIXELS, MINE_TILE_PIXELS,
-                                                             LR_DEFAULTCOLOR);     
-                if (NULL == imageData.numbers[ix])
-                {
-                    MineDebug_PrintError("Loading clicked 0 bitmap: %i\n", GetLastError());
-                    status = MINE_ERROR_BITMAP;
-                    break;
-                }
-                break;
-
-            default:
-                __assume(0);
-                break;
-
-            }
-            if (MINE_ERROR_SUCCESS != status)
-            {
-                break;
-            }
+            menuData.movementConsistent = valueFromRegistry;
         }
-        if (MINE_ERROR_SUCCESS != status)
+
+        /** A percentage of the mines can be at most all of them. */
+        if (menuData.movementBatchPercent && (menuData.movementBatch > 100))
         {
-            break;
+            menuData.movementBatch = 100;
         }
 
         __assume(FALSE == bFalse);
     } while (bFalse);
 
-    return status;
-}
-
-/**
-    Mine_SetupWindow
-*//**
-    Store information about the coordinates of window components.
-*/
-VOID
-Mine_SetupWindow(VOID)
-{
-    windowData.clientHeight = MINE_BASE_HEIGHT_PIXELS + MINE_TILE_PIXELS*gameData.height;
-    windowData.clientWidth = MINE_BASE_WIDTH_PIXELS + MINE_TILE_PIXELS*gameData.width;
-
-    /** Store coordinates for all decorative white lines. */
-    //White lines along left side of window
-    windowData.whiteLines[0].top = 0;
-    windowData.whiteLines[0].left = 0;
-    windowData.whiteLines[0].right = 0;
-    windowData.whiteLines[0].bottom = (LONG) windowData.clientHeight;
-
-    windowData.whiteLines[1].top = 0;
-    windowData.whiteLines[1].left = 1;
-    windowData.whiteLines[1].right = 1;
-    windowData.whiteLines[1].bottom = (LONG) windowData.clientHeight;
-
-    windowData.whiteLines[2].top = 0;
-    windowData.whiteLines[2].left = 2;
-    windowData.whiteLines[2].right = 2;
-    windowData.whiteLines[2].bottom = (LONG) windowData.clientHeight;
-
-    //White lines along top of window
-    windowData.whiteLines[3].top = 0;
-    windowData.whiteLines[3].left = 0;
-    windowData.whiteLines[3].right = (LONG) windowData.clientWidth;
-    windowData.whiteLines[3].bottom = 0;
-
-    windowData.whiteLines[4].top = 1;
-    windowData.whiteLines[4].left = 0;
-    windowData.whiteLines[4].right = (LONG) windowData.clientWidth;
-    windowData.whiteLines[4].bottom = 1;
-
-    windowData.whiteLines[5].top = 2;
-    windowData.whiteLines[5].left = 0;
-    windowData.whiteLines[5].right = (LONG) windowData.clientWidth;
-    windowData.whiteLines[5].bottom = 2;
-
-    //White lines highlighting remaining mines counter
-    windowData.whiteLines[6].top = 39;
-    windowData.whiteLines[6].left = 17;
-    windowData.whiteLines[6].right = 70;
-    windowData.whiteLines[6].bottom = 39;
-
-    windowData.whiteLines[7].top = 16;
-    windowData.whiteLines[7].left = 69;
-    windowData.whiteLines[7].right = 69;
-    windowData.whiteLines[7].bottom = 40;
-
-    //White lines highlighting timer
-    windowData.whiteLines[8].top = 39;
-    windowData.whiteLines[8].left = (LONG) windowData.clientWidth - 54;
-    windowData.whiteLines[8].right = (LONG) windowData.clientWidth - 14;
-    windowData.whiteLines[8].bottom = 39;
-
-    windowData.whiteLines[9].top = 16;
-    windowData.whiteLines[9].left = (LONG) windowData.clientWidth - 15;
-    windowData.whiteLines[9].right = (LONG) windowData.clientWidth - 15;
-    windowData.whiteLines[9].bottom = 40;
-
-    //White lines highlighting the top banner region of the window
-    windowData.whiteLines[10].top = 44;
-    windowData.whiteLines[10].left = 11;
-    windowData.whiteLines[10].right = (LONG) windowData.clientWidth - 5;
-    windowData.whiteLines[10].bottom = 44;
-
-    windowData.whiteLines[11].top = 45;
-    windowData.whiteLines[11].left = 10;
-    windowData.whiteLines[11].right = (LONG) windowData.clientWidth - 5;
-    windowData.whiteLines[11].bottom = 45;
-
-    windowData.whiteLines[12].top = 11;
-    windowData.whiteLines[12].left = (LONG) windowData.clientWidth - 7;
-    windowData.whiteLines[12].right = (LONG) windowData.clientWidth - 7;
-    windowData.whiteLines[12].bottom = 46;
-
-    windowData.whiteLines[13].top = 10;
-    windowData.whiteLines[13].left = (LONG) windowData.clientWidth - 6;
-    windowData.whiteLines[13].right = (LONG) windowData.clientWidth - 6;
-    windowData.whiteLines[13].bottom = 46;
-
-    //White lines highlighting game board
-    windowData.whiteLines[14].top = (LONG) windowData.clientHeight - 8;
-    windowData.whiteLines[14].left = 12;
-    windowData.whiteLines[14].right = (LONG) windowData.clientWidth - 5;
-    windowData.whiteLines[14].bottom = (LONG) windowData.clientHeight - 8;
-
-    windowData.whiteLines[15].top = (LONG) windowData.clientHeight - 7;
-    windowData.whiteLines[15].left = 11;
-    windowData.whiteLines[15].right = (LONG) windowData.clientWidth - 5;
-    windowData.whiteLines[15].bottom = (LONG) windowData.clientHeight - 7;
-
-    windowData.whiteLines[16].top = (LONG) windowData.clientHeight - 6;
-    windowData.whiteLines[16].left = 10;
-    windowData.whiteLines[16].right = (LONG) windowData.clientWidth - 5;
-    windowData.whiteLines[16].bottom = (LONG) windowData.clientHeight - 6;
-
-    windowData.whiteLines[17].top = 55;
-    windowData.whiteLines[17].left = (LONG) windowData.clientWidth - 8;
-    windowData.whiteLines[17].right = (LONG) windowData.clientWidth - 8;
-    windowData.whiteLines[17].bottom = (LONG) windowData.clientHeight - 5;
-
-    windowData.whiteLines[18].top = 54;
-    windowData.whiteLines[18].left = (LONG) windowData.clientWidth - 7;
-    windowData.whiteLines[18].right = (LONG) windowData.clientWidth - 7;
-    windowData.whiteLines[18].bottom = (LONG) windowData.clientHeight - 5;
-
-    windowData.whiteLines[19].top = 53;
-    windowData.whiteLines[19].left = (LONG) windowData.clientWidth - 6;
-    windowData.whiteLines[19].right = (LONG) windowData.clientWidth - 6;
-    windowData.whiteLines[19].bottom = (LONG) windowData.clientHeight - 5;
-
-    /** Store coordinates for all decorative grey lines. */
-    //Grey lines highlighting the top banner region of the window
-    windowData.greyLines[0].top = 9;
-    windowData.greyLines[0].left = 9;
-    windowData.greyLines[0].right = 9;
-    windowData.greyLines[0].bottom = 45;
-
-    windowData.greyLines[1].top = 9;
-    windowData.greyLines[1].left = 10;
-    windowData.greyLines[1].right = 10;
-    windowData.greyLines[1].bottom = 44;
+    //Clean up
 
-    
-    windowData.greyLines[2].top = 9;
-    windowData.greyLines[2].left = 9;
-    windowData.greyLines[2].right = (LONG) windowData.clientWidth - 6;
-    windowData.greyLines[2].bottom = 9;
-
-    windowData.greyLines[3].top = 10;
-    windowData.greyLines[3].left = 9;
-    windowData.greyLines[3].right = (LONG) windowData.clientWidth - 7;
-    windowData.greyLines[3].bottom = 10;
-
-    //Grey lines highlighting remaining mines counter
-    windowData.greyLines[4].top = 15;
-    windowData.greyLines[4].left = 16;
-    windowData.greyLines[4].right = 16;
-    windowData.greyLines[4].bottom = 39;
-
-    windowData.greyLines[5].top = 15;
-    windowData.greyLines[5].left = 16;
-    windowData.greyLines[5].right = 69;
-    windowData.greyLines[5].bottom = 15;
-
-    //Grey lines highlighting timer
-    windowData.greyLines[6].top = 15;
-    windowData.greyLines[6].left = (LONG) windowData.clientWidth - 55;
-    windowData.greyLines[6].right = (LONG) windowData.clientWidth - 55;
-    windowData.greyLines[6].bottom = 39;
-
-    windowData.greyLines[7].top = 15;
-    windowData.greyLines[7].left = (LONG) windowData.clientWidth - 55;
-    windowData.greyLines[7].right = (LONG) windowData.clientWidth - 15;
-    windowData.greyLines[7].bottom = 15;
-
-    //Grey lines highlighting game board
-    windowData.greyLines[8].top = 52;
-    windowData.greyLines[8].left = 9;
-    windowData.greyLines[8].right = 9;
-    windowData.greyLines[8].bottom = (LONG) windowData.clientHeight - 6;
-
-    windowData.greyLines[9].top = 52;
-    windowData.greyLines[9].left = 10;
-    windowData.greyLines[9].right = 10;
-    windowData.greyLines[9].bottom = (LONG) windowData.clientHeight - 7;
-
-    windowData.greyLines[10].top = 52;
-    windowData.greyLines[10].left = 11;
-    windowData.greyLines[10].right = 11;
-    windowData.greyLines[10].bottom = (LONG) windowData.clientHeight - 8;
-
-    windowData.greyLines[11].top = 52;
-    windowData.greyLines[11].left = 9;
-    windowData.greyLines[11].right = (LONG) windowData.clientWidth - 6;
-    windowData.greyLines[11].bottom = 52;
-
-    windowData.greyLines[12].top = 53;
-    windowData.greyLines[12].left = 9;
-    windowData.greyLines[12].right = (LONG) windowData.clientWidth - 7;
-    windowData.greyLines[12].bottom = 53;
-
-    windowData.greyLines[13].top = 54;
-    windowData.greyLines[13].left = 9;
-    windowData.greyLines[13].right = (LONG) windowData.clientWidth - 8;
-    windowData.greyLines[13].bottom = 54;
-
-    //Store boundary of timer
-    windowData.timerRegion.top = 16;
-    windowData.timerRegion.left = (LONG) windowData.clientWidth - 54;
-    windowData.timerRegion.right = (LONG) windowData.clientWidth - 15;
-    windowData.timerRegion.bottom = 39;
-
-    //Store boundary of remaining mines counter
-    windowData.mineCountRegion.top = 16;
-    windowData.mineCountRegion.left = 17;
-    windowData.mineCountRegion.right = 69;
-    windowData.mineCountRegion.bottom = 39;
-
-    //Store boundary of smiley face
-    windowData.faceRegion.top = 15;
-    windowData.faceRegion.left = ((LONG) windowData.clientWidth / 2) - 11;
-    windowData.faceRegion.right = ((LONG) windowData.clientWidth / 2) + 15;
-    windowData.faceRegion.bottom = 41;
-
-    //Store boundary of top banner region
-    windowData.topBannerRegion.top = 11;
-    windowData.topBannerRegion.left = 11;
-    windowData.topBannerRegion.right = (LONG) windowData.clientWidth - 7;
-    windowData.topBannerRegion.bottom = 44;
-
-    //Store boundary of game board
-    windowData.boardRegion.top = 55;
-    windowData.boardRegion.left = 12;
-    windowData.boardRegion.right = (LONG) windowData.clientWidth - 8;
-    windowData.boardRegion.bottom = (LONG) windowData.clientHeight - 8;
+    if (NULL != registryKey)
+    {
+        lstatus = RegCloseKey(registryKey);
+        if (ERROR_SUCCESS != lstatus)
+        {
+            MineDebug_PrintWarning("Unable to close registry key: %li\n", lstatus);
+        }
+        registryKey = NULL;
+    }
 
-    return;
+    return status;
 }
 
 /**
@@ -3319,18 +2016,18 @@ WndProc(_In_ HWND hWnd, UINT message, WPARAM wParam, LPARAM lParam)
 {
     INT_PTR           dialogReturn = 0;
     static BOOLEAN    errorOccurred = FALSE;
+    MINE_ERROR        frameStatus = MINE_ERROR_SUCCESS;
     static int        functionEntryCount = 0;
     static HMENU      hMenu = NULL;
-    DWORD             oldHeight = 0;
-    DWORD             oldWidth = 0;
     static UINT       prevMenuGame = 0;
     static UINT       prevMenuImages = 0;
     LRESULT           returnValue = 0;
+    BOOLEAN           scrollView = FALSE;
     HINSTANCE         shellExecuteReturn = 0;
+    MINE_ERROR        simStatus = MINE_ERROR_SUCCESS;
     //Keep status as static variable. Set if an error is encountered processing 
     //a message, return as quit message when window is destroyed.
     static MINE_ERROR status = MINE_ERROR_SUCCESS;
-    RECT              windowSize;
     UINT              wmId = 0;
     short             xMouse = 0;
     short             yMouse = 0;
@@ -3354,10 +2051,7 @@ WndProc(_In_ HWND hWnd, UINT message, WPARAM wParam, LPARAM lParam)
                 errorOccurred = TRUE;
                 break;
             }
-            if (0 == InvalidateRect(hWnd, NULL, FALSE))
-            {
-                MineDebug_PrintWarning("Unable to invalidate rectangle\n");
-            }
+            MineDamage_AddAll();
             break;
 
         //Change to a non-custom level
@@ -3385,33 +2079,17 @@ WndProc(_In_ HWND hWnd, UINT message, WPARAM wParam, LPARAM lParam)
                                  ((IDM_EXPERT   == wmId) ? (DWORD) MINE_LEVEL_EXPERT : 
                                                            (DWORD) MINE_LEVEL_INTERMEDIATE));
 
-            //Store old height and width to assist in changing window size
-            oldHeight = gameData.height;
-            oldWidth =  gameData.width;
-
             //Send message to start a new game
             (void) SendMessageW(hWnd, WM_COMMAND, MAKEWPARAM(IDM_NEW, 0), 0);
 
             //Determine the new coordinates for all the window elements
             Mine_SetupWindow();
-            if (0 == GetWindowRect(hWnd, &windowSize))
-            {
-                status = MINE_ERROR_GET_DATA;
-                MineDebug_PrintError("Getting window rectangle: %lu\n", GetLastError());
-                errorOccurred = TRUE;
-                break;
-            }
-            //Change in window size can be derived from change in board size
-            windowSize.right += (gameData.width - oldWidth) * MINE_TILE_PIXELS;
-            windowSize.bottom += (gameData.height - oldHeight) * MINE_TILE_PIXELS;
 
             //Resize board
-            if (0 == MoveWindow(hWnd, windowSize.left, windowSize.top, 
-                                windowSize.right - windowSize.left,
-                                windowSize.bottom - windowSize.top, TRUE))
+            status = Mine_FitWindowToClient();
+            if (MINE_ERROR_SUCCESS != status)
             {
-                status = MINE_ERROR_RESIZE;
-                MineDebug_PrintError("Moving the window: %lu\n", GetLastError());
+                MineDebug_PrintError("In function Mine_FitWindowToClient: %i\n", (int) status);
                 errorOccurred = TRUE;
                 break;
             }
@@ -3453,33 +2131,17 @@ WndProc(_In_ HWND hWnd, UINT message, WPARAM wParam, LPARAM lParam)
             
                 menuData.gameLevel = MINE_LEVEL_CUSTOM;
 
-                //Store old height and width to assist in changing window size
-                oldHeight = gameData.height;
-                oldWidth =  gameData.width;
-
                 //Send message to start a new game
                 (void) SendMessageW(hWnd, WM_COMMAND, MAKEWPARAM(IDM_NEW, 0), 0);
 
                 //Determine the new coordinates for all the window elements
                 Mine_SetupWindow();
-                if (0 == GetWindowRect(hWnd, &windowSize))
-                {
-                    status = MINE_ERROR_GET_DATA;
-                    MineDebug_PrintError("Getting window rectangle: %lu\n", GetLastError());
-                    errorOccurred = TRUE;
-                    break;
-                }
-                //Change in window size can be derived from change in board size
-                windowSize.right += (gameData.width - oldWidth) * MINE_TILE_PIXELS;
-                windowSize.bottom += (gameData.height - oldHeight) * MINE_TILE_PIXELS;
 
                 //Resize board
-                if (0 == MoveWindow(hWnd, windowSize.left, windowSize.top, 
-                                    windowSize.right - windowSize.left,
-                                    windowSize.bottom - windowSize.top, TRUE))
+                status = Mine_FitWindowToClient();
+                if (MINE_ERROR_SUCCESS != status)
                 {
-                    status = MINE_ERROR_RESIZE;
-                    MineDebug_PrintError("Moving the window: %lu\n", GetLastError());
+                    MineDebug_PrintError("In function Mine_FitWindowToClient: %i\n", (int) status);
                     errorOccurred = TRUE;
                     break;
                 }
@@ -3545,16 +2207,7 @@ WndProc(_In_ HWND hWnd, UINT message, WPARAM wParam, LPARAM lParam)
                                      ((IDM_RANDOM  == wmId) ? (DWORD) MINE_NUMBER_IMAGE_RANDOM  :
                                                               (DWORD) MINE_NUMBER_IMAGE_BLANK))));
 
-            //Obtain new handles for the new number image bitmaps
-            status = Mine_SetupNumberImageData();
-            if (MINE_ERROR_SUCCESS != status)
-            {
-                MineDebug_PrintError("In function Mine_SetupNumberImageData: %i\n", (int) status);
-                errorOccurred = TRUE;
-                break;
-            }
-
-            //Send message to start a new game
+            //Send message to start a new game, which maps the numbers to the new set of sprites
             (void) SendMessageW(hWnd, WM_COMMAND, MAKEWPARAM(IDM_NEW, 0), 0);
 
             //Store change in registry so it can persist when game is closed
@@ -3771,13 +2424,27 @@ WndProc(_In_ HWND hWnd, UINT message, WPARAM wParam, LPARAM lParam)
             MineDebug_PrintWarning("Unable to kill timer: %lu\n", GetLastError());
         }
 
-        //Movement timer exists if movementTimerCreated flag is set
-        if (movementTimerCreated)
+        //Movement thread posts to the window, so it ends first
+        MineSim_Cleanup();
+
+        //Scroll timer exists while the board is scrolling
+        if (scrollTimerCreated)
+        {
+            if (0 == KillTimer(hWnd, MINE_TIMER_SCROLL))
+            {
+                MineDebug_PrintWarning("Unable to kill scroll timer: %lu\n", GetLastError());
+            }
+            scrollTimerCreated = FALSE;
+        }
+
+        //Frame timer exists while damage is waiting to be drawn
+        if (frameTimerCreated)
         {
-            if (0 == KillTimer(hwnd, MINE_TIMER_MOVE))
+            if (0 == KillTimer(hWnd, MINE_TIMER_FRAME))
             {
-                MineDebug_PrintWarning("Unable to kill movement timer: %lu\n", GetLastError());
+                MineDebug_PrintWarning("Unable to kill frame timer: %lu\n", GetLastError());
             }
+            frameTimerCreated = FALSE;
         }
 
         if (errorOccurred && (MINE_ERROR_SUCCESS == status))
@@ -3790,99 +2457,68 @@ WndProc(_In_ HWND hWnd, UINT message, WPARAM wParam, LPARAM lParam)
 
         break;
 
+    /** Process WM_ERASEBKGND message... */
+    case WM_ERASEBKGND:
+        //The frame covers the whole client area, so filling it with the class brush first is wasted
+        returnValue = 1;
+        break;
+
     /** Process WM_KEYDOWN message... */
     case WM_KEYDOWN:
-
-        //Store coordinates of previously held tile before coordinates shift to keep 
-        //held tile on same spot of the board after the scroll
-        xMouse = (short) (windowData.boardRegion.left + gameData.prevGridX*MINE_TILE_PIXELS);
-        yMouse = (short) (windowData.boardRegion.top  + gameData.prevGridY*MINE_TILE_PIXELS);
         switch (wParam)
         {
-         /** Scroll the board if an arrow key is pressed while in a wrap mode. */
+        /** Scroll the board view a tile if an arrow key is pressed. */
         case VK_DOWN:
-            if (menuData.wrapVert)
-            {
-                //Update the vertical shift amount
-                gameData.vertShift = (gameData.vertShift + 1) % (LONG) gameData.height;
-                if (-1 != gameData.prevGridY)
-                {
-                    //Translate held tile to its new grid coordinates
-                    gameData.prevGridY = (gameData.prevGridY + (LONG) gameData.height - 1) % (LONG) gameData.height;
-                }
-                //Scroll the game board
-                if (ERROR == ScrollWindowEx(hWnd, 0, (-1)*MINE_TILE_PIXELS, &windowData.boardRegion,
-                                            &windowData.boardRegion, NULL, NULL, SW_INVALIDATE))
-                {
-                    status = MINE_ERROR_PAINT;
-                    MineDebug_PrintError("Scrolling window up: %lu\n", GetLastError());
-                    errorOccurred = TRUE;
-                    break;
-                }
-            }
+            scrollView = Mine_MoveView(0, 1);
             break;
         case VK_UP:
-            if (menuData.wrapVert)
-            {
-                gameData.vertShift = (gameData.vertShift + (LONG) gameData.height - 1) % (LONG) gameData.height;
-                if (-1 != gameData.prevGridY)
-                {
-                    gameData.prevGridY = (gameData.prevGridY + 1) % (LONG) gameData.height;
-                }
-                if (ERROR == ScrollWindowEx(hWnd, 0, MINE_TILE_PIXELS, &windowData.boardRegion,
-                                            &windowData.boardRegion, NULL, NULL, SW_INVALIDATE))
-                {
-                    status = MINE_ERROR_PAINT;
-                    MineDebug_PrintError("Scrolling window down: %lu\n", GetLastError());
-                    errorOccurred = TRUE;
-                    break;
-                }
-            }
+            scrollView = Mine_MoveView(0, -1);
             break;
         case VK_RIGHT:
-            if (menuData.wrapHorz)
-            {
-                gameData.horzShift = (gameData.horzShift + 1) % (LONG) gameData.width;
-                if (-1 != gameData.prevGridX)
-                {
-                    gameData.prevGridX = (gameData.prevGridX + (LONG) gameData.width - 1) % (LONG) gameData.width;
-                }
-                if (ERROR == ScrollWindowEx(hWnd, (-1)*MINE_TILE_PIXELS, 0, &windowData.boardRegion,
-                                            &windowData.boardRegion, NULL, NULL, SW_INVALIDATE))
-                {
-                    status = MINE_ERROR_PAINT;
-                    MineDebug_PrintError("Scrolling window left: %lu\n", GetLastError());
-                    errorOccurred = TRUE;
-                    break;
-                }
-            }
+            scrollView = Mine_MoveView(1, 0);
             break;
         case VK_LEFT:
-            if (menuData.wrapHorz)
+            scrollView = Mine_MoveView(-1, 0);
+            break;
+        /** Zoom the board in or out one step if plus or minus is pressed. */
+        case VK_ADD:       /* Fall through */
+        case VK_OEM_PLUS:  /* Fall through */
+        case VK_SUBTRACT:  /* Fall through */
+        case VK_OEM_MINUS:
+            Mine_SetZoom(((VK_ADD == wParam) || (VK_OEM_PLUS == wParam)) ?
+                         (windowData.zoom + 1) : (windowData.zoom - 1));
+
+            //The view holds a different number of tiles, so the window changes size
+            status = Mine_FitWindowToClient();
+            if (MINE_ERROR_SUCCESS != status)
             {
-                gameData.horzShift = (gameData.horzShift + (LONG) gameData.width - 1) % (LONG) gameData.width;
-                if (-1 != gameData.prevGridX)
-                {
-                    gameData.prevGridX = (gameData.prevGridX + 1) % (LONG) gameData.width;
-                }
-                if (ERROR == ScrollWindowEx(hWnd, MINE_TILE_PIXELS, 0, &windowData.boardRegion,
-                                            &windowData.boardRegion, NULL, NULL, SW_INVALIDATE))
-                {
-                    status = MINE_ERROR_PAINT;
-                    MineDebug_PrintError("Scrolling window right: %lu\n", GetLastError());
-                    errorOccurred = TRUE;
-                    break;
-                }
+                MineDebug_PrintError("In function Mine_FitWindowToClient: %i\n", (int) status);
+                errorOccurred = TRUE;
+                break;
             }
+            MineDamage_AddAll();
+            break;
         default:
             //Send all other key presses to default window procedure
             returnValue = DefWindowProcW(hWnd, message, wParam, lParam);
             break;
         }
-        //If a tile is held, send a message in order to keep held tile in same spot on board
-        if ((-1 != gameData.prevGridX) && (-1 != gameData.prevGridY))
+        /** Slide the view toward its new target, the scroll timer stops itself once there. */
+        if (scrollView && (!scrollTimerCreated))
         {
-            (void) SendMessage(hWnd, WM_MOUSEMOVE, 0, MAKELPARAM(xMouse, yMouse));
+            if (0 == SetTimer(hWnd, MINE_TIMER_SCROLL, MINE_SCROLL_UPDATE_TIME, NULL))
+            {
+                MineDebug_PrintWarning("Creating scroll timer: %lu\n", GetLastError());
+
+                //Without a timer, jump straight to the new position
+                windowData.scrollX = windowData.targetX;
+                windowData.scrollY = windowData.targetY;
+                Mine_ProcessScroll();
+            }
+            else
+            {
+                scrollTimerCreated = TRUE;
+            }
         }
         break;
 
@@ -3915,11 +2551,17 @@ WndProc(_In_ HWND hWnd, UINT message, WPARAM wParam, LPARAM lParam)
                 }
             }
         }
-
-        if (0 == InvalidateRect(hWnd, &(windowData.faceRegion), FALSE))
+        /** If the minimap was clicked, jump the view to the tiles under the mouse. */
+        else if (Mine_PointInRect(xMouse, yMouse, &windowData.minimapRegion))
         {
-            MineDebug_PrintWarning("Unable to invalidate rectangle\n");
+            Mine_JumpView(min((xMouse - windowData.minimapRegion.left)*minimapData.blockTiles +
+                              minimapData.blockTiles/2, (LONG) gameData.width - 1),
+                          min((yMouse - windowData.minimapRegion.top)*minimapData.blockTiles +
+                              minimapData.blockTiles/2, (LONG) gameData.height - 1));
+            Mine_ProcessScroll();
         }
+
+        MineDamage_AddRect(&(windowData.faceRegion));
         (void) SetCapture(hWnd);
         //Store variables for which mouse buttons are pressed instead of using wParam value
         //for proper behavior when pressing both buttons simultaneously, releasing the right,
@@ -3963,10 +2605,7 @@ WndProc(_In_ HWND hWnd, UINT message, WPARAM wParam, LPARAM lParam)
             }
         }
 
-        if (0 == InvalidateRect(hWnd, &(windowData.faceRegion), FALSE))
-        {
-            MineDebug_PrintWarning("Unable to invalidate rectangle\n");
-        }
+        MineDamage_AddRect(&(windowData.faceRegion));
         if (0 == ReleaseCapture())
         {
             MineDebug_PrintWarning("Unable to release mouse capture: %lu\n", GetLastError());
@@ -4076,10 +2715,7 @@ WndProc(_In_ HWND hWnd, UINT message, WPARAM wParam, LPARAM lParam)
             gameData.leftDown = FALSE;
         }
 
-        if (0 == InvalidateRect(hWnd, &(windowData.faceRegion), FALSE))
-        {
-            MineDebug_PrintWarning("Unable to invalidate rectangle\n");
-        }
+        MineDamage_AddRect(&(windowData.faceRegion));
         if (0 == ReleaseCapture())
         {
             MineDebug_PrintWarning("Unable to release mouse capture: %lu\n", GetLastError());
@@ -4089,32 +2725,68 @@ WndProc(_In_ HWND hWnd, UINT message, WPARAM wParam, LPARAM lParam)
 
     /** Process WM_TIMER message... */
     case WM_TIMER:
-        if (gameData.gameStarted && (!gameData.gameOver))
+        /** Draw everything damaged since the last frame. */
+        if (MINE_TIMER_FRAME == wParam)
+        {
+            status = Mine_FlushDamage();
+            if (MINE_ERROR_SUCCESS != status)
+            {
+                MineDebug_PrintError("In function Mine_FlushDamage: %i\n", (int) status);
+                errorOccurred = TRUE;
+                break;
+            }
+        }
+        /** The board can be scrolled whether or not a game is in progress. */
+        else if (MINE_TIMER_SCROLL == wParam)
+        {
+            Mine_ProcessScroll();
+        }
+        else if (gameData.gameStarted && (!gameData.gameOver))
         {
             /** Update the clock if the time has not already reached the maximum value. */
             if ((MINE_TIMER_CLOCK == wParam) && (gameData.time < MINE_MAX_TIME))
             {
                 Mine_ProcessTimer();
             }
-            else if (MINE_TIMER_MOVE == wParam)
-            {
-                status = MineMovement_ProcessMovement();
-                if (MINE_ERROR_SUCCESS != status)
-                {
-                    MineDebug_PrintError("In function MineMovement_ProcessMovement: %i\n", (int) status);
-                    errorOccurred = TRUE;
-                    break;
-                }
-            }
         } 
         break;
 
+    /** Process WM_MINE_SIM message... */
+    case WM_MINE_SIM:
+        /** Make the moves chosen by the movement thread. */
+        status = MineSim_ApplyMoves();
+        if (MINE_ERROR_SUCCESS != status)
+        {
+            MineDebug_PrintError("In function MineSim_ApplyMoves: %i\n", (int) status);
+            errorOccurred = TRUE;
+        }
+        break;
+
     //Process all other messages by calling the default window procedure
     default:
         returnValue = DefWindowProcW(hWnd, message, wParam, lParam);
         break;
     }
 
+    /** Whatever the message changed on screen is drawn on the next frame. */
+    if ((!errorOccurred) && (WM_DESTROY != message))
+    {
+        frameStatus = Mine_ScheduleFrame(hWnd);
+        if (MINE_ERROR_SUCCESS != frameStatus)
+        {
+            MineDebug_PrintError("In function Mine_ScheduleFrame: %i\n", (int) frameStatus);
+            errorOccurred = TRUE;
+        }
+
+        /** Start or stop mine movement if the message started or ended a game. */
+        simStatus = MineSim_Sync();
+        if (MINE_ERROR_SUCCESS != simStatus)
+        {
+            MineDebug_PrintError("In function MineSim_Sync: %i\n", (int) simStatus);
+            errorOccurred = TRUE;
+        }
+    }
+
     functionEntryCount -= 1;
 
     //Upon error, destroy window when we are about to exit the window procedure,
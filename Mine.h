@@ -24,7 +24,7 @@
 */
 #pragma once
 
-#include "resource.h"
+#include "Resource.h"
 #include "stdafx.h"
 
 //--------------------------------------------------------------
@@ -61,12 +61,13 @@
 /** Number of mines in expert level. */
 #define MINE_EXPERT_MINES  99
 
-//Maximum size for custom level is twice the 
-//maximum from the original minewsweeper game
+//Boards larger than the screen are shown through a scrolling view
 /** Maximum height (in tiles) for custom level. */
-#define MINE_MAX_HEIGHT 48
+#define MINE_MAX_HEIGHT 500
 /** Maximum width (in tiles) for custom level. */
-#define MINE_MAX_WIDTH  60 
+#define MINE_MAX_WIDTH  500
+/** Maximum number of mines for custom level, the most the mine counter can show. */
+#define MINE_MAX_MINES  9999
 
 /** Maximum number of seconds on the timer. */
 #define MINE_MAX_TIME 999
@@ -109,9 +110,39 @@
 #define MINE_CLOCK_UPDATE_TIME 250
 
 /** Identifier for clock timer. */
-#define MINE_TIMER_CLOCK 1
-/** Identifier for movement timer. */
-#define MINE_TIMER_MOVE  2
+#define MINE_TIMER_CLOCK  1
+/** Identifier for board scrolling timer. */
+#define MINE_TIMER_SCROLL 3
+/** Identifier for frame timer, which redraws damaged parts of the window. */
+#define MINE_TIMER_FRAME  4
+
+/** Number of milliseconds between frames, about one per display refresh. */
+#define MINE_FRAME_TIME 16
+
+/** Longest time (in microseconds) from process creation to the first frame
+    before startup is reported as over budget. */
+#define MINE_STARTUP_BUDGET 250000
+
+/** Number of zoom steps in every whole magnification of the board. */
+#define MINE_ZOOM_STEPS 4
+/** Largest magnification of the board. */
+#define MINE_MAX_ZOOM 4
+/** Number of zoom levels, one for each step from 1 to MINE_MAX_ZOOM. */
+#define MINE_NUM_ZOOMS ((MINE_MAX_ZOOM - 1)*MINE_ZOOM_STEPS + 1)
+/** Size (in pixels) of a tile at a zoom level given in zoom steps. */
+#define MINE_ZOOM_TILE_PIXELS(zoom) ((MINE_TILE_PIXELS*(zoom)) / MINE_ZOOM_STEPS)
+
+/** Width (in pixels) of the board view when no limit has been set. */
+#define MINE_DEFAULT_VIEW_WIDTH  960
+/** Height (in pixels) of the board view when no limit has been set. */
+#define MINE_DEFAULT_VIEW_HEIGHT 720
+
+/** Number of milliseconds between board scrolling steps. */
+#define MINE_SCROLL_UPDATE_TIME 15
+/** Minimum number of pixels the board scrolls each step. */
+#define MINE_SCROLL_STEP_PIXELS 4
+/** Scrolling covers at least 1/MINE_SCROLL_CATCH_UP of the remaining distance each step. */
+#define MINE_SCROLL_CATCH_UP    4
 
 /** Numeric identifier indicating tile is unclicked. */
 #define MINE_TILE_STATUS_NORMAL   0
@@ -143,18 +174,32 @@
 
 /** Number of milliseconds in a second. */
 #define MINE_SECOND 1000
-/** Number of milliseconds in a quarter of a second. */
-#define MINE_QUARTER_SECOND 250
+/** Fewest milliseconds between movement ticks. */
+#define MINE_MOVEMENT_MIN_FREQ 20
 
 /** Default movement aggressiveness value. */
 #define MINE_MOVEMENT_DEFAULT_AGGRESSIVENESS 5
+/** Default number of mines moved each movement tick. */
+#define MINE_MOVEMENT_DEFAULT_BATCH 1
+/** Most mines moved in one movement tick. */
+#define MINE_MOVEMENT_MAX_BATCH 1024
+
+/** Movement policy that moves mines one tile in a random direction. */
+#define MINE_MOVEMENT_POLICY_WALK     0
+/** Movement policy that moves mines away from revealed tiles. */
+#define MINE_MOVEMENT_POLICY_FLEE     1
+/** Movement policy that moves mines toward the unflagged edge of the revealed area. */
+#define MINE_MOVEMENT_POLICY_FRONTIER 2
+/** Movement policy that jumps mines heavy tailed distances. */
+#define MINE_MOVEMENT_POLICY_LEVY     3
+/** Number of movement policies. */
+#define MINE_MOVEMENT_POLICIES        4
 
 /** Offset for returning a MINE_ERROR from a dialog window. */
 #define MINE_DIALOG_ERROR_OFFSET 200
 
 /** Macro to convert x and y grid position of tile into array index. */
-#define MINE_INDEX(x,y) (((((LONG)(x))+gameData.horzShift)%((LONG)gameData.width))+\
-   (((((LONG)(y))+gameData.vertShift)%((LONG)gameData.height))*((LONG)gameData.width)))
+#define MINE_INDEX(x,y) (((LONG)(x))+(((LONG)(y))*((LONG)gameData.width)))
 
 //--------------------------------------------------------------
 //    Enumerations
@@ -246,6 +291,14 @@ struct _MINE_GLOBAL_SETTINGS
     DWORD  movementFreq;
     /** Mine movement aggressiveness. */
     DWORD  movementAggressive;
+    /** Number of mines, or percentage of mines, moved each movement tick. */
+    DWORD  movementBatch;
+    /** Flag to determine if movementBatch is a percentage of the mines. */
+    DWORD  movementBatchPercent;
+    /** Mine movement policy (MINE_MOVEMENT_POLICY_*). */
+    DWORD  movementPolicy;
+    /** Flag to determine if mines only make moves that leave every revealed number unchanged. */
+    DWORD  movementConsistent;
 };
 
 struct _MINE_GAME_SETTINGS
@@ -264,6 +317,12 @@ struct _MINE_GAME_SETTINGS
     CHAR*     gameBoard;
     /** Array of board showing clicked/flagged status. */
     CHAR*     tileStatus;
+    /** Array of board indices of every mine, in no particular order. */
+    LONG*     mineTiles;
+    /** Array of board showing where in mineTiles each mine is listed (-1 if no mine). */
+    LONG*     mineSlots;
+    /** Worklist of revealed zero tiles whose neighbors are still to be uncovered. */
+    LONG*     cascadeTiles;
     /** Time (in seconds) game has been played. */
     UINT      time;
     /** Time (in milliseconds since computer start) of game start. */
@@ -272,10 +331,6 @@ struct _MINE_GAME_SETTINGS
     LONG      prevGridX;
     /** Y position (in grid coordinates) or last mouse press. */
     LONG      prevGridY;
-    /** Horizontal shift due to arrow key presses. */
-    LONG      horzShift;
-    /** Vertical shift due to arrow key presses. */
-    LONG      vertShift;
     /** Flag for if the game has been started. */
     BOOLEAN   gameStarted;
     /** Flag for if the game has been finished. */
@@ -310,36 +365,51 @@ struct _MINE_WINDOW_SETTINGS
     RECT  topBannerRegion;
     /** Location of game board. */
     RECT  boardRegion;
+    /** Location of board overview, empty when the whole board is in view. */
+    RECT  minimapRegion;
+    /** Largest width (in pixels) the board view may take up, 0 for MINE_DEFAULT_VIEW_WIDTH. */
+    LONG  maxViewWidth;
+    /** Largest height (in pixels) the board view may take up, 0 for MINE_DEFAULT_VIEW_HEIGHT. */
+    LONG  maxViewHeight;
+    /** Magnification of the board in zoom steps, from MINE_ZOOM_STEPS to
+        MINE_MAX_ZOOM*MINE_ZOOM_STEPS. */
+    LONG  zoom;
+    /** Size (in pixels) of a tile on screen. */
+    LONG  tilePixels;
+    /** Horizontal offset (in pixels) of the board as currently shown. */
+    LONG  scrollX;
+    /** Vertical offset (in pixels) of the board as currently shown. */
+    LONG  scrollY;
+    /** Horizontal offset (in pixels) the board is scrolling toward. */
+    LONG  targetX;
+    /** Vertical offset (in pixels) the board is scrolling toward. */
+    LONG  targetY;
 };
 
+#ifdef _WIN32
+struct _MINE_STARTUP_TIMES
+{
+    /** Performance counter ticks per second. */
+    LARGE_INTEGER frequency;
+    /** Performance counter when wWinMain was entered. */
+    LARGE_INTEGER mainCounter;
+    /** Time (in microseconds since the process was created) wWinMain was entered. */
+    ULONGLONG     mainTime;
+    /** Time (in microseconds since the process was created) settings were read. */
+    ULONGLONG     settingsTime;
+    /** Time (in microseconds since the process was created) the window was created. */
+    ULONGLONG     windowTime;
+    /** Time (in microseconds since the process was created) the first frame was
+        shown, 0 until then. */
+    ULONGLONG     firstFrameTime;
+};
+#endif /* _WIN32 */
+
 struct _MINE_IMAGE_STORAGE
 {
-    /** Images for timer numbers. */
-    HBITMAP timer[10];
-    /** Dash for negative remainng mine count. */
-    HBITMAP timerDash;
-    /** Normal smiley face. */
-    HBITMAP faceNormal;
-    /** Face when left mouse button is clicked. */
-    HBITMAP faceClicked;
-    /** Face when game has been won. */
-    HBITMAP faceWon;
-    /** Face when game has been lost. */
-    HBITMAP faceLost;
-    /** Images for numbers in game board. */
-    HBITMAP numbers[9];
-    /** Image for unclicked tile in game board. */
-    HBITMAP unclicked;
-    /** Image for tile that is being held. */
-    HBITMAP held;
-    /** Image for flagged tile. */
-    HBITMAP flag;
-    /** Image for a flag that was incorrectly placed. */
-    HBITMAP falseFlag;
-    /** Image for a mine when a game is lost. */
-    HBITMAP mine;
-    /** Image for a mine that was clicked. */
-    HBITMAP mineHit;
+    /** Atlas sprite used for each number in game board. Every number image set is
+        compiled into the atlas, so changing sets only rewrites this table. */
+    UINT numbers[9];
 };
 
 //--------------------------------------------------------------
@@ -359,25 +429,50 @@ typedef struct _MINE_GAME_SETTINGS MINE_GAME_SETTINGS;
 /** Location of regions in window. */
 typedef struct _MINE_WINDOW_SETTINGS MINE_WINDOW_SETTINGS;
 
-/** Structure containing handles to bitmaps. */
+/** Structure containing the sprite atlas and number sprite mapping. */
 typedef struct _MINE_IMAGE_STORAGE MINE_IMAGE_STORAGE;
 
+#ifdef _WIN32
+/** When each step of starting the program finished. */
+typedef struct _MINE_STARTUP_TIMES MINE_STARTUP_TIMES;
+#endif /* _WIN32 */
+
 //--------------------------------------------------------------
 //    Global Variable Externs
 //--------------------------------------------------------------
 
 extern MINE_GAME_SETTINGS   gameData;
-extern HINSTANCE            hInst;
-extern HWND                 hwnd;
 extern MINE_IMAGE_STORAGE   imageData;
 extern MINE_GLOBAL_SETTINGS menuData;
-extern BOOLEAN              movementTimerCreated;
 extern MINE_WINDOW_SETTINGS windowData;
 
+#ifdef _WIN32
+extern HINSTANCE            hInst;
+extern HWND                 hwnd;
+extern BOOLEAN              frameTimerCreated;
+extern BOOLEAN              scrollTimerCreated;
+extern MINE_STARTUP_TIMES   startupTimes;
+#endif /* _WIN32 */
+
 //--------------------------------------------------------------
 //    Function Prototypes
 //--------------------------------------------------------------
 
+/**
+    Mine_AllocBoard
+*//**
+    Carve the board arrays for a game of the current size out of the arena,
+    with room left over for the frontend's own per-tile buffers. All of them
+    start zeroed.
+
+    @param[in] scratchBytes - Number of extra bytes the caller will take from
+                              the arena with MineArena_Alloc.
+
+    @return Mine error code (MINE_ERROR_SUCCESS on success).
+*/
+MINE_ERROR
+Mine_AllocBoard(SIZE_T scratchBytes);
+
 /** 
     Mine_AssignNumbers
 *//**
@@ -415,6 +510,37 @@ Mine_Cleanup(VOID);
 BOOLEAN
 Mine_DoRectOverlap(_In_ PRECT pRect1, _In_ PRECT pRect2);
 
+#ifdef _WIN32
+/**
+    Mine_FitWindowToClient
+*//**
+    Resize the main window so its client area matches the size stored in windowData.
+
+    @return Mine error code (MINE_ERROR_SUCCESS on success).
+*/
+MINE_ERROR
+Mine_FitWindowToClient(VOID);
+
+/**
+    Mine_FlushDamage
+*//**
+    Draw everything damaged since the last frame into the frame, and mark the
+    same areas of the window to be copied from the frame on the next paint.
+
+    @return Mine error code (MINE_ERROR_SUCCESS on success).
+*/
+MINE_ERROR
+Mine_FlushDamage(VOID);
+#endif /* _WIN32 */
+
+/**
+    Mine_FreeBoard
+*//**
+    Give the board arrays and the arena they were carved from back at program close.
+*/
+VOID
+Mine_FreeBoard(VOID);
+
 /**
     Mine_GameWon
 *//**
@@ -423,6 +549,37 @@ Mine_DoRectOverlap(_In_ PRECT pRect1, _In_ PRECT pRect2);
 VOID
 Mine_GameWon(VOID);
 
+/**
+    Mine_GetGridRects
+*//**
+    Find where a block of tiles appears in the board view. A wrapped board can
+    show a block split across the edges of the view, so up to four rectangles
+    are needed.
+
+    @param[in]  xGridMin - Minimum x coordinate of block in grid.
+    @param[in]  xGridMax - Maximum x coordinate of block in grid.
+    @param[in]  yGridMin - Minimum y coordinate of block in grid.
+    @param[in]  yGridMax - Maximum y coordinate of block in grid.
+    @param[out] pRects   - Array of four rectangles, clipped to the board region.
+
+    @return Number of rectangles stored in pRects, 0 if the block is out of view.
+*/
+UINT
+Mine_GetGridRects(LONG xGridMin, LONG xGridMax, LONG yGridMin, LONG yGridMax,
+                  _Out_writes_(4) PRECT pRects);
+
+#ifdef _WIN32
+/**
+    Mine_GetStartupTime
+*//**
+    Read the time since the process was created.
+
+    @return Time in microseconds.
+*/
+ULONGLONG
+Mine_GetStartupTime(VOID);
+#endif /* _WIN32 */
+
 /**
     Mine_InitInstance
 *//**
@@ -448,16 +605,72 @@ Mine_InitInstance(int nCmdShow);
 BOOLEAN
 Mine_IsRectSubset(_In_ PRECT pBoundary, _In_ PRECT pRect);
 
+/**
+    Mine_JumpView
+*//**
+    Move the board view straight to a tile, centering it as far as the edges
+    of the board allow.
+
+    @param[in] xGrid - X coordinate of tile in grid.
+    @param[in] yGrid - Y coordinate of tile in grid.
+*/
+VOID
+Mine_JumpView(LONG xGrid, LONG yGrid);
+
+/**
+    Mine_LimitScroll
+*//**
+    Bring a scroll offset back onto the board. Wrapped directions go around the
+    board, other directions stop where the view reaches the edge of the board.
+
+    @param[in] offset - Scroll offset (in pixels).
+    @param[in] span   - Size (in pixels) of the board along the scroll direction.
+    @param[in] view   - Size (in pixels) of the view along the scroll direction.
+    @param[in] wrap   - Flag for if the board wraps along the scroll direction.
+
+    @return Scroll offset (in pixels) inside the board.
+*/
+LONG
+Mine_LimitScroll(LONG offset, LONG span, LONG view, BOOLEAN wrap);
+
+/**
+    Mine_MoveView
+*//**
+    Set the board view scrolling by a number of tiles. Wrapped directions go
+    around the board, other directions stop at its edges.
+
+    @param[in] xTiles - Number of tiles to scroll right, negative to scroll left.
+    @param[in] yTiles - Number of tiles to scroll down, negative to scroll up.
+
+    @return TRUE if the view needs to scroll to reach its new target. FALSE otherwise.
+*/
+BOOLEAN
+Mine_MoveView(LONG xTiles, LONG yTiles);
+
+/**
+    Mine_MoveMine
+*//**
+    Move a mine to a tile without one, keeping the list of mine positions
+    up to date. Numbers around either tile are not reassigned.
+
+    @param[in] fromIndex - Board index of the tile the mine is on.
+    @param[in] toIndex   - Board index of the tile to move the mine to.
+*/
+VOID
+Mine_MoveMine(LONG fromIndex, LONG toIndex);
+
 /**
     Mine_NewRandomBoard
 *//**
-    Assign the correct number of mines randomly to a new game board.
+    Assign the correct number of mines randomly to a new game board, and
+    list where they are in mineTiles and mineSlots.
 
     @return Mine error code (MINE_ERROR_SUCCESS on success).
 */
 MINE_ERROR
 Mine_NewRandomBoard(VOID);
 
+#ifdef _WIN32
 /**
     Mine_PaintScreen
 *//**
@@ -469,6 +682,7 @@ Mine_NewRandomBoard(VOID);
 */
 MINE_ERROR
 Mine_PaintScreen(_In_ HWND hwnd);
+#endif /* _WIN32 */
 
 /**
     Mine_PointInRect
@@ -484,6 +698,31 @@ Mine_PaintScreen(_In_ HWND hwnd);
 BOOLEAN
 Mine_PointInRect(short x, short y, _In_ PRECT pRect);
 
+/**
+    Mine_PointToGrid
+*//**
+    Find the tile under a point in the window, taking into account how far the
+    board is currently scrolled.
+
+    @param[in]  x      - X coordinate of point.
+    @param[in]  y      - Y coordinate of point.
+    @param[out] pxGrid - X coordinate of tile in grid.
+    @param[out] pyGrid - Y coordinate of tile in grid.
+
+    @return TRUE if point is on the game board. FALSE otherwise.
+*/
+BOOLEAN
+Mine_PointToGrid(short x, short y, _Out_ PLONG pxGrid, _Out_ PLONG pyGrid);
+
+/**
+    Mine_ProcessScroll
+*//**
+    Move the board one step closer to its scroll target and repaint it, stopping
+    the scroll timer once the target is reached.
+*/
+VOID
+Mine_ProcessScroll(VOID);
+
 /**
     Mine_ProcessTimer
 *//**
@@ -520,6 +759,17 @@ MINE_ERROR
 Mine_RandomPerm(_Inout_updates_to_(numArray, numPerm) PUINT pArray, 
                 UINT numArray, UINT numPerm);
 
+#ifdef _WIN32
+/**
+    Mine_RecordProcessStart
+*//**
+    Start the clock read by Mine_GetStartupTime, counting the time the process
+    spent loading before wWinMain was entered.
+*/
+VOID
+Mine_RecordProcessStart(VOID);
+#endif /* _WIN32 */
+
 /**
     Mine_RegisterClass
 *//**
@@ -530,6 +780,59 @@ Mine_RandomPerm(_Inout_updates_to_(numArray, numPerm) PUINT pArray,
 MINE_ERROR
 Mine_RegisterClass(VOID);
 
+#ifdef _WIN32
+/**
+    Mine_ReportStartup
+*//**
+    Log how long each step of starting the program took, warning if the first
+    frame was shown later than MINE_STARTUP_BUDGET.
+*/
+VOID
+Mine_ReportStartup(VOID);
+
+/**
+    Mine_ScheduleFrame
+*//**
+    Start the frame timer if anything has been damaged and no frame is already
+    waiting to be drawn. Nothing is scheduled before the window exists, its
+    first WM_PAINT draws everything.
+
+    @param[in] hWnd - Handle to the main window, NULL while it is being created.
+
+    @return Mine error code (MINE_ERROR_SUCCESS on success).
+*/
+MINE_ERROR
+Mine_ScheduleFrame(_In_opt_ HWND hWnd);
+#endif /* _WIN32 */
+
+/**
+    Mine_ScrollToward
+*//**
+    Advance a scroll offset one step toward its target. On a wrapped board it
+    goes whichever way around is shorter.
+
+    @param[in] current - Current offset (in pixels).
+    @param[in] target  - Target offset (in pixels).
+    @param[in] span    - Size (in pixels) of the board along the scroll direction.
+    @param[in] wrap    - Flag for if the board wraps along the scroll direction.
+
+    @return New offset (in pixels) in the range 0 to (span-1) inclusive.
+*/
+LONG
+Mine_ScrollToward(LONG current, LONG target, LONG span, BOOLEAN wrap);
+
+/**
+    Mine_SetZoom
+*//**
+    Change the magnification of the board, keeping the same tiles in view, and
+    lay the window out again.
+
+    @param[in] zoom - New magnification in zoom steps, limited to MINE_ZOOM_STEPS
+                      to MINE_MAX_ZOOM*MINE_ZOOM_STEPS.
+*/
+VOID
+Mine_SetZoom(LONG zoom);
+
 /**
     Mine_SetRegDword
 *//**
@@ -556,6 +859,32 @@ Mine_SetRegDword(_In_ LPWSTR pValueName, DWORD newValue);
 MINE_ERROR
 Mine_SetRegString(_In_ LPWSTR pValueName, _In_ LPWSTR pNewValue);
 
+#ifndef _WIN32
+/**
+    Mine_SeedRandom
+*//**
+    Restart the random number sequence so headless runs are repeatable.
+
+    @param[in] seed - Starting value for the random number generator.
+*/
+VOID
+Mine_SeedRandom(ULONGLONG seed);
+#endif /* _WIN32 */
+
+/**
+    Mine_SetTileStatus
+*//**
+    Change the status of a tile, pass the change on to the minimap and the
+    frontier, and mark whatever changed on screen to be redrawn. All changes to
+    tileStatus after a game is set up go through here.
+
+    @param[in] xGrid  - X coordinate of tile in grid.
+    @param[in] yGrid  - Y coordinate of tile in grid.
+    @param[in] status - New status of the tile (MINE_TILE_STATUS_*).
+*/
+VOID
+Mine_SetTileStatus(LONG xGrid, LONG yGrid, CHAR status);
+
 /**
     Mine_SetupGame
 *//**
@@ -576,20 +905,10 @@ Mine_SetupGame(VOID);
 MINE_ERROR
 Mine_SetupGlobal(VOID);
 
-/**
-    Mine_SetupImageData
-*//**
-    Load handles to images needed to draw window.
-
-    @return Mine error code (MINE_ERROR_SUCCESS upon success).
-*/
-MINE_ERROR
-Mine_SetupImageData(VOID);
-
 /**
     Mine_SetupNumberImageData
 *//**
-    Load handles to tile number images.
+    Map tile numbers to sprites in the atlas for the current number image mode.
 
     @return Mine error code (MINE_ERROR_SUCCESS upon success).
 */
@@ -599,11 +918,23 @@ Mine_SetupNumberImageData(VOID);
 /**
     Mine_SetupWindow
 *//**
-    Store information about the coordinates of window components.
+    Store information about the coordinates of window components. The board
+    view is sized to show as many whole tiles as fit within the view limits.
 */
 VOID
 Mine_SetupWindow(VOID);
 
+/**
+    Mine_StepScroll
+*//**
+    Move the scroll offsets of the board one step toward their targets.
+
+    @return TRUE if the board still needs to scroll further. FALSE otherwise.
+*/
+BOOLEAN
+Mine_StepScroll(VOID);
+
+#ifdef _WIN32
 /**
     WndProc
 *//**
@@ -617,4 +948,5 @@ Mine_SetupWindow(VOID);
     @return Return value depends on message that was processed.
 */
 LRESULT CALLBACK 
-WndProc(_In_ HWND hWnd, UINT message, WPARAM wParam, LPARAM lParam);
\ No newline at end of file
+WndProc(_In_ HWND hWnd, UINT message, WPARAM wParam, LPARAM lParam);
+#endif /* _WIN32 */
@@ -0,0 +1,147 @@
+/**
+    @file MineArena.cpp
+
+    @author Craig Burkhart
+
+    @brief Per-game arena, one block of memory that all board arrays and game
+           scratch buffers are carved out of. It is reset rather than freed
+           between games, so play makes no calls to the process heap.
+*//*
+    Copyright (C) 2014 - Craig Burkhart
+
+    This file is part of Minesweeper Deluxe.
+
+    Minesweeper Deluxe is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Minesweeper Deluxe is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Minesweeper Deluxe.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#include "stdafx.h"
+#include "MineArena.h"
+#include "MineDebug.h"
+
+// Global Variables:
+MINE_ARENA_DATA arenaData = {0};
+
+/**
+    MineArena_Alloc
+*//**
+    Hand out a zeroed block from the arena. Blocks stay valid until the next
+    reset, and are never freed one at a time.
+
+    @param[in] bytes - Number of bytes needed.
+
+    @return Pointer to the block, NULL if the arena was sized too small.
+*/
+PVOID
+MineArena_Alloc(SIZE_T bytes)
+{
+    PVOID pBlock = NULL;
+
+    if (MINE_ARENA_BYTES(bytes) > arenaData.capacity - arenaData.used)
+    {
+        MineDebug_PrintError("Arena has %u bytes left, %u needed\n",
+                             (UINT) (arenaData.capacity - arenaData.used), (UINT) bytes);
+    }
+    else
+    {
+        pBlock = arenaData.pBase + arenaData.used;
+        arenaData.used += MINE_ARENA_BYTES(bytes);
+        arenaData.blocks++;
+
+        ZeroMemory(pBlock, bytes);
+    }
+
+    return pBlock;
+}
+
+/**
+    MineArena_Cleanup
+*//**
+    Give the arena memory back to the process heap at program close.
+*/
+VOID
+MineArena_Cleanup(VOID)
+{
+    HANDLE hHeap = GetProcessHeap();
+
+    if ((NULL != hHeap) && (NULL != arenaData.pBase))
+    {
+        if (0 == HeapFree(hHeap, 0, arenaData.pBase))
+        {
+            MineDebug_PrintWarning("Unable to free arena: %lu\n", GetLastError());
+        }
+        arenaData.heapFrees++;
+    }
+
+    arenaData.pBase = NULL;
+    arenaData.capacity = 0;
+    arenaData.used = 0;
+
+    return;
+}
+
+/**
+    MineArena_Reset
+*//**
+    Start handing out blocks from the beginning of the arena again. Memory is
+    only taken from the process heap when the arena is smaller than needed,
+    so new games of the same size or smaller make no heap calls.
+
+    @param[in] bytes - Number of bytes the new game will use, each block
+                       rounded up with MINE_ARENA_BYTES.
+
+    @return Mine error code (MINE_ERROR_SUCCESS upon success).
+*/
+MINE_ERROR
+MineArena_Reset(SIZE_T bytes)
+{
+    BOOLEAN    bFalse = FALSE;
+    HANDLE     hHeap = NULL;
+    MINE_ERROR status = MINE_ERROR_SUCCESS;
+
+    do
+    {
+        arenaData.used = 0;
+        arenaData.resets++;
+
+        if (bytes <= arenaData.capacity)
+        {
+            break;
+        }
+
+        hHeap = GetProcessHeap();
+        if (NULL == hHeap)
+        {
+            MineDebug_PrintError("Getting process heap: %lu\n", GetLastError());
+            status = MINE_ERROR_HEAP;
+            break;
+        }
+
+        /** Grow to fit the larger game. Nothing handed out before the reset is kept. */
+        MineArena_Cleanup();
+
+        arenaData.pBase = (BYTE*) HeapAlloc(hHeap, 0, bytes);
+        if (NULL == arenaData.pBase)
+        {
+            MineDebug_PrintError("Allocating %u bytes for arena\n", (UINT) bytes);
+            status = MINE_ERROR_MEMORY;
+            break;
+        }
+
+        arenaData.capacity = bytes;
+        arenaData.heapAllocs++;
+
+        __assume(FALSE == bFalse);
+    } while (bFalse);
+
+    return status;
+}
@@ -0,0 +1,113 @@
+/**
+    @file MineArena.h
+
+    @author Craig Burkhart
+
+    @brief Header file for the per-game arena, one block of memory that all
+           board arrays and game scratch buffers are carved out of.
+*//*
+    Copyright (C) 2014 - Craig Burkhart
+
+    This file is part of Minesweeper Deluxe.
+
+    Minesweeper Deluxe is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Minesweeper Deluxe is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Minesweeper Deluxe.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#pragma once
+
+#include "Mine.h"
+
+//--------------------------------------------------------------
+//    Macros
+//--------------------------------------------------------------
+
+/** Alignment (in bytes) of every block handed out by the arena. */
+#define MINE_ARENA_ALIGN 16
+
+/** Number of bytes a block of the given size takes up in the arena. */
+#define MINE_ARENA_BYTES(bytes) ((((SIZE_T) (bytes)) + (MINE_ARENA_ALIGN - 1)) & ~((SIZE_T) (MINE_ARENA_ALIGN - 1)))
+
+//--------------------------------------------------------------
+//    Structures
+//--------------------------------------------------------------
+
+struct _MINE_ARENA_DATA
+{
+    /** Memory the blocks are carved out of. */
+    BYTE*     pBase;
+    /** Number of bytes in pBase. */
+    SIZE_T    capacity;
+    /** Number of bytes handed out since the last reset. */
+    SIZE_T    used;
+    /** Number of times the arena was reset for a new game. */
+    UINT      resets;
+    /** Number of blocks handed out since the program started. */
+    ULONGLONG blocks;
+    /** Number of times memory was taken from the process heap. */
+    UINT      heapAllocs;
+    /** Number of times memory was given back to the process heap. */
+    UINT      heapFrees;
+};
+
+//--------------------------------------------------------------
+//    Typedefs
+//--------------------------------------------------------------
+
+/** Memory for the board arrays and scratch buffers of the current game. */
+typedef struct _MINE_ARENA_DATA MINE_ARENA_DATA;
+
+//--------------------------------------------------------------
+//    Global Variable Externs
+//--------------------------------------------------------------
+
+extern MINE_ARENA_DATA arenaData;
+
+//--------------------------------------------------------------
+//    Function Prototypes
+//--------------------------------------------------------------
+
+/**
+    MineArena_Alloc
+*//**
+    Hand out a zeroed block from the arena. Blocks stay valid until the next
+    reset, and are never freed one at a time.
+
+    @param[in] bytes - Number of bytes needed.
+
+    @return Pointer to the block, NULL if the arena was sized too small.
+*/
+PVOID
+MineArena_Alloc(SIZE_T bytes);
+
+/**
+    MineArena_Cleanup
+*//**
+    Give the arena memory back to the process heap at program close.
+*/
+VOID
+MineArena_Cleanup(VOID);
+
+/**
+    MineArena_Reset
+*//**
+    Start handing out blocks from the beginning of the arena again. Memory is
+    only taken from the process heap when the arena is smaller than needed,
+    so new games of the same size or smaller make no heap calls.
+
+    @param[in] bytes - Number of bytes the new game will use, each block
+                       rounded up with MINE_ARENA_BYTES.
+
+    @return Mine error code (MINE_ERROR_SUCCESS upon success).
+*/
+MINE_ERROR
+MineArena_Reset(SIZE_T bytes);
@@ -0,0 +1,3649 @@
+/**
+    @file MineAtlasData.h
+
+    @author Craig Burkhart
+
+    @brief Sprite atlas pixels generated by mineatlasgen from the sprite BMP
+           files. Do not edit, run make atlas after changing a BMP file.
+*//*
+    Copyright (C) 2014 - Craig Burkhart
+
+    This file is part of Minesweeper Deluxe.
+
+    Minesweeper Deluxe is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Minesweeper Deluxe is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Minesweeper Deluxe.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#pragma once
+
+#include "MineSprite.h"
+
+/** Sprite atlas pixels (0x00RRGGBB), MINE_ATLAS_WIDTH pixels per row. */
+static const UINT32 mineAtlasPixels[MINE_ATLAS_WIDTH*MINE_ATLAS_HEIGHT] =
+{
+    0x00FFFFFF, 0x00FFFFFF, 0x00FFFFFF, 0x00FFFFFF, 0x00FFFFFF, 0x00FFFFFF, 0x00FFFFFF, 0x00FFFFFF,
+    0x00FFFFFF, 0x00FFFFFF, 0x00FFFFFF, 0x00FFFFFF, 0x00FFFFFF, 0x00FFFFFF, 0x00FFFFFF, 0x00C0C0C0,
+    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+    0x00FFFFFF, 0x00FFFFFF, 0x00FFFFFF, 0x00FFFFFF, 0x00FFFFFF, 0x00FFFFFF, 0x00FFFFFF, 0x00FFFFFF,
+    0x00FFFFFF, 0x00FFFFFF, 0x00FFFFFF, 0x00FFFFFF, 0x00FFFFFF, 0x00FFFFFF, 0x00FFFFFF, 0x00C0C0C0,
+    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00FFFFFF, 0x00FFFFFF, 0x00FFFFFF, 0x00FFFFFF, 0x00FFFFFF, 0x00FFFFFF, 0x00FFFFFF, 0x00FFFFFF,
+    0x00FFFFFF, 0x00FFFFFF, 0x00FFFFFF, 0x00FFFFFF, 0x00FFFFFF, 0x00FFFFFF, 0x00C0C0C0, 0x00808080,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00FFFFFF, 0x00FFFFFF, 0x00FFFFFF, 0x00FFFFFF, 0x00FFFFFF, 0x00FFFFFF, 0x00FFFFFF, 0x00FFFFFF,
+    0x00FFFFFF, 0x00FFFFFF, 0x00FFFFFF, 0x00FFFFFF, 0x00FFFFFF, 0x00FFFFFF, 0x00C0C0C0, 0x00808080,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000,
+    0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00FFFFFF, 0x00FFFFFF, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00808080, 0x00808080,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00FFFFFF, 0x00FFFFFF, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00808080, 0x00808080,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00000000, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00000000, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000,
+    0x00000000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00FFFFFF, 0x00FFFFFF, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00808080, 0x00808080,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00FFFFFF, 0x00FFFFFF, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00FF0000,
+    0x00FF0000, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00808080, 0x00808080,
+    0x00808080, 0x00C0C0C0, 0x00FF0000, 0x00FF0000, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00000000, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00FF0000, 0x00FF0000, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00000000, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000,
+    0x00000000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00FFFFFF, 0x00FFFFFF, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00808080, 0x00808080,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00FFFFFF, 0x00FFFFFF, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00FF0000, 0x00FF0000, 0x00FF0000,
+    0x00FF0000, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00808080, 0x00808080,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00FF0000, 0x00FF0000, 0x00C0C0C0, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00C0C0C0, 0x00FF0000, 0x00FF0000, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00000000, 0x00C0C0C0, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00C0C0C0, 0x00000000, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00000000, 0x00FF0000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00FF0000, 0x00000000, 0x00FF0000, 0x00FF0000, 0x00FF0000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00FFFFFF, 0x00FFFFFF, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00808080, 0x00808080,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00FFFFFF, 0x00FFFFFF, 0x00C0C0C0, 0x00C0C0C0, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000,
+    0x00FF0000, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00808080, 0x00808080,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00FF0000, 0x00FF0000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00FF0000, 0x00FF0000, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00FFFFFF, 0x00FFFFFF, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00808080, 0x00808080,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00FFFFFF, 0x00FFFFFF, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00FF0000, 0x00FF0000, 0x00FF0000,
+    0x00FF0000, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00808080, 0x00808080,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00000000, 0x00FF0000, 0x00FF0000, 0x00FFFFFF,
+    0x00000000, 0x00000000, 0x00FF0000, 0x00FF0000, 0x00000000, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00000000, 0x00000000, 0x00FFFFFF, 0x00FFFFFF,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00000000, 0x00000000, 0x00FFFFFF, 0x00FFFFFF,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00FF0000, 0x00FF0000, 0x00FF0000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00FFFFFF, 0x00FFFFFF, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00808080, 0x00808080,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00FFFFFF, 0x00FFFFFF, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00FF0000,
+    0x00FF0000, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00808080, 0x00808080,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00000000, 0x00000000, 0x00FF0000, 0x00FF0000,
+    0x00000000, 0x00FF0000, 0x00FF0000, 0x00000000, 0x00000000, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00000000, 0x00000000, 0x00FFFFFF, 0x00FFFFFF,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00000000, 0x00000000, 0x00FFFFFF, 0x00FFFFFF,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00FF0000, 0x00FF0000, 0x00FF0000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00FFFFFF, 0x00FFFFFF, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00808080, 0x00808080,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00FFFFFF, 0x00FFFFFF, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00000000, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00808080, 0x00808080,
+    0x00808080, 0x00C0C0C0, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00FF0000,
+    0x00FF0000, 0x00FF0000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00C0C0C0,
+    0x00808080, 0x00FF0000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00FF0000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00FFFFFF, 0x00FFFFFF, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00808080, 0x00808080,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00FFFFFF, 0x00FFFFFF, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00000000, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00808080, 0x00808080,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00000000, 0x00000000, 0x00000000, 0x00FF0000,
+    0x00FF0000, 0x00FF0000, 0x00000000, 0x00000000, 0x00000000, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00FF0000, 0x00FF0000, 0x00FF0000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00FFFFFF, 0x00FFFFFF, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00808080, 0x00808080,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00FFFFFF, 0x00FFFFFF, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00808080, 0x00808080,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00000000, 0x00000000, 0x00FF0000, 0x00FF0000,
+    0x00000000, 0x00FF0000, 0x00FF0000, 0x00000000, 0x00000000, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00FF0000, 0x00FF0000, 0x00FF0000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00FFFFFF, 0x00FFFFFF, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00808080, 0x00808080,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00FFFFFF, 0x00FFFFFF, 0x00C0C0C0, 0x00C0C0C0, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00C0C0C0, 0x00C0C0C0, 0x00808080, 0x00808080,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00FF0000, 0x00FF0000, 0x00000000,
+    0x00000000, 0x00000000, 0x00FF0000, 0x00FF0000, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00FFFFFF, 0x00FFFFFF, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00808080, 0x00808080,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00FFFFFF, 0x00FFFFFF, 0x00C0C0C0, 0x00C0C0C0, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00C0C0C0, 0x00C0C0C0, 0x00808080, 0x00808080,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00FF0000, 0x00FF0000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00FF0000, 0x00FF0000, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00000000, 0x00C0C0C0, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00C0C0C0, 0x00000000, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00000000, 0x00FF0000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00FF0000, 0x00000000, 0x00FF0000, 0x00FF0000, 0x00FF0000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00FFFFFF, 0x00FFFFFF, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00808080, 0x00808080,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00FFFFFF, 0x00FFFFFF, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00808080, 0x00808080,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00FF0000, 0x00FF0000, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00000000, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00FF0000, 0x00FF0000, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00000000, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000,
+    0x00000000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00FFFFFF, 0x00C0C0C0, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00FFFFFF, 0x00C0C0C0, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+    0x00808080, 0x00C0C0C0, 0x00FF0000, 0x00FF0000, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00000000, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00FF0000, 0x00FF0000, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00000000, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000,
+    0x00000000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00C0C0C0, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000,
+    0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x000000FF, 0x000000FF, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00008000, 0x00008000, 0x00008000, 0x00008000,
+    0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000,
+    0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00000080, 0x00000080, 0x00000080,
+    0x00C0C0C0, 0x00000080, 0x00000080, 0x00000080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00800000,
+    0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00008080, 0x00008080, 0x00008080, 0x00008080,
+    0x00008080, 0x00008080, 0x00008080, 0x00008080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x000000FF,
+    0x000000FF, 0x000000FF, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000,
+    0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000,
+    0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00000080, 0x00000080, 0x00000080,
+    0x00C0C0C0, 0x00000080, 0x00000080, 0x00000080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00800000,
+    0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00008080, 0x00008080, 0x00008080, 0x00008080, 0x00008080,
+    0x00008080, 0x00008080, 0x00008080, 0x00008080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x000000FF, 0x000000FF,
+    0x000000FF, 0x000000FF, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00008000, 0x00008000, 0x00008000, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00008000, 0x00008000, 0x00008000, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00000080, 0x00000080, 0x00000080, 0x00C0C0C0,
+    0x00C0C0C0, 0x00000080, 0x00000080, 0x00000080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00800000, 0x00800000, 0x00800000, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00008080, 0x00008080, 0x00008080, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00000000, 0x00000000, 0x00000000, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00808080, 0x00808080, 0x00808080, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00808080, 0x00808080, 0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x000000FF, 0x000000FF, 0x000000FF,
+    0x000000FF, 0x000000FF, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00008000, 0x00008000, 0x00008000, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00000080, 0x00000080, 0x00000080, 0x00C0C0C0,
+    0x00C0C0C0, 0x00000080, 0x00000080, 0x00000080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00800000, 0x00800000, 0x00800000, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00008080, 0x00008080, 0x00008080, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00000000, 0x00000000, 0x00000000, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00808080, 0x00808080, 0x00808080, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00808080, 0x00808080, 0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x000000FF,
+    0x000000FF, 0x000000FF, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00FF0000, 0x00FF0000,
+    0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00000080, 0x00000080, 0x00000080, 0x00000080, 0x00000080,
+    0x00000080, 0x00000080, 0x00000080, 0x00000080, 0x00000080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00800000,
+    0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00008080, 0x00008080, 0x00008080, 0x00008080, 0x00008080,
+    0x00008080, 0x00008080, 0x00008080, 0x00008080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00000000, 0x00000000, 0x00000000, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x000000FF,
+    0x000000FF, 0x000000FF, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00008000, 0x00008000,
+    0x00008000, 0x00008000, 0x00008000, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00FF0000, 0x00FF0000,
+    0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00000080, 0x00000080, 0x00000080, 0x00000080, 0x00000080,
+    0x00000080, 0x00000080, 0x00000080, 0x00000080, 0x00000080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00800000,
+    0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00008080, 0x00008080, 0x00008080, 0x00008080, 0x00008080,
+    0x00008080, 0x00008080, 0x00008080, 0x00008080, 0x00008080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00000000, 0x00000000, 0x00000000, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x000000FF,
+    0x000000FF, 0x000000FF, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00008000, 0x00008000, 0x00008000, 0x00008000,
+    0x00008000, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00000080, 0x00000080, 0x00000080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00800000, 0x00800000, 0x00800000, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00008080, 0x00008080, 0x00008080, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00008080, 0x00008080, 0x00008080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00000000, 0x00000000, 0x00000000, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00808080, 0x00808080, 0x00808080, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00808080, 0x00808080, 0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x000000FF,
+    0x000000FF, 0x000000FF, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00000080, 0x00000080, 0x00000080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00800000, 0x00800000, 0x00800000, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00008080, 0x00008080, 0x00008080, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00008080, 0x00008080, 0x00008080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00000000, 0x00000000, 0x00000000, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00808080, 0x00808080, 0x00808080, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00808080, 0x00808080, 0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x000000FF, 0x000000FF, 0x000000FF,
+    0x000000FF, 0x000000FF, 0x000000FF, 0x000000FF, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000,
+    0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000,
+    0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00000080, 0x00000080, 0x00000080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00800000,
+    0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00008080, 0x00008080, 0x00008080, 0x00008080, 0x00008080,
+    0x00008080, 0x00008080, 0x00008080, 0x00008080, 0x00008080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00000000,
+    0x00000000, 0x00000000, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x000000FF, 0x000000FF, 0x000000FF,
+    0x000000FF, 0x000000FF, 0x000000FF, 0x000000FF, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000,
+    0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000,
+    0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00000080, 0x00000080, 0x00000080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00800000,
+    0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00008080, 0x00008080, 0x00008080, 0x00008080,
+    0x00008080, 0x00008080, 0x00008080, 0x00008080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00000000,
+    0x00000000, 0x00000000, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x000000FF, 0x000000FF, 0x000000FF, 0x000000FF, 0x000000FF, 0x000000FF, 0x000000FF,
+    0x000000FF, 0x000000FF, 0x000000FF, 0x000000FF, 0x000000FF, 0x000000FF, 0x000000FF, 0x000000FF,
+    0x00808080, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000,
+    0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000,
+    0x00808080, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000,
+    0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000,
+    0x00808080, 0x00000080, 0x00000080, 0x00000080, 0x00000080, 0x00000080, 0x00000080, 0x00000080,
+    0x00000080, 0x00000080, 0x00000080, 0x00000080, 0x00000080, 0x00000080, 0x00000080, 0x00000080,
+    0x00808080, 0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00800000,
+    0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00800000,
+    0x00808080, 0x00008080, 0x00008080, 0x00008080, 0x00008080, 0x00008080, 0x00008080, 0x00008080,
+    0x00008080, 0x00008080, 0x00008080, 0x00008080, 0x00008080, 0x00008080, 0x00008080, 0x00008080,
+    0x00808080, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x000000FF, 0x000000FF, 0x000000FF, 0x000000FF, 0x000000FF, 0x000000FF, 0x000000FF,
+    0x000000FF, 0x000000FF, 0x000000FF, 0x000000FF, 0x000000FF, 0x000000FF, 0x000000FF, 0x000000FF,
+    0x00808080, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000,
+    0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000,
+    0x00808080, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000,
+    0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000,
+    0x00808080, 0x00000080, 0x00000080, 0x00000080, 0x00000080, 0x00000080, 0x00000080, 0x00000080,
+    0x00000080, 0x00000080, 0x00000080, 0x00000080, 0x00000080, 0x00000080, 0x00000080, 0x00000080,
+    0x00808080, 0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00800000,
+    0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00800000,
+    0x00808080, 0x00008080, 0x00008080, 0x00008080, 0x00008080, 0x00008080, 0x00008080, 0x00008080,
+    0x00008080, 0x00008080, 0x00008080, 0x00008080, 0x00008080, 0x00008080, 0x00008080, 0x00008080,
+    0x00808080, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x000000FF, 0x000000FF, 0x000000FF, 0x000000FF, 0x000000FF, 0x000000FF, 0x000000FF,
+    0x000000FF, 0x000000FF, 0x000000FF, 0x000000FF, 0x000000FF, 0x000000FF, 0x000000FF, 0x000000FF,
+    0x00808080, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000,
+    0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000,
+    0x00808080, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000,
+    0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000,
+    0x00808080, 0x00000080, 0x00000080, 0x00000080, 0x00000080, 0x00000080, 0x00000080, 0x00000080,
+    0x00000080, 0x00000080, 0x00000080, 0x00000080, 0x00000080, 0x00000080, 0x00000080, 0x00000080,
+    0x00808080, 0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00800000,
+    0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00800000,
+    0x00808080, 0x00008080, 0x00008080, 0x00008080, 0x00008080, 0x00008080, 0x00008080, 0x00008080,
+    0x00008080, 0x00008080, 0x00008080, 0x00008080, 0x00008080, 0x00008080, 0x00008080, 0x00008080,
+    0x00808080, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x000000FF, 0x000000FF, 0x000000FF, 0x000000FF, 0x000000FF, 0x000000FF, 0x000000FF,
+    0x000000FF, 0x000000FF, 0x000000FF, 0x000000FF, 0x000000FF, 0x000000FF, 0x000000FF, 0x000000FF,
+    0x00808080, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000,
+    0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000,
+    0x00808080, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000,
+    0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000,
+    0x00808080, 0x00000080, 0x00000080, 0x00000080, 0x00000080, 0x00000080, 0x00000080, 0x00000080,
+    0x00000080, 0x00000080, 0x00000080, 0x00000080, 0x00000080, 0x00000080, 0x00000080, 0x00000080,
+    0x00808080, 0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00800000,
+    0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00800000,
+    0x00808080, 0x00008080, 0x00008080, 0x00008080, 0x00008080, 0x00008080, 0x00008080, 0x00008080,
+    0x00008080, 0x00008080, 0x00008080, 0x00008080, 0x00008080, 0x00008080, 0x00008080, 0x00008080,
+    0x00808080, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x000000FF, 0x000000FF, 0x000000FF, 0x000000FF, 0x000000FF, 0x000000FF, 0x000000FF,
+    0x000000FF, 0x000000FF, 0x000000FF, 0x000000FF, 0x000000FF, 0x000000FF, 0x000000FF, 0x000000FF,
+    0x00808080, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000,
+    0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000,
+    0x00808080, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000,
+    0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000,
+    0x00808080, 0x00000080, 0x00000080, 0x00000080, 0x00000080, 0x00000080, 0x00000080, 0x00000080,
+    0x00000080, 0x00000080, 0x00000080, 0x00000080, 0x00000080, 0x00000080, 0x00000080, 0x00000080,
+    0x00808080, 0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00800000,
+    0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00800000,
+    0x00808080, 0x00008080, 0x00008080, 0x00008080, 0x00008080, 0x00008080, 0x00008080, 0x00008080,
+    0x00008080, 0x00008080, 0x00008080, 0x00008080, 0x00008080, 0x00008080, 0x00008080, 0x00008080,
+    0x00808080, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x000000FF, 0x000000FF, 0x000000FF, 0x000000FF, 0x000000FF, 0x000000FF, 0x000000FF,
+    0x000000FF, 0x000000FF, 0x000000FF, 0x000000FF, 0x000000FF, 0x000000FF, 0x000000FF, 0x000000FF,
+    0x00808080, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000,
+    0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000,
+    0x00808080, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000,
+    0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000,
+    0x00808080, 0x00000080, 0x00000080, 0x00000080, 0x00000080, 0x00000080, 0x00000080, 0x00000080,
+    0x00000080, 0x00000080, 0x00000080, 0x00000080, 0x00000080, 0x00000080, 0x00000080, 0x00000080,
+    0x00808080, 0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00800000,
+    0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00800000,
+    0x00808080, 0x00008080, 0x00008080, 0x00008080, 0x00008080, 0x00008080, 0x00008080, 0x00008080,
+    0x00008080, 0x00008080, 0x00008080, 0x00008080, 0x00008080, 0x00008080, 0x00008080, 0x00008080,
+    0x00808080, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x000000FF, 0x000000FF, 0x000000FF, 0x000000FF, 0x000000FF, 0x000000FF, 0x000000FF,
+    0x000000FF, 0x000000FF, 0x000000FF, 0x000000FF, 0x000000FF, 0x000000FF, 0x000000FF, 0x000000FF,
+    0x00808080, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000,
+    0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000,
+    0x00808080, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000,
+    0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000,
+    0x00808080, 0x00000080, 0x00000080, 0x00000080, 0x00000080, 0x00000080, 0x00000080, 0x00000080,
+    0x00000080, 0x00000080, 0x00000080, 0x00000080, 0x00000080, 0x00000080, 0x00000080, 0x00000080,
+    0x00808080, 0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00800000,
+    0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00800000,
+    0x00808080, 0x00008080, 0x00008080, 0x00008080, 0x00008080, 0x00008080, 0x00008080, 0x00008080,
+    0x00008080, 0x00008080, 0x00008080, 0x00008080, 0x00008080, 0x00008080, 0x00008080, 0x00008080,
+    0x00808080, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x000000FF, 0x000000FF, 0x000000FF, 0x000000FF, 0x000000FF, 0x000000FF, 0x000000FF,
+    0x000000FF, 0x000000FF, 0x000000FF, 0x000000FF, 0x000000FF, 0x000000FF, 0x000000FF, 0x000000FF,
+    0x00808080, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000,
+    0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000,
+    0x00808080, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000,
+    0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000,
+    0x00808080, 0x00000080, 0x00000080, 0x00000080, 0x00000080, 0x00000080, 0x00000080, 0x00000080,
+    0x00000080, 0x00000080, 0x00000080, 0x00000080, 0x00000080, 0x00000080, 0x00000080, 0x00000080,
+    0x00808080, 0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00800000,
+    0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00800000,
+    0x00808080, 0x00008080, 0x00008080, 0x00008080, 0x00008080, 0x00008080, 0x00008080, 0x00008080,
+    0x00008080, 0x00008080, 0x00008080, 0x00008080, 0x00008080, 0x00008080, 0x00008080, 0x00008080,
+    0x00808080, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x000000FF, 0x000000FF, 0x000000FF, 0x000000FF, 0x000000FF, 0x000000FF, 0x000000FF,
+    0x000000FF, 0x000000FF, 0x000000FF, 0x000000FF, 0x000000FF, 0x000000FF, 0x000000FF, 0x000000FF,
+    0x00808080, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000,
+    0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000,
+    0x00808080, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000,
+    0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000,
+    0x00808080, 0x00000080, 0x00000080, 0x00000080, 0x00000080, 0x00000080, 0x00000080, 0x00000080,
+    0x00000080, 0x00000080, 0x00000080, 0x00000080, 0x00000080, 0x00000080, 0x00000080, 0x00000080,
+    0x00808080, 0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00800000,
+    0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00800000,
+    0x00808080, 0x00008080, 0x00008080, 0x00008080, 0x00008080, 0x00008080, 0x00008080, 0x00008080,
+    0x00008080, 0x00008080, 0x00008080, 0x00008080, 0x00008080, 0x00008080, 0x00008080, 0x00008080,
+    0x00808080, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x000000FF, 0x000000FF, 0x000000FF, 0x000000FF, 0x000000FF, 0x000000FF, 0x000000FF,
+    0x000000FF, 0x000000FF, 0x000000FF, 0x000000FF, 0x000000FF, 0x000000FF, 0x000000FF, 0x000000FF,
+    0x00808080, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000,
+    0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000,
+    0x00808080, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000,
+    0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000,
+    0x00808080, 0x00000080, 0x00000080, 0x00000080, 0x00000080, 0x00000080, 0x00000080, 0x00000080,
+    0x00000080, 0x00000080, 0x00000080, 0x00000080, 0x00000080, 0x00000080, 0x00000080, 0x00000080,
+    0x00808080, 0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00800000,
+    0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00800000,
+    0x00808080, 0x00008080, 0x00008080, 0x00008080, 0x00008080, 0x00008080, 0x00008080, 0x00008080,
+    0x00008080, 0x00008080, 0x00008080, 0x00008080, 0x00008080, 0x00008080, 0x00008080, 0x00008080,
+    0x00808080, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x000000FF, 0x000000FF, 0x000000FF, 0x000000FF, 0x000000FF, 0x000000FF, 0x000000FF,
+    0x000000FF, 0x000000FF, 0x000000FF, 0x000000FF, 0x000000FF, 0x000000FF, 0x000000FF, 0x000000FF,
+    0x00808080, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000,
+    0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000,
+    0x00808080, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000,
+    0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000,
+    0x00808080, 0x00000080, 0x00000080, 0x00000080, 0x00000080, 0x00000080, 0x00000080, 0x00000080,
+    0x00000080, 0x00000080, 0x00000080, 0x00000080, 0x00000080, 0x00000080, 0x00000080, 0x00000080,
+    0x00808080, 0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00800000,
+    0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00800000,
+    0x00808080, 0x00008080, 0x00008080, 0x00008080, 0x00008080, 0x00008080, 0x00008080, 0x00008080,
+    0x00008080, 0x00008080, 0x00008080, 0x00008080, 0x00008080, 0x00008080, 0x00008080, 0x00008080,
+    0x00808080, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x000000FF, 0x000000FF, 0x000000FF, 0x000000FF, 0x000000FF, 0x000000FF, 0x000000FF,
+    0x000000FF, 0x000000FF, 0x000000FF, 0x000000FF, 0x000000FF, 0x000000FF, 0x000000FF, 0x000000FF,
+    0x00808080, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000,
+    0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000,
+    0x00808080, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000,
+    0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000,
+    0x00808080, 0x00000080, 0x00000080, 0x00000080, 0x00000080, 0x00000080, 0x00000080, 0x00000080,
+    0x00000080, 0x00000080, 0x00000080, 0x00000080, 0x00000080, 0x00000080, 0x00000080, 0x00000080,
+    0x00808080, 0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00800000,
+    0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00800000,
+    0x00808080, 0x00008080, 0x00008080, 0x00008080, 0x00008080, 0x00008080, 0x00008080, 0x00008080,
+    0x00008080, 0x00008080, 0x00008080, 0x00008080, 0x00008080, 0x00008080, 0x00008080, 0x00008080,
+    0x00808080, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x000000FF, 0x000000FF, 0x000000FF, 0x000000FF, 0x000000FF, 0x000000FF, 0x000000FF,
+    0x000000FF, 0x000000FF, 0x000000FF, 0x000000FF, 0x000000FF, 0x000000FF, 0x000000FF, 0x000000FF,
+    0x00808080, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000,
+    0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000,
+    0x00808080, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000,
+    0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000,
+    0x00808080, 0x00000080, 0x00000080, 0x00000080, 0x00000080, 0x00000080, 0x00000080, 0x00000080,
+    0x00000080, 0x00000080, 0x00000080, 0x00000080, 0x00000080, 0x00000080, 0x00000080, 0x00000080,
+    0x00808080, 0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00800000,
+    0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00800000,
+    0x00808080, 0x00008080, 0x00008080, 0x00008080, 0x00008080, 0x00008080, 0x00008080, 0x00008080,
+    0x00008080, 0x00008080, 0x00008080, 0x00008080, 0x00008080, 0x00008080, 0x00008080, 0x00008080,
+    0x00808080, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x000000FF, 0x000000FF, 0x000000FF, 0x000000FF, 0x000000FF, 0x000000FF, 0x000000FF,
+    0x000000FF, 0x000000FF, 0x000000FF, 0x000000FF, 0x000000FF, 0x000000FF, 0x000000FF, 0x000000FF,
+    0x00808080, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000,
+    0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000,
+    0x00808080, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000,
+    0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000,
+    0x00808080, 0x00000080, 0x00000080, 0x00000080, 0x00000080, 0x00000080, 0x00000080, 0x00000080,
+    0x00000080, 0x00000080, 0x00000080, 0x00000080, 0x00000080, 0x00000080, 0x00000080, 0x00000080,
+    0x00808080, 0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00800000,
+    0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00800000,
+    0x00808080, 0x00008080, 0x00008080, 0x00008080, 0x00008080, 0x00008080, 0x00008080, 0x00008080,
+    0x00008080, 0x00008080, 0x00008080, 0x00008080, 0x00008080, 0x00008080, 0x00008080, 0x00008080,
+    0x00808080, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x000000FF, 0x000000FF, 0x000000FF, 0x000000FF, 0x000000FF, 0x000000FF, 0x000000FF,
+    0x000000FF, 0x000000FF, 0x000000FF, 0x000000FF, 0x000000FF, 0x000000FF, 0x000000FF, 0x000000FF,
+    0x00808080, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000,
+    0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000,
+    0x00808080, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000,
+    0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000,
+    0x00808080, 0x00000080, 0x00000080, 0x00000080, 0x00000080, 0x00000080, 0x00000080, 0x00000080,
+    0x00000080, 0x00000080, 0x00000080, 0x00000080, 0x00000080, 0x00000080, 0x00000080, 0x00000080,
+    0x00808080, 0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00800000,
+    0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00800000,
+    0x00808080, 0x00008080, 0x00008080, 0x00008080, 0x00008080, 0x00008080, 0x00008080, 0x00008080,
+    0x00008080, 0x00008080, 0x00008080, 0x00008080, 0x00008080, 0x00008080, 0x00008080, 0x00008080,
+    0x00808080, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00FF00FF, 0x00FF00FF, 0x00FF00FF, 0x00FF00FF, 0x00FF00FF, 0x00FF00FF,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x0000FFFF, 0x0000FFFF, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x0000FFFF, 0x0000FFFF, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x008080FF, 0x008080FF, 0x008080FF, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x0000FF00,
+    0x0000FF00, 0x0000FF00, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00FF8000, 0x00FF8000, 0x00FF8000, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00800080, 0x00800080, 0x00800080, 0x00800080, 0x00800080,
+    0x00800080, 0x00800080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x0092A224, 0x0092A224,
+    0x0092A224, 0x0092A224, 0x0092A224, 0x0092A224, 0x0092A224, 0x0092A224, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00FFFF00, 0x00FFFF00, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00FFFF00,
+    0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00FF00FF, 0x00FF00FF, 0x00FF00FF, 0x00FF00FF, 0x00FF00FF, 0x00FF00FF,
+    0x00FF00FF, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x0000FFFF, 0x0000FFFF, 0x0000FFFF, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x0000FFFF, 0x0000FFFF, 0x0000FFFF, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00800040, 0x00800040, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x008080FF, 0x008080FF, 0x008080FF, 0x008080FF, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x0000FF00, 0x0000FF00,
+    0x0000FF00, 0x0000FF00, 0x0000FF00, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00FF8000, 0x00FF8000, 0x00FF8000, 0x00FF8000, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00804000,
+    0x00804000, 0x00804000, 0x00804000, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00800080, 0x00800080, 0x00800080, 0x00800080, 0x00800080,
+    0x00800080, 0x00800080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00E2A79C, 0x00E2A79C, 0x00E2A79C, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00E2A79C, 0x00E2A79C, 0x00E2A79C, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x0092A224, 0x0092A224,
+    0x0092A224, 0x0092A224, 0x0092A224, 0x0092A224, 0x0092A224, 0x0092A224, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00404040, 0x00404040, 0x00404040, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00CAEA48, 0x00CAEA48,
+    0x00CAEA48, 0x00CAEA48, 0x00CAEA48, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00FFFF00, 0x00FFFF00, 0x00C0C0C0, 0x00C0C0C0, 0x00FFFF00, 0x00FFFF00,
+    0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00FF00FF,
+    0x00FF00FF, 0x00FF00FF, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x0000FFFF, 0x0000FFFF, 0x0000FFFF, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x0000FFFF, 0x0000FFFF, 0x0000FFFF, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00800040, 0x00800040, 0x00800040, 0x00800040, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x008080FF, 0x008080FF, 0x008080FF, 0x008080FF, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x0000FF00, 0x0000FF00,
+    0x0000FF00, 0x0000FF00, 0x0000FF00, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00FF8000, 0x00FF8000, 0x00FF8000, 0x00FF8000, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00804000, 0x00804000,
+    0x00804000, 0x00804000, 0x00804000, 0x00804000, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00800080, 0x00800080, 0x00800080, 0x00800080, 0x00800080,
+    0x00800080, 0x00800080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00E2A79C, 0x00E2A79C, 0x00E2A79C, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00E2A79C, 0x00E2A79C, 0x00E2A79C, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x0092A224, 0x0092A224,
+    0x0092A224, 0x0092A224, 0x0092A224, 0x0092A224, 0x0092A224, 0x0092A224, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00404040, 0x00404040, 0x00404040, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x0000789B, 0x0000789B, 0x0000789B, 0x00C0C0C0, 0x00C0C0C0,
+    0x0000789B, 0x0000789B, 0x0000789B, 0x00C0C0C0, 0x00C0C0C0, 0x0000789B, 0x0000789B, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00CAEA48, 0x00CAEA48, 0x00CAEA48,
+    0x00CAEA48, 0x00CAEA48, 0x00CAEA48, 0x00CAEA48, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00000000, 0x00000000, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00000000, 0x00000000, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00FF00FF, 0x00FF00FF, 0x00FF00FF, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x0000FFFF, 0x0000FFFF, 0x0000FFFF, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x0000FFFF, 0x0000FFFF, 0x0000FFFF, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00800040, 0x00800040, 0x00800040, 0x00800040, 0x00800040, 0x00800040, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x008080FF, 0x008080FF, 0x008080FF, 0x008080FF, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x0000FF00, 0x0000FF00, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x0000FF00, 0x0000FF00, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00FF8000, 0x00FF8000, 0x00FF8000, 0x00FF8000,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00804000, 0x00804000, 0x00804000,
+    0x00804000, 0x00804000, 0x00804000, 0x00804000, 0x00804000, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00800080,
+    0x00800080, 0x00800080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00E2A79C, 0x00E2A79C, 0x00E2A79C, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00E2A79C, 0x00E2A79C, 0x00E2A79C, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x0092A224, 0x0092A224,
+    0x0092A224, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00404040, 0x00404040, 0x00404040,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x0000789B, 0x0000789B, 0x0000789B, 0x00C0C0C0, 0x00C0C0C0,
+    0x0000789B, 0x0000789B, 0x0000789B, 0x00C0C0C0, 0x00C0C0C0, 0x0000789B, 0x0000789B, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00CAEA48, 0x00CAEA48, 0x00CAEA48, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00CAEA48, 0x00CAEA48, 0x00CAEA48, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00000000, 0x00000000, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00000000, 0x00000000, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C93100, 0x00C93100,
+    0x00C93100, 0x00C93100, 0x00C93100, 0x00C93100, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00FF00FF, 0x00FF00FF, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x0000FFFF, 0x0000FFFF, 0x0000FFFF,
+    0x00C0C0C0, 0x0000FFFF, 0x0000FFFF, 0x0000FFFF, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00800040,
+    0x00800040, 0x00800040, 0x00C0C0C0, 0x00C0C0C0, 0x00800040, 0x00800040, 0x00800040, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x008080FF, 0x008080FF, 0x008080FF, 0x008080FF, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x0000FF00, 0x0000FF00, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x0000FF00, 0x0000FF00, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00FF8000, 0x00FF8000, 0x00FF8000,
+    0x00FF8000, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00804000, 0x00804000, 0x00804000, 0x00804000,
+    0x00C0C0C0, 0x00C0C0C0, 0x00804000, 0x00804000, 0x00804000, 0x00804000, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00800080,
+    0x00800080, 0x00800080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00E2A79C, 0x00E2A79C, 0x00E2A79C, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00E2A79C, 0x00E2A79C, 0x00E2A79C, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x0092A224, 0x0092A224,
+    0x0092A224, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00404040, 0x00404040,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x0000789B, 0x0000789B, 0x0000789B, 0x0000789B, 0x00C0C0C0,
+    0x0000789B, 0x0000789B, 0x0000789B, 0x0000789B, 0x00C0C0C0, 0x0000789B, 0x0000789B, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00CAEA48, 0x00CAEA48, 0x00CAEA48, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00CAEA48, 0x00CAEA48, 0x00CAEA48, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00000000, 0x00000000, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00000000, 0x00000000, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C93100, 0x00C93100, 0x00C93100,
+    0x00C93100, 0x00C93100, 0x00C93100, 0x00C93100, 0x00C93100, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00FFFF00, 0x00FFFF00, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00FF00FF, 0x00FF00FF, 0x00FF00FF, 0x00FF00FF, 0x00FF00FF, 0x00FF00FF,
+    0x00FF00FF, 0x00FF00FF, 0x00FF00FF, 0x00FF00FF, 0x00FF00FF, 0x00FF00FF, 0x00FF00FF, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x0000FFFF, 0x0000FFFF,
+    0x0000FFFF, 0x0000FFFF, 0x0000FFFF, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00800040,
+    0x00800040, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00800040, 0x00800040, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x008080FF, 0x008080FF, 0x008080FF, 0x008080FF, 0x008080FF, 0x008080FF,
+    0x008080FF, 0x008080FF, 0x008080FF, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x0000FF00, 0x0000FF00, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x0000FF00, 0x0000FF00, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00FF8000, 0x00FF8000,
+    0x00FF8000, 0x00FF8000, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00804000, 0x00804000, 0x00804000, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00804000, 0x00804000, 0x00804000, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00800080,
+    0x00800080, 0x00800080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00E2A79C, 0x00E2A79C, 0x00E2A79C, 0x00E2A79C, 0x00E2A79C,
+    0x00E2A79C, 0x00E2A79C, 0x00E2A79C, 0x00E2A79C, 0x00E2A79C, 0x00E2A79C, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x0092A224, 0x0092A224,
+    0x0092A224, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00404040, 0x00404040, 0x00404040,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x0000789B, 0x0000789B, 0x0000789B, 0x0000789B, 0x00C0C0C0,
+    0x0000789B, 0x0000789B, 0x0000789B, 0x0000789B, 0x00C0C0C0, 0x0000789B, 0x0000789B, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00CAEA48, 0x00CAEA48, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00CAEA48, 0x00CAEA48, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00000000, 0x00000000, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00000000, 0x00000000, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C93100, 0x00C93100, 0x00C93100, 0x00C0C0C0,
+    0x00C93100, 0x00C93100, 0x00C0C0C0, 0x00C93100, 0x00C93100, 0x00C93100, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00FFFF00, 0x00FFFF00, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00FF00FF, 0x00FF00FF, 0x00FF00FF, 0x00FF00FF, 0x00FF00FF, 0x00FF00FF,
+    0x00FF00FF, 0x00FF00FF, 0x00FF00FF, 0x00FF00FF, 0x00FF00FF, 0x00FF00FF, 0x00FF00FF, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x0000FFFF, 0x0000FFFF, 0x0000FFFF, 0x0000FFFF, 0x0000FFFF,
+    0x0000FFFF, 0x0000FFFF, 0x0000FFFF, 0x0000FFFF, 0x0000FFFF, 0x0000FFFF, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00800040,
+    0x00800040, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00800040, 0x00800040, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x008080FF, 0x008080FF, 0x008080FF, 0x008080FF, 0x008080FF, 0x008080FF,
+    0x008080FF, 0x008080FF, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x0000FF00, 0x0000FF00, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x0000FF00, 0x0000FF00, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00FF8000, 0x00FF8000, 0x00FF8000, 0x00FF8000, 0x00FF8000,
+    0x00FF8000, 0x00FF8000, 0x00FF8000, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00804000, 0x00804000, 0x00804000, 0x00804000,
+    0x00C0C0C0, 0x00C0C0C0, 0x00804000, 0x00804000, 0x00804000, 0x00804000, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00800080,
+    0x00800080, 0x00800080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00E2A79C, 0x00E2A79C, 0x00E2A79C, 0x00E2A79C, 0x00E2A79C,
+    0x00E2A79C, 0x00E2A79C, 0x00E2A79C, 0x00E2A79C, 0x00E2A79C, 0x00E2A79C, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x0092A224, 0x0092A224,
+    0x0092A224, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00404040, 0x00404040, 0x00404040, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x0000789B, 0x0000789B, 0x00C0C0C0, 0x0000789B, 0x00C0C0C0,
+    0x0000789B, 0x0000789B, 0x00C0C0C0, 0x0000789B, 0x00C0C0C0, 0x0000789B, 0x0000789B, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00CAEA48, 0x00CAEA48, 0x00CAEA48, 0x00CAEA48, 0x00CAEA48, 0x00CAEA48,
+    0x00CAEA48, 0x00CAEA48, 0x00CAEA48, 0x00CAEA48, 0x00CAEA48, 0x00CAEA48, 0x00CAEA48, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00000000, 0x00000000, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00000000, 0x00000000, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C93100, 0x00C93100, 0x00C93100, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C93100, 0x00C93100, 0x00C0C0C0, 0x00C0C0C0, 0x00C93100, 0x00C93100, 0x00C93100, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00FFFF00, 0x00FFFF00, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00FF00FF, 0x00FF00FF, 0x00FF00FF, 0x00FF00FF, 0x00FF00FF, 0x00FF00FF,
+    0x00FF00FF, 0x00FF00FF, 0x00FF00FF, 0x00FF00FF, 0x00FF00FF, 0x00FF00FF, 0x00FF00FF, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x0000FFFF, 0x0000FFFF,
+    0x0000FFFF, 0x0000FFFF, 0x0000FFFF, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00800040,
+    0x00800040, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00800040, 0x00800040, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x008080FF, 0x008080FF, 0x008080FF, 0x008080FF, 0x008080FF, 0x008080FF,
+    0x008080FF, 0x008080FF, 0x008080FF, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x0000FF00, 0x0000FF00, 0x0000FF00, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x0000FF00, 0x0000FF00, 0x0000FF00, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00FF8000, 0x00FF8000, 0x00FF8000, 0x00FF8000, 0x00FF8000,
+    0x00FF8000, 0x00FF8000, 0x00FF8000, 0x00FF8000, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00804000, 0x00804000, 0x00804000,
+    0x00804000, 0x00804000, 0x00804000, 0x00804000, 0x00804000, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00800080,
+    0x00800080, 0x00800080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00E2A79C, 0x00E2A79C, 0x00E2A79C, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00E2A79C, 0x00E2A79C, 0x00E2A79C, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x0092A224, 0x0092A224,
+    0x0092A224, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00404040, 0x00404040, 0x00404040, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x0000789B, 0x0000789B, 0x00C0C0C0, 0x0000789B, 0x0000789B,
+    0x0000789B, 0x0000789B, 0x00C0C0C0, 0x0000789B, 0x0000789B, 0x0000789B, 0x0000789B, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00CAEA48, 0x00CAEA48, 0x00CAEA48, 0x00CAEA48, 0x00CAEA48, 0x00CAEA48,
+    0x00CAEA48, 0x00CAEA48, 0x00CAEA48, 0x00CAEA48, 0x00CAEA48, 0x00CAEA48, 0x00CAEA48, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00000000, 0x00000000, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00000000, 0x00000000, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C93100, 0x00C93100, 0x00C93100, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C93100, 0x00C93100, 0x00C0C0C0, 0x00C0C0C0, 0x00C93100, 0x00C93100, 0x00C93100, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00FF00FF, 0x00FF00FF, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x0000FFFF, 0x0000FFFF, 0x0000FFFF,
+    0x00C0C0C0, 0x0000FFFF, 0x0000FFFF, 0x0000FFFF, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00800040, 0x00800040, 0x00800040, 0x00800040, 0x00800040, 0x00800040,
+    0x00800040, 0x00800040, 0x00800040, 0x00800040, 0x00800040, 0x00800040, 0x00800040, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x008080FF, 0x008080FF, 0x008080FF, 0x008080FF, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x0000FF00, 0x0000FF00, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x0000FF00, 0x0000FF00, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00FF8000, 0x00FF8000, 0x00FF8000, 0x00FF8000, 0x00FF8000,
+    0x00FF8000, 0x00FF8000, 0x00FF8000, 0x00FF8000, 0x00FF8000, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00804000, 0x00804000,
+    0x00804000, 0x00804000, 0x00804000, 0x00804000, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00800080,
+    0x00800080, 0x00800080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00E2A79C, 0x00E2A79C, 0x00E2A79C, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00E2A79C, 0x00E2A79C, 0x00E2A79C, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x0092A224, 0x0092A224,
+    0x0092A224, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00404040, 0x00404040, 0x00404040, 0x00404040, 0x00404040,
+    0x00404040, 0x00404040, 0x00404040, 0x00404040, 0x00404040, 0x00404040, 0x00404040, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x0000789B, 0x0000789B, 0x00C0C0C0, 0x0000789B, 0x0000789B,
+    0x0000789B, 0x0000789B, 0x00C0C0C0, 0x0000789B, 0x0000789B, 0x0000789B, 0x0000789B, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00CAEA48, 0x00CAEA48, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00CAEA48, 0x00CAEA48, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00000000, 0x00000000,
+    0x00C0C0C0, 0x00000000, 0x00000000, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C93100, 0x00C93100, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C93100, 0x00C93100, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C93100, 0x00C93100, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00FF00FF, 0x00FF00FF, 0x00FF00FF, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x0000FFFF, 0x0000FFFF, 0x0000FFFF, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x0000FFFF, 0x0000FFFF, 0x0000FFFF, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00800040, 0x00800040, 0x00800040, 0x00800040, 0x00800040, 0x00800040,
+    0x00800040, 0x00800040, 0x00800040, 0x00800040, 0x00800040, 0x00800040, 0x00800040, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x008080FF, 0x008080FF, 0x008080FF, 0x008080FF, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x0000FF00, 0x0000FF00, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x0000FF00, 0x0000FF00, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00FF8000, 0x00FF8000, 0x00FF8000, 0x00FF8000, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00804000,
+    0x00804000, 0x00804000, 0x00804000, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00800080,
+    0x00800080, 0x00800080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00E2A79C, 0x00E2A79C, 0x00E2A79C, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00E2A79C, 0x00E2A79C, 0x00E2A79C, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x0092A224, 0x0092A224,
+    0x0092A224, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00404040, 0x00404040, 0x00404040, 0x00404040, 0x00404040,
+    0x00404040, 0x00404040, 0x00404040, 0x00404040, 0x00404040, 0x00404040, 0x00404040, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x0000789B, 0x0000789B, 0x00C0C0C0, 0x00C0C0C0, 0x0000789B,
+    0x0000789B, 0x0000789B, 0x00C0C0C0, 0x00C0C0C0, 0x0000789B, 0x0000789B, 0x0000789B, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00CAEA48, 0x00CAEA48, 0x00CAEA48, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00CAEA48, 0x00CAEA48, 0x00CAEA48, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00000000, 0x00000000,
+    0x00C0C0C0, 0x00000000, 0x00000000, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C93100, 0x00C93100, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C93100, 0x00C93100, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C93100, 0x00C93100, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00FFFF00, 0x00FFFF00, 0x00C0C0C0, 0x00C0C0C0, 0x00FFFF00, 0x00FFFF00,
+    0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00FF00FF,
+    0x00FF00FF, 0x00FF00FF, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x0000FFFF, 0x0000FFFF, 0x0000FFFF, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x0000FFFF, 0x0000FFFF, 0x0000FFFF, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00800040, 0x00800040, 0x00800040, 0x00800040, 0x00800040, 0x00800040,
+    0x00800040, 0x00800040, 0x00800040, 0x00800040, 0x00800040, 0x00800040, 0x00800040, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x008080FF, 0x008080FF, 0x008080FF, 0x008080FF, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x0000FF00, 0x0000FF00, 0x0000FF00, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x0000FF00, 0x0000FF00, 0x0000FF00, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00FF8000, 0x00FF8000, 0x00FF8000, 0x00FF8000, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00804000, 0x00804000, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00800080,
+    0x00800080, 0x00800080, 0x00800080, 0x00800080, 0x00800080, 0x00800080, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00E2A79C, 0x00E2A79C, 0x00E2A79C, 0x00E2A79C, 0x00E2A79C,
+    0x00E2A79C, 0x00E2A79C, 0x00E2A79C, 0x00E2A79C, 0x00E2A79C, 0x00E2A79C, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x0092A224, 0x0092A224, 0x0092A224, 0x0092A224, 0x0092A224, 0x0092A224,
+    0x0092A224, 0x0092A224, 0x0092A224, 0x0092A224, 0x0092A224, 0x0092A224, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00404040, 0x00404040, 0x00404040, 0x00404040, 0x00404040,
+    0x00404040, 0x00404040, 0x00404040, 0x00404040, 0x00404040, 0x00404040, 0x00404040, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x0000789B, 0x0000789B, 0x00C0C0C0, 0x00C0C0C0, 0x0000789B,
+    0x0000789B, 0x0000789B, 0x00C0C0C0, 0x00C0C0C0, 0x0000789B, 0x0000789B, 0x0000789B, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00CAEA48, 0x00CAEA48, 0x00CAEA48, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00CAEA48, 0x00CAEA48, 0x00CAEA48, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00000000, 0x00000000,
+    0x00C0C0C0, 0x00000000, 0x00000000, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00FFFF00, 0x00FFFF00, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00FFFF00,
+    0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00FF00FF, 0x00FF00FF, 0x00FF00FF, 0x00FF00FF, 0x00FF00FF, 0x00FF00FF,
+    0x00FF00FF, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x0000FFFF, 0x0000FFFF, 0x0000FFFF, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x0000FFFF, 0x0000FFFF, 0x0000FFFF, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x008080FF, 0x008080FF, 0x008080FF, 0x008080FF, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x0000FF00, 0x0000FF00, 0x0000FF00, 0x0000FF00, 0x0000FF00, 0x0000FF00,
+    0x0000FF00, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x0000FF00, 0x0000FF00, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00FF8000, 0x00FF8000, 0x00FF8000, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00804000, 0x00804000, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00800080,
+    0x00800080, 0x00800080, 0x00800080, 0x00800080, 0x00800080, 0x00800080, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00E2A79C, 0x00E2A79C, 0x00E2A79C, 0x00E2A79C, 0x00E2A79C,
+    0x00E2A79C, 0x00E2A79C, 0x00E2A79C, 0x00E2A79C, 0x00E2A79C, 0x00E2A79C, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x0092A224, 0x0092A224, 0x0092A224, 0x0092A224, 0x0092A224, 0x0092A224,
+    0x0092A224, 0x0092A224, 0x0092A224, 0x0092A224, 0x0092A224, 0x0092A224, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00CAEA48, 0x00CAEA48, 0x00CAEA48,
+    0x00CAEA48, 0x00CAEA48, 0x00CAEA48, 0x00CAEA48, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00000000,
+    0x00000000, 0x00000000, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00FF00FF, 0x00FF00FF, 0x00FF00FF, 0x00FF00FF, 0x00FF00FF, 0x00FF00FF,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x0000FFFF, 0x0000FFFF, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x0000FFFF, 0x0000FFFF, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x008080FF, 0x008080FF, 0x008080FF, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x0000FF00, 0x0000FF00, 0x0000FF00, 0x0000FF00, 0x0000FF00, 0x0000FF00,
+    0x0000FF00, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x0000FF00, 0x0000FF00, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00FF8000, 0x00FF8000, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00804000, 0x00804000, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00800080,
+    0x00800080, 0x00800080, 0x00800080, 0x00800080, 0x00800080, 0x00800080, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x0092A224, 0x0092A224, 0x0092A224, 0x0092A224, 0x0092A224, 0x0092A224,
+    0x0092A224, 0x0092A224, 0x0092A224, 0x0092A224, 0x0092A224, 0x0092A224, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00CAEA48, 0x00CAEA48,
+    0x00CAEA48, 0x00CAEA48, 0x00CAEA48, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00000000,
+    0x00000000, 0x00000000, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00808080, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000,
+    0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00800000, 0x00000000, 0x00800000, 0x00000000, 0x00800000, 0x00000000, 0x00800000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000,
+    0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000,
+    0x00FF0000, 0x00FF0000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00800000,
+    0x00000000, 0x00800000, 0x00000000, 0x00800000, 0x00000000, 0x00800000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000,
+    0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000,
+    0x00FF0000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00FF0000, 0x00FF0000, 0x00FF0000,
+    0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000,
+    0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00FF0000,
+    0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00800000, 0x00000000, 0x00800000,
+    0x00000000, 0x00800000, 0x00000000, 0x00800000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00FF0000, 0x00000000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000,
+    0x00FF0000, 0x00FF0000, 0x00000000, 0x00FF0000, 0x00000000, 0x00000000, 0x00800000, 0x00000000,
+    0x00000000, 0x00800000, 0x00000000, 0x00800000, 0x00000000, 0x00800000, 0x00000000, 0x00000000,
+    0x00FF0000, 0x00000000, 0x00000000, 0x00800000, 0x00000000, 0x00FF0000, 0x00FF0000, 0x00FF0000,
+    0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00000000, 0x00FF0000, 0x00000000, 0x00000000,
+    0x00800000, 0x00000000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000,
+    0x00FF0000, 0x00000000, 0x00FF0000, 0x00000000, 0x00000000, 0x00FF0000, 0x00000000, 0x00000000,
+    0x00800000, 0x00000000, 0x00800000, 0x00000000, 0x00800000, 0x00000000, 0x00000000, 0x00FF0000,
+    0x00000000, 0x00000000, 0x00FF0000, 0x00000000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000,
+    0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00000000, 0x00800000, 0x00000000, 0x00000000, 0x00FF0000,
+    0x00000000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000,
+    0x00000000, 0x00800000, 0x00000000, 0x00000000, 0x00800000, 0x00000000, 0x00FF0000, 0x00FF0000,
+    0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00000000, 0x00FF0000, 0x00000000,
+    0x00000000, 0x00FF0000, 0x00000000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000,
+    0x00FF0000, 0x00FF0000, 0x00000000, 0x00FF0000, 0x00000000, 0x00000000, 0x00FF0000, 0x00000000,
+    0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00000000,
+    0x00FF0000, 0x00000000, 0x00000000, 0x00800000, 0x00000000, 0x00000000, 0x00800000, 0x00000000,
+    0x00800000, 0x00000000, 0x00800000, 0x00000000, 0x00000000, 0x00800000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00FF0000, 0x00FF0000, 0x00000000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000,
+    0x00FF0000, 0x00000000, 0x00FF0000, 0x00FF0000, 0x00000000, 0x00000000, 0x00000000, 0x00800000,
+    0x00000000, 0x00000000, 0x00800000, 0x00000000, 0x00800000, 0x00000000, 0x00000000, 0x00FF0000,
+    0x00FF0000, 0x00000000, 0x00000000, 0x00000000, 0x00800000, 0x00000000, 0x00FF0000, 0x00FF0000,
+    0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00000000, 0x00FF0000, 0x00FF0000, 0x00000000, 0x00000000,
+    0x00000000, 0x00800000, 0x00000000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000,
+    0x00000000, 0x00FF0000, 0x00FF0000, 0x00000000, 0x00000000, 0x00FF0000, 0x00FF0000, 0x00000000,
+    0x00000000, 0x00800000, 0x00000000, 0x00800000, 0x00000000, 0x00000000, 0x00FF0000, 0x00FF0000,
+    0x00000000, 0x00000000, 0x00FF0000, 0x00FF0000, 0x00000000, 0x00FF0000, 0x00FF0000, 0x00FF0000,
+    0x00FF0000, 0x00FF0000, 0x00000000, 0x00800000, 0x00000000, 0x00000000, 0x00000000, 0x00FF0000,
+    0x00FF0000, 0x00000000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00000000,
+    0x00800000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00800000, 0x00000000, 0x00FF0000,
+    0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00000000, 0x00FF0000, 0x00FF0000, 0x00000000,
+    0x00000000, 0x00FF0000, 0x00FF0000, 0x00000000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000,
+    0x00FF0000, 0x00000000, 0x00FF0000, 0x00FF0000, 0x00000000, 0x00000000, 0x00FF0000, 0x00FF0000,
+    0x00000000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00000000, 0x00FF0000,
+    0x00FF0000, 0x00000000, 0x00000000, 0x00000000, 0x00800000, 0x00000000, 0x00000000, 0x00800000,
+    0x00000000, 0x00800000, 0x00000000, 0x00000000, 0x00800000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00000000, 0x00000000, 0x00800000, 0x00000000,
+    0x00800000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00FF0000, 0x00FF0000,
+    0x00FF0000, 0x00000000, 0x00000000, 0x00800000, 0x00000000, 0x00800000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00000000, 0x00000000,
+    0x00800000, 0x00000000, 0x00800000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00000000, 0x00000000, 0x00FF0000, 0x00FF0000, 0x00FF0000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00FF0000, 0x00FF0000, 0x00FF0000,
+    0x00000000, 0x00000000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00800000, 0x00000000, 0x00800000, 0x00000000, 0x00000000, 0x00FF0000,
+    0x00FF0000, 0x00FF0000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00800000,
+    0x00000000, 0x00800000, 0x00000000, 0x00000000, 0x00800000, 0x00000000, 0x00800000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00000000,
+    0x00000000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00000000, 0x00000000, 0x00FF0000, 0x00FF0000,
+    0x00FF0000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00FF0000, 0x00FF0000,
+    0x00FF0000, 0x00000000, 0x00000000, 0x00800000, 0x00000000, 0x00800000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00800000, 0x00000000, 0x00800000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00000000, 0x00000000, 0x00000000, 0x00800000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00FF0000, 0x00FF0000,
+    0x00FF0000, 0x00000000, 0x00000000, 0x00000000, 0x00800000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00000000, 0x00000000,
+    0x00000000, 0x00800000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00000000, 0x00000000, 0x00FF0000, 0x00FF0000, 0x00FF0000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00FF0000, 0x00FF0000, 0x00FF0000,
+    0x00000000, 0x00000000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00800000, 0x00000000, 0x00000000, 0x00000000, 0x00FF0000,
+    0x00FF0000, 0x00FF0000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00800000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00800000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00000000,
+    0x00000000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00000000, 0x00000000, 0x00FF0000, 0x00FF0000,
+    0x00FF0000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00FF0000, 0x00FF0000,
+    0x00FF0000, 0x00000000, 0x00000000, 0x00000000, 0x00800000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00800000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00000000, 0x00000000, 0x00800000, 0x00000000,
+    0x00800000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00FF0000, 0x00FF0000,
+    0x00FF0000, 0x00000000, 0x00000000, 0x00800000, 0x00000000, 0x00800000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00000000, 0x00000000,
+    0x00800000, 0x00000000, 0x00800000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00000000, 0x00000000, 0x00FF0000, 0x00FF0000, 0x00FF0000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00FF0000, 0x00FF0000, 0x00FF0000,
+    0x00000000, 0x00000000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00800000, 0x00000000, 0x00800000, 0x00000000, 0x00000000, 0x00FF0000,
+    0x00FF0000, 0x00FF0000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00800000,
+    0x00000000, 0x00800000, 0x00000000, 0x00000000, 0x00800000, 0x00000000, 0x00800000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00000000,
+    0x00000000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00000000, 0x00000000, 0x00FF0000, 0x00FF0000,
+    0x00FF0000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00FF0000, 0x00FF0000,
+    0x00FF0000, 0x00000000, 0x00000000, 0x00800000, 0x00000000, 0x00800000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00800000, 0x00000000, 0x00800000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00000000, 0x00000000, 0x00000000, 0x00800000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00FF0000, 0x00FF0000,
+    0x00FF0000, 0x00000000, 0x00000000, 0x00000000, 0x00800000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00000000, 0x00000000,
+    0x00000000, 0x00800000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00000000, 0x00000000, 0x00FF0000, 0x00FF0000, 0x00FF0000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00FF0000, 0x00FF0000, 0x00FF0000,
+    0x00000000, 0x00000000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00800000, 0x00000000, 0x00000000, 0x00000000, 0x00FF0000,
+    0x00FF0000, 0x00FF0000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00800000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00800000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00000000,
+    0x00000000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00000000, 0x00000000, 0x00FF0000, 0x00FF0000,
+    0x00FF0000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00FF0000, 0x00FF0000,
+    0x00FF0000, 0x00000000, 0x00000000, 0x00000000, 0x00800000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00800000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00000000, 0x00000000, 0x00800000, 0x00000000,
+    0x00800000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00FF0000, 0x00FF0000,
+    0x00FF0000, 0x00000000, 0x00000000, 0x00800000, 0x00000000, 0x00800000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00000000, 0x00000000,
+    0x00800000, 0x00000000, 0x00800000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00000000, 0x00000000, 0x00FF0000, 0x00FF0000, 0x00FF0000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00FF0000, 0x00FF0000, 0x00FF0000,
+    0x00000000, 0x00000000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00800000, 0x00000000, 0x00800000, 0x00000000, 0x00000000, 0x00FF0000,
+    0x00FF0000, 0x00FF0000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00800000,
+    0x00000000, 0x00800000, 0x00000000, 0x00000000, 0x00800000, 0x00000000, 0x00800000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00000000,
+    0x00000000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00000000, 0x00000000, 0x00FF0000, 0x00FF0000,
+    0x00FF0000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00FF0000, 0x00FF0000,
+    0x00FF0000, 0x00000000, 0x00000000, 0x00800000, 0x00000000, 0x00800000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00800000, 0x00000000, 0x00800000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00FF0000, 0x00FF0000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00FF0000, 0x00FF0000, 0x00000000, 0x00000000, 0x00000000, 0x00800000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00FF0000,
+    0x00FF0000, 0x00000000, 0x00000000, 0x00000000, 0x00800000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00FF0000, 0x00FF0000, 0x00000000, 0x00000000,
+    0x00000000, 0x00800000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00FF0000, 0x00FF0000, 0x00000000, 0x00000000, 0x00FF0000, 0x00FF0000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00FF0000, 0x00FF0000,
+    0x00000000, 0x00000000, 0x00FF0000, 0x00FF0000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00800000, 0x00000000, 0x00000000, 0x00000000, 0x00FF0000,
+    0x00FF0000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00800000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00800000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00FF0000, 0x00FF0000, 0x00000000,
+    0x00000000, 0x00FF0000, 0x00FF0000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00FF0000, 0x00FF0000, 0x00000000, 0x00000000, 0x00FF0000, 0x00FF0000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00FF0000,
+    0x00FF0000, 0x00000000, 0x00000000, 0x00000000, 0x00800000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00800000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00FF0000, 0x00000000, 0x00000000, 0x00800000, 0x00000000, 0x00800000, 0x00000000,
+    0x00800000, 0x00000000, 0x00000000, 0x00FF0000, 0x00000000, 0x00000000, 0x00800000, 0x00000000,
+    0x00000000, 0x00800000, 0x00000000, 0x00800000, 0x00000000, 0x00800000, 0x00000000, 0x00000000,
+    0x00FF0000, 0x00000000, 0x00000000, 0x00800000, 0x00000000, 0x00FF0000, 0x00FF0000, 0x00FF0000,
+    0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00000000, 0x00FF0000, 0x00000000, 0x00000000,
+    0x00800000, 0x00000000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000,
+    0x00FF0000, 0x00000000, 0x00FF0000, 0x00000000, 0x00000000, 0x00FF0000, 0x00000000, 0x00FF0000,
+    0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00000000, 0x00FF0000,
+    0x00000000, 0x00000000, 0x00FF0000, 0x00000000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000,
+    0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00000000, 0x00800000, 0x00000000, 0x00000000, 0x00FF0000,
+    0x00000000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000,
+    0x00000000, 0x00800000, 0x00000000, 0x00000000, 0x00800000, 0x00000000, 0x00000000, 0x00800000,
+    0x00000000, 0x00800000, 0x00000000, 0x00800000, 0x00000000, 0x00000000, 0x00FF0000, 0x00000000,
+    0x00000000, 0x00FF0000, 0x00000000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000,
+    0x00FF0000, 0x00FF0000, 0x00000000, 0x00FF0000, 0x00000000, 0x00000000, 0x00FF0000, 0x00000000,
+    0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00000000,
+    0x00FF0000, 0x00000000, 0x00000000, 0x00800000, 0x00000000, 0x00FF0000, 0x00FF0000, 0x00FF0000,
+    0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00000000, 0x00800000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00800000, 0x00000000, 0x00800000, 0x00000000, 0x00800000,
+    0x00000000, 0x00800000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00800000, 0x00000000, 0x00800000, 0x00000000, 0x00800000, 0x00000000, 0x00800000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000,
+    0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000,
+    0x00FF0000, 0x00FF0000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00FF0000, 0x00FF0000,
+    0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000,
+    0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000,
+    0x00FF0000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00800000, 0x00000000,
+    0x00800000, 0x00000000, 0x00800000, 0x00000000, 0x00800000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000,
+    0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00FF0000,
+    0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000,
+    0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00FF0000, 0x00000000, 0x00000000, 0x00800000, 0x00000000, 0x00800000, 0x00000000,
+    0x00800000, 0x00000000, 0x00000000, 0x00FF0000, 0x00000000, 0x00000000, 0x00800000, 0x00000000,
+    0x00000000, 0x00800000, 0x00000000, 0x00800000, 0x00000000, 0x00800000, 0x00000000, 0x00000000,
+    0x00FF0000, 0x00000000, 0x00000000, 0x00FF0000, 0x00000000, 0x00FF0000, 0x00FF0000, 0x00FF0000,
+    0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00000000, 0x00800000, 0x00000000, 0x00000000,
+    0x00800000, 0x00000000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000,
+    0x00FF0000, 0x00000000, 0x00FF0000, 0x00000000, 0x00000000, 0x00800000, 0x00000000, 0x00FF0000,
+    0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00000000, 0x00FF0000,
+    0x00000000, 0x00000000, 0x00800000, 0x00000000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000,
+    0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00000000, 0x00FF0000, 0x00000000, 0x00000000, 0x00FF0000,
+    0x00000000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000,
+    0x00000000, 0x00FF0000, 0x00000000, 0x00000000, 0x00800000, 0x00000000, 0x00000000, 0x00800000,
+    0x00000000, 0x00800000, 0x00000000, 0x00800000, 0x00000000, 0x00000000, 0x00FF0000, 0x00000000,
+    0x00000000, 0x00FF0000, 0x00000000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000,
+    0x00FF0000, 0x00FF0000, 0x00000000, 0x00FF0000, 0x00000000, 0x00000000, 0x00800000, 0x00000000,
+    0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00000000,
+    0x00FF0000, 0x00000000, 0x00000000, 0x00800000, 0x00000000, 0x00FF0000, 0x00FF0000, 0x00FF0000,
+    0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00000000, 0x00800000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00FF0000, 0x00FF0000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00FF0000, 0x00FF0000, 0x00000000, 0x00000000, 0x00000000, 0x00800000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00FF0000,
+    0x00FF0000, 0x00000000, 0x00000000, 0x00FF0000, 0x00FF0000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00800000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00800000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00FF0000, 0x00FF0000, 0x00000000, 0x00000000, 0x00000000, 0x00800000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00FF0000, 0x00FF0000,
+    0x00000000, 0x00000000, 0x00000000, 0x00800000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00FF0000, 0x00FF0000, 0x00000000, 0x00000000, 0x00FF0000,
+    0x00FF0000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00FF0000, 0x00FF0000, 0x00000000, 0x00000000, 0x00000000, 0x00800000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00FF0000, 0x00FF0000, 0x00000000,
+    0x00000000, 0x00FF0000, 0x00FF0000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00FF0000, 0x00FF0000, 0x00000000, 0x00000000, 0x00000000, 0x00800000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00FF0000,
+    0x00FF0000, 0x00000000, 0x00000000, 0x00000000, 0x00800000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00800000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00000000, 0x00000000, 0x00800000, 0x00000000,
+    0x00800000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00FF0000, 0x00FF0000,
+    0x00FF0000, 0x00000000, 0x00000000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00800000, 0x00000000, 0x00800000, 0x00000000, 0x00000000,
+    0x00800000, 0x00000000, 0x00800000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00000000, 0x00000000, 0x00800000, 0x00000000, 0x00800000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00FF0000, 0x00FF0000, 0x00FF0000,
+    0x00000000, 0x00000000, 0x00800000, 0x00000000, 0x00800000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00000000, 0x00000000, 0x00FF0000,
+    0x00FF0000, 0x00FF0000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00FF0000,
+    0x00FF0000, 0x00FF0000, 0x00000000, 0x00000000, 0x00800000, 0x00000000, 0x00800000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00000000,
+    0x00000000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00000000, 0x00000000, 0x00800000, 0x00000000,
+    0x00800000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00FF0000, 0x00FF0000,
+    0x00FF0000, 0x00000000, 0x00000000, 0x00800000, 0x00000000, 0x00800000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00800000, 0x00000000, 0x00800000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00000000, 0x00000000, 0x00000000, 0x00800000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00FF0000, 0x00FF0000,
+    0x00FF0000, 0x00000000, 0x00000000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00800000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00800000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00000000, 0x00000000, 0x00000000, 0x00800000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00FF0000, 0x00FF0000, 0x00FF0000,
+    0x00000000, 0x00000000, 0x00000000, 0x00800000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00000000, 0x00000000, 0x00FF0000,
+    0x00FF0000, 0x00FF0000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00FF0000,
+    0x00FF0000, 0x00FF0000, 0x00000000, 0x00000000, 0x00000000, 0x00800000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00000000,
+    0x00000000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00000000, 0x00000000, 0x00000000, 0x00800000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00FF0000, 0x00FF0000,
+    0x00FF0000, 0x00000000, 0x00000000, 0x00000000, 0x00800000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00800000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00000000, 0x00000000, 0x00800000, 0x00000000,
+    0x00800000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00FF0000, 0x00FF0000,
+    0x00FF0000, 0x00000000, 0x00000000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00800000, 0x00000000, 0x00800000, 0x00000000, 0x00000000,
+    0x00800000, 0x00000000, 0x00800000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00000000, 0x00000000, 0x00800000, 0x00000000, 0x00800000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00FF0000, 0x00FF0000, 0x00FF0000,
+    0x00000000, 0x00000000, 0x00800000, 0x00000000, 0x00800000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00000000, 0x00000000, 0x00FF0000,
+    0x00FF0000, 0x00FF0000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00FF0000,
+    0x00FF0000, 0x00FF0000, 0x00000000, 0x00000000, 0x00800000, 0x00000000, 0x00800000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00000000,
+    0x00000000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00000000, 0x00000000, 0x00800000, 0x00000000,
+    0x00800000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00FF0000, 0x00FF0000,
+    0x00FF0000, 0x00000000, 0x00000000, 0x00800000, 0x00000000, 0x00800000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00800000, 0x00000000, 0x00800000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00000000, 0x00000000, 0x00000000, 0x00800000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00FF0000, 0x00FF0000,
+    0x00FF0000, 0x00000000, 0x00000000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00800000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00800000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00000000, 0x00000000, 0x00000000, 0x00800000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00FF0000, 0x00FF0000, 0x00FF0000,
+    0x00000000, 0x00000000, 0x00000000, 0x00800000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00000000, 0x00000000, 0x00FF0000,
+    0x00FF0000, 0x00FF0000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00FF0000,
+    0x00FF0000, 0x00FF0000, 0x00000000, 0x00000000, 0x00000000, 0x00800000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00000000,
+    0x00000000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00000000, 0x00000000, 0x00000000, 0x00800000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00FF0000, 0x00FF0000,
+    0x00FF0000, 0x00000000, 0x00000000, 0x00000000, 0x00800000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00800000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00000000, 0x00000000, 0x00800000, 0x00000000,
+    0x00800000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00FF0000, 0x00FF0000,
+    0x00FF0000, 0x00000000, 0x00000000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00800000, 0x00000000, 0x00800000, 0x00000000, 0x00000000,
+    0x00800000, 0x00000000, 0x00800000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00000000, 0x00000000, 0x00800000, 0x00000000, 0x00800000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00FF0000, 0x00FF0000, 0x00FF0000,
+    0x00000000, 0x00000000, 0x00800000, 0x00000000, 0x00800000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00000000, 0x00000000, 0x00FF0000,
+    0x00FF0000, 0x00FF0000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00FF0000,
+    0x00FF0000, 0x00FF0000, 0x00000000, 0x00000000, 0x00800000, 0x00000000, 0x00800000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00000000,
+    0x00000000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00000000, 0x00000000, 0x00800000, 0x00000000,
+    0x00800000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00FF0000, 0x00FF0000,
+    0x00FF0000, 0x00000000, 0x00000000, 0x00800000, 0x00000000, 0x00800000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00800000, 0x00000000, 0x00800000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00FF0000, 0x00FF0000, 0x00000000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000,
+    0x00FF0000, 0x00000000, 0x00FF0000, 0x00FF0000, 0x00000000, 0x00000000, 0x00000000, 0x00800000,
+    0x00000000, 0x00000000, 0x00800000, 0x00000000, 0x00800000, 0x00000000, 0x00000000, 0x00FF0000,
+    0x00FF0000, 0x00000000, 0x00000000, 0x00FF0000, 0x00FF0000, 0x00000000, 0x00FF0000, 0x00FF0000,
+    0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00000000, 0x00800000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00800000, 0x00000000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000,
+    0x00000000, 0x00FF0000, 0x00FF0000, 0x00000000, 0x00000000, 0x00000000, 0x00800000, 0x00000000,
+    0x00000000, 0x00800000, 0x00000000, 0x00800000, 0x00000000, 0x00000000, 0x00FF0000, 0x00FF0000,
+    0x00000000, 0x00000000, 0x00000000, 0x00800000, 0x00000000, 0x00FF0000, 0x00FF0000, 0x00FF0000,
+    0x00FF0000, 0x00FF0000, 0x00000000, 0x00FF0000, 0x00FF0000, 0x00000000, 0x00000000, 0x00FF0000,
+    0x00FF0000, 0x00000000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00000000,
+    0x00FF0000, 0x00FF0000, 0x00000000, 0x00000000, 0x00000000, 0x00800000, 0x00000000, 0x00000000,
+    0x00800000, 0x00000000, 0x00800000, 0x00000000, 0x00000000, 0x00FF0000, 0x00FF0000, 0x00000000,
+    0x00000000, 0x00FF0000, 0x00FF0000, 0x00000000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000,
+    0x00FF0000, 0x00000000, 0x00FF0000, 0x00FF0000, 0x00000000, 0x00000000, 0x00000000, 0x00800000,
+    0x00000000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00000000, 0x00FF0000,
+    0x00FF0000, 0x00000000, 0x00000000, 0x00000000, 0x00800000, 0x00000000, 0x00000000, 0x00800000,
+    0x00000000, 0x00800000, 0x00000000, 0x00000000, 0x00800000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00FF0000, 0x00000000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000,
+    0x00FF0000, 0x00FF0000, 0x00000000, 0x00FF0000, 0x00000000, 0x00000000, 0x00800000, 0x00000000,
+    0x00000000, 0x00800000, 0x00000000, 0x00800000, 0x00000000, 0x00800000, 0x00000000, 0x00000000,
+    0x00FF0000, 0x00000000, 0x00000000, 0x00FF0000, 0x00000000, 0x00FF0000, 0x00FF0000, 0x00FF0000,
+    0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00000000, 0x00800000, 0x00000000, 0x00000000,
+    0x00800000, 0x00000000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000,
+    0x00FF0000, 0x00000000, 0x00FF0000, 0x00000000, 0x00000000, 0x00800000, 0x00000000, 0x00000000,
+    0x00800000, 0x00000000, 0x00800000, 0x00000000, 0x00800000, 0x00000000, 0x00000000, 0x00FF0000,
+    0x00000000, 0x00000000, 0x00800000, 0x00000000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000,
+    0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00000000, 0x00FF0000, 0x00000000, 0x00000000, 0x00FF0000,
+    0x00000000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000,
+    0x00000000, 0x00FF0000, 0x00000000, 0x00000000, 0x00800000, 0x00000000, 0x00000000, 0x00800000,
+    0x00000000, 0x00800000, 0x00000000, 0x00800000, 0x00000000, 0x00000000, 0x00FF0000, 0x00000000,
+    0x00000000, 0x00FF0000, 0x00000000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000,
+    0x00FF0000, 0x00FF0000, 0x00000000, 0x00FF0000, 0x00000000, 0x00000000, 0x00800000, 0x00000000,
+    0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00000000,
+    0x00FF0000, 0x00000000, 0x00000000, 0x00800000, 0x00000000, 0x00000000, 0x00800000, 0x00000000,
+    0x00800000, 0x00000000, 0x00800000, 0x00000000, 0x00000000, 0x00800000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000,
+    0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00800000, 0x00000000, 0x00800000, 0x00000000, 0x00800000, 0x00000000, 0x00800000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000,
+    0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000,
+    0x00FF0000, 0x00FF0000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00800000,
+    0x00000000, 0x00800000, 0x00000000, 0x00800000, 0x00000000, 0x00800000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000,
+    0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000,
+    0x00FF0000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00800000, 0x00000000,
+    0x00800000, 0x00000000, 0x00800000, 0x00000000, 0x00800000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000,
+    0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00FF0000,
+    0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000, 0x00FF0000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00800000, 0x00000000, 0x00800000,
+    0x00000000, 0x00800000, 0x00000000, 0x00800000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+    0x00808080, 0x00C0C0C0, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+    0x00808080, 0x00808080, 0x00808080, 0x00C0C0C0, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00C0C0C0, 0x00808080, 0x00808080,
+    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00C0C0C0,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00808080, 0x00FFFFFF, 0x00FFFFFF, 0x00FFFFFF, 0x00FFFFFF, 0x00FFFFFF, 0x00FFFFFF, 0x00FFFFFF,
+    0x00FFFFFF, 0x00FFFFFF, 0x00FFFFFF, 0x00FFFFFF, 0x00FFFFFF, 0x00FFFFFF, 0x00FFFFFF, 0x00FFFFFF,
+    0x00FFFFFF, 0x00FFFFFF, 0x00FFFFFF, 0x00FFFFFF, 0x00FFFFFF, 0x00FFFFFF, 0x00FFFFFF, 0x00FFFFFF,
+    0x00C0C0C0, 0x00808080, 0x00808080, 0x00FFFFFF, 0x00FFFFFF, 0x00FFFFFF, 0x00FFFFFF, 0x00FFFFFF,
+    0x00FFFFFF, 0x00FFFFFF, 0x00FFFFFF, 0x00FFFFFF, 0x00FFFFFF, 0x00FFFFFF, 0x00FFFFFF, 0x00FFFFFF,
+    0x00FFFFFF, 0x00FFFFFF, 0x00FFFFFF, 0x00FFFFFF, 0x00FFFFFF, 0x00FFFFFF, 0x00FFFFFF, 0x00FFFFFF,
+    0x00FFFFFF, 0x00FFFFFF, 0x00C0C0C0, 0x00808080, 0x00808080, 0x00FFFFFF, 0x00FFFFFF, 0x00FFFFFF,
+    0x00FFFFFF, 0x00FFFFFF, 0x00FFFFFF, 0x00FFFFFF, 0x00FFFFFF, 0x00FFFFFF, 0x00FFFFFF, 0x00FFFFFF,
+    0x00FFFFFF, 0x00FFFFFF, 0x00FFFFFF, 0x00FFFFFF, 0x00FFFFFF, 0x00FFFFFF, 0x00FFFFFF, 0x00FFFFFF,
+    0x00FFFFFF, 0x00FFFFFF, 0x00FFFFFF, 0x00FFFFFF, 0x00C0C0C0, 0x00808080, 0x00808080, 0x00FFFFFF,
+    0x00FFFFFF, 0x00FFFFFF, 0x00FFFFFF, 0x00FFFFFF, 0x00FFFFFF, 0x00FFFFFF, 0x00FFFFFF, 0x00FFFFFF,
+    0x00FFFFFF, 0x00FFFFFF, 0x00FFFFFF, 0x00FFFFFF, 0x00FFFFFF, 0x00FFFFFF, 0x00FFFFFF, 0x00FFFFFF,
+    0x00FFFFFF, 0x00FFFFFF, 0x00FFFFFF, 0x00FFFFFF, 0x00FFFFFF, 0x00FFFFFF, 0x00C0C0C0, 0x00808080,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00808080, 0x00FFFFFF, 0x00FFFFFF, 0x00FFFFFF, 0x00FFFFFF, 0x00FFFFFF, 0x00FFFFFF, 0x00FFFFFF,
+    0x00FFFFFF, 0x00FFFFFF, 0x00FFFFFF, 0x00FFFFFF, 0x00FFFFFF, 0x00FFFFFF, 0x00FFFFFF, 0x00FFFFFF,
+    0x00FFFFFF, 0x00FFFFFF, 0x00FFFFFF, 0x00FFFFFF, 0x00FFFFFF, 0x00FFFFFF, 0x00FFFFFF, 0x00C0C0C0,
+    0x00808080, 0x00808080, 0x00808080, 0x00FFFFFF, 0x00FFFFFF, 0x00FFFFFF, 0x00FFFFFF, 0x00FFFFFF,
+    0x00FFFFFF, 0x00FFFFFF, 0x00FFFFFF, 0x00FFFFFF, 0x00FFFFFF, 0x00FFFFFF, 0x00FFFFFF, 0x00FFFFFF,
+    0x00FFFFFF, 0x00FFFFFF, 0x00FFFFFF, 0x00FFFFFF, 0x00FFFFFF, 0x00FFFFFF, 0x00FFFFFF, 0x00FFFFFF,
+    0x00FFFFFF, 0x00C0C0C0, 0x00808080, 0x00808080, 0x00808080, 0x00FFFFFF, 0x00FFFFFF, 0x00FFFFFF,
+    0x00FFFFFF, 0x00FFFFFF, 0x00FFFFFF, 0x00FFFFFF, 0x00FFFFFF, 0x00FFFFFF, 0x00FFFFFF, 0x00FFFFFF,
+    0x00FFFFFF, 0x00FFFFFF, 0x00FFFFFF, 0x00FFFFFF, 0x00FFFFFF, 0x00FFFFFF, 0x00FFFFFF, 0x00FFFFFF,
+    0x00FFFFFF, 0x00FFFFFF, 0x00FFFFFF, 0x00C0C0C0, 0x00808080, 0x00808080, 0x00808080, 0x00FFFFFF,
+    0x00FFFFFF, 0x00FFFFFF, 0x00FFFFFF, 0x00FFFFFF, 0x00FFFFFF, 0x00FFFFFF, 0x00FFFFFF, 0x00FFFFFF,
+    0x00FFFFFF, 0x00FFFFFF, 0x00FFFFFF, 0x00FFFFFF, 0x00FFFFFF, 0x00FFFFFF, 0x00FFFFFF, 0x00FFFFFF,
+    0x00FFFFFF, 0x00FFFFFF, 0x00FFFFFF, 0x00FFFFFF, 0x00FFFFFF, 0x00C0C0C0, 0x00808080, 0x00808080,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00808080, 0x00FFFFFF, 0x00FFFFFF, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00808080,
+    0x00808080, 0x00808080, 0x00808080, 0x00FFFFFF, 0x00FFFFFF, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00FFFFFF, 0x00FFFFFF, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00FFFFFF,
+    0x00FFFFFF, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00808080, 0x00808080, 0x00808080,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00808080, 0x00FFFFFF, 0x00FFFFFF, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00808080,
+    0x00808080, 0x00808080, 0x00808080, 0x00FFFFFF, 0x00FFFFFF, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00FFFFFF, 0x00FFFFFF, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00FFFFFF,
+    0x00FFFFFF, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00808080, 0x00808080, 0x00808080,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00808080, 0x00FFFFFF, 0x00FFFFFF, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00808080,
+    0x00808080, 0x00808080, 0x00808080, 0x00FFFFFF, 0x00FFFFFF, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00FFFFFF, 0x00FFFFFF, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00FFFFFF,
+    0x00FFFFFF, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00808080, 0x00808080, 0x00808080,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00808080, 0x00FFFFFF, 0x00FFFFFF, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00000000, 0x00000000, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00,
+    0x00000000, 0x00000000, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00808080,
+    0x00808080, 0x00808080, 0x00808080, 0x00FFFFFF, 0x00FFFFFF, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00000000, 0x00000000, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00,
+    0x00FFFF00, 0x00FFFF00, 0x00000000, 0x00000000, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00FFFFFF, 0x00FFFFFF, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00000000, 0x00000000, 0x00FFFF00,
+    0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00000000, 0x00000000, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00FFFFFF,
+    0x00FFFFFF, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00000000,
+    0x00000000, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00000000, 0x00000000,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00808080, 0x00808080, 0x00808080,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00808080, 0x00FFFFFF, 0x00FFFFFF, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00000000, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00,
+    0x00FFFF00, 0x00FFFF00, 0x00000000, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00808080,
+    0x00808080, 0x00808080, 0x00808080, 0x00FFFFFF, 0x00FFFFFF, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00000000, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00,
+    0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00000000, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00FFFFFF, 0x00FFFFFF, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00000000, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00,
+    0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00000000, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00FFFFFF,
+    0x00FFFFFF, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00000000, 0x00FFFF00,
+    0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00,
+    0x00000000, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00808080, 0x00808080, 0x00808080,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00808080, 0x00FFFFFF, 0x00FFFFFF, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00000000,
+    0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00,
+    0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00000000, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00808080,
+    0x00808080, 0x00808080, 0x00808080, 0x00FFFFFF, 0x00FFFFFF, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00000000, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00,
+    0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00000000, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00FFFFFF, 0x00FFFFFF, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00000000, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00,
+    0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00000000,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00FFFFFF,
+    0x00FFFFFF, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00000000, 0x00FFFF00, 0x00FFFF00,
+    0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00,
+    0x00FFFF00, 0x00000000, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00808080, 0x00808080, 0x00808080,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00808080, 0x00FFFFFF, 0x00FFFFFF, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00000000, 0x00FFFF00,
+    0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00,
+    0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00000000, 0x00C0C0C0, 0x00C0C0C0, 0x00808080,
+    0x00808080, 0x00808080, 0x00808080, 0x00FFFFFF, 0x00FFFFFF, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00000000, 0x00FFFF00, 0x00FFFF00, 0x00808000, 0x00000000, 0x00808000, 0x00FFFF00, 0x00FFFF00,
+    0x00FFFF00, 0x00808000, 0x00000000, 0x00808000, 0x00FFFF00, 0x00FFFF00, 0x00000000, 0x00C0C0C0,
+    0x00C0C0C0, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00FFFFFF, 0x00FFFFFF, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00000000, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00,
+    0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00,
+    0x00000000, 0x00C0C0C0, 0x00C0C0C0, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00FFFFFF,
+    0x00FFFFFF, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00000000, 0x00FFFF00, 0x00FFFF00, 0x00000000,
+    0x00FFFF00, 0x00000000, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00000000, 0x00FFFF00, 0x00000000,
+    0x00FFFF00, 0x00FFFF00, 0x00000000, 0x00C0C0C0, 0x00C0C0C0, 0x00808080, 0x00808080, 0x00808080,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00808080, 0x00FFFFFF, 0x00FFFFFF, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00000000, 0x00FFFF00,
+    0x00FFFF00, 0x00FFFF00, 0x00000000, 0x00000000, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00000000,
+    0x00000000, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00000000, 0x00C0C0C0, 0x00C0C0C0, 0x00808080,
+    0x00808080, 0x00808080, 0x00808080, 0x00FFFFFF, 0x00FFFFFF, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00000000, 0x00FFFF00, 0x00FFFF00, 0x00000000, 0x00000000, 0x00000000, 0x00FFFF00, 0x00FFFF00,
+    0x00FFFF00, 0x00000000, 0x00000000, 0x00000000, 0x00FFFF00, 0x00FFFF00, 0x00000000, 0x00C0C0C0,
+    0x00C0C0C0, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00FFFFFF, 0x00FFFFFF, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00000000, 0x00FFFF00, 0x00FFFF00, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00FFFF00, 0x00FFFF00,
+    0x00000000, 0x00C0C0C0, 0x00C0C0C0, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00FFFFFF,
+    0x00FFFFFF, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00000000, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00,
+    0x00000000, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00000000, 0x00FFFF00,
+    0x00FFFF00, 0x00FFFF00, 0x00000000, 0x00C0C0C0, 0x00C0C0C0, 0x00808080, 0x00808080, 0x00808080,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00808080, 0x00FFFFFF, 0x00FFFFFF, 0x00C0C0C0, 0x00C0C0C0, 0x00000000, 0x00FFFF00, 0x00FFFF00,
+    0x00FFFF00, 0x00FFFF00, 0x00000000, 0x00000000, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00000000,
+    0x00000000, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00000000, 0x00C0C0C0, 0x00808080,
+    0x00808080, 0x00808080, 0x00808080, 0x00FFFFFF, 0x00FFFFFF, 0x00C0C0C0, 0x00C0C0C0, 0x00000000,
+    0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00808000, 0x00000000, 0x00808000, 0x00FFFF00, 0x00FFFF00,
+    0x00FFFF00, 0x00808000, 0x00000000, 0x00808000, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00000000,
+    0x00C0C0C0, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00FFFFFF, 0x00FFFFFF, 0x00C0C0C0,
+    0x00C0C0C0, 0x00000000, 0x00FFFF00, 0x00FFFF00, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00FFFF00, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00FFFF00,
+    0x00FFFF00, 0x00000000, 0x00C0C0C0, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00FFFFFF,
+    0x00FFFFFF, 0x00C0C0C0, 0x00C0C0C0, 0x00000000, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00000000,
+    0x00FFFF00, 0x00000000, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00000000, 0x00FFFF00, 0x00000000,
+    0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00000000, 0x00C0C0C0, 0x00808080, 0x00808080, 0x00808080,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00808080, 0x00FFFFFF, 0x00FFFFFF, 0x00C0C0C0, 0x00C0C0C0, 0x00000000, 0x00FFFF00, 0x00FFFF00,
+    0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00,
+    0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00000000, 0x00C0C0C0, 0x00808080,
+    0x00808080, 0x00808080, 0x00808080, 0x00FFFFFF, 0x00FFFFFF, 0x00C0C0C0, 0x00C0C0C0, 0x00000000,
+    0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00,
+    0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00000000,
+    0x00C0C0C0, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00FFFFFF, 0x00FFFFFF, 0x00C0C0C0,
+    0x00C0C0C0, 0x00000000, 0x00FFFF00, 0x00000000, 0x00FFFF00, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00FFFF00, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00FFFF00, 0x00000000,
+    0x00FFFF00, 0x00000000, 0x00C0C0C0, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00FFFFFF,
+    0x00FFFFFF, 0x00C0C0C0, 0x00C0C0C0, 0x00000000, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00,
+    0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00,
+    0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00000000, 0x00C0C0C0, 0x00808080, 0x00808080, 0x00808080,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00808080, 0x00FFFFFF, 0x00FFFFFF, 0x00C0C0C0, 0x00C0C0C0, 0x00000000, 0x00FFFF00, 0x00FFFF00,
+    0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00,
+    0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00000000, 0x00C0C0C0, 0x00808080,
+    0x00808080, 0x00808080, 0x00808080, 0x00FFFFFF, 0x00FFFFFF, 0x00C0C0C0, 0x00C0C0C0, 0x00000000,
+    0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00,
+    0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00000000,
+    0x00C0C0C0, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00FFFFFF, 0x00FFFFFF, 0x00C0C0C0,
+    0x00C0C0C0, 0x00000000, 0x00000000, 0x00FFFF00, 0x00FFFF00, 0x00808000, 0x00000000, 0x00000000,
+    0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00000000, 0x00000000, 0x00808000, 0x00FFFF00, 0x00FFFF00,
+    0x00000000, 0x00000000, 0x00C0C0C0, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00FFFFFF,
+    0x00FFFFFF, 0x00C0C0C0, 0x00C0C0C0, 0x00000000, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00,
+    0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00,
+    0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00000000, 0x00C0C0C0, 0x00808080, 0x00808080, 0x00808080,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00808080, 0x00FFFFFF, 0x00FFFFFF, 0x00C0C0C0, 0x00C0C0C0, 0x00000000, 0x00FFFF00, 0x00FFFF00,
+    0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00,
+    0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00000000, 0x00C0C0C0, 0x00808080,
+    0x00808080, 0x00808080, 0x00808080, 0x00FFFFFF, 0x00FFFFFF, 0x00C0C0C0, 0x00C0C0C0, 0x00000000,
+    0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00000000, 0x00000000,
+    0x00000000, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00000000,
+    0x00C0C0C0, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00FFFFFF, 0x00FFFFFF, 0x00C0C0C0,
+    0x00C0C0C0, 0x00000000, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00,
+    0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00,
+    0x00FFFF00, 0x00000000, 0x00C0C0C0, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00FFFFFF,
+    0x00FFFFFF, 0x00C0C0C0, 0x00C0C0C0, 0x00000000, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00,
+    0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00,
+    0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00000000, 0x00C0C0C0, 0x00808080, 0x00808080, 0x00808080,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00808080, 0x00FFFFFF, 0x00FFFFFF, 0x00C0C0C0, 0x00C0C0C0, 0x00000000, 0x00FFFF00, 0x00FFFF00,
+    0x00FFFF00, 0x00000000, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00,
+    0x00FFFF00, 0x00000000, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00000000, 0x00C0C0C0, 0x00808080,
+    0x00808080, 0x00808080, 0x00808080, 0x00FFFFFF, 0x00FFFFFF, 0x00C0C0C0, 0x00C0C0C0, 0x00000000,
+    0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00808000, 0x00000000, 0x00FFFF00,
+    0x00000000, 0x00808000, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00000000,
+    0x00C0C0C0, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00FFFFFF, 0x00FFFFFF, 0x00C0C0C0,
+    0x00C0C0C0, 0x00000000, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00,
+    0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00,
+    0x00FFFF00, 0x00000000, 0x00C0C0C0, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00FFFFFF,
+    0x00FFFFFF, 0x00C0C0C0, 0x00C0C0C0, 0x00000000, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00,
+    0x00FFFF00, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00FFFF00, 0x00FFFF00,
+    0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00000000, 0x00C0C0C0, 0x00808080, 0x00808080, 0x00808080,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00808080, 0x00FFFFFF, 0x00FFFFFF, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00000000, 0x00FFFF00,
+    0x00FFFF00, 0x00FFFF00, 0x00000000, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00,
+    0x00000000, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00000000, 0x00C0C0C0, 0x00C0C0C0, 0x00808080,
+    0x00808080, 0x00808080, 0x00808080, 0x00FFFFFF, 0x00FFFFFF, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00000000, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00000000, 0x00FFFF00, 0x00FFFF00,
+    0x00FFFF00, 0x00000000, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00000000, 0x00C0C0C0,
+    0x00C0C0C0, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00FFFFFF, 0x00FFFFFF, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00000000, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00000000, 0x00FFFF00,
+    0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00000000, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00,
+    0x00000000, 0x00C0C0C0, 0x00C0C0C0, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00FFFFFF,
+    0x00FFFFFF, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00000000, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00,
+    0x00000000, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00000000, 0x00FFFF00,
+    0x00FFFF00, 0x00FFFF00, 0x00000000, 0x00C0C0C0, 0x00C0C0C0, 0x00808080, 0x00808080, 0x00808080,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00808080, 0x00FFFFFF, 0x00FFFFFF, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00000000, 0x00FFFF00,
+    0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00000000, 0x00C0C0C0, 0x00C0C0C0, 0x00808080,
+    0x00808080, 0x00808080, 0x00808080, 0x00FFFFFF, 0x00FFFFFF, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00000000, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00808000, 0x00000000, 0x00FFFF00,
+    0x00000000, 0x00808000, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00000000, 0x00C0C0C0,
+    0x00C0C0C0, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00FFFFFF, 0x00FFFFFF, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00000000, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00,
+    0x00000000, 0x00C0C0C0, 0x00C0C0C0, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00FFFFFF,
+    0x00FFFFFF, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00000000, 0x00FFFF00, 0x00FFFF00, 0x00000000,
+    0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00000000,
+    0x00FFFF00, 0x00FFFF00, 0x00000000, 0x00C0C0C0, 0x00C0C0C0, 0x00808080, 0x00808080, 0x00808080,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00808080, 0x00FFFFFF, 0x00FFFFFF, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00000000,
+    0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00,
+    0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00000000, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00808080,
+    0x00808080, 0x00808080, 0x00808080, 0x00FFFFFF, 0x00FFFFFF, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00000000, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00000000, 0x00000000,
+    0x00000000, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00000000, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00FFFFFF, 0x00FFFFFF, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00000000, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00,
+    0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00000000,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00FFFFFF,
+    0x00FFFFFF, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00000000, 0x00FFFF00, 0x00FFFF00,
+    0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00,
+    0x00FFFF00, 0x00000000, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00808080, 0x00808080, 0x00808080,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00808080, 0x00FFFFFF, 0x00FFFFFF, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00000000, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00,
+    0x00FFFF00, 0x00FFFF00, 0x00000000, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00808080,
+    0x00808080, 0x00808080, 0x00808080, 0x00FFFFFF, 0x00FFFFFF, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00000000, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00,
+    0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00000000, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00FFFFFF, 0x00FFFFFF, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00000000, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00,
+    0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00000000, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00FFFFFF,
+    0x00FFFFFF, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00000000, 0x00FFFF00,
+    0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00,
+    0x00000000, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00808080, 0x00808080, 0x00808080,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00808080, 0x00FFFFFF, 0x00FFFFFF, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00000000, 0x00000000, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00,
+    0x00000000, 0x00000000, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00808080,
+    0x00808080, 0x00808080, 0x00808080, 0x00FFFFFF, 0x00FFFFFF, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00000000, 0x00000000, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00,
+    0x00FFFF00, 0x00FFFF00, 0x00000000, 0x00000000, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00FFFFFF, 0x00FFFFFF, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00000000, 0x00000000, 0x00FFFF00,
+    0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00000000, 0x00000000, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00FFFFFF,
+    0x00FFFFFF, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00000000,
+    0x00000000, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00FFFF00, 0x00000000, 0x00000000,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00808080, 0x00808080, 0x00808080,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00808080, 0x00FFFFFF, 0x00FFFFFF, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00808080,
+    0x00808080, 0x00808080, 0x00808080, 0x00FFFFFF, 0x00FFFFFF, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00FFFFFF, 0x00FFFFFF, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00FFFFFF,
+    0x00FFFFFF, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00808080, 0x00808080, 0x00808080,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00808080, 0x00FFFFFF, 0x00FFFFFF, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00808080,
+    0x00808080, 0x00808080, 0x00808080, 0x00FFFFFF, 0x00FFFFFF, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00FFFFFF, 0x00FFFFFF, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00FFFFFF,
+    0x00FFFFFF, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0,
+    0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00C0C0C0, 0x00808080, 0x00808080, 0x00808080,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00808080, 0x00FFFFFF, 0x00C0C0C0, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+    0x00808080, 0x00808080, 0x00808080, 0x00FFFFFF, 0x00C0C0C0, 0x00808080, 0x00808080, 0x00808080,
+    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00FFFFFF, 0x00C0C0C0, 0x00808080,
+    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00FFFFFF,
+    0x00C0C0C0, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00808080, 0x00C0C0C0, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+    0x00808080, 0x00808080, 0x00808080, 0x00C0C0C0, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00C0C0C0, 0x00808080, 0x00808080,
+    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00C0C0C0,
+    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00C0C0C0, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+    0x00808080, 0x00808080, 0x00C0C0C0, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00C0C0C0, 0x00808080, 0x00808080, 0x00808080,
+    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00C0C0C0, 0x00808080,
+    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000
+};
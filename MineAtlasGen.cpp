@@ -0,0 +1,444 @@
+/**
+    @file MineAtlasGen.cpp
+
+    @author Craig Burkhart
+
+    @brief Build tool that packs the sprite bitmaps into the atlas compiled
+           into the renderer, so the game never decodes a bitmap at run time.
+*//*
+    Copyright (C) 2014 - Craig Burkhart
+
+    This file is part of Minesweeper Deluxe.
+
+    Minesweeper Deluxe is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Minesweeper Deluxe is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Minesweeper Deluxe.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#include "stdafx.h"
+#include "MineAtlasGen.h"
+#include "MineDebug.h"
+
+/** License block placed at the top of the generated header. */
+static const LPCSTR headerLicense =
+    "/*\n"
+    "    Copyright (C) 2014 - Craig Burkhart\n"
+    "\n"
+    "    This file is part of Minesweeper Deluxe.\n"
+    "\n"
+    "    Minesweeper Deluxe is free software: you can redistribute it and/or modify\n"
+    "    it under the terms of the GNU General Public License as published by\n"
+    "    the Free Software Foundation, either version 3 of the License, or\n"
+    "    (at your option) any later version.\n"
+    "\n"
+    "    Minesweeper Deluxe is distributed in the hope that it will be useful,\n"
+    "    but WITHOUT ANY WARRANTY; without even the implied warranty of\n"
+    "    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the\n"
+    "    GNU General Public License for more details.\n"
+    "\n"
+    "    You should have received a copy of the GNU General Public License\n"
+    "    along with Minesweeper Deluxe.  If not, see <http://www.gnu.org/licenses/>.\n"
+    "*/\n";
+
+/**
+    main
+*//**
+    Decode every sprite BMP file and write the atlas header.
+
+    Usage: mineatlasgen [-s sprite dir] [-o header file]
+
+    @param[in] argc - Number of command line arguments.
+    @param[in] argv - Command line arguments.
+
+    @return 0 if the header was written, 1 otherwise.
+*/
+int
+main(int argc, char* argv[])
+{
+    BOOLEAN    bFalse = FALSE;
+    HANDLE     hHeap = NULL;
+    INT        ix = 0;
+    UINT32*    pAtlas = NULL;
+    LPCSTR     pHeaderFile = "MineAtlasData.h";
+    LPCSTR     pSpriteDir = ".";
+    MINE_ERROR status = MINE_ERROR_SUCCESS;
+
+    do
+    {
+        for (ix = 1; ix < argc; ix++)
+        {
+            if ((0 == strcmp(argv[ix], "-s")) && (ix + 1 < argc))
+            {
+                pSpriteDir = argv[++ix];
+            }
+            else if ((0 == strcmp(argv[ix], "-o")) && (ix + 1 < argc))
+            {
+                pHeaderFile = argv[++ix];
+            }
+            else
+            {
+                (void) fprintf(stderr, "Usage: %s [-s sprite dir] [-o header file]\n", argv[0]);
+                status = MINE_ERROR_PARAMETER;
+                break;
+            }
+        }
+        if (MINE_ERROR_SUCCESS != status)
+        {
+            break;
+        }
+
+        hHeap = GetProcessHeap();
+        if (NULL == hHeap)
+        {
+            status = MINE_ERROR_HEAP;
+            break;
+        }
+
+        //Pixels between sprites are left black
+        pAtlas = (UINT32*) HeapAlloc(hHeap, HEAP_ZERO_MEMORY, MINE_ATLAS_WIDTH*MINE_ATLAS_HEIGHT*sizeof(UINT32));
+        if (NULL == pAtlas)
+        {
+            status = MINE_ERROR_MEMORY;
+            break;
+        }
+
+        status = MineAtlasGen_LoadSprites(pSpriteDir, pAtlas);
+        if (MINE_ERROR_SUCCESS != status)
+        {
+            (void) fprintf(stderr, "Unable to load sprites from %s: %i\n", pSpriteDir, (int) status);
+            break;
+        }
+
+        status = MineAtlasGen_WriteHeader(pHeaderFile, pAtlas);
+        if (MINE_ERROR_SUCCESS != status)
+        {
+            (void) fprintf(stderr, "Unable to write %s: %i\n", pHeaderFile, (int) status);
+            break;
+        }
+
+        __assume(FALSE == bFalse);
+    } while (bFalse);
+
+    //Clean up
+    if (NULL != pAtlas)
+    {
+        (void) HeapFree(hHeap, 0, pAtlas);
+        pAtlas = NULL;
+    }
+
+    return (MINE_ERROR_SUCCESS == status) ? 0 : 1;
+}
+
+/**
+    MineAtlasGen_DecodeBitmap
+*//**
+    Convert an uncompressed 24 or 32 bit bitmap into its slot in the atlas.
+
+    @param[in]  pHeader    - Pointer to the BITMAPINFOHEADER of the bitmap.
+    @param[in]  pPixels    - Pointer to the first byte of pixel data.
+    @param[in]  pixelBytes - Number of bytes available at pPixels.
+    @param[in]  pInfo      - Location of the sprite in the atlas.
+    @param[out] pAtlas     - Atlas pixels (0x00RRGGBB), MINE_ATLAS_WIDTH pixels per row.
+
+    @return Mine error code (MINE_ERROR_SUCCESS upon success).
+*/
+MINE_ERROR
+MineAtlasGen_DecodeBitmap(_In_ const BYTE* pHeader, _In_ const BYTE* pPixels, SIZE_T pixelBytes,
+                          _In_ const MINE_SPRITE_INFO* pInfo, _Inout_ UINT32* pAtlas)
+{
+    BOOLEAN     bFalse = FALSE;
+    DWORD       bitCount = 0;
+    DWORD       bytesPerPixel = 0;
+    DWORD       compression = 0;
+    LONG        height = 0;
+    LONG        ix = 0;
+    LONG        jx = 0;
+    UINT32*     pDest = NULL;
+    const BYTE* pSource = NULL;
+    SIZE_T      rowBytes = 0;
+    MINE_ERROR  status = MINE_ERROR_SUCCESS;
+    LONG        width = 0;
+
+    do
+    {
+        if ((NULL == pHeader) || (NULL == pPixels) || (NULL == pInfo) || (NULL == pAtlas))
+        {
+            MineDebug_PrintError("Invalid parameter to MineAtlasGen_DecodeBitmap\n");
+            status = MINE_ERROR_PARAMETER;
+            break;
+        }
+
+        width = (LONG) MINE_ATLASGEN_READ32(pHeader + 4);
+        height = (LONG) MINE_ATLASGEN_READ32(pHeader + 8);
+        bitCount = MINE_ATLASGEN_READ16(pHeader + 14);
+        compression = MINE_ATLASGEN_READ32(pHeader + 16);
+
+        if ((0 != compression) || ((24 != bitCount) && (32 != bitCount)) ||
+            (width != pInfo->width) || ((height != pInfo->height) && (height != -pInfo->height)))
+        {
+            (void) fprintf(stderr, "Unsupported bitmap %s: %li x %li, %lu bits\n", pInfo->fileName,
+                           (long) width, (long) height, (unsigned long) bitCount);
+            status = MINE_ERROR_BITMAP;
+            break;
+        }
+
+        //Bitmap rows are padded to a multiple of four bytes
+        bytesPerPixel = bitCount / 8;
+        rowBytes = (((SIZE_T) width*bitCount + 31) / 32) * 4;
+
+        if (pixelBytes < rowBytes*((SIZE_T) pInfo->height))
+        {
+            (void) fprintf(stderr, "Bitmap %s pixel data is truncated\n", pInfo->fileName);
+            status = MINE_ERROR_BITMAP;
+            break;
+        }
+
+        /** Positive heights are stored bottom row first, negative heights top row first. */
+        for (jx = 0; jx < pInfo->height; jx++)
+        {
+            pSource = pPixels + rowBytes*((SIZE_T) ((height > 0) ? (height - 1 - jx) : jx));
+            pDest = pAtlas + (pInfo->y + jx)*MINE_ATLAS_WIDTH + pInfo->x;
+
+            for (ix = 0; ix < width; ix++)
+            {
+                //Bitmap pixels are stored blue, green, red
+                pDest[ix] = ((UINT32) pSource[2] << 16) | ((UINT32) pSource[1] << 8) | (UINT32) pSource[0];
+                pSource += bytesPerPixel;
+            }
+        }
+
+        __assume(FALSE == bFalse);
+    } while (bFalse);
+
+    return status;
+}
+
+/**
+    MineAtlasGen_LoadSprites
+*//**
+    Decode every sprite BMP file into the atlas.
+
+    @param[in]  pSpriteDir - Directory holding the BMP files.
+    @param[out] pAtlas     - Atlas pixels (0x00RRGGBB), MINE_ATLAS_WIDTH pixels per row.
+
+    @return Mine error code (MINE_ERROR_SUCCESS upon success).
+*/
+MINE_ERROR
+MineAtlasGen_LoadSprites(_In_z_ LPCSTR pSpriteDir, _Inout_ UINT32* pAtlas)
+{
+    BOOLEAN                 bFalse = FALSE;
+    SIZE_T                  dataBytes = 0;
+    long                    fileBytes = 0;
+    HANDLE                  hHeap = NULL;
+    UINT                    ix = 0;
+    DWORD                   offBits = 0;
+    CHAR                    path[MINE_ATLASGEN_PATH_CHARS] = {0};
+    FILE*                   pFile = NULL;
+    BYTE*                   pFileData = NULL;
+    const MINE_SPRITE_INFO* pInfo = NULL;
+    MINE_ERROR              status = MINE_ERROR_SUCCESS;
+
+    do
+    {
+        if ((NULL == pSpriteDir) || (NULL == pAtlas))
+        {
+            MineDebug_PrintError("Invalid parameter to MineAtlasGen_LoadSprites\n");
+            status = MINE_ERROR_PARAMETER;
+            break;
+        }
+
+        hHeap = GetProcessHeap();
+        if (NULL == hHeap)
+        {
+            status = MINE_ERROR_HEAP;
+            break;
+        }
+
+        for (ix = 0; ix < MINE_SPRITE_COUNT; ix++)
+        {
+            pInfo = MineSprite_GetInfo(ix);
+
+            /** BMP files are a BITMAPFILEHEADER, a BITMAPINFOHEADER, then the pixels. */
+            if (MINE_ATLASGEN_PATH_CHARS <= snprintf(path, MINE_ATLASGEN_PATH_CHARS, "%s/%s",
+                                                     pSpriteDir, pInfo->fileName))
+            {
+                (void) fprintf(stderr, "Path of bitmap file %s is too long\n", pInfo->fileName);
+                status = MINE_ERROR_BITMAP;
+                break;
+            }
+
+            if ((0 != fopen_s(&pFile, path, "rb")) || (NULL == pFile))
+            {
+                (void) fprintf(stderr, "Opening bitmap file %s\n", path);
+                status = MINE_ERROR_BITMAP;
+                break;
+            }
+
+            (void) fseek(pFile, 0, SEEK_END);
+            fileBytes = ftell(pFile);
+            (void) fseek(pFile, 0, SEEK_SET);
+
+            if (fileBytes < MINE_ATLASGEN_BMP_FILE_HEADER + MINE_ATLASGEN_BMP_INFO_HEADER)
+            {
+                (void) fprintf(stderr, "Bitmap file %s is too small\n", path);
+                status = MINE_ERROR_BITMAP;
+                break;
+            }
+
+            pFileData = (BYTE*) HeapAlloc(hHeap, 0, (SIZE_T) fileBytes);
+            if (NULL == pFileData)
+            {
+                status = MINE_ERROR_MEMORY;
+                break;
+            }
+
+            dataBytes = fread(pFileData, 1, (SIZE_T) fileBytes, pFile);
+            offBits = MINE_ATLASGEN_READ32(pFileData + MINE_ATLASGEN_BMP_OFFBITS);
+
+            if (((SIZE_T) fileBytes != dataBytes) || ('B' != pFileData[0]) || ('M' != pFileData[1]) ||
+                (offBits >= dataBytes))
+            {
+                (void) fprintf(stderr, "Reading bitmap file %s\n", path);
+                status = MINE_ERROR_BITMAP;
+                break;
+            }
+
+            status = MineAtlasGen_DecodeBitmap(pFileData + MINE_ATLASGEN_BMP_FILE_HEADER, pFileData + offBits,
+                                               dataBytes - offBits, pInfo, pAtlas);
+
+            (void) HeapFree(hHeap, 0, pFileData);
+            pFileData = NULL;
+            (void) fclose(pFile);
+            pFile = NULL;
+
+            if (MINE_ERROR_SUCCESS != status)
+            {
+                break;
+            }
+        }
+        if (MINE_ERROR_SUCCESS != status)
+        {
+            break;
+        }
+
+        __assume(FALSE == bFalse);
+    } while (bFalse);
+
+    //Clean up
+    if (NULL != pFileData)
+    {
+        (void) HeapFree(hHeap, 0, pFileData);
+        pFileData = NULL;
+    }
+
+    if (NULL != pFile)
+    {
+        (void) fclose(pFile);
+        pFile = NULL;
+    }
+
+    return status;
+}
+
+/**
+    MineAtlasGen_WriteHeader
+*//**
+    Write the atlas out as a C++ header holding one constant pixel array.
+
+    @param[in] pFileName - Name of header file to create.
+    @param[in] pAtlas    - Atlas pixels (0x00RRGGBB), MINE_ATLAS_WIDTH pixels per row.
+
+    @return Mine error code (MINE_ERROR_SUCCESS upon success).
+*/
+MINE_ERROR
+MineAtlasGen_WriteHeader(_In_z_ LPCSTR pFileName, _In_ const UINT32* pAtlas)
+{
+    BOOLEAN    bFalse = FALSE;
+    UINT       ix = 0;
+    FILE*      pFile = NULL;
+    MINE_ERROR status = MINE_ERROR_SUCCESS;
+
+    do
+    {
+        if ((NULL == pFileName) || (NULL == pAtlas))
+        {
+            MineDebug_PrintError("Invalid parameter to MineAtlasGen_WriteHeader\n");
+            status = MINE_ERROR_PARAMETER;
+            break;
+        }
+
+        if ((0 != fopen_s(&pFile, pFileName, "wb")) || (NULL == pFile))
+        {
+            (void) fprintf(stderr, "Opening header file %s\n", pFileName);
+            status = MINE_ERROR_PARAMETER;
+            break;
+        }
+
+        /** The array is const data initialized at compile time, so the atlas is
+            ready to draw from as soon as the program is loaded. */
+        if (0 > fprintf(pFile,
+                        "/**\n"
+                        "    @file MineAtlasData.h\n"
+                        "\n"
+                        "    @author Craig Burkhart\n"
+                        "\n"
+                        "    @brief Sprite atlas pixels generated by mineatlasgen from the sprite BMP\n"
+                        "           files. Do not edit, run make atlas after changing a BMP file.\n"
+                        "*/%s"
+                        "#pragma once\n"
+                        "\n"
+                        "#include \"MineSprite.h\"\n"
+                        "\n"
+                        "/** Sprite atlas pixels (0x00RRGGBB), MINE_ATLAS_WIDTH pixels per row. */\n"
+                        "static const UINT32 mineAtlasPixels[MINE_ATLAS_WIDTH*MINE_ATLAS_HEIGHT] =\n"
+                        "{",
+                        headerLicense))
+        {
+            status = MINE_ERROR_BITMAP;
+            break;
+        }
+
+        for (ix = 0; ix < MINE_ATLAS_WIDTH*MINE_ATLAS_HEIGHT; ix++)
+        {
+            if (0 > fprintf(pFile, "%s0x%08X%s", (0 == ix % MINE_ATLASGEN_PIXELS_PER_LINE) ? "\n    " : " ",
+                            (unsigned int) pAtlas[ix], (MINE_ATLAS_WIDTH*MINE_ATLAS_HEIGHT - 1 == ix) ? "" : ","))
+            {
+                status = MINE_ERROR_BITMAP;
+                break;
+            }
+        }
+        if (MINE_ERROR_SUCCESS != status)
+        {
+            break;
+        }
+
+        if (0 > fprintf(pFile, "\n};\n"))
+        {
+            status = MINE_ERROR_BITMAP;
+            break;
+        }
+
+        __assume(FALSE == bFalse);
+    } while (bFalse);
+
+    //Clean up
+    if (NULL != pFile)
+    {
+        if ((0 != fclose(pFile)) && (MINE_ERROR_SUCCESS == status))
+        {
+            (void) fprintf(stderr, "Closing header file %s\n", pFileName);
+            status = MINE_ERROR_BITMAP;
+        }
+        pFile = NULL;
+    }
+
+    return status;
+}
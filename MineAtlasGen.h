@@ -0,0 +1,97 @@
+/**
+    @file MineAtlasGen.h
+
+    @author Craig Burkhart
+
+    @brief Header file for the build tool that packs the sprite bitmaps into
+           the atlas compiled into the renderer.
+*//*
+    Copyright (C) 2014 - Craig Burkhart
+
+    This file is part of Minesweeper Deluxe.
+
+    Minesweeper Deluxe is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Minesweeper Deluxe is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Minesweeper Deluxe.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#pragma once
+
+#include "MineSprite.h"
+
+//--------------------------------------------------------------
+//    Macros
+//--------------------------------------------------------------
+
+/** Byte offset of the pixel data offset in a BITMAPFILEHEADER. */
+#define MINE_ATLASGEN_BMP_OFFBITS     10
+/** Number of bytes in a BITMAPFILEHEADER. */
+#define MINE_ATLASGEN_BMP_FILE_HEADER 14
+/** Number of bytes in a BITMAPINFOHEADER. */
+#define MINE_ATLASGEN_BMP_INFO_HEADER 40
+
+/** Maximum number of characters in the path of a sprite bitmap file. */
+#define MINE_ATLASGEN_PATH_CHARS 260
+
+/** Number of atlas pixels written on each line of the generated header. */
+#define MINE_ATLASGEN_PIXELS_PER_LINE 8
+
+/** Read a little endian 16 bit value from a bitmap header. */
+#define MINE_ATLASGEN_READ16(p) ((DWORD) (p)[0] | ((DWORD) (p)[1] << 8))
+/** Read a little endian 32 bit value from a bitmap header. */
+#define MINE_ATLASGEN_READ32(p) (MINE_ATLASGEN_READ16(p) | (MINE_ATLASGEN_READ16((p) + 2) << 16))
+
+//--------------------------------------------------------------
+//    Function Prototypes
+//--------------------------------------------------------------
+
+/**
+    MineAtlasGen_DecodeBitmap
+*//**
+    Convert an uncompressed 24 or 32 bit bitmap into its slot in the atlas.
+
+    @param[in]  pHeader    - Pointer to the BITMAPINFOHEADER of the bitmap.
+    @param[in]  pPixels    - Pointer to the first byte of pixel data.
+    @param[in]  pixelBytes - Number of bytes available at pPixels.
+    @param[in]  pInfo      - Location of the sprite in the atlas.
+    @param[out] pAtlas     - Atlas pixels (0x00RRGGBB), MINE_ATLAS_WIDTH pixels per row.
+
+    @return Mine error code (MINE_ERROR_SUCCESS upon success).
+*/
+MINE_ERROR
+MineAtlasGen_DecodeBitmap(_In_ const BYTE* pHeader, _In_ const BYTE* pPixels, SIZE_T pixelBytes,
+                          _In_ const MINE_SPRITE_INFO* pInfo, _Inout_ UINT32* pAtlas);
+
+/**
+    MineAtlasGen_LoadSprites
+*//**
+    Decode every sprite BMP file into the atlas.
+
+    @param[in]  pSpriteDir - Directory holding the BMP files.
+    @param[out] pAtlas     - Atlas pixels (0x00RRGGBB), MINE_ATLAS_WIDTH pixels per row.
+
+    @return Mine error code (MINE_ERROR_SUCCESS upon success).
+*/
+MINE_ERROR
+MineAtlasGen_LoadSprites(_In_z_ LPCSTR pSpriteDir, _Inout_ UINT32* pAtlas);
+
+/**
+    MineAtlasGen_WriteHeader
+*//**
+    Write the atlas out as a C++ header holding one constant pixel array.
+
+    @param[in] pFileName - Name of header file to create.
+    @param[in] pAtlas    - Atlas pixels (0x00RRGGBB), MINE_ATLAS_WIDTH pixels per row.
+
+    @return Mine error code (MINE_ERROR_SUCCESS upon success).
+*/
+MINE_ERROR
+MineAtlasGen_WriteHeader(_In_z_ LPCSTR pFileName, _In_ const UINT32* pAtlas);
@@ -0,0 +1,587 @@
+/**
+    @file MineBelief.cpp
+
+    @author Craig Burkhart
+
+    @brief Approximate mine probability engine. Runs loopy belief propagation
+           between the hidden tiles and the revealed numbers around them, with
+           the count of mines left folded in as the chance of a tile before any
+           number is read. Messages are kept between solves, and only numbers
+           whose inputs moved are updated again, so after a reveal the work
+           follows the change rather than the board.
+*//*
+    Copyright (C) 2014 - Craig Burkhart
+
+    This file is part of Minesweeper Deluxe.
+
+    Minesweeper Deluxe is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Minesweeper Deluxe is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Minesweeper Deluxe.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#include "stdafx.h"
+#include "MineBelief.h"
+#include "MineArena.h"
+#include "MineDebug.h"
+#include "MineSolver.h"
+
+// Global Variables:
+MINE_BELIEF_DATA beliefData = {0};
+
+/**
+    MineBelief_ArenaBytes
+*//**
+    Number of bytes the storage for the board in gameData takes from the
+    arena, to be added to what Mine_AllocBoard is asked for.
+
+    @return Number of bytes.
+*/
+SIZE_T
+MineBelief_ArenaBytes(VOID)
+{
+    SIZE_T tiles = ((SIZE_T) gameData.width)*((SIZE_T) gameData.height);
+
+    //A constraint is the number on a revealed tile, so there are never more than tiles
+    return 2*MINE_ARENA_BYTES(tiles*sizeof(FLOAT)) + MINE_ARENA_BYTES(tiles*MINE_SOLVER_MAX_NEIGHBORS*sizeof(FLOAT)) +
+           3*MINE_ARENA_BYTES(tiles*sizeof(LONG)) + MINE_ARENA_BYTES(tiles*sizeof(BOOLEAN)) +
+           MINE_ARENA_BYTES(tiles*MINE_SOLVER_MAX_NEIGHBORS);
+}
+
+/**
+    MineBelief_Chance
+*//**
+    Turn log odds into the chance of a mine.
+
+    @param[in] logOdds - Log odds of a mine.
+
+    @return Chance of a mine.
+*/
+double
+MineBelief_Chance(double logOdds)
+{
+    return 1.0/(1.0 + exp(-logOdds));
+}
+
+/**
+    MineBelief_Queue
+*//**
+    Queue the constraints around a tile to be updated, skipping those already
+    waiting and those with no undecided tiles.
+
+    @param[in] tile - Board index of the tile.
+    @param[in] skip - Index into solverData.pConstraints of a constraint to leave out.
+*/
+VOID
+MineBelief_Queue(LONG tile, LONG skip)
+{
+    LONG constraint = -1;
+    UINT ix = 0;
+    LONG neighbors[MINE_SOLVER_MAX_NEARBY] = {0};
+    UINT numNeighbors = MineSolver_Nearby(tile, 1, neighbors);
+
+    for (ix = 0; ix < numNeighbors; ix++)
+    {
+        constraint = solverData.pConstraintOf[neighbors[ix]];
+        if ((0 <= constraint) && (skip != constraint) && !beliefData.pQueued[constraint])
+        {
+            //Each constraint waits at most once, so the ring cannot overflow
+            beliefData.pQueue[(beliefData.queueHead + beliefData.queueCount) % solverData.numConstraints] = constraint;
+            beliefData.queueCount++;
+            beliefData.pQueued[constraint] = TRUE;
+        }
+    }
+
+    return;
+}
+
+/**
+    MineBelief_Reserve
+*//**
+    Start a solve with an empty queue and no results, on the storage carved
+    for the current game.
+
+    @return Mine error code (MINE_ERROR_SUCCESS upon success).
+*/
+MINE_ERROR
+MineBelief_Reserve(VOID)
+{
+    BOOLEAN    bFalse = FALSE;
+    MINE_ERROR status = MINE_ERROR_SUCCESS;
+    DWORD      tiles = gameData.width*gameData.height;
+
+    do
+    {
+        if ((NULL == beliefData.pProbabilities) || (arenaData.resets != beliefData.arenaResets) ||
+            (tiles != beliefData.tileCapacity))
+        {
+            MineDebug_PrintError("Belief storage has not been set up for the game\n");
+            status = MINE_ERROR_PARAMETER;
+            break;
+        }
+
+        beliefData.queueHead = 0;
+        beliefData.queueCount = 0;
+        beliefData.numFrontier = 0;
+        beliefData.numLive = 0;
+        beliefData.numInterior = 0;
+        beliefData.bestTile = -1;
+        beliefData.bestProbability = 1.0f;
+        beliefData.updates = 0;
+        beliefData.sweeps = 0;
+        beliefData.residual = 0.0f;
+        beliefData.converged = FALSE;
+        beliefData.contradiction = FALSE;
+
+        __assume(FALSE == bFalse);
+    } while (bFalse);
+
+    return status;
+}
+
+/**
+    MineBelief_Reset
+*//**
+    Carve the storage for the board in gameData out of the arena, with every
+    message forgotten. Must be called whenever a new game starts, the board
+    looks nothing like the last one even at the same size, and after
+    Mine_AllocBoard was given MineBelief_ArenaBytes more bytes. The next solve
+    starts cold.
+
+    @return Mine error code (MINE_ERROR_SUCCESS upon success).
+*/
+MINE_ERROR
+MineBelief_Reset(VOID)
+{
+    BOOLEAN    bFalse = FALSE;
+    MINE_ERROR status = MINE_ERROR_SUCCESS;
+    DWORD      tiles = gameData.width*gameData.height;
+
+    do
+    {
+        //What was carved for the last game went with the arena reset, the new arrays start zeroed
+        beliefData.pProbabilities = (FLOAT*) MineArena_Alloc(((SIZE_T) tiles)*sizeof(FLOAT));
+        beliefData.pMessages = (FLOAT*) MineArena_Alloc(((SIZE_T) tiles)*MINE_SOLVER_MAX_NEIGHBORS*sizeof(FLOAT));
+        beliefData.pLogOdds = (FLOAT*) MineArena_Alloc(((SIZE_T) tiles)*sizeof(FLOAT));
+        beliefData.pFrontier = (LONG*) MineArena_Alloc(((SIZE_T) tiles)*sizeof(LONG));
+        beliefData.pSignatures = (LONG*) MineArena_Alloc(((SIZE_T) tiles)*sizeof(LONG));
+        beliefData.pQueue = (LONG*) MineArena_Alloc(((SIZE_T) tiles)*sizeof(LONG));
+        beliefData.pQueued = (BOOLEAN*) MineArena_Alloc(((SIZE_T) tiles)*sizeof(BOOLEAN));
+        beliefData.pSlots = (CHAR*) MineArena_Alloc(((SIZE_T) tiles)*MINE_SOLVER_MAX_NEIGHBORS);
+        beliefData.tileCapacity = tiles;
+        beliefData.arenaResets = arenaData.resets;
+        beliefData.queueCount = 0;
+        beliefData.numFrontier = 0;
+        beliefData.density = -1.0;
+
+        if ((NULL == beliefData.pProbabilities) || (NULL == beliefData.pMessages) || (NULL == beliefData.pLogOdds) ||
+            (NULL == beliefData.pFrontier) || (NULL == beliefData.pSignatures) || (NULL == beliefData.pQueue) ||
+            (NULL == beliefData.pQueued) || (NULL == beliefData.pSlots))
+        {
+            MineDebug_PrintError("Arena has no room for the belief storage of %u tiles\n", (UINT) tiles);
+            beliefData.pProbabilities = NULL;
+            status = MINE_ERROR_MEMORY;
+            break;
+        }
+
+        __assume(FALSE == bFalse);
+    } while (bFalse);
+
+    return status;
+}
+
+/**
+    MineBelief_Solve
+*//**
+    Find the approximate chance of each tile being a mine from what the player
+    can see. Runs the solver first, so certain tiles come out at exactly 0 or
+    1, then passes messages between the undecided tiles and the numbers around
+    them until no message moves by more than MINE_BELIEF_TOLERANCE or the
+    sweeps run out. Messages are kept from the last solve, so only numbers
+    that changed since then are updated to begin with. Results are left in
+    beliefData.
+
+    @param[in] sweeps - Most updates to spend, in sweeps over the constraints,
+                        0 for MINE_BELIEF_DEFAULT_SWEEPS.
+
+    @return Mine error code (MINE_ERROR_SUCCESS upon success).
+*/
+MINE_ERROR
+MineBelief_Solve(UINT sweeps)
+{
+    BOOLEAN                 bFalse = FALSE;
+    double                  chance = 0.0;
+    LONG                    constraint = 0;
+    double                  density = 0.0;
+    double                  expected = 0.0;
+    UINT                    ix = 0;
+    UINT                    jx = 0;
+    ULONGLONG               limit = 0;
+    LONG                    minesLeft = 0;
+    LONG                    neighbors[MINE_SOLVER_MAX_NEARBY] = {0};
+    UINT                    numNeighbors = 0;
+    MINE_SOLVER_CONSTRAINT* pConstraint = NULL;
+    double                  residual = 0.0;
+    LONG                    signature = 0;
+    MINE_ERROR              status = MINE_ERROR_SUCCESS;
+    LONG                    tile = 0;
+    LONG                    tiles = (LONG) (gameData.width*gameData.height);
+    LONG                    undecided = 0;
+    ULONGLONG               window = 0;
+
+    do
+    {
+        status = MineSolver_Solve();
+        if (MINE_ERROR_SUCCESS != status)
+        {
+            MineDebug_PrintError("In function MineSolver_Solve: %i\n", (int) status);
+            break;
+        }
+
+        status = MineBelief_Reserve();
+        if (MINE_ERROR_SUCCESS != status)
+        {
+            MineDebug_PrintError("In function MineBelief_Reserve: %i\n", (int) status);
+            break;
+        }
+
+        beliefData.solves++;
+        beliefData.contradiction = solverData.contradiction;
+        sweeps = (0 == sweeps) ? MINE_BELIEF_DEFAULT_SWEEPS : sweeps;
+
+        /** Take the decided tiles out of every constraint, and find where each
+            tile left sits around its number, which is where its message is kept.
+            Only constraints that changed since their messages were last worked
+            out are queued, or every one of them after a contradiction or a new
+            game. */
+        for (constraint = 0; constraint < (LONG) solverData.numConstraints; constraint++)
+        {
+            pConstraint = &solverData.pConstraints[constraint];
+            MineSolver_Build(pConstraint->center, pConstraint);
+
+            //Constraints with nothing left to say never join the queue
+            beliefData.pQueued[constraint] = TRUE;
+            if (0 == pConstraint->count)
+            {
+                beliefData.pSignatures[pConstraint->center] = 0;
+                continue;
+            }
+
+            signature = ((LONG) (pConstraint->remaining & 0xFF)) << MINE_SOLVER_MAX_NEIGHBORS;
+
+            numNeighbors = MineSolver_Nearby(pConstraint->center, 1, neighbors);
+            for (ix = 0; ix < pConstraint->count; ix++)
+            {
+                for (jx = 0; jx < numNeighbors; jx++)
+                {
+                    if (neighbors[jx] == pConstraint->tiles[ix])
+                    {
+                        break;
+                    }
+                }
+                beliefData.pSlots[constraint*MINE_SOLVER_MAX_NEIGHBORS + ix] = (CHAR) jx;
+                signature |= 1 << jx;
+
+                //A tile is marked the first time it is seen, by a chance no solve leaves behind
+                if (-1.0f != beliefData.pProbabilities[pConstraint->tiles[ix]])
+                {
+                    beliefData.pProbabilities[pConstraint->tiles[ix]] = -1.0f;
+                    beliefData.pLogOdds[pConstraint->tiles[ix]] = 0.0f;
+                    beliefData.pFrontier[beliefData.numFrontier++] = pConstraint->tiles[ix];
+                }
+                beliefData.pLogOdds[pConstraint->tiles[ix]] +=
+                    beliefData.pMessages[pConstraint->center*MINE_SOLVER_MAX_NEIGHBORS + jx];
+            }
+
+            beliefData.pQueued[constraint] = FALSE;
+            beliefData.numLive++;
+
+            if ((0.0 > beliefData.density) || (signature != beliefData.pSignatures[pConstraint->center]))
+            {
+                beliefData.pSignatures[pConstraint->center] = signature;
+                beliefData.pQueue[beliefData.queueCount++] = constraint;
+                beliefData.pQueued[constraint] = TRUE;
+            }
+        }
+
+        minesLeft = (LONG) gameData.mines - (LONG) solverData.numFlagged - (LONG) solverData.numMines;
+        undecided = (LONG) solverData.numUnknown - (LONG) solverData.numSafe - (LONG) solverData.numMines;
+        beliefData.numInterior = (UINT) undecided - beliefData.numFrontier;
+        if ((0 > minesLeft) || (minesLeft > undecided))
+        {
+            beliefData.contradiction = TRUE;
+        }
+
+        density = (0 < undecided) ? ((double) minesLeft)/((double) undecided) : 0.0;
+        density = (0.0 > density) ? 0.0 : ((1.0 < density) ? 1.0 : density);
+        beliefData.interiorProbability = (FLOAT) density;
+
+        //The messages kept were worked out with the last density, which is the best place to start
+        if (0.0 <= beliefData.density)
+        {
+            density = beliefData.density;
+        }
+
+        /** The queued numbers are updated, and after them only those whose
+            tiles' other messages moved. When the queue empties the mine density
+            is read again from the frontier, and if it moved every number goes
+            again. */
+        limit = ((ULONGLONG) sweeps)*((ULONGLONG) beliefData.numLive);
+        while (!beliefData.contradiction)
+        {
+            chance = (1e-6 > density) ? 1e-6 : ((1.0 - 1e-6 < density) ? 1.0 - 1e-6 : density);
+            beliefData.logPrior = log(chance) - log(1.0 - chance);
+
+            while ((0 < beliefData.queueCount) && (beliefData.updates < limit))
+            {
+                constraint = beliefData.pQueue[beliefData.queueHead];
+                beliefData.queueHead = (beliefData.queueHead + 1) % solverData.numConstraints;
+                beliefData.queueCount--;
+                beliefData.pQueued[constraint] = FALSE;
+
+                chance = MineBelief_Update(constraint);
+                residual = (chance > residual) ? chance : residual;
+                beliefData.updates++;
+
+                //The residual reported is the largest change over the last sweep
+                if (++window >= beliefData.numLive)
+                {
+                    beliefData.residual = (FLOAT) residual;
+                    residual = 0.0;
+                    window = 0;
+                }
+            }
+
+            //Out of sweeps before the messages settled
+            if (0 < beliefData.queueCount)
+            {
+                break;
+            }
+
+            expected = 0.0;
+            for (ix = 0; ix < beliefData.numFrontier; ix++)
+            {
+                expected += MineBelief_Chance(beliefData.logPrior + beliefData.pLogOdds[beliefData.pFrontier[ix]]);
+            }
+
+            chance = (0 < beliefData.numInterior) ?
+                     (((double) minesLeft) - expected)/((double) beliefData.numInterior) : density;
+            chance = (0.0 > chance) ? 0.0 : ((1.0 < chance) ? 1.0 : chance);
+            beliefData.interiorProbability = (FLOAT) chance;
+
+            if (fabs(chance - density) <= MINE_BELIEF_TOLERANCE)
+            {
+                beliefData.converged = TRUE;
+                break;
+            }
+
+            density = chance;
+            if (beliefData.updates >= limit)
+            {
+                break;
+            }
+
+            for (constraint = 0; constraint < (LONG) solverData.numConstraints; constraint++)
+            {
+                if (!beliefData.pQueued[constraint])
+                {
+                    beliefData.pQueue[(beliefData.queueHead + beliefData.queueCount) % solverData.numConstraints] = constraint;
+                    beliefData.queueCount++;
+                    beliefData.pQueued[constraint] = TRUE;
+                }
+            }
+        }
+
+        /** Numbers still waiting when the sweeps ran out are the first to be
+            updated next time. */
+        while (0 < beliefData.queueCount)
+        {
+            constraint = beliefData.pQueue[beliefData.queueHead];
+            beliefData.queueHead = (beliefData.queueHead + 1) % solverData.numConstraints;
+            beliefData.queueCount--;
+            beliefData.pSignatures[solverData.pConstraints[constraint].center] = 0;
+        }
+        beliefData.density = beliefData.contradiction ? -1.0 : density;
+
+        if (window > 0)
+        {
+            beliefData.residual = (FLOAT) ((residual > beliefData.residual) ? residual : beliefData.residual);
+        }
+        beliefData.sweeps = (0 < beliefData.numLive) ?
+                            (UINT) ((beliefData.updates + beliefData.numLive - 1)/beliefData.numLive) : 0;
+        beliefData.totalUpdates += beliefData.updates;
+        if (beliefData.converged)
+        {
+            beliefData.convergedSolves++;
+        }
+
+        /** Fill in every tile off the frontier, still marked -1, then the
+            frontier, and pick the safest hidden tile. */
+        for (tile = 0; tile < tiles; tile++)
+        {
+            if (MINE_TILE_STATUS_REVEALED == gameData.tileStatus[tile])
+            {
+                beliefData.pProbabilities[tile] = 0.0f;
+                continue;
+            }
+
+            if (MINE_TILE_STATUS_FLAG == gameData.tileStatus[tile])
+            {
+                beliefData.pProbabilities[tile] = 1.0f;
+                continue;
+            }
+
+            if (MINE_SOLVER_MARK_SAFE == solverData.pMarks[tile])
+            {
+                beliefData.pProbabilities[tile] = 0.0f;
+            }
+            else if (MINE_SOLVER_MARK_MINE == solverData.pMarks[tile])
+            {
+                beliefData.pProbabilities[tile] = 1.0f;
+            }
+            else if (-1.0f == beliefData.pProbabilities[tile])
+            {
+                continue;
+            }
+            else
+            {
+                beliefData.pProbabilities[tile] = beliefData.interiorProbability;
+            }
+
+            if ((0 > beliefData.bestTile) || (beliefData.pProbabilities[tile] < beliefData.bestProbability))
+            {
+                beliefData.bestTile = tile;
+                beliefData.bestProbability = beliefData.pProbabilities[tile];
+            }
+        }
+
+        for (ix = 0; ix < beliefData.numFrontier; ix++)
+        {
+            tile = beliefData.pFrontier[ix];
+            beliefData.pProbabilities[tile] = beliefData.contradiction ? beliefData.interiorProbability :
+                                              (FLOAT) MineBelief_Chance(beliefData.logPrior + beliefData.pLogOdds[tile]);
+
+            if ((0 > beliefData.bestTile) || (beliefData.pProbabilities[tile] < beliefData.bestProbability))
+            {
+                beliefData.bestTile = tile;
+                beliefData.bestProbability = beliefData.pProbabilities[tile];
+            }
+        }
+
+        __assume(FALSE == bFalse);
+    } while (bFalse);
+
+    return status;
+}
+
+/**
+    MineBelief_Update
+*//**
+    Work out the messages from a revealed number to each of its undecided
+    tiles: the odds of the tile being a mine given the messages of the other
+    tiles into the number. Constraints around a tile whose message moved by
+    more than MINE_BELIEF_TOLERANCE are queued to be updated again.
+
+    @param[in] constraint - Index into solverData.pConstraints of the number.
+
+    @return Largest change of a message, as a chance of a mine.
+*/
+double
+MineBelief_Update(LONG constraint)
+{
+    double                  chance = 0.0;
+    double                  chances[MINE_SOLVER_MAX_NEIGHBORS] = {0};
+    double                  change = 0.0;
+    UINT                    ix = 0;
+    UINT                    jx = 0;
+    double                  largest = 0.0;
+    double                  mine = 0.0;
+    MINE_SOLVER_CONSTRAINT* pConstraint = &solverData.pConstraints[constraint];
+    FLOAT*                  pMessage = NULL;
+    double                  safe = 0.0;
+    LONG                    sum = 0;
+    LONG                    total = 0;
+    double                  updated[MINE_SOLVER_MAX_NEIGHBORS] = {0};
+    double                  ways[MINE_SOLVER_MAX_NEIGHBORS + 1] = {0};
+    LONG                    weight = 0;
+
+    /** What each tile tells the number, leaving out what the number told it. */
+    for (ix = 0; ix < pConstraint->count; ix++)
+    {
+        pMessage = &beliefData.pMessages[pConstraint->center*MINE_SOLVER_MAX_NEIGHBORS +
+                                         beliefData.pSlots[constraint*MINE_SOLVER_MAX_NEIGHBORS + ix]];
+        chances[ix] = MineBelief_Chance(beliefData.logPrior + beliefData.pLogOdds[pConstraint->tiles[ix]] - *pMessage);
+    }
+
+    for (ix = 0; ix < pConstraint->count; ix++)
+    {
+        /** Chance of each weighted count of mines among the other tiles. */
+        ZeroMemory(ways, sizeof(ways));
+        ways[0] = 1.0;
+        total = 0;
+        for (jx = 0; jx < pConstraint->count; jx++)
+        {
+            if (jx == ix)
+            {
+                continue;
+            }
+
+            weight = (LONG) pConstraint->weights[jx];
+            for (sum = total; sum >= 0; sum--)
+            {
+                ways[sum + weight] += ways[sum]*chances[jx];
+                ways[sum] *= 1.0 - chances[jx];
+            }
+            total += weight;
+        }
+
+        weight = (LONG) pConstraint->weights[ix];
+        mine = ((pConstraint->remaining >= weight) && (pConstraint->remaining - weight <= total)) ?
+               ways[pConstraint->remaining - weight] : 0.0;
+        safe = ((pConstraint->remaining >= 0) && (pConstraint->remaining <= total)) ? ways[pConstraint->remaining] : 0.0;
+
+        pMessage = &beliefData.pMessages[pConstraint->center*MINE_SOLVER_MAX_NEIGHBORS +
+                                         beliefData.pSlots[constraint*MINE_SOLVER_MAX_NEIGHBORS + ix]];
+        if ((0.0 >= mine) && (0.0 >= safe))
+        {
+            //The other tiles cannot meet the number either way, it says nothing
+            updated[ix] = *pMessage;
+        }
+        else
+        {
+            updated[ix] = log((1e-300 > mine) ? 1e-300 : mine) - log((1e-300 > safe) ? 1e-300 : safe);
+            updated[ix] = (MINE_BELIEF_MAX_LOG_ODDS < updated[ix]) ? MINE_BELIEF_MAX_LOG_ODDS :
+                          ((-MINE_BELIEF_MAX_LOG_ODDS > updated[ix]) ? -MINE_BELIEF_MAX_LOG_ODDS : updated[ix]);
+
+            //Loops in the board make undamped messages swing back and forth
+            updated[ix] = *pMessage + MINE_BELIEF_DAMPING*(updated[ix] - *pMessage);
+        }
+    }
+
+    /** Every message is worked out from the old ones before any is replaced. */
+    for (ix = 0; ix < pConstraint->count; ix++)
+    {
+        pMessage = &beliefData.pMessages[pConstraint->center*MINE_SOLVER_MAX_NEIGHBORS +
+                                         beliefData.pSlots[constraint*MINE_SOLVER_MAX_NEIGHBORS + ix]];
+        chance = MineBelief_Chance(*pMessage);
+        change = fabs(MineBelief_Chance(updated[ix]) - chance);
+
+        beliefData.pLogOdds[pConstraint->tiles[ix]] += (FLOAT) updated[ix] - *pMessage;
+        *pMessage = (FLOAT) updated[ix];
+
+        if (MINE_BELIEF_TOLERANCE < change)
+        {
+            MineBelief_Queue(pConstraint->tiles[ix], constraint);
+        }
+        largest = (change > largest) ? change : largest;
+    }
+
+    return largest;
+}
@@ -0,0 +1,224 @@
+/**
+    @file MineBelief.h
+
+    @author Craig Burkhart
+
+    @brief Header file for the approximate mine probability engine, which runs
+           belief propagation over the revealed numbers for boards too large
+           to count exactly.
+*//*
+    Copyright (C) 2014 - Craig Burkhart
+
+    This file is part of Minesweeper Deluxe.
+
+    Minesweeper Deluxe is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Minesweeper Deluxe is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Minesweeper Deluxe.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#pragma once
+
+#include "Mine.h"
+
+//--------------------------------------------------------------
+//    Macros
+//--------------------------------------------------------------
+
+/** Sweeps over the constraints a solve may spend when none are given. */
+#define MINE_BELIEF_DEFAULT_SWEEPS 30
+/** Change in a message, as a chance of a mine, small enough to not pass on. */
+#define MINE_BELIEF_TOLERANCE      1e-4
+/** Share of the way a message moves toward its new value in one update. */
+#define MINE_BELIEF_DAMPING        0.5
+/** Largest log odds a message may carry, so certain messages can be undone. */
+#define MINE_BELIEF_MAX_LOG_ODDS   30.0
+
+//--------------------------------------------------------------
+//    Structures
+//--------------------------------------------------------------
+
+struct _MINE_BELIEF_DATA
+{
+    /** Chance of each tile being a mine, 0 for revealed tiles and 1 for flags. */
+    FLOAT*    pProbabilities;
+    /** Log odds of the message from each revealed tile to each tile around it,
+        MINE_SOLVER_MAX_NEIGHBORS per tile in MineSolver_Nearby order. Kept
+        from one solve to the next, so each solve starts where the last ended. */
+    FLOAT*    pMessages;
+    /** Sum of the log odds of the messages into each frontier tile. */
+    FLOAT*    pLogOdds;
+    /** Frontier tiles. */
+    LONG*     pFrontier;
+    /** Undecided tiles and mines left of the constraint around each revealed
+        tile when its messages were last worked out, 0 if it had none. */
+    LONG*     pSignatures;
+    /** Number of tiles the tile arrays have room for, also the most
+        constraints the constraint arrays have room for. */
+    DWORD     tileCapacity;
+    /** Value of arenaData.resets when the arrays were carved out of the
+        arena, they are gone once it is reset again. */
+    UINT      arenaResets;
+    /** Ring of indexes into solverData.pConstraints still to be updated. */
+    LONG*     pQueue;
+    /** Flag for each constraint for if it is waiting in pQueue, always set for
+        constraints with no undecided tiles. */
+    BOOLEAN*  pQueued;
+    /** Position in MineSolver_Nearby order of each tile of each constraint. */
+    CHAR*     pSlots;
+    /** Position in pQueue of the next constraint to update. */
+    UINT      queueHead;
+    /** Number of constraints in pQueue. */
+    UINT      queueCount;
+    /** Log odds of a frontier tile being a mine before any number is read. */
+    double    logPrior;
+    /** Mine density the messages were last worked out with, negative if the
+        last solve found a contradiction or none has run since the last reset. */
+    double    density;
+    /** Number of frontier tiles. */
+    UINT      numFrontier;
+    /** Number of constraints with undecided tiles. */
+    UINT      numLive;
+    /** Number of undecided tiles next to no revealed number. */
+    UINT      numInterior;
+    /** Chance of each interior tile being a mine. */
+    FLOAT     interiorProbability;
+    /** Board index of the hidden tile least likely to be a mine, -1 if none. */
+    LONG      bestTile;
+    /** Chance of bestTile being a mine. */
+    FLOAT     bestProbability;
+    /** Number of constraint updates in the last solve. */
+    ULONGLONG updates;
+    /** Sweeps over the constraints the last solve took, rounded up. */
+    UINT      sweeps;
+    /** Largest message change over the last sweep of the last solve. */
+    FLOAT     residual;
+    /** Flag for if the last solve settled before running out of sweeps. */
+    BOOLEAN   converged;
+    /** Flag for if no mine layout fits the visible board. */
+    BOOLEAN   contradiction;
+    /** Number of solves run. */
+    ULONGLONG solves;
+    /** Number of solves that settled. */
+    ULONGLONG convergedSolves;
+    /** Constraint updates since the program started. */
+    ULONGLONG totalUpdates;
+};
+
+//--------------------------------------------------------------
+//    Typedefs
+//--------------------------------------------------------------
+
+/** Working storage and results of the approximate probability engine. */
+typedef struct _MINE_BELIEF_DATA MINE_BELIEF_DATA;
+
+//--------------------------------------------------------------
+//    Global Variable Externs
+//--------------------------------------------------------------
+
+extern MINE_BELIEF_DATA beliefData;
+
+//--------------------------------------------------------------
+//    Function Prototypes
+//--------------------------------------------------------------
+
+/**
+    MineBelief_ArenaBytes
+*//**
+    Number of bytes the storage for the board in gameData takes from the
+    arena, to be added to what Mine_AllocBoard is asked for.
+
+    @return Number of bytes.
+*/
+SIZE_T
+MineBelief_ArenaBytes(VOID);
+
+/**
+    MineBelief_Chance
+*//**
+    Turn log odds into the chance of a mine.
+
+    @param[in] logOdds - Log odds of a mine.
+
+    @return Chance of a mine.
+*/
+double
+MineBelief_Chance(double logOdds);
+
+/**
+    MineBelief_Queue
+*//**
+    Queue the constraints around a tile to be updated, skipping those already
+    waiting and those with no undecided tiles.
+
+    @param[in] tile - Board index of the tile.
+    @param[in] skip - Index into solverData.pConstraints of a constraint to leave out.
+*/
+VOID
+MineBelief_Queue(LONG tile, LONG skip);
+
+/**
+    MineBelief_Reserve
+*//**
+    Start a solve with an empty queue and no results, on the storage carved
+    for the current game.
+
+    @return Mine error code (MINE_ERROR_SUCCESS upon success).
+*/
+MINE_ERROR
+MineBelief_Reserve(VOID);
+
+/**
+    MineBelief_Reset
+*//**
+    Carve the storage for the board in gameData out of the arena, with every
+    message forgotten. Must be called whenever a new game starts, the board
+    looks nothing like the last one even at the same size, and after
+    Mine_AllocBoard was given MineBelief_ArenaBytes more bytes. The next solve
+    starts cold.
+
+    @return Mine error code (MINE_ERROR_SUCCESS upon success).
+*/
+MINE_ERROR
+MineBelief_Reset(VOID);
+
+/**
+    MineBelief_Solve
+*//**
+    Find the approximate chance of each tile being a mine from what the player
+    can see. Runs the solver first, so certain tiles come out at exactly 0 or
+    1, then passes messages between the undecided tiles and the numbers around
+    them until no message moves by more than MINE_BELIEF_TOLERANCE or the
+    sweeps run out. Messages are kept from the last solve, so only numbers
+    that changed since then are updated to begin with. Results are left in
+    beliefData.
+
+    @param[in] sweeps - Most updates to spend, in sweeps over the constraints,
+                        0 for MINE_BELIEF_DEFAULT_SWEEPS.
+
+    @return Mine error code (MINE_ERROR_SUCCESS upon success).
+*/
+MINE_ERROR
+MineBelief_Solve(UINT sweeps);
+
+/**
+    MineBelief_Update
+*//**
+    Work out the messages from a revealed number to each of its undecided
+    tiles: the odds of the tile being a mine given the messages of the other
+    tiles into the number. Constraints around a tile whose message moved by
+    more than MINE_BELIEF_TOLERANCE are queued to be updated again.
+
+    @param[in] constraint - Index into solverData.pConstraints of the number.
+
+    @return Largest change of a message, as a chance of a mine.
+*/
+double
+MineBelief_Update(LONG constraint);
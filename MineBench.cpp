@@ -0,0 +1,758 @@
+/**
+    @file MineBench.cpp
+
+    @author Craig Burkhart
+
+    @brief Headless benchmark and golden frame check for the frame renderer.
+*//*
+    Copyright (C) 2014 - Craig Burkhart
+
+    This file is part of Minesweeper Deluxe.
+
+    Minesweeper Deluxe is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Minesweeper Deluxe is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Minesweeper Deluxe.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#include "stdafx.h"
+#include "MineBench.h"
+#include "MineArena.h"
+#include "MineDebug.h"
+#include "MineMinimap.h"
+#include "MineRender.h"
+
+/** Board sizes replayed by the benchmark. */
+static const MINE_BENCH_SIZE benchSizes[MINE_BENCH_NUM_SIZES] =
+{
+    {"beginner", MINE_BEGINNER_WIDTH, MINE_BEGINNER_HEIGHT, MINE_BEGINNER_MINES},
+    {"expert",   MINE_EXPERT_WIDTH,   MINE_EXPERT_HEIGHT,   MINE_EXPERT_MINES},
+    {"maximum",  MINE_MAX_WIDTH,      MINE_MAX_HEIGHT,      min((MINE_MAX_WIDTH - 1)*(MINE_MAX_HEIGHT - 1)/5, MINE_MAX_MINES)}
+};
+
+/** Names of the number image modes, indexed by MINE_NUMBER_IMAGE_*. */
+static const LPCSTR imageNames[MINE_BENCH_NUM_IMAGES] = {"normal", "reverse", "solid", "random", "blank"};
+
+/** Names of the scenario endings, indexed by MINE_BENCH_ENDING_*. */
+static const LPCSTR endingNames[MINE_BENCH_NUM_ENDINGS] = {"loss", "win"};
+
+/** Zoom levels (in zoom steps) the expert board is also replayed at, one scaled
+    by filtering and one by repeating pixels. */
+static const LONG benchZooms[MINE_BENCH_NUM_ZOOMS] = {(3*MINE_ZOOM_STEPS) / 2, 2*MINE_ZOOM_STEPS};
+
+/**
+    main
+*//**
+    Replay every scenario, report frame times and check the golden hashes.
+
+    Usage: minebench [-i iterations] [-g golden file] [-u] [-p ppm dir]
+                     [-b startup budget in microseconds, 0 for none]
+
+    @param[in] argc - Number of command line arguments.
+    @param[in] argv - Command line arguments.
+
+    @return 0 if every frame matched its golden hash and the cold start was within
+            budget, 1 otherwise.
+*/
+int
+main(int argc, char* argv[])
+{
+    BOOLEAN                bFalse = FALSE;
+    UINT                   budget = MINE_BENCH_DEFAULT_STARTUP_BUDGET;
+    UINT                   ending = 0;
+    UINT                   iterations = MINE_BENCH_DEFAULT_ITERATIONS;
+    INT                    ix = 0;
+    UINT                   jx = 0;
+    INT                    mismatches = 0;
+    INT                    numImages = 0;
+    UINT                   numResults = 0;
+    LPCSTR                 pGolden = "MineBench.golden";
+    LPCSTR                 pPpmDir = NULL;
+    const MINE_BENCH_SIZE* pSize = NULL;
+    MINE_BENCH_RESULT      results[MINE_BENCH_MAX_SCENARIOS];
+    ULONGLONG              startupTime = 0;
+    MINE_ERROR             status = MINE_ERROR_SUCCESS;
+    ULONGLONG              totalFrames = 0;
+    ULONGLONG              totalTime = 0;
+    BOOLEAN                update = FALSE;
+    LONG                   zoom = 0;
+
+    do
+    {
+        for (ix = 1; ix < argc; ix++)
+        {
+            if ((0 == strcmp(argv[ix], "-i")) && (ix + 1 < argc))
+            {
+                ix++;
+                iterations = (UINT) max(1, atoi(argv[ix]));
+            }
+            else if ((0 == strcmp(argv[ix], "-g")) && (ix + 1 < argc))
+            {
+                pGolden = argv[++ix];
+            }
+            else if (0 == strcmp(argv[ix], "-u"))
+            {
+                update = TRUE;
+            }
+            else if ((0 == strcmp(argv[ix], "-p")) && (ix + 1 < argc))
+            {
+                pPpmDir = argv[++ix];
+            }
+            else if ((0 == strcmp(argv[ix], "-b")) && (ix + 1 < argc))
+            {
+                ix++;
+                budget = (UINT) max(0, atoi(argv[ix]));
+            }
+            else
+            {
+                (void) fprintf(stderr, "Usage: %s [-i iterations] [-g golden file] [-u] "
+                               "[-p ppm dir] [-b startup budget us]\n", argv[0]);
+                status = MINE_ERROR_PARAMETER;
+                break;
+            }
+        }
+        if (MINE_ERROR_SUCCESS != status)
+        {
+            break;
+        }
+
+        //Nothing may be drawn before the cold start is timed
+        status = MineBench_MeasureStartup(&startupTime);
+        if (MINE_ERROR_SUCCESS != status)
+        {
+            (void) fprintf(stderr, "Cold start failed: %i\n", (int) status);
+            break;
+        }
+
+        (void) printf("startup %.2f us, budget %u us\n\n", startupTime/1e3, budget);
+
+        (void) printf("%-26s %7s %10s %10s %10s %10s %10s\n", "scenario", "frames", "fps",
+                      "p50 us", "p90 us", "p99 us", "max us");
+
+        /** Replay every size, number image mode and ending, then the expert board
+            with normal numbers at each zoom level. */
+        for (jx = 0; jx < MINE_BENCH_NUM_SIZES + MINE_BENCH_NUM_ZOOMS; jx++)
+        {
+            if (MINE_BENCH_NUM_SIZES > jx)
+            {
+                numImages = MINE_BENCH_NUM_IMAGES;
+                pSize = &benchSizes[jx];
+                zoom = MINE_ZOOM_STEPS;
+            }
+            else
+            {
+                numImages = 1;
+                pSize = &benchSizes[1];
+                zoom = benchZooms[jx - MINE_BENCH_NUM_SIZES];
+            }
+
+            for (ix = 0; ix < numImages; ix++)
+            {
+                for (ending = 0; ending < MINE_BENCH_NUM_ENDINGS; ending++)
+                {
+                    status = MineBench_RunScenario(pSize, (DWORD) ix, ending, zoom, iterations, pPpmDir,
+                                                   &results[numResults]);
+                    if (MINE_ERROR_SUCCESS != status)
+                    {
+                        (void) fprintf(stderr, "Scenario %s-%s-%s at zoom %i failed: %i\n", pSize->name,
+                                       imageNames[ix], endingNames[ending], (int) zoom, (int) status);
+                        break;
+                    }
+
+                    (void) printf("%-26s %7u %10.1f %10.2f %10.2f %10.2f %10.2f\n",
+                                  results[numResults].name, results[numResults].frames,
+                                  (1e9*results[numResults].frames)/(double) max(1, results[numResults].totalTime),
+                                  results[numResults].p50/1e3, results[numResults].p90/1e3,
+                                  results[numResults].p99/1e3, results[numResults].worst/1e3);
+
+                    totalFrames += results[numResults].frames;
+                    totalTime += results[numResults].totalTime;
+                    numResults++;
+                }
+                if (MINE_ERROR_SUCCESS != status)
+                {
+                    break;
+                }
+            }
+            if (MINE_ERROR_SUCCESS != status)
+            {
+                break;
+            }
+        }
+        if (MINE_ERROR_SUCCESS != status)
+        {
+            break;
+        }
+
+        (void) printf("%-26s %7llu %10.1f\n", "all", (unsigned long long) totalFrames,
+                      (1e9*totalFrames)/(double) max(1, totalTime));
+
+        /** Boards only go to the heap when a scenario needs a bigger one than before. */
+        (void) printf("\narena %u boards, %u heap allocations, %llu blocks, %u bytes\n\n", arenaData.resets,
+                      arenaData.heapAllocs, (unsigned long long) arenaData.blocks, (UINT) arenaData.capacity);
+
+        mismatches = MineBench_CheckGolden(pGolden, results, numResults, update);
+        if (0 > mismatches)
+        {
+            status = MINE_ERROR_PARAMETER;
+            break;
+        }
+
+        if ((0 != budget) && (startupTime > budget*1000ULL))
+        {
+            (void) fprintf(stderr, "Cold start took %.2f us, over the %u us budget\n",
+                           startupTime/1e3, budget);
+            status = MINE_ERROR_PARAMETER;
+            break;
+        }
+
+        __assume(FALSE == bFalse);
+    } while (bFalse);
+
+    //Clean up
+    MineRender_Cleanup();
+    MineMinimap_Cleanup();
+    Mine_FreeBoard();
+
+    return ((MINE_ERROR_SUCCESS == status) && (0 == mismatches)) ? 0 : 1;
+}
+
+/**
+    MineBench_ApplyStep
+*//**
+    Put the board into the state for one frame of the scripted replay. Frames
+    before MINE_BENCH_STEPS uncover the board in order, the last frame ends the game.
+
+    @param[in] step   - Frame number, 0 to MINE_BENCH_STEPS inclusive.
+    @param[in] ending - How the game ends (MINE_BENCH_ENDING_*).
+*/
+VOID
+MineBench_ApplyStep(UINT step, UINT ending)
+{
+    BOOLEAN mineHit = FALSE;
+    DWORD   ix = 0;
+    DWORD   revealCount = 0;
+    DWORD   tiles = gameData.width*gameData.height;
+    LONG    xGrid = 0;
+    LONG    yGrid = 0;
+
+    if (MINE_BENCH_STEPS > step)
+    {
+        revealCount = (tiles*step)/MINE_BENCH_STEPS;
+    }
+    else
+    {
+        //A lost game freezes half way, a won game uncovers everything
+        revealCount = (MINE_BENCH_ENDING_LOSS == ending) ? tiles/2 : tiles;
+    }
+
+    /** Tiles before revealCount are uncovered, with every mine among them flagged. */
+    gameData.numFlagged = 0;
+    gameData.numUncovered = 0;
+
+    for (ix = 0; ix < tiles; ix++)
+    {
+        xGrid = (LONG) (ix % gameData.width);
+        yGrid = (LONG) (ix / gameData.width);
+
+        if (ix >= revealCount)
+        {
+            Mine_SetTileStatus(xGrid, yGrid, MINE_TILE_STATUS_NORMAL);
+        }
+        else if (MINE_BOMB_VALUE == gameData.gameBoard[ix])
+        {
+            Mine_SetTileStatus(xGrid, yGrid, MINE_TILE_STATUS_FLAG);
+            gameData.numFlagged++;
+        }
+        else
+        {
+            Mine_SetTileStatus(xGrid, yGrid, MINE_TILE_STATUS_REVEALED);
+            gameData.numUncovered++;
+        }
+    }
+
+    gameData.time = step*31;
+    gameData.gameOver = (MINE_BENCH_STEPS <= step) ? (BOOLEAN) TRUE : (BOOLEAN) FALSE;
+    gameData.gameWon = (gameData.gameOver && (MINE_BENCH_ENDING_WIN == ending)) ? (BOOLEAN) TRUE : (BOOLEAN) FALSE;
+    gameData.leftDown = FALSE;
+
+    if (!gameData.gameOver)
+    {
+        //Every other frame holds down the next tile, as if the left button were pressed
+        if ((step & 1) && (revealCount < tiles))
+        {
+            Mine_SetTileStatus((LONG) (revealCount % gameData.width), (LONG) (revealCount / gameData.width),
+                               MINE_TILE_STATUS_HELD);
+            gameData.leftDown = TRUE;
+        }
+    }
+    else if (!gameData.gameWon)
+    {
+        /** Hit the first hidden mine and misplace enough flags to drive the counter negative. */
+        for (ix = revealCount; ix < tiles; ix++)
+        {
+            xGrid = (LONG) (ix % gameData.width);
+            yGrid = (LONG) (ix / gameData.width);
+
+            if (MINE_BOMB_VALUE == gameData.gameBoard[ix])
+            {
+                if (!mineHit)
+                {
+                    Mine_SetTileStatus(xGrid, yGrid, MINE_TILE_STATUS_REVEALED);
+                    mineHit = TRUE;
+                }
+            }
+            else if (gameData.numFlagged < gameData.mines + 3)
+            {
+                Mine_SetTileStatus(xGrid, yGrid, MINE_TILE_STATUS_FLAG);
+                gameData.numFlagged++;
+            }
+        }
+    }
+
+    return;
+}
+
+/**
+    MineBench_CheckGolden
+*//**
+    Compare scenario hashes against the golden file, or rewrite the golden file.
+
+    @param[in] pFileName  - Name of the golden hash file.
+    @param[in] pResults   - Results of every scenario.
+    @param[in] numResults - Number of scenarios.
+    @param[in] update     - TRUE to rewrite the golden file with the current hashes.
+
+    @return Number of scenarios that did not match, or -1 if the file could not be used.
+*/
+INT
+MineBench_CheckGolden(_In_z_ LPCSTR pFileName, _In_reads_(numResults) MINE_BENCH_RESULT* pResults,
+                      UINT numResults, BOOLEAN update)
+{
+    BOOLEAN            found = FALSE;
+    unsigned long long hash = 0;
+    UINT               ix = 0;
+    CHAR               line[2*MINE_BENCH_NAME_CHARS] = {0};
+    INT                mismatches = 0;
+    CHAR               name[MINE_BENCH_NAME_CHARS] = {0};
+    FILE*              pFile = NULL;
+
+    if ((NULL == pFileName) || (NULL == pResults))
+    {
+        mismatches = -1;
+    }
+    else if (update)
+    {
+        if ((0 != fopen_s(&pFile, pFileName, "w")) || (NULL == pFile))
+        {
+            (void) fprintf(stderr, "Unable to create golden file %s\n", pFileName);
+            mismatches = -1;
+        }
+        else
+        {
+            (void) fprintf(pFile, "# Frame hashes checked by MineBench. Regenerate with: make golden\n");
+            for (ix = 0; ix < numResults; ix++)
+            {
+                (void) fprintf(pFile, "%s %016llx\n", pResults[ix].name, (unsigned long long) pResults[ix].hash);
+            }
+            (void) printf("Wrote %u golden hashes to %s\n", numResults, pFileName);
+        }
+    }
+    else if ((0 != fopen_s(&pFile, pFileName, "r")) || (NULL == pFile))
+    {
+        (void) fprintf(stderr, "Unable to open golden file %s\n", pFileName);
+        mismatches = -1;
+    }
+    else
+    {
+        /** Every scenario must appear in the golden file with the same hash. */
+        for (ix = 0; ix < numResults; ix++)
+        {
+            found = FALSE;
+            rewind(pFile);
+
+            while (NULL != fgets(line, (int) sizeof(line), pFile))
+            {
+                if (('#' == line[0]) || (2 != sscanf(line, "%63s %llx", name, &hash)))
+                {
+                    continue;
+                }
+
+                if (0 == strcmp(name, pResults[ix].name))
+                {
+                    found = TRUE;
+                    break;
+                }
+            }
+
+            if (!found)
+            {
+                (void) printf("MISSING  %s %016llx\n", pResults[ix].name, (unsigned long long) pResults[ix].hash);
+                mismatches++;
+            }
+            else if (hash != pResults[ix].hash)
+            {
+                (void) printf("MISMATCH %s %016llx expected %016llx\n", pResults[ix].name,
+                              (unsigned long long) pResults[ix].hash, hash);
+                mismatches++;
+            }
+        }
+
+        (void) printf("%u of %u scenarios match %s\n", numResults - (UINT) mismatches, numResults, pFileName);
+    }
+
+    if (NULL != pFile)
+    {
+        (void) fclose(pFile);
+        pFile = NULL;
+    }
+
+    return mismatches;
+}
+
+/**
+    MineBench_CompareTimes
+*//**
+    Order two frame times for qsort.
+
+    @param[in] pFirst  - Pointer to a ULONGLONG.
+    @param[in] pSecond - Pointer to a ULONGLONG.
+
+    @return Negative, zero or positive as first is less, equal or greater.
+*/
+int
+MineBench_CompareTimes(_In_ const void* pFirst, _In_ const void* pSecond)
+{
+    ULONGLONG first = *((const ULONGLONG*) pFirst);
+    ULONGLONG second = *((const ULONGLONG*) pSecond);
+
+    return (first < second) ? -1 : ((first > second) ? 1 : 0);
+}
+
+/**
+    MineBench_HashFrame
+*//**
+    Continue a 64 bit FNV-1a hash over every pixel of the frame.
+
+    @param[in] hash - Hash of the frames before this one.
+
+    @return Updated hash.
+*/
+ULONGLONG
+MineBench_HashFrame(ULONGLONG hash)
+{
+    LONG   ix = 0;
+    LONG   numPixels = renderData.frameWidth*renderData.frameHeight;
+    UINT32 pixel = 0;
+
+    //Hash bytes in a fixed order so the result does not depend on endianness
+    for (ix = 0; ix < numPixels; ix++)
+    {
+        pixel = renderData.pFrame[ix];
+        hash = (hash ^ (pixel & 0xFF))*MINE_BENCH_FNV_PRIME;
+        hash = (hash ^ ((pixel >> 8) & 0xFF))*MINE_BENCH_FNV_PRIME;
+        hash = (hash ^ ((pixel >> 16) & 0xFF))*MINE_BENCH_FNV_PRIME;
+    }
+
+    return hash;
+}
+
+/**
+    MineBench_MeasureStartup
+*//**
+    Time a cold start, from setting up a beginner game to its first frame. Must
+    run before any frame has been drawn.
+
+    @param[out] pTime - Time taken in nanoseconds.
+
+    @return Mine error code (MINE_ERROR_SUCCESS upon success).
+*/
+MINE_ERROR
+MineBench_MeasureStartup(_Out_ ULONGLONG* pTime)
+{
+    BOOLEAN    bFalse = FALSE;
+    ULONGLONG  start = 0;
+    MINE_ERROR status = MINE_ERROR_SUCCESS;
+
+    do
+    {
+        if (NULL == pTime)
+        {
+            MineDebug_PrintError("Invalid parameter to MineBench_MeasureStartup\n");
+            status = MINE_ERROR_PARAMETER;
+            break;
+        }
+
+        *pTime = 0;
+        start = MineBench_Now();
+
+        status = MineBench_SetupBoard(&benchSizes[0], MINE_NUMBER_IMAGE_NORMAL, MINE_ZOOM_STEPS, 0);
+        if (MINE_ERROR_SUCCESS != status)
+        {
+            break;
+        }
+
+        status = MineRender_DrawFrame(NULL);
+        if (MINE_ERROR_SUCCESS != status)
+        {
+            break;
+        }
+
+        *pTime = MineBench_Now() - start;
+
+        __assume(FALSE == bFalse);
+    } while (bFalse);
+
+    return status;
+}
+
+/**
+    MineBench_Now
+*//**
+    Read a monotonic clock.
+
+    @return Current time in nanoseconds.
+*/
+ULONGLONG
+MineBench_Now(VOID)
+{
+#ifdef _WIN32
+    static LARGE_INTEGER frequency = {0};
+    LARGE_INTEGER        now = {0};
+
+    if (0 == frequency.QuadPart)
+    {
+        (void) QueryPerformanceFrequency(&frequency);
+    }
+
+    (void) QueryPerformanceCounter(&now);
+
+    return (ULONGLONG) ((now.QuadPart/frequency.QuadPart)*1000000000LL +
+                        ((now.QuadPart%frequency.QuadPart)*1000000000LL)/frequency.QuadPart);
+#else /* _WIN32 */
+    struct timespec now;
+
+    (void) clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return ((ULONGLONG) now.tv_sec)*1000000000ULL + (ULONGLONG) now.tv_nsec;
+#endif /* _WIN32 */
+}
+
+/**
+    MineBench_RunScenario
+*//**
+    Replay one scripted game, hashing the first replay and timing every frame.
+
+    @param[in]  pSize        - Board size to play.
+    @param[in]  numberImages - Number image mode (MINE_NUMBER_IMAGE_*).
+    @param[in]  ending       - How the game ends (MINE_BENCH_ENDING_*).
+    @param[in]  zoom         - Magnification in zoom steps (MINE_ZOOM_STEPS for none).
+    @param[in]  iterations   - Number of times to replay the game.
+    @param[in]  pPpmDir      - Directory to save the final frame in, NULL to skip.
+    @param[out] pResult      - Timing and hash of the scenario.
+
+    @return Mine error code (MINE_ERROR_SUCCESS upon success).
+*/
+MINE_ERROR
+MineBench_RunScenario(_In_ const MINE_BENCH_SIZE* pSize, DWORD numberImages, UINT ending, LONG zoom,
+                      UINT iterations, _In_opt_z_ LPCSTR pPpmDir, _Out_ MINE_BENCH_RESULT* pResult)
+{
+    BOOLEAN    bFalse = FALSE;
+    HANDLE     hHeap = NULL;
+    UINT       ix = 0;
+    UINT       jx = 0;
+    UINT       numTimes = 0;
+    CHAR       path[MINE_RENDER_PATH_CHARS] = {0};
+    ULONGLONG* pTimes = NULL;
+    ULONGLONG  start = 0;
+    MINE_ERROR status = MINE_ERROR_SUCCESS;
+
+    do
+    {
+        if ((NULL == pSize) || (NULL == pResult) || (MINE_BENCH_NUM_IMAGES <= numberImages) ||
+            (MINE_BENCH_NUM_ENDINGS <= ending) || (MINE_ZOOM_STEPS > zoom) ||
+            (MINE_MAX_ZOOM*MINE_ZOOM_STEPS < zoom) || (0 == iterations))
+        {
+            MineDebug_PrintError("Invalid parameter to MineBench_RunScenario\n");
+            status = MINE_ERROR_PARAMETER;
+            break;
+        }
+
+        ZeroMemory(pResult, sizeof(MINE_BENCH_RESULT));
+        (void) snprintf(pResult->name, MINE_BENCH_NAME_CHARS, "%s-%s-%s", pSize->name,
+                        imageNames[numberImages], endingNames[ending]);
+
+        //Scenarios at no zoom keep their names so their golden hashes carry over
+        if (MINE_ZOOM_STEPS != zoom)
+        {
+            (void) snprintf(pResult->name + strlen(pResult->name), MINE_BENCH_NAME_CHARS - strlen(pResult->name),
+                            "-zoom%i", (int) ((zoom*100) / MINE_ZOOM_STEPS));
+        }
+
+        hHeap = GetProcessHeap();
+        if (NULL == hHeap)
+        {
+            status = MINE_ERROR_HEAP;
+            break;
+        }
+
+        pTimes = (ULONGLONG*) HeapAlloc(hHeap, 0, iterations*(MINE_BENCH_STEPS + 1)*sizeof(ULONGLONG));
+        if (NULL == pTimes)
+        {
+            status = MINE_ERROR_MEMORY;
+            break;
+        }
+
+        //Same board for both endings so only the reveal differs
+        status = MineBench_SetupBoard(pSize, numberImages, zoom,
+                                      ((ULONGLONG) pSize->width << 32) | ((ULONGLONG) pSize->height << 16) |
+                                      (ULONGLONG) (numberImages + 1));
+        if (MINE_ERROR_SUCCESS != status)
+        {
+            break;
+        }
+
+        /** Every replay renders whole frames, only the first one is hashed. */
+        pResult->hash = MINE_BENCH_FNV_OFFSET;
+
+        for (ix = 0; ix < iterations; ix++)
+        {
+            for (jx = 0; jx <= MINE_BENCH_STEPS; jx++)
+            {
+                MineBench_ApplyStep(jx, ending);
+
+                start = MineBench_Now();
+                status = MineRender_DrawFrame(NULL);
+                pTimes[numTimes] = MineBench_Now() - start;
+                if (MINE_ERROR_SUCCESS != status)
+                {
+                    break;
+                }
+
+                pResult->totalTime += pTimes[numTimes];
+                numTimes++;
+
+                if (0 == ix)
+                {
+                    pResult->hash = MineBench_HashFrame(pResult->hash);
+                }
+            }
+            if (MINE_ERROR_SUCCESS != status)
+            {
+                break;
+            }
+        }
+        if (MINE_ERROR_SUCCESS != status)
+        {
+            break;
+        }
+
+        if (NULL != pPpmDir)
+        {
+            (void) snprintf(path, MINE_RENDER_PATH_CHARS, "%s/%s.ppm", pPpmDir, pResult->name);
+            status = MineRender_WritePpm(path);
+            if (MINE_ERROR_SUCCESS != status)
+            {
+                break;
+            }
+        }
+
+        qsort(pTimes, numTimes, sizeof(ULONGLONG), MineBench_CompareTimes);
+
+        pResult->frames = numTimes;
+        pResult->p50 = pTimes[((numTimes - 1)*50)/100];
+        pResult->p90 = pTimes[((numTimes - 1)*90)/100];
+        pResult->p99 = pTimes[((numTimes - 1)*99)/100];
+        pResult->worst = pTimes[numTimes - 1];
+
+        __assume(FALSE == bFalse);
+    } while (bFalse);
+
+    if (NULL != pTimes)
+    {
+        (void) HeapFree(hHeap, 0, pTimes);
+        pTimes = NULL;
+    }
+
+    return status;
+}
+
+/**
+    MineBench_SetupBoard
+*//**
+    Allocate and fill a new board with a repeatable mine layout.
+
+    @param[in] pSize        - Board size to create.
+    @param[in] numberImages - Number image mode (MINE_NUMBER_IMAGE_*).
+    @param[in] zoom         - Magnification in zoom steps (MINE_ZOOM_STEPS for none).
+    @param[in] seed         - Seed for the mine layout and random number images.
+
+    @return Mine error code (MINE_ERROR_SUCCESS upon success).
+*/
+MINE_ERROR
+MineBench_SetupBoard(_In_ const MINE_BENCH_SIZE* pSize, DWORD numberImages, LONG zoom, ULONGLONG seed)
+{
+    BOOLEAN    bFalse = FALSE;
+    MINE_ERROR status = MINE_ERROR_SUCCESS;
+
+    do
+    {
+        //The board arrays belong to the arena, so they can be dropped with the rest
+        ZeroMemory(&gameData, sizeof(MINE_GAME_SETTINGS));
+        gameData.width = pSize->width;
+        gameData.height = pSize->height;
+        gameData.mines = pSize->mines;
+
+        menuData.wrapHorz = FALSE;
+        menuData.wrapVert = FALSE;
+        menuData.numberImages = numberImages;
+        windowData.zoom = zoom;
+
+        status = Mine_AllocBoard(0);
+        if (MINE_ERROR_SUCCESS != status)
+        {
+            break;
+        }
+
+        status = MineMinimap_Reset();
+        if (MINE_ERROR_SUCCESS != status)
+        {
+            break;
+        }
+
+        Mine_SeedRandom(seed);
+
+        status = Mine_NewRandomBoard();
+        if (MINE_ERROR_SUCCESS != status)
+        {
+            break;
+        }
+
+        status = Mine_AssignNumbers(0, (LONG) gameData.width - 1, 0, (LONG) gameData.height - 1);
+        if (MINE_ERROR_SUCCESS != status)
+        {
+            break;
+        }
+
+        status = Mine_SetupNumberImageData();
+        if (MINE_ERROR_SUCCESS != status)
+        {
+            break;
+        }
+
+        Mine_SetupWindow();
+
+        status = MineRender_ResizeFrame();
+
+        __assume(FALSE == bFalse);
+    } while (bFalse);
+
+    return status;
+}
@@ -0,0 +1,221 @@
+/**
+    @file MineBench.h
+
+    @author Craig Burkhart
+
+    @brief Header file for the headless rendering benchmark.
+*//*
+    Copyright (C) 2014 - Craig Burkhart
+
+    This file is part of Minesweeper Deluxe.
+
+    Minesweeper Deluxe is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Minesweeper Deluxe is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Minesweeper Deluxe.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#pragma once
+
+#include "Mine.h"
+
+//--------------------------------------------------------------
+//    Macros
+//--------------------------------------------------------------
+
+/** Number of in progress frames replayed before the final reveal frame. */
+#define MINE_BENCH_STEPS 32
+/** Default number of times each scenario is replayed for timing. */
+#define MINE_BENCH_DEFAULT_ITERATIONS 10
+/** Number of board sizes in the benchmark. */
+#define MINE_BENCH_NUM_SIZES 3
+/** Number of number image modes in the benchmark. */
+#define MINE_BENCH_NUM_IMAGES 5
+/** Number of ways a scenario can end. */
+#define MINE_BENCH_NUM_ENDINGS 2
+/** Number of zoom levels the expert board is also replayed at. */
+#define MINE_BENCH_NUM_ZOOMS 2
+/** Maximum number of scenarios in the benchmark. */
+#define MINE_BENCH_MAX_SCENARIOS ((MINE_BENCH_NUM_SIZES*MINE_BENCH_NUM_IMAGES + MINE_BENCH_NUM_ZOOMS)* \
+                                  MINE_BENCH_NUM_ENDINGS)
+/** Number of characters in a scenario name. */
+#define MINE_BENCH_NAME_CHARS 64
+/** Default longest time (in microseconds) a cold start may take before the run fails. */
+#define MINE_BENCH_DEFAULT_STARTUP_BUDGET 20000
+
+/** Scenario ends with the mines being revealed after a loss. */
+#define MINE_BENCH_ENDING_LOSS 0
+/** Scenario ends with the flags being revealed after a win. */
+#define MINE_BENCH_ENDING_WIN  1
+
+/** Starting value of a 64 bit FNV-1a hash. */
+#define MINE_BENCH_FNV_OFFSET 0xCBF29CE484222325ULL
+/** Multiplier of a 64 bit FNV-1a hash. */
+#define MINE_BENCH_FNV_PRIME  0x00000100000001B3ULL
+
+//--------------------------------------------------------------
+//    Structures
+//--------------------------------------------------------------
+
+struct _MINE_BENCH_SIZE
+{
+    /** Name used in scenario names. */
+    LPCSTR name;
+    /** Width (in tiles) of the board. */
+    DWORD  width;
+    /** Height (in tiles) of the board. */
+    DWORD  height;
+    /** Number of mines on the board. */
+    DWORD  mines;
+};
+
+struct _MINE_BENCH_RESULT
+{
+    /** Name of the scenario, i.e. "expert-random-win" or "expert-normal-loss-zoom150". */
+    CHAR      name[MINE_BENCH_NAME_CHARS];
+    /** Hash of every frame rendered in the first replay. */
+    ULONGLONG hash;
+    /** Number of frames timed. */
+    UINT      frames;
+    /** Total time (in nanoseconds) spent rendering. */
+    ULONGLONG totalTime;
+    /** Median frame time in nanoseconds. */
+    ULONGLONG p50;
+    /** 90th percentile frame time in nanoseconds. */
+    ULONGLONG p90;
+    /** 99th percentile frame time in nanoseconds. */
+    ULONGLONG p99;
+    /** Slowest frame time in nanoseconds. */
+    ULONGLONG worst;
+};
+
+//--------------------------------------------------------------
+//    Typedefs
+//--------------------------------------------------------------
+
+/** Board size replayed by the benchmark. */
+typedef struct _MINE_BENCH_SIZE MINE_BENCH_SIZE;
+
+/** Timing and hash of a single benchmark scenario. */
+typedef struct _MINE_BENCH_RESULT MINE_BENCH_RESULT;
+
+//--------------------------------------------------------------
+//    Function Prototypes
+//--------------------------------------------------------------
+
+/**
+    MineBench_ApplyStep
+*//**
+    Put the board into the state for one frame of the scripted replay. Frames
+    before MINE_BENCH_STEPS uncover the board in order, the last frame ends the game.
+
+    @param[in] step   - Frame number, 0 to MINE_BENCH_STEPS inclusive.
+    @param[in] ending - How the game ends (MINE_BENCH_ENDING_*).
+*/
+VOID
+MineBench_ApplyStep(UINT step, UINT ending);
+
+/**
+    MineBench_CheckGolden
+*//**
+    Compare scenario hashes against the golden file, or rewrite the golden file.
+
+    @param[in] pFileName  - Name of the golden hash file.
+    @param[in] pResults   - Results of every scenario.
+    @param[in] numResults - Number of scenarios.
+    @param[in] update     - TRUE to rewrite the golden file with the current hashes.
+
+    @return Number of scenarios that did not match, or -1 if the file could not be used.
+*/
+INT
+MineBench_CheckGolden(_In_z_ LPCSTR pFileName, _In_reads_(numResults) MINE_BENCH_RESULT* pResults,
+                      UINT numResults, BOOLEAN update);
+
+/**
+    MineBench_CompareTimes
+*//**
+    Order two frame times for qsort.
+
+    @param[in] pFirst  - Pointer to a ULONGLONG.
+    @param[in] pSecond - Pointer to a ULONGLONG.
+
+    @return Negative, zero or positive as first is less, equal or greater.
+*/
+int
+MineBench_CompareTimes(_In_ const void* pFirst, _In_ const void* pSecond);
+
+/**
+    MineBench_HashFrame
+*//**
+    Continue a 64 bit FNV-1a hash over every pixel of the frame.
+
+    @param[in] hash - Hash of the frames before this one.
+
+    @return Updated hash.
+*/
+ULONGLONG
+MineBench_HashFrame(ULONGLONG hash);
+
+/**
+    MineBench_MeasureStartup
+*//**
+    Time a cold start, from setting up a beginner game to its first frame. Must
+    run before any frame has been drawn.
+
+    @param[out] pTime - Time taken in nanoseconds.
+
+    @return Mine error code (MINE_ERROR_SUCCESS upon success).
+*/
+MINE_ERROR
+MineBench_MeasureStartup(_Out_ ULONGLONG* pTime);
+
+/**
+    MineBench_Now
+*//**
+    Read a monotonic clock.
+
+    @return Current time in nanoseconds.
+*/
+ULONGLONG
+MineBench_Now(VOID);
+
+/**
+    MineBench_RunScenario
+*//**
+    Replay one scripted game, hashing the first replay and timing every frame.
+
+    @param[in]  pSize        - Board size to play.
+    @param[in]  numberImages - Number image mode (MINE_NUMBER_IMAGE_*).
+    @param[in]  ending       - How the game ends (MINE_BENCH_ENDING_*).
+    @param[in]  zoom         - Magnification in zoom steps (MINE_ZOOM_STEPS for none).
+    @param[in]  iterations   - Number of times to replay the game.
+    @param[in]  pPpmDir      - Directory to save the final frame in, NULL to skip.
+    @param[out] pResult      - Timing and hash of the scenario.
+
+    @return Mine error code (MINE_ERROR_SUCCESS upon success).
+*/
+MINE_ERROR
+MineBench_RunScenario(_In_ const MINE_BENCH_SIZE* pSize, DWORD numberImages, UINT ending, LONG zoom,
+                      UINT iterations, _In_opt_z_ LPCSTR pPpmDir, _Out_ MINE_BENCH_RESULT* pResult);
+
+/**
+    MineBench_SetupBoard
+*//**
+    Allocate and fill a new board with a repeatable mine layout.
+
+    @param[in] pSize        - Board size to create.
+    @param[in] numberImages - Number image mode (MINE_NUMBER_IMAGE_*).
+    @param[in] zoom         - Magnification in zoom steps (MINE_ZOOM_STEPS for none).
+    @param[in] seed         - Seed for the mine layout and random number images.
+
+    @return Mine error code (MINE_ERROR_SUCCESS upon success).
+*/
+MINE_ERROR
+MineBench_SetupBoard(_In_ const MINE_BENCH_SIZE* pSize, DWORD numberImages, LONG zoom, ULONGLONG seed);
@@ -0,0 +1,790 @@
+/**
+    @file MineBot.cpp
+
+    @author Craig Burkhart
+
+    @brief Headless autoplay benchmark. Plays whole games through the game
+           core, first click, solver deductions and probability guided
+           guesses, and reports win rates, games per second and the time
+           spent in each stage of a game.
+*//*
+    Copyright (C) 2014 - Craig Burkhart
+
+    This file is part of Minesweeper Deluxe.
+
+    Minesweeper Deluxe is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Minesweeper Deluxe is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Minesweeper Deluxe.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#include "stdafx.h"
+#include "MineBot.h"
+#include "MineBelief.h"
+#include "MineDamage.h"
+#include "MineDebug.h"
+#include "MineFrontier.h"
+#include "MineMinimap.h"
+#include "MineMouse.h"
+#include "MineMovement.h"
+#include "MinePool.h"
+#include "MineProbability.h"
+#include "MineSolver.h"
+
+/** Board sizes played on by the benchmark, the last one filled in from the command line. */
+static MINE_BOT_SIZE botSizes[MINE_BOT_NUM_SIZES] =
+{
+    {"beginner",     MINE_BEGINNER_WIDTH,     MINE_BEGINNER_HEIGHT,     MINE_BEGINNER_MINES},
+    {"intermediate", MINE_INTERMEDIATE_WIDTH, MINE_INTERMEDIATE_HEIGHT, MINE_INTERMEDIATE_MINES},
+    {"expert",       MINE_EXPERT_WIDTH,       MINE_EXPERT_HEIGHT,       MINE_EXPERT_MINES},
+    {"custom",       0,                       0,                        0}
+};
+
+/** Names of the wrap modes, indexed by the wrap flag. */
+static const LPCSTR wrapNames[MINE_BOT_NUM_WRAPS] = {"nowrap", "wrap"};
+
+/** Names of the movement modes, indexed by the movement flag. */
+static const LPCSTR moveNames[MINE_BOT_NUM_MOVES] = {"still", "move"};
+
+/** Names of the stages, indexed by MINE_BOT_STAGE_*. */
+static const LPCSTR stageNames[MINE_BOT_NUM_STAGES] = {"gen us", "number us", "reveal us", "solve us", "move us"};
+
+/**
+    main
+*//**
+    Play every scenario, report win rates and stage times, and check the
+    outcome hashes.
+
+    Usage: minebot [-n games] [-s seed] [-c width height mines] [-a]
+                   [-g golden file] [-u]
+
+    With -c only the custom size is played. With -a every guess uses belief
+    propagation, whatever the board size.
+
+    @param[in] argc - Number of command line arguments.
+    @param[in] argv - Command line arguments.
+
+    @return 0 if every scenario ran and matched its golden hash, 1 otherwise.
+*/
+int
+main(int argc, char* argv[])
+{
+    BOOLEAN         approximate = FALSE;
+    BOOLEAN         bFalse = FALSE;
+    double          center = 0.0;
+    UINT            first = 0;
+    UINT            games = MINE_BOT_DEFAULT_GAMES;
+    double          half = 0.0;
+    INT             ix = 0;
+    UINT            jx = 0;
+    UINT            last = MINE_BOT_NUM_SIZES - 1;
+    INT             mismatches = 0;
+    UINT            move = 0;
+    UINT            numResults = 0;
+    LPCSTR          pGolden = NULL;
+    double          rate = 0.0;
+    MINE_BOT_RESULT results[MINE_BOT_NUM_SIZES*MINE_BOT_NUM_WRAPS*MINE_BOT_NUM_MOVES];
+    ULONGLONG       seed = MINE_BOT_DEFAULT_SEED;
+    MINE_ERROR      status = MINE_ERROR_SUCCESS;
+    ULONGLONG       totalGames = 0;
+    ULONGLONG       totalTime = 0;
+    BOOLEAN         update = FALSE;
+    UINT            wrap = 0;
+    double          z = MINE_BOT_CONFIDENCE_Z;
+
+    do
+    {
+        for (ix = 1; ix < argc; ix++)
+        {
+            if ((0 == strcmp(argv[ix], "-n")) && (ix + 1 < argc))
+            {
+                ix++;
+                games = (UINT) max(1, atoi(argv[ix]));
+            }
+            else if ((0 == strcmp(argv[ix], "-s")) && (ix + 1 < argc))
+            {
+                ix++;
+                seed = (ULONGLONG) strtoull(argv[ix], NULL, 0);
+            }
+            else if ((0 == strcmp(argv[ix], "-c")) && (ix + 3 < argc))
+            {
+                botSizes[MINE_BOT_NUM_SIZES - 1].width = (DWORD) max(1, min(MINE_MAX_WIDTH, atoi(argv[ix + 1])));
+                botSizes[MINE_BOT_NUM_SIZES - 1].height = (DWORD) max(1, min(MINE_MAX_HEIGHT, atoi(argv[ix + 2])));
+                botSizes[MINE_BOT_NUM_SIZES - 1].mines = (DWORD) max(1, atoi(argv[ix + 3]));
+                ix += 3;
+            }
+            else if (0 == strcmp(argv[ix], "-a"))
+            {
+                approximate = TRUE;
+            }
+            else if ((0 == strcmp(argv[ix], "-g")) && (ix + 1 < argc))
+            {
+                pGolden = argv[++ix];
+            }
+            else if (0 == strcmp(argv[ix], "-u"))
+            {
+                update = TRUE;
+            }
+            else
+            {
+                (void) fprintf(stderr, "Usage: %s [-n games] [-s seed] [-c width height mines] [-a] "
+                               "[-g golden file] [-u]\n", argv[0]);
+                status = MINE_ERROR_PARAMETER;
+                break;
+            }
+        }
+        if (MINE_ERROR_SUCCESS != status)
+        {
+            break;
+        }
+
+        //The first click is always safe, so one tile must be left without a mine
+        if (0 < botSizes[MINE_BOT_NUM_SIZES - 1].width)
+        {
+            botSizes[MINE_BOT_NUM_SIZES - 1].mines = min(botSizes[MINE_BOT_NUM_SIZES - 1].mines,
+                                                         min((DWORD) MINE_MAX_MINES,
+                                                             botSizes[MINE_BOT_NUM_SIZES - 1].width*
+                                                             botSizes[MINE_BOT_NUM_SIZES - 1].height - 1));
+            first = MINE_BOT_NUM_SIZES - 1;
+        }
+        else
+        {
+            last = MINE_BOT_NUM_SIZES - 2;
+        }
+
+        status = MinePool_Startup(0);
+        if (MINE_ERROR_SUCCESS != status)
+        {
+            (void) fprintf(stderr, "Unable to start the worker pool: %i\n", (int) status);
+            break;
+        }
+
+        menuData.movementPolicy = MINE_MOVEMENT_POLICY_WALK;
+        menuData.movementAggressive = MINE_MOVEMENT_DEFAULT_AGGRESSIVENESS;
+        menuData.movementBatch = MINE_MOVEMENT_DEFAULT_BATCH;
+        menuData.movementBatchPercent = FALSE;
+        menuData.movementConsistent = FALSE;
+
+        (void) printf("%u games per scenario, seed %llu, %u worker threads%s\n\n", games,
+                      (unsigned long long) seed, (UINT) poolData.numThreads,
+                      approximate ? ", every guess by belief propagation" : "");
+
+        (void) printf("%-28s %6s %6s %6s %13s %8s %8s", "scenario", "games", "wins", "win %", "95% interval",
+                      "games/s", "guesses");
+        for (jx = 0; jx < MINE_BOT_NUM_STAGES; jx++)
+        {
+            (void) printf(" %9s", stageNames[jx]);
+        }
+        (void) printf("\n");
+
+        /** Every size with and without wrapping, with still and moving mines. */
+        for (jx = first; jx <= last; jx++)
+        {
+            for (wrap = 0; wrap < MINE_BOT_NUM_WRAPS; wrap++)
+            {
+                for (move = 0; move < MINE_BOT_NUM_MOVES; move++)
+                {
+                    status = MineBot_RunScenario(&botSizes[jx], (BOOLEAN) wrap, (BOOLEAN) move, approximate,
+                                                 games, seed, &results[numResults]);
+                    if (MINE_ERROR_SUCCESS != status)
+                    {
+                        (void) fprintf(stderr, "Scenario %s-%s-%s failed: %i\n", botSizes[jx].name,
+                                       wrapNames[wrap], moveNames[move], (int) status);
+                        break;
+                    }
+
+                    /** Wilson score interval, which stays inside 0 to 100% even
+                        when nearly every game is won or lost. */
+                    rate = results[numResults].wins/(double) results[numResults].games;
+                    center = (rate + z*z/(2.0*results[numResults].games))/(1.0 + z*z/results[numResults].games);
+                    half = (z/(1.0 + z*z/results[numResults].games))*
+                           sqrt(rate*(1.0 - rate)/results[numResults].games +
+                                z*z/(4.0*results[numResults].games*results[numResults].games));
+
+                    //Stage times are per game, so scenarios with different game counts compare
+                    (void) printf("%-28s %6u %6u %6.2f %6.2f-%6.2f %8.1f %8.2f", results[numResults].name,
+                                  results[numResults].games, results[numResults].wins, 100.0*rate,
+                                  100.0*max(0.0, center - half), 100.0*min(1.0, center + half),
+                                  (1e9*results[numResults].games)/(double) max(1, results[numResults].totalTime),
+                                  results[numResults].guesses/(double) results[numResults].games);
+                    for (ix = 0; ix < MINE_BOT_NUM_STAGES; ix++)
+                    {
+                        (void) printf(" %9.2f", results[numResults].stageTime[ix]/(1e3*results[numResults].games));
+                    }
+                    (void) printf("\n");
+
+                    totalGames += results[numResults].games;
+                    totalTime += results[numResults].totalTime;
+                    numResults++;
+                }
+                if (MINE_ERROR_SUCCESS != status)
+                {
+                    break;
+                }
+            }
+            if (MINE_ERROR_SUCCESS != status)
+            {
+                break;
+            }
+        }
+        if (MINE_ERROR_SUCCESS != status)
+        {
+            break;
+        }
+
+        (void) printf("%-28s %6llu %6s %6s %13s %8.1f\n", "all", (unsigned long long) totalGames, "", "", "",
+                      (1e9*totalGames)/(double) max(1, totalTime));
+
+        if (NULL != pGolden)
+        {
+            mismatches = MineBot_CheckGolden(pGolden, results, numResults, update);
+        }
+
+        __assume(FALSE == bFalse);
+    } while (bFalse);
+
+    //Clean up
+    MineProbability_Cleanup();
+    MinePool_Cleanup();
+    MineMinimap_Cleanup();
+    Mine_FreeBoard();
+
+    return ((MINE_ERROR_SUCCESS == status) && (0 == mismatches)) ? 0 : 1;
+}
+
+/**
+    Mine_GameWon
+*//**
+    Process a win of the game.
+*/
+VOID
+Mine_GameWon(VOID)
+{
+    gameData.numFlagged = gameData.mines;
+    gameData.gameOver = TRUE;
+    gameData.gameWon = TRUE;
+
+    return;
+}
+
+/**
+    MineBot_CheckGolden
+*//**
+    Compare scenario outcome hashes against the golden file, or rewrite the
+    golden file.
+
+    @param[in] pFileName  - Name of the golden hash file.
+    @param[in] pResults   - Results of every scenario.
+    @param[in] numResults - Number of scenarios.
+    @param[in] update     - TRUE to rewrite the golden file with the current hashes.
+
+    @return Number of scenarios that did not match, or -1 if the file could not be used.
+*/
+INT
+MineBot_CheckGolden(_In_z_ LPCSTR pFileName, _In_reads_(numResults) MINE_BOT_RESULT* pResults,
+                    UINT numResults, BOOLEAN update)
+{
+    BOOLEAN            found = FALSE;
+    unsigned long long hash = 0;
+    UINT               ix = 0;
+    CHAR               line[2*MINE_BOT_NAME_CHARS] = {0};
+    INT                mismatches = 0;
+    CHAR               name[MINE_BOT_NAME_CHARS] = {0};
+    FILE*              pFile = NULL;
+
+    if ((NULL == pFileName) || (NULL == pResults))
+    {
+        mismatches = -1;
+    }
+    else if (update)
+    {
+        if ((0 != fopen_s(&pFile, pFileName, "w")) || (NULL == pFile))
+        {
+            (void) fprintf(stderr, "Unable to create golden file %s\n", pFileName);
+            mismatches = -1;
+        }
+        else
+        {
+            (void) fprintf(pFile, "# Game outcome hashes checked by MineBot. Regenerate with: make golden\n");
+            for (ix = 0; ix < numResults; ix++)
+            {
+                (void) fprintf(pFile, "%s %016llx\n", pResults[ix].name, (unsigned long long) pResults[ix].hash);
+            }
+            (void) printf("Wrote %u golden hashes to %s\n", numResults, pFileName);
+        }
+    }
+    else if ((0 != fopen_s(&pFile, pFileName, "r")) || (NULL == pFile))
+    {
+        (void) fprintf(stderr, "Unable to open golden file %s\n", pFileName);
+        mismatches = -1;
+    }
+    else
+    {
+        /** Every scenario must appear in the golden file with the same hash. */
+        for (ix = 0; ix < numResults; ix++)
+        {
+            found = FALSE;
+            rewind(pFile);
+
+            while (NULL != fgets(line, (int) sizeof(line), pFile))
+            {
+                if (('#' == line[0]) || (2 != sscanf(line, "%63s %llx", name, &hash)))
+                {
+                    continue;
+                }
+
+                if (0 == strcmp(name, pResults[ix].name))
+                {
+                    found = TRUE;
+                    break;
+                }
+            }
+
+            if (!found)
+            {
+                (void) printf("MISSING  %s %016llx\n", pResults[ix].name, (unsigned long long) pResults[ix].hash);
+                mismatches++;
+            }
+            else if (hash != pResults[ix].hash)
+            {
+                (void) printf("MISMATCH %s %016llx expected %016llx\n", pResults[ix].name,
+                              (unsigned long long) pResults[ix].hash, hash);
+                mismatches++;
+            }
+        }
+
+        (void) printf("%u of %u scenarios match %s\n", numResults - (UINT) mismatches, numResults, pFileName);
+    }
+
+    if (NULL != pFile)
+    {
+        (void) fclose(pFile);
+        pFile = NULL;
+    }
+
+    return mismatches;
+}
+
+/**
+    MineBot_Guess
+*//**
+    Choose the hidden tile least likely to be a mine, with the exact engine on
+    boards up to MINE_BOT_EXACT_TILES and belief propagation on larger ones.
+
+    @param[in]  approximate - Flag for if belief propagation is used at any size.
+    @param[out] pTile       - Board index of the tile to reveal.
+
+    @return Mine error code (MINE_ERROR_SUCCESS upon success).
+*/
+MINE_ERROR
+MineBot_Guess(BOOLEAN approximate, _Out_ PLONG pTile)
+{
+    BOOLEAN    bFalse = FALSE;
+    MINE_ERROR status = MINE_ERROR_SUCCESS;
+
+    do
+    {
+        *pTile = -1;
+
+        if ((!approximate) && (MINE_BOT_EXACT_TILES >= gameData.width*gameData.height))
+        {
+            status = MineProbability_Solve();
+            if (MINE_ERROR_SUCCESS != status)
+            {
+                MineDebug_PrintError("In function MineProbability_Solve: %i\n", (int) status);
+                break;
+            }
+
+            *pTile = probabilityData.bestTile;
+        }
+        else
+        {
+            status = MineBelief_Solve(0);
+            if (MINE_ERROR_SUCCESS != status)
+            {
+                MineDebug_PrintError("In function MineBelief_Solve: %i\n", (int) status);
+                break;
+            }
+
+            *pTile = beliefData.bestTile;
+        }
+
+        if (0 > *pTile)
+        {
+            MineDebug_PrintError("No hidden tile left to guess\n");
+            status = MINE_ERROR_PARAMETER;
+            break;
+        }
+
+        __assume(FALSE == bFalse);
+    } while (bFalse);
+
+    return status;
+}
+
+/**
+    MineBot_Hash
+*//**
+    Fold a value into a 64 bit FNV-1a hash, one byte at a time.
+
+    @param[in] hash  - Hash so far.
+    @param[in] value - Value to fold in.
+
+    @return Updated hash.
+*/
+ULONGLONG
+MineBot_Hash(ULONGLONG hash, ULONGLONG value)
+{
+    UINT ix = 0;
+
+    //Lowest byte first so the result does not depend on endianness
+    for (ix = 0; ix < sizeof(ULONGLONG); ix++)
+    {
+        hash = (hash ^ ((value >> (8*ix)) & 0xFF))*MINE_BOT_FNV_PRIME;
+    }
+
+    return hash;
+}
+
+/**
+    MineBot_Now
+*//**
+    Read a monotonic clock.
+
+    @return Current time in nanoseconds.
+*/
+ULONGLONG
+MineBot_Now(VOID)
+{
+#ifdef _WIN32
+    static LARGE_INTEGER frequency = {0};
+    LARGE_INTEGER        now = {0};
+
+    if (0 == frequency.QuadPart)
+    {
+        (void) QueryPerformanceFrequency(&frequency);
+    }
+
+    (void) QueryPerformanceCounter(&now);
+
+    return (ULONGLONG) ((now.QuadPart/frequency.QuadPart)*1000000000LL +
+                        ((now.QuadPart%frequency.QuadPart)*1000000000LL)/frequency.QuadPart);
+#else /* _WIN32 */
+    struct timespec now;
+
+    (void) clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return ((ULONGLONG) now.tv_sec)*1000000000ULL + (ULONGLONG) now.tv_nsec;
+#endif /* _WIN32 */
+}
+
+/**
+    MineBot_PlayGame
+*//**
+    Play one game to the end: click the middle tile, then each turn reveal
+    every tile the solver finds safe, or guess when it finds none. Mines move
+    between turns if the scenario moves them.
+
+    @param[in]     approximate - Flag for if guesses always use belief propagation.
+    @param[in]     move        - Flag for if mines move between turns.
+    @param[in]     seed        - Seed for the mine layout and the moves.
+    @param[in,out] pResult     - Scenario counts and times the game is added to.
+
+    @return Mine error code (MINE_ERROR_SUCCESS upon success).
+*/
+MINE_ERROR
+MineBot_PlayGame(BOOLEAN approximate, BOOLEAN move, ULONGLONG seed, _Inout_ MINE_BOT_RESULT* pResult)
+{
+    BOOLEAN    bFalse = FALSE;
+    UINT       guesses = 0;
+    UINT       ix = 0;
+    RECT       rects[MINE_DAMAGE_MAX_RECTS];
+    ULONGLONG  start = 0;
+    MINE_ERROR status = MINE_ERROR_SUCCESS;
+    LONG       tile = 0;
+    LONG       tiles = (LONG) (gameData.width*gameData.height);
+    UINT       turns = 0;
+
+    do
+    {
+        /** The first click goes in the middle, and is made safe by moving its mine. */
+        start = MineBot_Now();
+        status = MineMouse_FirstClick((LONG) gameData.width/2, (LONG) gameData.height/2);
+        pResult->stageTime[MINE_BOT_STAGE_NUMBER] += MineBot_Now() - start;
+        if (MINE_ERROR_SUCCESS != status)
+        {
+            MineDebug_PrintError("In function MineMouse_FirstClick: %i\n", (int) status);
+            break;
+        }
+
+        start = MineBot_Now();
+        status = MineMouse_RevealTile((LONG) gameData.width/2, (LONG) gameData.height/2);
+        pResult->stageTime[MINE_BOT_STAGE_REVEAL] += MineBot_Now() - start;
+        if (MINE_ERROR_SUCCESS != status)
+        {
+            MineDebug_PrintError("In function MineMouse_RevealTile: %i\n", (int) status);
+            break;
+        }
+        turns++;
+
+        //Every turn reveals at least one tile, so a game cannot take more turns than tiles
+        while ((!gameData.gameOver) && (turns < (UINT) tiles))
+        {
+            //What the frontend would draw between turns is not the bot's work
+            (void) MineDamage_Take(rects);
+
+            if (move)
+            {
+                start = MineBot_Now();
+                status = MineMovement_ProcessMovement();
+                pResult->stageTime[MINE_BOT_STAGE_MOVE] += MineBot_Now() - start;
+                if (MINE_ERROR_SUCCESS != status)
+                {
+                    MineDebug_PrintError("In function MineMovement_ProcessMovement: %i\n", (int) status);
+                    break;
+                }
+            }
+
+            /** Safe tiles are all revealed in one turn, since nothing moves until it ends. */
+            start = MineBot_Now();
+            status = MineSolver_Solve();
+            if ((MINE_ERROR_SUCCESS == status) && (0 == solverData.numSafe))
+            {
+                status = MineBot_Guess(approximate, &tile);
+                guesses++;
+            }
+            pResult->stageTime[MINE_BOT_STAGE_SOLVE] += MineBot_Now() - start;
+            if (MINE_ERROR_SUCCESS != status)
+            {
+                MineDebug_PrintError("Choosing tiles to reveal: %i\n", (int) status);
+                break;
+            }
+
+            start = MineBot_Now();
+            if (0 == solverData.numSafe)
+            {
+                status = MineMouse_RevealTile(tile % (LONG) gameData.width, tile / (LONG) gameData.width);
+            }
+            else
+            {
+                //Tiles opened by an earlier cascade this turn are skipped
+                for (ix = 0; (ix < solverData.numSafe) && (MINE_ERROR_SUCCESS == status); ix++)
+                {
+                    tile = solverData.pSafe[ix];
+                    if (MINE_TILE_STATUS_NORMAL == gameData.tileStatus[tile])
+                    {
+                        status = MineMouse_RevealTile(tile % (LONG) gameData.width, tile / (LONG) gameData.width);
+                    }
+                }
+            }
+            pResult->stageTime[MINE_BOT_STAGE_REVEAL] += MineBot_Now() - start;
+            if (MINE_ERROR_SUCCESS != status)
+            {
+                MineDebug_PrintError("In function MineMouse_RevealTile: %i\n", (int) status);
+                break;
+            }
+            turns++;
+        }
+        if (MINE_ERROR_SUCCESS != status)
+        {
+            break;
+        }
+
+        /** A game cut off by the turn limit was neither won nor lost, so it is not counted. */
+        if (!gameData.gameOver)
+        {
+            MineDebug_PrintError("Game did not end within %u turns\n", turns);
+            status = MINE_ERROR_PARAMETER;
+            break;
+        }
+
+        (void) MineDamage_Take(rects);
+
+        pResult->games++;
+        pResult->wins += gameData.gameWon ? 1 : 0;
+        pResult->turns += turns;
+        pResult->guesses += guesses;
+        pResult->uncovered += gameData.numUncovered;
+
+        /** Anything that changes what the bot saw or did changes the hash. */
+        pResult->hash = MineBot_Hash(pResult->hash, seed);
+        pResult->hash = MineBot_Hash(pResult->hash, gameData.gameWon ? 1 : 0);
+        pResult->hash = MineBot_Hash(pResult->hash, turns);
+        pResult->hash = MineBot_Hash(pResult->hash, guesses);
+        pResult->hash = MineBot_Hash(pResult->hash, gameData.numUncovered);
+
+        __assume(FALSE == bFalse);
+    } while (bFalse);
+
+    return status;
+}
+
+/**
+    MineBot_RunScenario
+*//**
+    Play a number of games on one board size, wrap mode and movement mode.
+
+    @param[in]  pSize       - Board size to play on.
+    @param[in]  wrap        - Flag for if the board wraps across both edges.
+    @param[in]  move        - Flag for if mines move between turns.
+    @param[in]  approximate - Flag for if guesses always use belief propagation.
+    @param[in]  games       - Number of games to play.
+    @param[in]  seed        - Seed the mine layout of each game is made from.
+    @param[out] pResult     - Win rate, timing and outcome hash of the scenario.
+
+    @return Mine error code (MINE_ERROR_SUCCESS upon success).
+*/
+MINE_ERROR
+MineBot_RunScenario(_In_ const MINE_BOT_SIZE* pSize, BOOLEAN wrap, BOOLEAN move, BOOLEAN approximate,
+                    UINT games, ULONGLONG seed, _Out_ MINE_BOT_RESULT* pResult)
+{
+    BOOLEAN    bFalse = FALSE;
+    ULONGLONG  gameSeed = 0;
+    UINT       ix = 0;
+    ULONGLONG  start = 0;
+    ULONGLONG  started = 0;
+    MINE_ERROR status = MINE_ERROR_SUCCESS;
+
+    do
+    {
+        if ((NULL == pSize) || (NULL == pResult) || (0 == games))
+        {
+            MineDebug_PrintError("Invalid parameter to MineBot_RunScenario\n");
+            status = MINE_ERROR_PARAMETER;
+            break;
+        }
+
+        ZeroMemory(pResult, sizeof(MINE_BOT_RESULT));
+        (void) snprintf(pResult->name, MINE_BOT_NAME_CHARS, "%s-%s-%s", pSize->name, wrapNames[wrap ? 1 : 0],
+                        moveNames[move ? 1 : 0]);
+        pResult->hash = MINE_BOT_FNV_OFFSET;
+
+        //Set before the frontier is reset, which counts neighbors across the wrapped edges
+        menuData.wrapHorz = wrap;
+        menuData.wrapVert = wrap;
+        windowData.zoom = MINE_ZOOM_STEPS;
+
+        started = MineBot_Now();
+        for (ix = 0; ix < games; ix++)
+        {
+            //Each game has its own seed, so a game plays the same whatever ran before it
+            gameSeed = MineBot_Hash(MineBot_Hash(MineBot_Hash(seed, ((ULONGLONG) pSize->width << 32) |
+                                                                    ((ULONGLONG) pSize->height << 16) |
+                                                                    (ULONGLONG) (wrap ? 2 : 0) |
+                                                                    (ULONGLONG) (move ? 1 : 0)),
+                                                 pSize->mines), ix);
+
+            start = MineBot_Now();
+            status = MineBot_SetupBoard(pSize, approximate, gameSeed);
+            pResult->stageTime[MINE_BOT_STAGE_GENERATE] += MineBot_Now() - start;
+            if (MINE_ERROR_SUCCESS != status)
+            {
+                break;
+            }
+
+            status = MineBot_PlayGame(approximate, move, gameSeed, pResult);
+            if (MINE_ERROR_SUCCESS != status)
+            {
+                break;
+            }
+        }
+        pResult->totalTime = MineBot_Now() - started;
+
+        __assume(FALSE == bFalse);
+    } while (bFalse);
+
+    return status;
+}
+
+/**
+    MineBot_SetupBoard
+*//**
+    Set up a new game on a board of the given size with a repeatable mine
+    layout, every tile hidden, with storage for the engines the game will use.
+
+    @param[in] pSize       - Board size to create.
+    @param[in] approximate - Flag for if guesses always use belief propagation.
+    @param[in] seed        - Seed for the mine layout and the moves.
+
+    @return Mine error code (MINE_ERROR_SUCCESS upon success).
+*/
+MINE_ERROR
+MineBot_SetupBoard(_In_ const MINE_BOT_SIZE* pSize, BOOLEAN approximate, ULONGLONG seed)
+{
+    BOOLEAN    bFalse = FALSE;
+    BOOLEAN    exact = FALSE;
+    BOOLEAN    resize = FALSE;
+    MINE_ERROR status = MINE_ERROR_SUCCESS;
+
+    do
+    {
+        //The exact engine only guesses on small boards, see MineBot_Guess
+        exact = ((!approximate) && (MINE_BOT_EXACT_TILES >= pSize->width*pSize->height)) ? (BOOLEAN) TRUE :
+                                                                                            (BOOLEAN) FALSE;
+        resize = ((pSize->width != gameData.width) || (pSize->height != gameData.height)) ? (BOOLEAN) TRUE :
+                                                                                             (BOOLEAN) FALSE;
+
+        //The board arrays belong to the arena, so they can be dropped with the rest
+        ZeroMemory(&gameData, sizeof(MINE_GAME_SETTINGS));
+        gameData.width = pSize->width;
+        gameData.height = pSize->height;
+        gameData.mines = pSize->mines;
+
+        status = Mine_AllocBoard(MineFrontier_ArenaBytes() + MineSolver_ArenaBytes() +
+                                 (exact ? MineProbability_ArenaBytes() : MineBelief_ArenaBytes()));
+        if (MINE_ERROR_SUCCESS != status)
+        {
+            break;
+        }
+
+        status = MineMinimap_Reset();
+        if (MINE_ERROR_SUCCESS != status)
+        {
+            break;
+        }
+
+        status = MineFrontier_Reset();
+        if (MINE_ERROR_SUCCESS != status)
+        {
+            break;
+        }
+
+        status = MineSolver_Reset();
+        if (MINE_ERROR_SUCCESS != status)
+        {
+            break;
+        }
+
+        //Messages from the last game would steer the guesses in this one
+        status = exact ? MineProbability_Reset() : MineBelief_Reset();
+        if (MINE_ERROR_SUCCESS != status)
+        {
+            break;
+        }
+
+        Mine_SeedRandom(seed);
+
+        status = Mine_NewRandomBoard();
+        if (MINE_ERROR_SUCCESS != status)
+        {
+            break;
+        }
+
+        //The window layout only depends on the board size
+        if (resize)
+        {
+            Mine_SetupWindow();
+        }
+
+        __assume(FALSE == bFalse);
+    } while (bFalse);
+
+    return status;
+}
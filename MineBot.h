@@ -0,0 +1,226 @@
+/**
+    @file MineBot.h
+
+    @author Craig Burkhart
+
+    @brief Header file for the headless autoplay benchmark, which plays whole
+           games through the game core and reports win rates and where the
+           time goes.
+*//*
+    Copyright (C) 2014 - Craig Burkhart
+
+    This file is part of Minesweeper Deluxe.
+
+    Minesweeper Deluxe is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Minesweeper Deluxe is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Minesweeper Deluxe.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#pragma once
+
+#include "Mine.h"
+
+//--------------------------------------------------------------
+//    Macros
+//--------------------------------------------------------------
+
+/** Default number of games played in each scenario. */
+#define MINE_BOT_DEFAULT_GAMES 1000
+/** Default seed the mine layouts of every scenario are made from. */
+#define MINE_BOT_DEFAULT_SEED  1
+/** Largest board (in tiles) guessed on with the exact probability engine,
+    larger boards use belief propagation. */
+#define MINE_BOT_EXACT_TILES   4096
+/** Number of board sizes in the benchmark, the last taken from the command line. */
+#define MINE_BOT_NUM_SIZES     4
+/** Number of wrap modes in the benchmark, none and both edges. */
+#define MINE_BOT_NUM_WRAPS     2
+/** Number of movement modes in the benchmark, still and moving mines. */
+#define MINE_BOT_NUM_MOVES     2
+/** Number of characters in a scenario name. */
+#define MINE_BOT_NAME_CHARS    64
+/** Normal quantile of the two sided 95% confidence interval of the win rate. */
+#define MINE_BOT_CONFIDENCE_Z  1.96
+
+/** Starting value of a 64 bit FNV-1a hash. */
+#define MINE_BOT_FNV_OFFSET 0xCBF29CE484222325ULL
+/** Multiplier of a 64 bit FNV-1a hash. */
+#define MINE_BOT_FNV_PRIME  0x00000100000001B3ULL
+
+/** Time spent setting up the board and laying the mines. */
+#define MINE_BOT_STAGE_GENERATE 0
+/** Time spent on the first click, moving a clicked mine and numbering the board. */
+#define MINE_BOT_STAGE_NUMBER   1
+/** Time spent revealing tiles, cascades included. */
+#define MINE_BOT_STAGE_REVEAL   2
+/** Time spent in the solver and probability engines. */
+#define MINE_BOT_STAGE_SOLVE    3
+/** Time spent moving mines between turns. */
+#define MINE_BOT_STAGE_MOVE     4
+/** Number of stages timed. */
+#define MINE_BOT_NUM_STAGES     5
+
+//--------------------------------------------------------------
+//    Structures
+//--------------------------------------------------------------
+
+struct _MINE_BOT_SIZE
+{
+    /** Name used in scenario names. */
+    LPCSTR name;
+    /** Width (in tiles) of the board. */
+    DWORD  width;
+    /** Height (in tiles) of the board. */
+    DWORD  height;
+    /** Number of mines on the board. */
+    DWORD  mines;
+};
+
+struct _MINE_BOT_RESULT
+{
+    /** Name of the scenario, i.e. "expert-wrap-move". */
+    CHAR      name[MINE_BOT_NAME_CHARS];
+    /** Number of games played. */
+    UINT      games;
+    /** Number of games won. */
+    UINT      wins;
+    /** Number of turns taken, each a batch of safe reveals or a single guess. */
+    ULONGLONG turns;
+    /** Number of turns that were guesses. */
+    ULONGLONG guesses;
+    /** Number of tiles uncovered, cascades included. */
+    ULONGLONG uncovered;
+    /** Total time (in nanoseconds) spent playing, every stage included. */
+    ULONGLONG totalTime;
+    /** Time (in nanoseconds) spent in each stage (MINE_BOT_STAGE_*). */
+    ULONGLONG stageTime[MINE_BOT_NUM_STAGES];
+    /** Hash of the outcome of every game, which changes if any move or result does. */
+    ULONGLONG hash;
+};
+
+//--------------------------------------------------------------
+//    Typedefs
+//--------------------------------------------------------------
+
+/** Board size played on by the benchmark. */
+typedef struct _MINE_BOT_SIZE MINE_BOT_SIZE;
+
+/** Win rate, timing and outcome hash of a single scenario. */
+typedef struct _MINE_BOT_RESULT MINE_BOT_RESULT;
+
+//--------------------------------------------------------------
+//    Function Prototypes
+//--------------------------------------------------------------
+
+/**
+    MineBot_CheckGolden
+*//**
+    Compare scenario outcome hashes against the golden file, or rewrite the
+    golden file.
+
+    @param[in] pFileName  - Name of the golden hash file.
+    @param[in] pResults   - Results of every scenario.
+    @param[in] numResults - Number of scenarios.
+    @param[in] update     - TRUE to rewrite the golden file with the current hashes.
+
+    @return Number of scenarios that did not match, or -1 if the file could not be used.
+*/
+INT
+MineBot_CheckGolden(_In_z_ LPCSTR pFileName, _In_reads_(numResults) MINE_BOT_RESULT* pResults,
+                    UINT numResults, BOOLEAN update);
+
+/**
+    MineBot_Guess
+*//**
+    Choose the hidden tile least likely to be a mine, with the exact engine on
+    boards up to MINE_BOT_EXACT_TILES and belief propagation on larger ones.
+
+    @param[in]  approximate - Flag for if belief propagation is used at any size.
+    @param[out] pTile       - Board index of the tile to reveal.
+
+    @return Mine error code (MINE_ERROR_SUCCESS upon success).
+*/
+MINE_ERROR
+MineBot_Guess(BOOLEAN approximate, _Out_ PLONG pTile);
+
+/**
+    MineBot_Hash
+*//**
+    Fold a value into a 64 bit FNV-1a hash, one byte at a time.
+
+    @param[in] hash  - Hash so far.
+    @param[in] value - Value to fold in.
+
+    @return Updated hash.
+*/
+ULONGLONG
+MineBot_Hash(ULONGLONG hash, ULONGLONG value);
+
+/**
+    MineBot_Now
+*//**
+    Read a monotonic clock.
+
+    @return Current time in nanoseconds.
+*/
+ULONGLONG
+MineBot_Now(VOID);
+
+/**
+    MineBot_PlayGame
+*//**
+    Play one game to the end: click the middle tile, then each turn reveal
+    every tile the solver finds safe, or guess when it finds none. Mines move
+    between turns if the scenario moves them.
+
+    @param[in]     approximate - Flag for if guesses always use belief propagation.
+    @param[in]     move        - Flag for if mines move between turns.
+    @param[in]     seed        - Seed for the mine layout and the moves.
+    @param[in,out] pResult     - Scenario counts and times the game is added to.
+
+    @return Mine error code (MINE_ERROR_SUCCESS upon success).
+*/
+MINE_ERROR
+MineBot_PlayGame(BOOLEAN approximate, BOOLEAN move, ULONGLONG seed, _Inout_ MINE_BOT_RESULT* pResult);
+
+/**
+    MineBot_RunScenario
+*//**
+    Play a number of games on one board size, wrap mode and movement mode.
+
+    @param[in]  pSize       - Board size to play on.
+    @param[in]  wrap        - Flag for if the board wraps across both edges.
+    @param[in]  move        - Flag for if mines move between turns.
+    @param[in]  approximate - Flag for if guesses always use belief propagation.
+    @param[in]  games       - Number of games to play.
+    @param[in]  seed        - Seed the mine layout of each game is made from.
+    @param[out] pResult     - Win rate, timing and outcome hash of the scenario.
+
+    @return Mine error code (MINE_ERROR_SUCCESS upon success).
+*/
+MINE_ERROR
+MineBot_RunScenario(_In_ const MINE_BOT_SIZE* pSize, BOOLEAN wrap, BOOLEAN move, BOOLEAN approximate,
+                    UINT games, ULONGLONG seed, _Out_ MINE_BOT_RESULT* pResult);
+
+/**
+    MineBot_SetupBoard
+*//**
+    Set up a new game on a board of the given size with a repeatable mine
+    layout, every tile hidden, with storage for the engines the game will use.
+
+    @param[in] pSize       - Board size to create.
+    @param[in] approximate - Flag for if guesses always use belief propagation.
+    @param[in] seed        - Seed for the mine layout and the moves.
+
+    @return Mine error code (MINE_ERROR_SUCCESS upon success).
+*/
+MINE_ERROR
+MineBot_SetupBoard(_In_ const MINE_BOT_SIZE* pSize, BOOLEAN approximate, ULONGLONG seed);
@@ -0,0 +1,1246 @@
+/**
+    @file MineCore.cpp
+
+    @author Craig Burkhart
+
+    @brief Game state and window layout shared by the Windows and headless builds.
+*//*
+    Copyright (C) 2014 - Craig Burkhart
+
+    This file is part of Minesweeper Deluxe.
+
+    Minesweeper Deluxe is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Minesweeper Deluxe is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Minesweeper Deluxe.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#include "stdafx.h"
+#include "Mine.h"
+#include "MineArena.h"
+#include "MineDamage.h"
+#include "MineDebug.h"
+#include "MineFrontier.h"
+#include "MineMinimap.h"
+#ifdef _WIN32
+#include "MineSim.h"
+#endif /* _WIN32 */
+#include "MineSprite.h"
+
+// Global Variables:
+MINE_GAME_SETTINGS   gameData = {0};
+MINE_IMAGE_STORAGE   imageData = {0};
+MINE_GLOBAL_SETTINGS menuData = {0};
+MINE_WINDOW_SETTINGS windowData = {0};
+
+/**
+    Mine_AllocBoard
+*//**
+    Carve the board arrays for a game of the current size out of the arena,
+    with room left over for the frontend's own per-tile buffers. All of them
+    start zeroed.
+
+    @param[in] scratchBytes - Number of extra bytes the caller will take from
+                              the arena with MineArena_Alloc.
+
+    @return Mine error code (MINE_ERROR_SUCCESS on success).
+*/
+MINE_ERROR
+Mine_AllocBoard(SIZE_T scratchBytes)
+{
+    BOOLEAN    bFalse = FALSE;
+    MINE_ERROR status = MINE_ERROR_SUCCESS;
+    SIZE_T     tiles = ((SIZE_T) gameData.width)*((SIZE_T) gameData.height);
+
+    do
+    {
+        //Everything carved out for the previous game goes away with the reset
+        gameData.gameBoard = NULL;
+        gameData.tileStatus = NULL;
+        gameData.mineTiles = NULL;
+        gameData.mineSlots = NULL;
+        gameData.cascadeTiles = NULL;
+
+        status = MineArena_Reset(2*MINE_ARENA_BYTES(tiles) + MINE_ARENA_BYTES(gameData.mines*sizeof(LONG)) +
+                                 2*MINE_ARENA_BYTES(tiles*sizeof(LONG)) + MINE_ARENA_BYTES(scratchBytes));
+        if (MINE_ERROR_SUCCESS != status)
+        {
+            MineDebug_PrintError("In function MineArena_Reset: %i\n", (int) status);
+            break;
+        }
+
+        //Cannot fail, the arena was sized for exactly these
+        gameData.gameBoard = (CHAR*) MineArena_Alloc(tiles);
+        gameData.tileStatus = (CHAR*) MineArena_Alloc(tiles);
+        gameData.mineTiles = (LONG*) MineArena_Alloc(gameData.mines*sizeof(LONG));
+        gameData.mineSlots = (LONG*) MineArena_Alloc(tiles*sizeof(LONG));
+        gameData.cascadeTiles = (LONG*) MineArena_Alloc(tiles*sizeof(LONG));
+
+        __assume(FALSE == bFalse);
+    } while (bFalse);
+
+    return status;
+}
+
+/** 
+    Mine_AssignNumbers
+*//**
+    Count the number of mines surrounding the tiles in a region of the board.
+
+    @param[in] xGridMin - Minimum x coordinate for board region.
+    @param[in] xGridMax - Maximum x coordinate for board region.
+    @param[in] yGridMin - Minimum y coordinate for board region.
+    @param[in] yGridMax - Maximum y coordinate for board region.
+
+    @return Mine error code (MINE_ERROR_SUCCESS on success).
+*/
+MINE_ERROR
+Mine_AssignNumbers(LONG xGridMin, LONG xGridMax, LONG yGridMin, LONG yGridMax)
+{
+    BOOLEAN    bFalse = FALSE;
+    INT        ix = 0;
+    INT        jx = 0;
+    CHAR       mines = 0;
+    MINE_ERROR status = MINE_ERROR_SUCCESS;
+    LONG       xGridBase = 0;
+    LONG       xGridPos = 0;
+    LONG       yGridBase = 0;
+    LONG       yGridPos = 0;
+
+    do
+    {
+        xGridMin = max(0, min(xGridMin, (LONG) gameData.width - 1));
+        xGridMax = max(0, min(xGridMax, (LONG) gameData.width - 1));
+        yGridMin = max(0, min(yGridMin, (LONG) gameData.height - 1));
+        yGridMax = max(0, min(yGridMax, (LONG) gameData.height - 1));
+
+        if ((xGridMin > xGridMax) || (yGridMin > yGridMax))
+        {
+            status = MINE_ERROR_PARAMETER;
+            MineDebug_PrintError("Grid input min is greater than max\n");
+            break;
+        }
+
+        for (xGridBase = xGridMin; xGridBase <= xGridMax; xGridBase++)
+        {
+            for (yGridBase = yGridMin; yGridBase <= yGridMax; yGridBase++)
+            {
+                //Tiles that are bombs do not get a number
+                if (MINE_BOMB_VALUE == gameData.gameBoard[MINE_INDEX(xGridBase, yGridBase)])
+                {
+                    continue;
+                }
+
+                mines = 0;
+
+                /** For each non-mine tile, count number of mines in surrounding tiles. */
+
+                /** Allow wrapping for x coordinates if in wrap horizontal mode. */
+                for (ix = -1; ix <= 1; ix++)
+                {
+                    xGridPos = xGridBase + ix;
+
+                    if (xGridPos < 0)
+                    {
+                        if (menuData.wrapHorz)
+                        {
+                            xGridPos = (LONG) gameData.width - 1;
+                        }
+                        else
+                        {
+                            continue;
+                        }
+                    }
+                    else if  (xGridPos > ((LONG) (gameData.width - 1)))
+                    {
+                        if (menuData.wrapHorz)
+                        {
+                            xGridPos = 0;
+                        }
+                        else
+                        {
+                            continue;
+                        }
+                    }
+                
+                    /** Allow wrapping for y coordinate if in wrap vertical mode. */
+                    for (jx = -1; jx <= 1; jx++)
+                    {
+                        //Skip the check for the current tile itself
+                        if ((0 == ix) && (0 == jx))
+                        {
+                            continue;
+                        }
+
+                        yGridPos = yGridBase + jx;
+
+                        if (yGridPos < 0)
+                        {
+                            if (menuData.wrapVert)
+                            {
+                                yGridPos = (LONG) gameData.height - 1;
+                            }
+                            else
+                            {
+                                continue;
+                            }
+                        }
+                        else if (yGridPos > (LONG) (gameData.height - 1))
+                        {
+                            if (menuData.wrapVert)
+                            {
+                                yGridPos = 0;
+                            }
+                            else
+                            {
+                                continue;
+                            }
+                        }
+                        
+                        //Check for a mine
+                        if (MINE_BOMB_VALUE == gameData.gameBoard[MINE_INDEX(xGridPos, yGridPos)])
+                        {
+                            mines += 1;
+                        }
+                    }
+                }
+
+                gameData.gameBoard[MINE_INDEX(xGridBase, yGridBase)] = mines;
+            }
+        }
+
+        __assume(FALSE == bFalse);
+    } while (bFalse);
+
+    return status;
+}
+
+/**
+    Mine_DoRectOverlap
+*//**
+    Determine if two rectangles have any overlap. Mainly used to see
+    if an invalid rectangle includes parts of a region of the window.
+
+    @param[in] pRect1 - Pointer to a RECT.
+    @param[in] pRect2 - Pointer to a RECT.
+
+    @return TRUE if rectangles overlap. FALSE otherwise.
+*/
+BOOLEAN 
+Mine_DoRectOverlap(_In_ PRECT pRect1, _In_ PRECT pRect2)
+{
+    BOOLEAN returnValue = FALSE;
+
+    if ((NULL == pRect1) || (NULL == pRect2))
+    {
+        MineDebug_PrintWarning("Input parameter to Mine_DoRectOverlap is NULL\n");
+    }
+    else
+    {
+        //Same test as IntersectRect, right and bottom edges are exclusive
+        returnValue = (((max(pRect1->left, pRect2->left) < min(pRect1->right, pRect2->right)) &&
+                        (max(pRect1->top, pRect2->top) < min(pRect1->bottom, pRect2->bottom))) ?
+                         (BOOLEAN) TRUE : (BOOLEAN) FALSE);
+    }
+
+    return returnValue;
+}
+
+/**
+    Mine_FreeBoard
+*//**
+    Give the board arrays and the arena they were carved from back at program close.
+*/
+VOID
+Mine_FreeBoard(VOID)
+{
+    gameData.gameBoard = NULL;
+    gameData.tileStatus = NULL;
+    gameData.mineTiles = NULL;
+    gameData.mineSlots = NULL;
+    gameData.cascadeTiles = NULL;
+
+    MineArena_Cleanup();
+
+    return;
+}
+
+/**
+    Mine_GetGridRects
+*//**
+    Find where a block of tiles appears in the board view. A wrapped board can
+    show a block split across the edges of the view, so up to four rectangles
+    are needed.
+
+    @param[in]  xGridMin - Minimum x coordinate of block in grid.
+    @param[in]  xGridMax - Maximum x coordinate of block in grid.
+    @param[in]  yGridMin - Minimum y coordinate of block in grid.
+    @param[in]  yGridMax - Maximum y coordinate of block in grid.
+    @param[out] pRects   - Array of four rectangles, clipped to the board region.
+
+    @return Number of rectangles stored in pRects, 0 if the block is out of view.
+*/
+UINT
+Mine_GetGridRects(LONG xGridMin, LONG xGridMax, LONG yGridMin, LONG yGridMax,
+                  _Out_writes_(4) PRECT pRects)
+{
+    RECT block = {0};
+    LONG ix = 0;
+    LONG jx = 0;
+    LONG left = 0;
+    UINT numRects = 0;
+    LONG spanX = ((LONG) gameData.width)*windowData.tilePixels;
+    LONG spanY = ((LONG) gameData.height)*windowData.tilePixels;
+    LONG top = 0;
+
+    if ((NULL == pRects) || (0 >= spanX) || (0 >= spanY))
+    {
+        MineDebug_PrintWarning("Invalid parameter to Mine_GetGridRects\n");
+    }
+    else
+    {
+        //Position of block relative to the start of the view, brought into the range 0 to span-1
+        left = (((xGridMin*windowData.tilePixels - windowData.scrollX) % spanX) + spanX) % spanX;
+        top = (((yGridMin*windowData.tilePixels - windowData.scrollY) % spanY) + spanY) % spanY;
+
+        /** A block near the far edge of the board also shows one board length earlier. */
+        for (ix = 0; ix < 2; ix++)
+        {
+            for (jx = 0; jx < 2; jx++)
+            {
+                block.left = max(windowData.boardRegion.left + left - ix*spanX, windowData.boardRegion.left);
+                block.top = max(windowData.boardRegion.top + top - jx*spanY, windowData.boardRegion.top);
+                block.right = min(windowData.boardRegion.left + left - ix*spanX +
+                                  (xGridMax - xGridMin + 1)*windowData.tilePixels,
+                                  windowData.boardRegion.right);
+                block.bottom = min(windowData.boardRegion.top + top - jx*spanY +
+                                   (yGridMax - yGridMin + 1)*windowData.tilePixels,
+                                   windowData.boardRegion.bottom);
+
+                if ((block.left < block.right) && (block.top < block.bottom))
+                {
+                    pRects[numRects] = block;
+                    numRects++;
+                }
+            }
+        }
+    }
+
+    return numRects;
+}
+
+/**
+    Mine_IsRectSubset
+*//**
+    Check if a rectangle is a subset of the boundary rectangle.
+
+    @param[in] pBoundary - Boundary rectangle.
+    @param[in] pRect     - Rectangle to check.
+
+    @return TRUE if rectangle is a subset. FALSE otherwise.
+*/
+BOOLEAN 
+Mine_IsRectSubset(_In_ PRECT pBoundary, _In_ PRECT pRect)
+{
+    BOOLEAN returnValue = FALSE;
+
+    if ((NULL == pBoundary) || (NULL == pRect))
+    {
+        MineDebug_PrintWarning("Input parameter to Mine_IsRectSubset is NULL\n");
+    }
+    else
+    {
+        returnValue = (((pBoundary->left <= pRect->left) && (pBoundary->top <= pRect->top) &&
+                        (pBoundary->bottom >= pRect->bottom) && (pBoundary->right >= pRect->right)) ? 
+                         (BOOLEAN) TRUE : (BOOLEAN) FALSE);
+    }
+
+    return returnValue;
+}
+
+/**
+    Mine_JumpView
+*//**
+    Move the board view straight to a tile, centering it as far as the edges
+    of the board allow.
+
+    @param[in] xGrid - X coordinate of tile in grid.
+    @param[in] yGrid - Y coordinate of tile in grid.
+*/
+VOID
+Mine_JumpView(LONG xGrid, LONG yGrid)
+{
+    LONG viewHeight = windowData.boardRegion.bottom - windowData.boardRegion.top;
+    LONG viewWidth = windowData.boardRegion.right - windowData.boardRegion.left;
+
+    windowData.targetX = Mine_LimitScroll(xGrid*windowData.tilePixels + (windowData.tilePixels - viewWidth)/2,
+                                          ((LONG) gameData.width)*windowData.tilePixels, viewWidth,
+                                          menuData.wrapHorz);
+    windowData.targetY = Mine_LimitScroll(yGrid*windowData.tilePixels + (windowData.tilePixels - viewHeight)/2,
+                                          ((LONG) gameData.height)*windowData.tilePixels, viewHeight,
+                                          menuData.wrapVert);
+
+    //No sliding, the view is somewhere else entirely
+    windowData.scrollX = windowData.targetX;
+    windowData.scrollY = windowData.targetY;
+
+    return;
+}
+
+/**
+    Mine_LimitScroll
+*//**
+    Bring a scroll offset back onto the board. Wrapped directions go around the
+    board, other directions stop where the view reaches the edge of the board.
+
+    @param[in] offset - Scroll offset (in pixels).
+    @param[in] span   - Size (in pixels) of the board along the scroll direction.
+    @param[in] view   - Size (in pixels) of the view along the scroll direction.
+    @param[in] wrap   - Flag for if the board wraps along the scroll direction.
+
+    @return Scroll offset (in pixels) inside the board.
+*/
+LONG
+Mine_LimitScroll(LONG offset, LONG span, LONG view, BOOLEAN wrap)
+{
+    if (0 >= span)
+    {
+        offset = 0;
+    }
+    else if (wrap)
+    {
+        offset = ((offset % span) + span) % span;
+    }
+    else
+    {
+        offset = max(0, min(offset, span - view));
+    }
+
+    return offset;
+}
+
+/**
+    Mine_MoveView
+*//**
+    Set the board view scrolling by a number of tiles. Wrapped directions go
+    around the board, other directions stop at its edges.
+
+    @param[in] xTiles - Number of tiles to scroll right, negative to scroll left.
+    @param[in] yTiles - Number of tiles to scroll down, negative to scroll up.
+
+    @return TRUE if the view needs to scroll to reach its new target. FALSE otherwise.
+*/
+BOOLEAN
+Mine_MoveView(LONG xTiles, LONG yTiles)
+{
+    windowData.targetX = Mine_LimitScroll(windowData.targetX + xTiles*windowData.tilePixels,
+                                          ((LONG) gameData.width)*windowData.tilePixels,
+                                          windowData.boardRegion.right - windowData.boardRegion.left,
+                                          menuData.wrapHorz);
+    windowData.targetY = Mine_LimitScroll(windowData.targetY + yTiles*windowData.tilePixels,
+                                          ((LONG) gameData.height)*windowData.tilePixels,
+                                          windowData.boardRegion.bottom - windowData.boardRegion.top,
+                                          menuData.wrapVert);
+
+    return (windowData.targetX != windowData.scrollX) || (windowData.targetY != windowData.scrollY);
+}
+
+/**
+    Mine_MoveMine
+*//**
+    Move a mine to a tile without one, keeping the list of mine positions
+    up to date. Numbers around either tile are not reassigned.
+
+    @param[in] fromIndex - Board index of the tile the mine is on.
+    @param[in] toIndex   - Board index of the tile to move the mine to.
+*/
+VOID
+Mine_MoveMine(LONG fromIndex, LONG toIndex)
+{
+    LONG slot = gameData.mineSlots[fromIndex];
+
+    gameData.gameBoard[fromIndex] = 0;
+    gameData.gameBoard[toIndex] = MINE_BOMB_VALUE;
+
+    /** The mine keeps its place in the list, only the tile it names changes. */
+    gameData.mineTiles[slot] = toIndex;
+    gameData.mineSlots[toIndex] = slot;
+    gameData.mineSlots[fromIndex] = -1;
+
+    return;
+}
+
+/**
+    Mine_NewRandomBoard
+*//**
+    Assign the correct number of mines randomly to a new game board, and
+    list where they are in mineTiles and mineSlots.
+
+    @return Mine error code (MINE_ERROR_SUCCESS on success).
+*/
+MINE_ERROR 
+Mine_NewRandomBoard(VOID)
+{
+    BOOLEAN    bFalse = FALSE;
+    INT        ix = 0;
+    LONG       minesPlaced = 0;
+    DWORD      minesRemaining = gameData.mines;
+    UINT       rand = 0;
+    MINE_ERROR status = MINE_ERROR_SUCCESS;
+    DWORD      tilesRemaining = gameData.height * gameData.width;
+
+    do
+    {
+        for (ix = 0; ix < (INT) (gameData.width*gameData.height); ix++)
+        {
+            gameData.mineSlots[ix] = -1;
+        }
+
+        /** For each tile, assign a mine with probability (num mines left)/(num tiles left).
+            This will produce a uniform distribution over all possible boards. */
+        for(ix = 0; (minesRemaining > 0) && (tilesRemaining > 0); ix++)
+        {
+            status = Mine_Random(tilesRemaining, &rand);
+            if (MINE_ERROR_SUCCESS != status)
+            {
+                MineDebug_PrintError("In function Mine_Random: %i\n", (int) status);
+                break;
+            }
+
+            if (rand < minesRemaining)
+            {
+                gameData.gameBoard[ix] = MINE_BOMB_VALUE;
+                gameData.mineTiles[minesPlaced] = (LONG) ix;
+                gameData.mineSlots[ix] = minesPlaced;
+                minesPlaced++;
+                minesRemaining--;
+            }
+
+            tilesRemaining--;
+        }
+        if (MINE_ERROR_SUCCESS != status)
+        {
+            break;
+        }
+
+        //All mines should be assigned. Tiles left starts greater than mines left. If mines left ever 
+        //equals tiles left then each remaining tile would be assigned a mine with probability one.
+
+        __assume(FALSE == bFalse);
+    } while (bFalse);
+
+    return status;
+}
+
+/**
+    Mine_PointInRect
+*//**
+    Checks if a point is inside a given rectangle.
+
+    @param[in] x     - X coordinate of point.
+    @param[in] y     - Y coordinate of point.
+    @param[in] pRect - Pointer to boundary rectangle.
+
+    @return TRUE if point is in rectangle. FALSE otherwise.
+*/
+BOOLEAN 
+Mine_PointInRect(short x, short y, _In_ PRECT pRect)
+{
+    BOOLEAN returnValue = TRUE;
+
+    if (NULL == pRect)
+    {
+        MineDebug_PrintWarning("Input parameter to Mine_PointInRect is NULL\n");
+        returnValue = FALSE;
+    }
+    else
+    {
+        if ((x < pRect->left) || (x >= pRect->right))
+        {
+            returnValue = FALSE;
+        }
+
+        if ((y < pRect->top) || (y >= pRect->bottom))
+        {
+            returnValue = FALSE;
+        }
+    }
+
+    return returnValue;
+}
+
+/**
+    Mine_PointToGrid
+*//**
+    Find the tile under a point in the window, taking into account how far the
+    board is currently scrolled.
+
+    @param[in]  x      - X coordinate of point.
+    @param[in]  y      - Y coordinate of point.
+    @param[out] pxGrid - X coordinate of tile in grid.
+    @param[out] pyGrid - Y coordinate of tile in grid.
+
+    @return TRUE if point is on the game board. FALSE otherwise.
+*/
+BOOLEAN
+Mine_PointToGrid(short x, short y, _Out_ PLONG pxGrid, _Out_ PLONG pyGrid)
+{
+    BOOLEAN returnValue = FALSE;
+    LONG    spanX = ((LONG) gameData.width)*windowData.tilePixels;
+    LONG    spanY = ((LONG) gameData.height)*windowData.tilePixels;
+
+    if ((NULL == pxGrid) || (NULL == pyGrid))
+    {
+        MineDebug_PrintWarning("Output parameter to Mine_PointToGrid is NULL\n");
+    }
+    else if (Mine_PointInRect(x, y, &windowData.boardRegion))
+    {
+        //Scroll offsets locate the view on the board, which can wrap past its far edge
+        *pxGrid = ((((LONG) x) - windowData.boardRegion.left + windowData.scrollX) % spanX) /
+                  windowData.tilePixels;
+        *pyGrid = ((((LONG) y) - windowData.boardRegion.top + windowData.scrollY) % spanY) /
+                  windowData.tilePixels;
+
+        returnValue = TRUE;
+    }
+
+    return returnValue;
+}
+
+#ifndef _WIN32
+/** State of the headless random number generator. */
+static ULONGLONG randomState = 0x853C49E6748FEA9BULL;
+
+/**
+    Mine_Random
+*//**
+    Obtain a random integer in the range 0 to (limit-1) inclusive.
+    Headless builds use a seedable xorshift generator so runs can be repeated.
+
+    @param[in]  limit  - Number of possible random value to return.
+    @param[out] output - Pointer to a UINT to hold the random number.
+
+    @return Mine error code (MINE_ERROR_SUCCESS upon success).
+*/
+MINE_ERROR 
+Mine_Random(UINT limit, _Out_ PUINT output)
+{
+    BOOLEAN    bFalse = FALSE;
+    UINT       rand = 0;
+    MINE_ERROR status = MINE_ERROR_SUCCESS;
+    UINT       threshold = 0;
+
+    do
+    {
+        if ((NULL == output) || (0 == limit))
+        {
+            MineDebug_PrintError("Invalid parameter to Mine_Random\n");
+            status = MINE_ERROR_PARAMETER;
+            break;
+        }
+
+        //Reject the low values that would bias the modulus
+        threshold = (0U - limit) % limit;
+
+        do
+        {
+            randomState ^= randomState >> 12;
+            randomState ^= randomState << 25;
+            randomState ^= randomState >> 27;
+            rand = (UINT) ((randomState * 0x2545F4914F6CDD1DULL) >> 32);
+        } while (rand < threshold);
+
+        *output = rand % limit;
+
+        __assume(FALSE == bFalse);
+    } while (bFalse);
+
+    return status;
+}
+#endif /* _WIN32 */
+
+/**
+    Mine_RandomPerm
+*//**
+    Create a random ordered set of numPerm elements from a collection of numArray elements.
+
+    @param[inout] pArray   - Pointer to the array of elements.
+    @param[in]    numArray - Number of elements in the array.
+    @param[in]    numPerm  - Size of ordered set to create.
+
+    @return Mine error code (MINE_ERROR_SUCCESS upon success).
+*/
+MINE_ERROR
+Mine_RandomPerm(_Inout_updates_to_(numArray, numPerm) PUINT pArray, 
+                UINT numArray, UINT numPerm)
+{
+    BOOLEAN    bFalse = FALSE;
+    UINT       ix = 0;
+    UINT       limit = 0;
+    UINT       rand = 0;
+    MINE_ERROR status = MINE_ERROR_SUCCESS;
+    UINT       temp = 0;
+
+    do
+    {
+        if (NULL == pArray)
+        {
+            MineDebug_PrintError("Parameter pArray is NULL\n");
+            status = MINE_ERROR_PARAMETER;
+            break;
+        }
+
+        if (numPerm > numArray)
+        {
+            MineDebug_PrintError("Parameter numPerm must be less than or equal to numArray\n");
+            status = MINE_ERROR_PARAMETER;
+            break;
+        }
+
+        /** Implement the Knuth shuffle to generate a random permutation. 
+            Stop after numPerm elements have been fixed. */
+        for (ix = 0; ix < numPerm; ix++)
+        {
+            limit = numArray - ix;
+
+            status = Mine_Random(limit, &rand);
+            if (MINE_ERROR_SUCCESS != status)
+            {
+                MineDebug_PrintError("In function Mine_Random: %i\n", (int) status);
+                break;
+            }
+
+            temp = pArray[numArray - 1 - rand];
+            pArray[numArray - 1 - rand] = pArray[ix];
+            pArray[ix] = temp;
+        }
+
+        __assume(FALSE == bFalse);
+    } while (bFalse);
+
+    return status;
+}
+
+#ifndef _WIN32
+/**
+    Mine_SeedRandom
+*//**
+    Restart the random number sequence so headless runs are repeatable.
+
+    @param[in] seed - Starting value for the random number generator.
+*/
+VOID
+Mine_SeedRandom(ULONGLONG seed)
+{
+    //Xorshift state must never be zero
+    randomState = (0 == seed) ? 0x853C49E6748FEA9BULL : seed;
+
+    return;
+}
+#endif /* _WIN32 */
+
+/**
+    Mine_ScrollToward
+*//**
+    Advance a scroll offset one step toward its target. On a wrapped board it
+    goes whichever way around is shorter.
+
+    @param[in] current - Current offset (in pixels).
+    @param[in] target  - Target offset (in pixels).
+    @param[in] span    - Size (in pixels) of the board along the scroll direction.
+    @param[in] wrap    - Flag for if the board wraps along the scroll direction.
+
+    @return New offset (in pixels) in the range 0 to (span-1) inclusive.
+*/
+LONG
+Mine_ScrollToward(LONG current, LONG target, LONG span, BOOLEAN wrap)
+{
+    LONG distance = 0;
+    LONG step = 0;
+
+    if (0 < span)
+    {
+        if (wrap)
+        {
+            //Distance going forward around the board, made negative if going back is shorter
+            distance = (((target - current) % span) + span) % span;
+            if (distance > span/2)
+            {
+                distance -= span;
+            }
+        }
+        else
+        {
+            distance = target - current;
+        }
+
+        //Scroll at a steady rate, but catch up if arrow keys are pressed faster than that
+        step = max(MINE_SCROLL_STEP_PIXELS, ((distance < 0) ? -distance : distance) / MINE_SCROLL_CATCH_UP);
+
+        if (distance < 0)
+        {
+            distance = max(distance, -step);
+        }
+        else
+        {
+            distance = min(distance, step);
+        }
+
+        current = (((current + distance) % span) + span) % span;
+    }
+
+    return current;
+}
+
+/**
+    Mine_SetTileStatus
+*//**
+    Change the status of a tile, pass the change on to the minimap and the
+    frontier, and mark whatever changed on screen to be redrawn. All changes to
+    tileStatus after a game is set up go through here.
+
+    @param[in] xGrid  - X coordinate of tile in grid.
+    @param[in] yGrid  - Y coordinate of tile in grid.
+    @param[in] status - New status of the tile (MINE_TILE_STATUS_*).
+*/
+VOID
+Mine_SetTileStatus(LONG xGrid, LONG yGrid, CHAR status)
+{
+    CHAR oldStatus = gameData.tileStatus[MINE_INDEX(xGrid, yGrid)];
+
+    gameData.tileStatus[MINE_INDEX(xGrid, yGrid)] = status;
+
+    if (oldStatus != status)
+    {
+        MineDamage_AddGrid(xGrid, xGrid, yGrid, yGrid);
+
+        //Only the one minimap pixel holding the tile can change
+        if (MineMinimap_UpdateTile(xGrid, yGrid, oldStatus, status))
+        {
+            MineDamage_AddMinimapTile(xGrid, yGrid);
+        }
+
+        MineFrontier_UpdateTile(xGrid, yGrid, oldStatus, status);
+
+#ifdef _WIN32
+        //The movement thread keeps its own copy of the board
+        MineSim_PostStatus(MINE_INDEX(xGrid, yGrid), status);
+#endif /* _WIN32 */
+    }
+
+    return;
+}
+
+/**
+    Mine_SetZoom
+*//**
+    Change the magnification of the board, keeping the same tiles in view, and
+    lay the window out again.
+
+    @param[in] zoom - New magnification in zoom steps, limited to MINE_ZOOM_STEPS
+                      to MINE_MAX_ZOOM*MINE_ZOOM_STEPS.
+*/
+VOID
+Mine_SetZoom(LONG zoom)
+{
+    LONG oldTilePixels = max(windowData.tilePixels, 1);
+    LONG tilePixels = 0;
+
+    zoom = max(MINE_ZOOM_STEPS, min(zoom, MINE_MAX_ZOOM*MINE_ZOOM_STEPS));
+    tilePixels = MINE_ZOOM_TILE_PIXELS(zoom);
+
+    //Scale the offsets so the same tile stays at the top left of the view
+    windowData.scrollX = windowData.scrollX*tilePixels / oldTilePixels;
+    windowData.scrollY = windowData.scrollY*tilePixels / oldTilePixels;
+    windowData.targetX = windowData.targetX*tilePixels / oldTilePixels;
+    windowData.targetY = windowData.targetY*tilePixels / oldTilePixels;
+
+    windowData.zoom = zoom;
+    Mine_SetupWindow();
+
+    return;
+}
+
+/**
+    Mine_SetupNumberImageData
+*//**
+    Map tile numbers to sprites in the atlas for the current number image mode.
+
+    @return Mine error code (MINE_ERROR_SUCCESS upon success).
+*/
+MINE_ERROR
+Mine_SetupNumberImageData(VOID)
+{
+    BOOLEAN    bFalse = FALSE;
+    UINT       ix = 0;
+    UINT       randArray[MINE_NUM_RANDOM_TILES];
+    MINE_ERROR status = MINE_ERROR_SUCCESS;
+
+    do
+    {
+        //For random images create a random permutation and use first 8 elements
+        if (MINE_NUMBER_IMAGE_RANDOM == menuData.numberImages)
+        {
+            for (ix = 0; ix < MINE_NUM_RANDOM_TILES; ix++)
+            {
+                randArray[ix] = ix;
+            }
+
+            status = Mine_RandomPerm(randArray, MINE_NUM_RANDOM_TILES, 8);
+            if (MINE_ERROR_SUCCESS != status)
+            {
+                MineDebug_PrintError("In function Mine_RandomPerm: %i\n", status);
+                break;
+            }
+        }
+
+        //Every number image set is compiled into the atlas, only the mapping changes
+        for (ix = 0; ix < 9; ix++)
+        {
+            switch(menuData.numberImages)
+            {
+            //Use images for normal numbers
+            case MINE_NUMBER_IMAGE_NORMAL:
+                imageData.numbers[ix] = MINE_SPRITE_CLICKED0 + ix;
+                break;
+
+            //Use images for reversed numbers
+            case MINE_NUMBER_IMAGE_REVERSE:
+                imageData.numbers[ix] = MINE_SPRITE_CLICKED0 + 8 - ix;
+                break;
+
+            //Use images for solid color numbers
+            case MINE_NUMBER_IMAGE_SOLID:
+                imageData.numbers[ix] = MINE_SPRITE_SOLID0 + ix;
+                break;
+
+            //Use random symbols for numbers
+            case MINE_NUMBER_IMAGE_RANDOM:
+                //Still keep a blank tile as the image for zero mines
+                if (0 == ix)
+                {
+                    imageData.numbers[ix] = MINE_SPRITE_CLICKED0;
+                }
+                else
+                {
+                    imageData.numbers[ix] = MINE_SPRITE_RANDOM0 + randArray[ix - 1];
+                }
+                break;
+                
+            //Use blank tile image for all numbers
+            case MINE_NUMBER_IMAGE_BLANK:
+                imageData.numbers[ix] = MINE_SPRITE_CLICKED0;
+                break;
+
+            default:
+                __assume(0);
+                break;
+
+            }
+        }
+
+        __assume(FALSE == bFalse);
+    } while (bFalse);
+
+    return status;
+}
+
+/**
+    Mine_SetupWindow
+*//**
+    Store information about the coordinates of window components.
+*/
+VOID
+Mine_SetupWindow(VOID)
+{
+    LONG maxViewHeight = (0 < windowData.maxViewHeight) ? windowData.maxViewHeight : MINE_DEFAULT_VIEW_HEIGHT;
+    LONG maxViewWidth = (0 < windowData.maxViewWidth) ? windowData.maxViewWidth : MINE_DEFAULT_VIEW_WIDTH;
+    LONG minimapHeight = 0;
+    LONG minimapWidth = 0;
+    LONG viewHeight = 0;
+    LONG viewWidth = 0;
+
+    windowData.zoom = max(MINE_ZOOM_STEPS, min(windowData.zoom, MINE_MAX_ZOOM*MINE_ZOOM_STEPS));
+    windowData.tilePixels = MINE_ZOOM_TILE_PIXELS(windowData.zoom);
+
+    /** Board view shows the whole board if it fits, otherwise as many whole tiles as fit. */
+    viewHeight = min((LONG) gameData.height, max(1, maxViewHeight / windowData.tilePixels))*windowData.tilePixels;
+    viewWidth = min((LONG) gameData.width, max(1, maxViewWidth / windowData.tilePixels))*windowData.tilePixels;
+
+    /** The minimap sits to the right of the view whenever part of the board is out of view. */
+    if ((NULL != minimapData.pPixels) &&
+        ((viewWidth < ((LONG) gameData.width)*windowData.tilePixels) ||
+         (viewHeight < ((LONG) gameData.height)*windowData.tilePixels)))
+    {
+        minimapHeight = minimapData.height;
+        minimapWidth = minimapData.width + MINE_MINIMAP_GAP_PIXELS;
+    }
+
+    windowData.clientHeight = MINE_BASE_HEIGHT_PIXELS + (DWORD) max(viewHeight, minimapHeight);
+    windowData.clientWidth = MINE_BASE_WIDTH_PIXELS + (DWORD) (viewWidth + minimapWidth);
+
+    /** Store coordinates for all decorative white lines. */
+    //White lines along left side of window
+    windowData.whiteLines[0].top = 0;
+    windowData.whiteLines[0].left = 0;
+    windowData.whiteLines[0].right = 0;
+    windowData.whiteLines[0].bottom = (LONG) windowData.clientHeight;
+
+    windowData.whiteLines[1].top = 0;
+    windowData.whiteLines[1].left = 1;
+    windowData.whiteLines[1].right = 1;
+    windowData.whiteLines[1].bottom = (LONG) windowData.clientHeight;
+
+    windowData.whiteLines[2].top = 0;
+    windowData.whiteLines[2].left = 2;
+    windowData.whiteLines[2].right = 2;
+    windowData.whiteLines[2].bottom = (LONG) windowData.clientHeight;
+
+    //White lines along top of window
+    windowData.whiteLines[3].top = 0;
+    windowData.whiteLines[3].left = 0;
+    windowData.whiteLines[3].right = (LONG) windowData.clientWidth;
+    windowData.whiteLines[3].bottom = 0;
+
+    windowData.whiteLines[4].top = 1;
+    windowData.whiteLines[4].left = 0;
+    windowData.whiteLines[4].right = (LONG) windowData.clientWidth;
+    windowData.whiteLines[4].bottom = 1;
+
+    windowData.whiteLines[5].top = 2;
+    windowData.whiteLines[5].left = 0;
+    windowData.whiteLines[5].right = (LONG) windowData.clientWidth;
+    windowData.whiteLines[5].bottom = 2;
+
+    //White lines highlighting remaining mines counter
+    windowData.whiteLines[6].top = 39;
+    windowData.whiteLines[6].left = 17;
+    windowData.whiteLines[6].right = 70;
+    windowData.whiteLines[6].bottom = 39;
+
+    windowData.whiteLines[7].top = 16;
+    windowData.whiteLines[7].left = 69;
+    windowData.whiteLines[7].right = 69;
+    windowData.whiteLines[7].bottom = 40;
+
+    //White lines highlighting timer
+    windowData.whiteLines[8].top = 39;
+    windowData.whiteLines[8].left = (LONG) windowData.clientWidth - 54;
+    windowData.whiteLines[8].right = (LONG) windowData.clientWidth - 14;
+    windowData.whiteLines[8].bottom = 39;
+
+    windowData.whiteLines[9].top = 16;
+    windowData.whiteLines[9].left = (LONG) windowData.clientWidth - 15;
+    windowData.whiteLines[9].right = (LONG) windowData.clientWidth - 15;
+    windowData.whiteLines[9].bottom = 40;
+
+    //White lines highlighting the top banner region of the window
+    windowData.whiteLines[10].top = 44;
+    windowData.whiteLines[10].left = 11;
+    windowData.whiteLines[10].right = (LONG) windowData.clientWidth - 5;
+    windowData.whiteLines[10].bottom = 44;
+
+    windowData.whiteLines[11].top = 45;
+    windowData.whiteLines[11].left = 10;
+    windowData.whiteLines[11].right = (LONG) windowData.clientWidth - 5;
+    windowData.whiteLines[11].bottom = 45;
+
+    windowData.whiteLines[12].top = 11;
+    windowData.whiteLines[12].left = (LONG) windowData.clientWidth - 7;
+    windowData.whiteLines[12].right = (LONG) windowData.clientWidth - 7;
+    windowData.whiteLines[12].bottom = 46;
+
+    windowData.whiteLines[13].top = 10;
+    windowData.whiteLines[13].left = (LONG) windowData.clientWidth - 6;
+    windowData.whiteLines[13].right = (LONG) windowData.clientWidth - 6;
+    windowData.whiteLines[13].bottom = 46;
+
+    //White lines highlighting game board
+    windowData.whiteLines[14].top = (LONG) windowData.clientHeight - 8;
+    windowData.whiteLines[14].left = 12;
+    windowData.whiteLines[14].right = (LONG) windowData.clientWidth - 5;
+    windowData.whiteLines[14].bottom = (LONG) windowData.clientHeight - 8;
+
+    windowData.whiteLines[15].top = (LONG) windowData.clientHeight - 7;
+    windowData.whiteLines[15].left = 11;
+    windowData.whiteLines[15].right = (LONG) windowData.clientWidth - 5;
+    windowData.whiteLines[15].bottom = (LONG) windowData.clientHeight - 7;
+
+    windowData.whiteLines[16].top = (LONG) windowData.clientHeight - 6;
+    windowData.whiteLines[16].left = 10;
+    windowData.whiteLines[16].right = (LONG) windowData.clientWidth - 5;
+    windowData.whiteLines[16].bottom = (LONG) windowData.clientHeight - 6;
+
+    windowData.whiteLines[17].top = 55;
+    windowData.whiteLines[17].left = (LONG) windowData.clientWidth - 8;
+    windowData.whiteLines[17].right = (LONG) windowData.clientWidth - 8;
+    windowData.whiteLines[17].bottom = (LONG) windowData.clientHeight - 5;
+
+    windowData.whiteLines[18].top = 54;
+    windowData.whiteLines[18].left = (LONG) windowData.clientWidth - 7;
+    windowData.whiteLines[18].right = (LONG) windowData.clientWidth - 7;
+    windowData.whiteLines[18].bottom = (LONG) windowData.clientHeight - 5;
+
+    windowData.whiteLines[19].top = 53;
+    windowData.whiteLines[19].left = (LONG) windowData.clientWidth - 6;
+    windowData.whiteLines[19].right = (LONG) windowData.clientWidth - 6;
+    windowData.whiteLines[19].bottom = (LONG) windowData.clientHeight - 5;
+
+    /** Store coordinates for all decorative grey lines. */
+    //Grey lines highlighting the top banner region of the window
+    windowData.greyLines[0].top = 9;
+    windowData.greyLines[0].left = 9;
+    windowData.greyLines[0].right = 9;
+    windowData.greyLines[0].bottom = 45;
+
+    windowData.greyLines[1].top = 9;
+    windowData.greyLines[1].left = 10;
+    windowData.greyLines[1].right = 10;
+    windowData.greyLines[1].bottom = 44;
+
+    
+    windowData.greyLines[2].top = 9;
+    windowData.greyLines[2].left = 9;
+    windowData.greyLines[2].right = (LONG) windowData.clientWidth - 6;
+    windowData.greyLines[2].bottom = 9;
+
+    windowData.greyLines[3].top = 10;
+    windowData.greyLines[3].left = 9;
+    windowData.greyLines[3].right = (LONG) windowData.clientWidth - 7;
+    windowData.greyLines[3].bottom = 10;
+
+    //Grey lines highlighting remaining mines counter
+    windowData.greyLines[4].top = 15;
+    windowData.greyLines[4].left = 16;
+    windowData.greyLines[4].right = 16;
+    windowData.greyLines[4].bottom = 39;
+
+    windowData.greyLines[5].top = 15;
+    windowData.greyLines[5].left = 16;
+    windowData.greyLines[5].right = 69;
+    windowData.greyLines[5].bottom = 15;
+
+    //Grey lines highlighting timer
+    windowData.greyLines[6].top = 15;
+    windowData.greyLines[6].left = (LONG) windowData.clientWidth - 55;
+    windowData.greyLines[6].right = (LONG) windowData.clientWidth - 55;
+    windowData.greyLines[6].bottom = 39;
+
+    windowData.greyLines[7].top = 15;
+    windowData.greyLines[7].left = (LONG) windowData.clientWidth - 55;
+    windowData.greyLines[7].right = (LONG) windowData.clientWidth - 15;
+    windowData.greyLines[7].bottom = 15;
+
+    //Grey lines highlighting game board
+    windowData.greyLines[8].top = 52;
+    windowData.greyLines[8].left = 9;
+    windowData.greyLines[8].right = 9;
+    windowData.greyLines[8].bottom = (LONG) windowData.clientHeight - 6;
+
+    windowData.greyLines[9].top = 52;
+    windowData.greyLines[9].left = 10;
+    windowData.greyLines[9].right = 10;
+    windowData.greyLines[9].bottom = (LONG) windowData.clientHeight - 7;
+
+    windowData.greyLines[10].top = 52;
+    windowData.greyLines[10].left = 11;
+    windowData.greyLines[10].right = 11;
+    windowData.greyLines[10].bottom = (LONG) windowData.clientHeight - 8;
+
+    windowData.greyLines[11].top = 52;
+    windowData.greyLines[11].left = 9;
+    windowData.greyLines[11].right = (LONG) windowData.clientWidth - 6;
+    windowData.greyLines[11].bottom = 52;
+
+    windowData.greyLines[12].top = 53;
+    windowData.greyLines[12].left = 9;
+    windowData.greyLines[12].right = (LONG) windowData.clientWidth - 7;
+    windowData.greyLines[12].bottom = 53;
+
+    windowData.greyLines[13].top = 54;
+    windowData.greyLines[13].left = 9;
+    windowData.greyLines[13].right = (LONG) windowData.clientWidth - 8;
+    windowData.greyLines[13].bottom = 54;
+
+    //Store boundary of timer
+    windowData.timerRegion.top = 16;
+    windowData.timerRegion.left = (LONG) windowData.clientWidth - 54;
+    windowData.timerRegion.right = (LONG) windowData.clientWidth - 15;
+    windowData.timerRegion.bottom = 39;
+
+    //Store boundary of remaining mines counter
+    windowData.mineCountRegion.top = 16;
+    windowData.mineCountRegion.left = 17;
+    windowData.mineCountRegion.right = 69;
+    windowData.mineCountRegion.bottom = 39;
+
+    //Store boundary of smiley face
+    windowData.faceRegion.top = 15;
+    windowData.faceRegion.left = ((LONG) windowData.clientWidth / 2) - 11;
+    windowData.faceRegion.right = ((LONG) windowData.clientWidth / 2) + 15;
+    windowData.faceRegion.bottom = 41;
+
+    //Store boundary of top banner region
+    windowData.topBannerRegion.top = 11;
+    windowData.topBannerRegion.left = 11;
+    windowData.topBannerRegion.right = (LONG) windowData.clientWidth - 7;
+    windowData.topBannerRegion.bottom = 44;
+
+    //Store boundary of game board
+    windowData.boardRegion.top = 55;
+    windowData.boardRegion.left = 12;
+    windowData.boardRegion.right = windowData.boardRegion.left + viewWidth;
+    windowData.boardRegion.bottom = windowData.boardRegion.top + viewHeight;
+
+    //Store boundary of board overview
+    if (0 < minimapWidth)
+    {
+        windowData.minimapRegion.top = windowData.boardRegion.top;
+        windowData.minimapRegion.left = windowData.boardRegion.right + MINE_MINIMAP_GAP_PIXELS;
+        windowData.minimapRegion.right = windowData.minimapRegion.left + minimapData.width;
+        windowData.minimapRegion.bottom = windowData.minimapRegion.top + minimapData.height;
+    }
+    else
+    {
+        ZeroMemory(&(windowData.minimapRegion), sizeof(RECT));
+    }
+
+    //A smaller view or a new board can leave the old offsets past the edge of the board
+    windowData.scrollX = Mine_LimitScroll(windowData.scrollX, ((LONG) gameData.width)*windowData.tilePixels,
+                                          viewWidth, menuData.wrapHorz);
+    windowData.scrollY = Mine_LimitScroll(windowData.scrollY, ((LONG) gameData.height)*windowData.tilePixels,
+                                          viewHeight, menuData.wrapVert);
+    windowData.targetX = Mine_LimitScroll(windowData.targetX, ((LONG) gameData.width)*windowData.tilePixels,
+                                          viewWidth, menuData.wrapHorz);
+    windowData.targetY = Mine_LimitScroll(windowData.targetY, ((LONG) gameData.height)*windowData.tilePixels,
+                                          viewHeight, menuData.wrapVert);
+
+    return;
+}
+
+/**
+    Mine_StepScroll
+*//**
+    Move the scroll offsets of the board one step toward their targets.
+
+    @return TRUE if the board still needs to scroll further. FALSE otherwise.
+*/
+BOOLEAN
+Mine_StepScroll(VOID)
+{
+    windowData.scrollX = Mine_ScrollToward(windowData.scrollX, windowData.targetX,
+                                           ((LONG) gameData.width)*windowData.tilePixels,
+                                           menuData.wrapHorz);
+    windowData.scrollY = Mine_ScrollToward(windowData.scrollY, windowData.targetY,
+                                           ((LONG) gameData.height)*windowData.tilePixels,
+                                           menuData.wrapVert);
+
+    return (windowData.targetX != windowData.scrollX) || (windowData.targetY != windowData.scrollY);
+}
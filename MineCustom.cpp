@@ -143,6 +143,11 @@ MineCustom_Dialog(_In_ HWND hDlg, UINT message, WPARAM wParam, LPARAM lParam)
                 MineDebug_PrintWarning("Custom mines too big: %u\n", value);
                 value = (UINT) (menuData.customHeight - 1)*(menuData.customWidth - 1);
             }
+            if (MINE_MAX_MINES < value)
+            {
+                MineDebug_PrintWarning("Custom mines too many: %u\n", value);
+                value = MINE_MAX_MINES;
+            }
 
             menuData.customMines = (DWORD) value;
 
@@ -0,0 +1,322 @@
+/**
+    @file MineDamage.cpp
+
+    @author Craig Burkhart
+
+    @brief Collects the parts of the window that need to be redrawn, so every
+           change made while handling input is drawn once on the next frame.
+*//*
+    Copyright (C) 2014 - Craig Burkhart
+
+    This file is part of Minesweeper Deluxe.
+
+    Minesweeper Deluxe is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Minesweeper Deluxe is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Minesweeper Deluxe.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#include "stdafx.h"
+#include "MineDamage.h"
+#include "MineDebug.h"
+#include "MineMinimap.h"
+
+/** Number of pixels covered by a rectangle. */
+#define MINE_DAMAGE_AREA(rect) (((rect).right - (rect).left)*((rect).bottom - (rect).top))
+
+// Global Variables:
+MINE_DAMAGE_DATA damageData = {0};
+
+/**
+    MineDamage_AddAll
+*//**
+    Mark the whole client area to be redrawn.
+*/
+VOID
+MineDamage_AddAll(VOID)
+{
+    RECT client = {0};
+
+    client.right = (LONG) windowData.clientWidth;
+    client.bottom = (LONG) windowData.clientHeight;
+
+    MineDamage_AddRect(&client);
+
+    if (damageData.trackTiles)
+    {
+        damageData.allTiles = TRUE;
+    }
+
+    return;
+}
+
+/**
+    MineDamage_AddGrid
+*//**
+    Mark a block of tiles to be redrawn, wherever the board view currently shows it,
+    and list the tiles if changed tiles are tracked.
+
+    @param[in] xGridMin - Minimum x coordinate of block in grid.
+    @param[in] xGridMax - Maximum x coordinate of block in grid.
+    @param[in] yGridMin - Minimum y coordinate of block in grid.
+    @param[in] yGridMax - Maximum y coordinate of block in grid.
+*/
+VOID
+MineDamage_AddGrid(LONG xGridMin, LONG xGridMax, LONG yGridMin, LONG yGridMax)
+{
+    UINT ix = 0;
+    UINT numRects = 0;
+    RECT rects[4] = {0};
+    LONG xGrid = 0;
+    LONG yGrid = 0;
+
+    numRects = Mine_GetGridRects(xGridMin, xGridMax, yGridMin, yGridMax, rects);
+
+    for (ix = 0; ix < numRects; ix++)
+    {
+        MineDamage_AddRect(&(rects[ix]));
+    }
+
+    /** Once the list is full every tile is redrawn, so nothing more needs listing. */
+    if (damageData.trackTiles && (!damageData.allTiles))
+    {
+        for (yGrid = yGridMin; (yGrid <= yGridMax) && (!damageData.allTiles); yGrid++)
+        {
+            for (xGrid = xGridMin; xGrid <= xGridMax; xGrid++)
+            {
+                if (MINE_DAMAGE_MAX_TILES == damageData.numTiles)
+                {
+                    damageData.allTiles = TRUE;
+                    break;
+                }
+
+                damageData.tiles[damageData.numTiles] = MINE_INDEX(xGrid, yGrid);
+                damageData.numTiles += 1;
+            }
+        }
+    }
+
+    return;
+}
+
+/**
+    MineDamage_AddMinimapTile
+*//**
+    Mark the minimap pixel holding a tile to be redrawn.
+
+    @param[in] xGrid - X coordinate of tile in grid.
+    @param[in] yGrid - Y coordinate of tile in grid.
+*/
+VOID
+MineDamage_AddMinimapTile(LONG xGrid, LONG yGrid)
+{
+    RECT pixel = {0};
+
+    //Nothing to redraw while the whole board is in view
+    if ((windowData.minimapRegion.left < windowData.minimapRegion.right) && (0 < minimapData.blockTiles))
+    {
+        pixel.left = windowData.minimapRegion.left + xGrid / minimapData.blockTiles;
+        pixel.top = windowData.minimapRegion.top + yGrid / minimapData.blockTiles;
+        pixel.right = pixel.left + 1;
+        pixel.bottom = pixel.top + 1;
+
+        MineDamage_AddRect(&pixel);
+    }
+
+    return;
+}
+
+/**
+    MineDamage_AddRect
+*//**
+    Mark part of the client area to be redrawn. Rectangles that overlap are
+    merged so no pixel is drawn twice in one frame.
+
+    @param[in] pRect - Rectangle in client area pixels.
+*/
+VOID
+MineDamage_AddRect(_In_ PRECT pRect)
+{
+    UINT    best = 0;
+    LONG    bestGrowth = 0;
+    BOOLEAN covered = FALSE;
+    RECT    damage = {0};
+    LONG    growth = 0;
+    UINT    ix = 0;
+    RECT    joined = {0};
+    BOOLEAN merged = TRUE;
+    PRECT   pOld = NULL;
+
+    if (NULL == pRect)
+    {
+        MineDebug_PrintWarning("Parameter pRect is NULL\n");
+    }
+    else
+    {
+        //Nothing outside the client area is ever drawn
+        damage.left = max(pRect->left, 0);
+        damage.top = max(pRect->top, 0);
+        damage.right = min(pRect->right, (LONG) windowData.clientWidth);
+        damage.bottom = min(pRect->bottom, (LONG) windowData.clientHeight);
+
+        covered = ((damage.left >= damage.right) || (damage.top >= damage.bottom)) ?
+                  (BOOLEAN) TRUE : (BOOLEAN) FALSE;
+
+        /** Fold in every stored rectangle the damage overlaps until it overlaps
+            none of them, so the stored rectangles never share a pixel. */
+        while (merged && (!covered))
+        {
+            merged = FALSE;
+
+            for (ix = 0; ix < damageData.numRects; ix++)
+            {
+                pOld = &(damageData.rects[ix]);
+
+                joined.left = min(pOld->left, damage.left);
+                joined.top = min(pOld->top, damage.top);
+                joined.right = max(pOld->right, damage.right);
+                joined.bottom = max(pOld->bottom, damage.bottom);
+
+                if (Mine_IsRectSubset(pOld, &damage))
+                {
+                    covered = TRUE;
+                    break;
+                }
+
+                //Neighbouring tiles in a row or column join up with no extra area to draw
+                if (Mine_DoRectOverlap(pOld, &damage) ||
+                    (MINE_DAMAGE_AREA(joined) <= MINE_DAMAGE_AREA(*pOld) + MINE_DAMAGE_AREA(damage)))
+                {
+                    merged = TRUE;
+                    break;
+                }
+            }
+
+            /** With no room left, merge into whichever rectangle grows the least. */
+            if ((!merged) && (!covered) && (MINE_DAMAGE_MAX_RECTS == damageData.numRects))
+            {
+                for (ix = 0; ix < damageData.numRects; ix++)
+                {
+                    pOld = &(damageData.rects[ix]);
+
+                    joined.left = min(pOld->left, damage.left);
+                    joined.top = min(pOld->top, damage.top);
+                    joined.right = max(pOld->right, damage.right);
+                    joined.bottom = max(pOld->bottom, damage.bottom);
+
+                    growth = MINE_DAMAGE_AREA(joined) - MINE_DAMAGE_AREA(*pOld);
+                    if ((0 == ix) || (growth < bestGrowth))
+                    {
+                        best = ix;
+                        bestGrowth = growth;
+                    }
+                }
+
+                ix = best;
+                pOld = &(damageData.rects[ix]);
+
+                joined.left = min(pOld->left, damage.left);
+                joined.top = min(pOld->top, damage.top);
+                joined.right = max(pOld->right, damage.right);
+                joined.bottom = max(pOld->bottom, damage.bottom);
+
+                merged = TRUE;
+            }
+
+            //The merged rectangle may now reach others, so take it out and check again
+            if (merged)
+            {
+                damage = joined;
+                damageData.numRects -= 1;
+                damageData.rects[ix] = damageData.rects[damageData.numRects];
+            }
+        }
+
+        if (!covered)
+        {
+            damageData.rects[damageData.numRects] = damage;
+            damageData.numRects += 1;
+        }
+    }
+
+    return;
+}
+
+/**
+    MineDamage_Take
+*//**
+    Hand over everything damaged since the last call and start collecting again.
+
+    @param[out] pRects - Array of MINE_DAMAGE_MAX_RECTS rectangles to hold the damage.
+
+    @return Number of rectangles stored in pRects.
+*/
+UINT
+MineDamage_Take(_Out_writes_(MINE_DAMAGE_MAX_RECTS) PRECT pRects)
+{
+    UINT ix = 0;
+    UINT numRects = 0;
+
+    if (NULL == pRects)
+    {
+        MineDebug_PrintWarning("Parameter pRects is NULL\n");
+    }
+    else
+    {
+        for (ix = 0; ix < damageData.numRects; ix++)
+        {
+            pRects[ix] = damageData.rects[ix];
+        }
+
+        numRects = damageData.numRects;
+        damageData.numRects = 0;
+    }
+
+    return numRects;
+}
+
+/**
+    MineDamage_TakeTiles
+*//**
+    Hand over every tile changed since the last call and start collecting again.
+    Only collected once trackTiles is set.
+
+    @param[out] pTiles - Array of MINE_DAMAGE_MAX_TILES board indexes to hold the tiles.
+    @param[out] pAll   - Set to TRUE if too many tiles changed to list and every
+                         tile has to be redrawn, FALSE otherwise.
+
+    @return Number of board indexes stored in pTiles.
+*/
+UINT
+MineDamage_TakeTiles(_Out_writes_(MINE_DAMAGE_MAX_TILES) PLONG pTiles, _Out_ BOOLEAN* pAll)
+{
+    UINT ix = 0;
+    UINT numTiles = 0;
+
+    if ((NULL == pTiles) || (NULL == pAll))
+    {
+        MineDebug_PrintWarning("Invalid parameter to MineDamage_TakeTiles\n");
+    }
+    else
+    {
+        for (ix = 0; ix < damageData.numTiles; ix++)
+        {
+            pTiles[ix] = damageData.tiles[ix];
+        }
+
+        numTiles = damageData.numTiles;
+        *pAll = damageData.allTiles;
+
+        damageData.numTiles = 0;
+        damageData.allTiles = FALSE;
+    }
+
+    return numTiles;
+}
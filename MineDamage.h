@@ -0,0 +1,147 @@
+/**
+    @file MineDamage.h
+
+    @author Craig Burkhart
+
+    @brief Header file for collecting the parts of the window that need to be
+           redrawn before the next frame.
+*//*
+    Copyright (C) 2014 - Craig Burkhart
+
+    This file is part of Minesweeper Deluxe.
+
+    Minesweeper Deluxe is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Minesweeper Deluxe is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Minesweeper Deluxe.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#pragma once
+
+#include "Mine.h"
+
+//--------------------------------------------------------------
+//    Macros
+//--------------------------------------------------------------
+
+/** Most separate rectangles kept before damaged areas are merged together. */
+#define MINE_DAMAGE_MAX_RECTS 16
+/** Most changed tiles listed before every tile is marked to be redrawn. */
+#define MINE_DAMAGE_MAX_TILES 1024
+
+//--------------------------------------------------------------
+//    Structures
+//--------------------------------------------------------------
+
+struct _MINE_DAMAGE_DATA
+{
+    /** Damaged areas of the client area, no two of which overlap. */
+    RECT    rects[MINE_DAMAGE_MAX_RECTS];
+    /** Number of rectangles in use. */
+    UINT    numRects;
+    /** Flag for if changed tiles are listed as well, for frontends that draw
+        whole tiles instead of pixels. */
+    BOOLEAN trackTiles;
+    /** Flag for if more tiles changed than fit in tiles, or the whole client
+        area was damaged, so every tile has to be redrawn. */
+    BOOLEAN allTiles;
+    /** Board indexes of the tiles changed, a tile may be listed more than once. */
+    LONG    tiles[MINE_DAMAGE_MAX_TILES];
+    /** Number of board indexes in use. */
+    UINT    numTiles;
+};
+
+//--------------------------------------------------------------
+//    Typedefs
+//--------------------------------------------------------------
+
+/** Parts of the window to redraw on the next frame. */
+typedef struct _MINE_DAMAGE_DATA MINE_DAMAGE_DATA;
+
+//--------------------------------------------------------------
+//    Global Variable Externs
+//--------------------------------------------------------------
+
+extern MINE_DAMAGE_DATA damageData;
+
+//--------------------------------------------------------------
+//    Function Prototypes
+//--------------------------------------------------------------
+
+/**
+    MineDamage_AddAll
+*//**
+    Mark the whole client area to be redrawn.
+*/
+VOID
+MineDamage_AddAll(VOID);
+
+/**
+    MineDamage_AddGrid
+*//**
+    Mark a block of tiles to be redrawn, wherever the board view currently shows it,
+    and list the tiles if changed tiles are tracked.
+
+    @param[in] xGridMin - Minimum x coordinate of block in grid.
+    @param[in] xGridMax - Maximum x coordinate of block in grid.
+    @param[in] yGridMin - Minimum y coordinate of block in grid.
+    @param[in] yGridMax - Maximum y coordinate of block in grid.
+*/
+VOID
+MineDamage_AddGrid(LONG xGridMin, LONG xGridMax, LONG yGridMin, LONG yGridMax);
+
+/**
+    MineDamage_AddMinimapTile
+*//**
+    Mark the minimap pixel holding a tile to be redrawn.
+
+    @param[in] xGrid - X coordinate of tile in grid.
+    @param[in] yGrid - Y coordinate of tile in grid.
+*/
+VOID
+MineDamage_AddMinimapTile(LONG xGrid, LONG yGrid);
+
+/**
+    MineDamage_AddRect
+*//**
+    Mark part of the client area to be redrawn. Rectangles that overlap are
+    merged so no pixel is drawn twice in one frame.
+
+    @param[in] pRect - Rectangle in client area pixels.
+*/
+VOID
+MineDamage_AddRect(_In_ PRECT pRect);
+
+/**
+    MineDamage_Take
+*//**
+    Hand over everything damaged since the last call and start collecting again.
+
+    @param[out] pRects - Array of MINE_DAMAGE_MAX_RECTS rectangles to hold the damage.
+
+    @return Number of rectangles stored in pRects.
+*/
+UINT
+MineDamage_Take(_Out_writes_(MINE_DAMAGE_MAX_RECTS) PRECT pRects);
+
+/**
+    MineDamage_TakeTiles
+*//**
+    Hand over every tile changed since the last call and start collecting again.
+    Only collected once trackTiles is set.
+
+    @param[out] pTiles - Array of MINE_DAMAGE_MAX_TILES board indexes to hold the tiles.
+    @param[out] pAll   - Set to TRUE if too many tiles changed to list and every
+                         tile has to be redrawn, FALSE otherwise.
+
+    @return Number of board indexes stored in pTiles.
+*/
+UINT
+MineDamage_TakeTiles(_Out_writes_(MINE_DAMAGE_MAX_TILES) PLONG pTiles, _Out_ BOOLEAN* pAll);
@@ -34,7 +34,7 @@ CHAR printBuffer[2*MINEDEBUG_BUFFER_CHARS];
 *//**
     @brief Print a format string to the debug console.
 
-    @param[in] level  - Level of severity, i.e. "WARNING" or "ERROR".
+    @param[in] level  - Level of severity, i.e. "INFO", "WARNING" or "ERROR".
     @param[in] file   - Name of file with print statement.
     @param[in] line   - Line number of print statement.
     @param[in] format - String to be placed in debug console.
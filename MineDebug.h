@@ -43,13 +43,21 @@ MineDebug_FormatPrintToDebugConsole("WARNING", __FILE__, __LINE__, __VA_ARGS__);
 #define MineDebug_PrintWarning(...) 
 #endif /* _DEBUG */
 
+#ifdef _DEBUG
+/** Macro to print information statement only if compiled in debug mode. */
+#define MineDebug_PrintInfo(...) \
+MineDebug_FormatPrintToDebugConsole("INFO", __FILE__, __LINE__, __VA_ARGS__);
+#else /* _DEBUG */
+#define MineDebug_PrintInfo(...) 
+#endif /* _DEBUG */
+
 #ifdef _DEBUG
 /**
     MineDebug_FormatPrintToDebugConsole
 *//**
     @brief Print a format string to the debug console.
 
-    @param[in] level  - Level of severity, i.e. "WARNING" or "ERROR".
+    @param[in] level  - Level of severity, i.e. "INFO", "WARNING" or "ERROR".
     @param[in] file   - Name of file with print statement.
     @param[in] line   - Line number of print statement.
     @param[in] format - String to be placed in debug console.
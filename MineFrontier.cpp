@@ -0,0 +1,265 @@
+/**
+    @file MineFrontier.cpp
+
+    @author Craig Burkhart
+
+    @brief Frontier of the current game, the revealed tiles with covered tiles
+           around them and the covered tiles next to revealed ones. Every
+           change of tile status updates it in place, so the solver starts
+           from it instead of scanning the board.
+*//*
+    Copyright (C) 2014 - Craig Burkhart
+
+    This file is part of Minesweeper Deluxe.
+
+    Minesweeper Deluxe is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Minesweeper Deluxe is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Minesweeper Deluxe.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#include "stdafx.h"
+#include "MineFrontier.h"
+#include "MineArena.h"
+#include "MineDebug.h"
+#include "MineSolver.h"
+
+// Global Variables:
+MINE_FRONTIER_DATA frontierData = {0};
+
+/**
+    MineFrontier_ArenaBytes
+*//**
+    Number of bytes the frontier for the board in gameData takes from the
+    arena, to be added to what Mine_AllocBoard is asked for.
+
+    @return Number of bytes.
+*/
+SIZE_T
+MineFrontier_ArenaBytes(VOID)
+{
+    SIZE_T tiles = ((SIZE_T) gameData.width)*((SIZE_T) gameData.height);
+
+    return 3*MINE_ARENA_BYTES(tiles*sizeof(LONG)) + 2*MINE_ARENA_BYTES(tiles);
+}
+
+/**
+    MineFrontier_Check
+*//**
+    Add a tile to the frontier or take it out, to match its status and the
+    counts around it. The tile must already be listed where its status says,
+    if it is listed at all.
+
+    @param[in] index - Board index of the tile.
+*/
+VOID
+MineFrontier_Check(LONG index)
+{
+    BOOLEAN belongs = FALSE;
+    BOOLEAN revealed = (MINE_TILE_STATUS_REVEALED == gameData.tileStatus[index]);
+
+    if (revealed)
+    {
+        belongs = (0 < frontierData.pCovered[index]);
+    }
+    else if (MINE_TILE_STATUS_FLAG != gameData.tileStatus[index])
+    {
+        belongs = (0 < frontierData.pRevealed[index]);
+    }
+
+    if (belongs && (0 > frontierData.pSlots[index]))
+    {
+        if (revealed)
+        {
+            frontierData.pSlots[index] = (LONG) frontierData.numNumbers;
+            frontierData.pNumbers[frontierData.numNumbers++] = index;
+        }
+        else
+        {
+            frontierData.pSlots[index] = (LONG) frontierData.numEdge;
+            frontierData.pEdge[frontierData.numEdge++] = index;
+        }
+    }
+    else if (!belongs && (0 <= frontierData.pSlots[index]))
+    {
+        MineFrontier_Remove(index, revealed);
+    }
+
+    return;
+}
+
+/**
+    MineFrontier_Remove
+*//**
+    Take a tile out of the list it is in, moving the last tile of that list
+    into its place.
+
+    @param[in] index    - Board index of the tile.
+    @param[in] revealed - Flag for if the tile is listed in pNumbers rather than pEdge.
+*/
+VOID
+MineFrontier_Remove(LONG index, BOOLEAN revealed)
+{
+    LONG  last = 0;
+    LONG* pList = revealed ? frontierData.pNumbers : frontierData.pEdge;
+    UINT* pCount = revealed ? &frontierData.numNumbers : &frontierData.numEdge;
+    LONG  slot = frontierData.pSlots[index];
+
+    (*pCount)--;
+    last = pList[*pCount];
+    pList[slot] = last;
+    frontierData.pSlots[last] = slot;
+    frontierData.pSlots[index] = -1;
+
+    return;
+}
+
+/**
+    MineFrontier_Reset
+*//**
+    Carve the frontier for the board stored in gameData out of the arena,
+    with every tile covered. Must be called whenever tileStatus is cleared for
+    a new game, after the wrap settings for the game are chosen and after
+    Mine_AllocBoard was given MineFrontier_ArenaBytes more bytes.
+
+    @return Mine error code (MINE_ERROR_SUCCESS upon success).
+*/
+MINE_ERROR
+MineFrontier_Reset(VOID)
+{
+    BOOLEAN    bFalse = FALSE;
+    LONG       columns = 0;
+    LONG       rows = 0;
+    MINE_ERROR status = MINE_ERROR_SUCCESS;
+    DWORD      tiles = gameData.width*gameData.height;
+    LONG       xGrid = 0;
+    LONG       yGrid = 0;
+
+    do
+    {
+        if (0 == tiles)
+        {
+            MineDebug_PrintError("Board size has not been set\n");
+            status = MINE_ERROR_PARAMETER;
+            break;
+        }
+
+        //What was carved for the last game went with the arena reset
+        frontierData.pNumbers = (LONG*) MineArena_Alloc(((SIZE_T) tiles)*sizeof(LONG));
+        frontierData.pEdge = (LONG*) MineArena_Alloc(((SIZE_T) tiles)*sizeof(LONG));
+        frontierData.pSlots = (LONG*) MineArena_Alloc(((SIZE_T) tiles)*sizeof(LONG));
+        frontierData.pCovered = (CHAR*) MineArena_Alloc(tiles);
+        frontierData.pRevealed = (CHAR*) MineArena_Alloc(tiles);
+        frontierData.tileCapacity = tiles;
+        frontierData.arenaResets = arenaData.resets;
+
+        if ((NULL == frontierData.pNumbers) || (NULL == frontierData.pEdge) || (NULL == frontierData.pSlots) ||
+            (NULL == frontierData.pCovered) || (NULL == frontierData.pRevealed))
+        {
+            MineDebug_PrintError("Arena has no room for the frontier of %u tiles\n", (UINT) tiles);
+            frontierData.pSlots = NULL;
+            status = MINE_ERROR_MEMORY;
+            break;
+        }
+
+        /** Every tile starts covered, so each is counted by as many tiles as
+            MineSolver_Nearby lists around it: all eight where the board wraps,
+            fewer along an edge where it does not. */
+        for (yGrid = 0; yGrid < (LONG) gameData.height; yGrid++)
+        {
+            rows = menuData.wrapVert ? 3 : (1 + (0 < yGrid) + (yGrid < (LONG) gameData.height - 1));
+
+            for (xGrid = 0; xGrid < (LONG) gameData.width; xGrid++)
+            {
+                columns = menuData.wrapHorz ? 3 : (1 + (0 < xGrid) + (xGrid < (LONG) gameData.width - 1));
+
+                frontierData.pCovered[MINE_INDEX(xGrid, yGrid)] = (CHAR) (rows*columns - 1);
+                frontierData.pSlots[MINE_INDEX(xGrid, yGrid)] = -1;
+            }
+        }
+
+        frontierData.width = gameData.width;
+        frontierData.height = gameData.height;
+        frontierData.numNumbers = 0;
+        frontierData.numEdge = 0;
+        frontierData.numFlagged = 0;
+        frontierData.numUnknown = (UINT) tiles;
+
+        __assume(FALSE == bFalse);
+    } while (bFalse);
+
+    return status;
+}
+
+/**
+    MineFrontier_UpdateTile
+*//**
+    Apply the change in status of one tile to the frontier. Only the tile and
+    the tiles around it are looked at. Changes made before the frontier was
+    set up for the current board are ignored.
+
+    @param[in] xGrid     - X coordinate of tile in grid.
+    @param[in] yGrid     - Y coordinate of tile in grid.
+    @param[in] oldStatus - Status of the tile before the change (MINE_TILE_STATUS_*).
+    @param[in] newStatus - Status of the tile after the change (MINE_TILE_STATUS_*).
+*/
+VOID
+MineFrontier_UpdateTile(LONG xGrid, LONG yGrid, CHAR oldStatus, CHAR newStatus)
+{
+    LONG    index = MINE_INDEX(xGrid, yGrid);
+    BOOLEAN isFlag = (MINE_TILE_STATUS_FLAG == newStatus);
+    BOOLEAN isRevealed = (MINE_TILE_STATUS_REVEALED == newStatus);
+    UINT    ix = 0;
+    LONG    neighbors[MINE_SOLVER_MAX_NEARBY] = {0};
+    UINT    numNeighbors = 0;
+    BOOLEAN wasFlag = (MINE_TILE_STATUS_FLAG == oldStatus);
+    BOOLEAN wasRevealed = (MINE_TILE_STATUS_REVEALED == oldStatus);
+
+    //Pressing and letting go of a covered tile changes nothing here
+    if ((NULL == frontierData.pSlots) || (arenaData.resets != frontierData.arenaResets) ||
+        (gameData.width != frontierData.width) || (gameData.height != frontierData.height) ||
+        ((isFlag == wasFlag) && (isRevealed == wasRevealed)))
+    {
+        return;
+    }
+
+    frontierData.changes++;
+    frontierData.numFlagged = frontierData.numFlagged - wasFlag + isFlag;
+    frontierData.numUnknown = frontierData.numUnknown - (!wasFlag && !wasRevealed) + (!isFlag && !isRevealed);
+
+    //Taken out by the status it had, put back by the one it has now
+    if (0 <= frontierData.pSlots[index])
+    {
+        MineFrontier_Remove(index, wasRevealed);
+    }
+
+    /** Only a tile being revealed or covered changes the counts around it. */
+    if (isRevealed != wasRevealed)
+    {
+        numNeighbors = MineSolver_Nearby(index, 1, neighbors);
+        for (ix = 0; ix < numNeighbors; ix++)
+        {
+            frontierData.pCovered[neighbors[ix]] += isRevealed ? -1 : 1;
+            frontierData.pRevealed[neighbors[ix]] += isRevealed ? 1 : -1;
+        }
+
+        for (ix = 0; ix < numNeighbors; ix++)
+        {
+            if (neighbors[ix] != index)
+            {
+                MineFrontier_Check(neighbors[ix]);
+            }
+        }
+    }
+
+    MineFrontier_Check(index);
+
+    return;
+}
@@ -0,0 +1,149 @@
+/**
+    @file MineFrontier.h
+
+    @author Craig Burkhart
+
+    @brief Header file for the frontier, the revealed tiles with covered tiles
+           around them and the covered tiles next to revealed ones, kept up to
+           date as tiles change rather than found by scanning the board.
+*//*
+    Copyright (C) 2014 - Craig Burkhart
+
+    This file is part of Minesweeper Deluxe.
+
+    Minesweeper Deluxe is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Minesweeper Deluxe is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Minesweeper Deluxe.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#pragma once
+
+#include "Mine.h"
+
+//--------------------------------------------------------------
+//    Structures
+//--------------------------------------------------------------
+
+struct _MINE_FRONTIER_DATA
+{
+    /** Board indexes of the revealed tiles with at least one covered tile
+        around them, flagged or not, in no particular order. */
+    LONG*     pNumbers;
+    /** Board indexes of the covered tiles that are not flagged and have at
+        least one revealed tile around them, in no particular order. */
+    LONG*     pEdge;
+    /** Position of each tile in pNumbers if revealed, or in pEdge if covered,
+        -1 if in neither. */
+    LONG*     pSlots;
+    /** Number of covered tiles around each tile, counted as Mine_AssignNumbers counts them. */
+    CHAR*     pCovered;
+    /** Number of revealed tiles around each tile, counted the same way. */
+    CHAR*     pRevealed;
+    /** Number of tiles the arrays have room for. */
+    DWORD     tileCapacity;
+    /** Value of arenaData.resets when the arrays were carved out of the
+        arena, they are gone once it is reset again. */
+    UINT      arenaResets;
+    /** Width of the board the frontier was set up for. */
+    DWORD     width;
+    /** Height of the board the frontier was set up for. */
+    DWORD     height;
+    /** Number of tiles in pNumbers. */
+    UINT      numNumbers;
+    /** Number of tiles in pEdge. */
+    UINT      numEdge;
+    /** Number of flagged tiles. */
+    UINT      numFlagged;
+    /** Number of tiles neither revealed nor flagged. */
+    UINT      numUnknown;
+    /** Number of tile changes applied since the program started. */
+    ULONGLONG changes;
+};
+
+//--------------------------------------------------------------
+//    Typedefs
+//--------------------------------------------------------------
+
+/** Frontier of the current game. */
+typedef struct _MINE_FRONTIER_DATA MINE_FRONTIER_DATA;
+
+//--------------------------------------------------------------
+//    Global Variable Externs
+//--------------------------------------------------------------
+
+extern MINE_FRONTIER_DATA frontierData;
+
+//--------------------------------------------------------------
+//    Function Prototypes
+//--------------------------------------------------------------
+
+/**
+    MineFrontier_ArenaBytes
+*//**
+    Number of bytes the frontier for the board in gameData takes from the
+    arena, to be added to what Mine_AllocBoard is asked for.
+
+    @return Number of bytes.
+*/
+SIZE_T
+MineFrontier_ArenaBytes(VOID);
+
+/**
+    MineFrontier_Check
+*//**
+    Add a tile to the frontier or take it out, to match its status and the
+    counts around it. The tile must already be listed where its status says,
+    if it is listed at all.
+
+    @param[in] index - Board index of the tile.
+*/
+VOID
+MineFrontier_Check(LONG index);
+
+/**
+    MineFrontier_Remove
+*//**
+    Take a tile out of the list it is in, moving the last tile of that list
+    into its place.
+
+    @param[in] index    - Board index of the tile.
+    @param[in] revealed - Flag for if the tile is listed in pNumbers rather than pEdge.
+*/
+VOID
+MineFrontier_Remove(LONG index, BOOLEAN revealed);
+
+/**
+    MineFrontier_Reset
+*//**
+    Carve the frontier for the board stored in gameData out of the arena,
+    with every tile covered. Must be called whenever tileStatus is cleared for
+    a new game, after the wrap settings for the game are chosen and after
+    Mine_AllocBoard was given MineFrontier_ArenaBytes more bytes.
+
+    @return Mine error code (MINE_ERROR_SUCCESS upon success).
+*/
+MINE_ERROR
+MineFrontier_Reset(VOID);
+
+/**
+    MineFrontier_UpdateTile
+*//**
+    Apply the change in status of one tile to the frontier. Only the tile and
+    the tiles around it are looked at. Changes made before the frontier was
+    set up for the current board are ignored.
+
+    @param[in] xGrid     - X coordinate of tile in grid.
+    @param[in] yGrid     - Y coordinate of tile in grid.
+    @param[in] oldStatus - Status of the tile before the change (MINE_TILE_STATUS_*).
+    @param[in] newStatus - Status of the tile after the change (MINE_TILE_STATUS_*).
+*/
+VOID
+MineFrontier_UpdateTile(LONG xGrid, LONG yGrid, CHAR oldStatus, CHAR newStatus);
@@ -0,0 +1,284 @@
+/**
+    @file MineMinimap.cpp
+
+    @author Craig Burkhart
+
+    @brief Reduced resolution overview of the whole board, kept up to date one
+           tile change at a time.
+*//*
+    Copyright (C) 2014 - Craig Burkhart
+
+    This file is part of Minesweeper Deluxe.
+
+    Minesweeper Deluxe is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Minesweeper Deluxe is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Minesweeper Deluxe.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#include "stdafx.h"
+#include "MineMinimap.h"
+#include "MineDebug.h"
+
+/** Blend one 8 bit channel of two colors, weight out of total toward the second color. */
+#define MINE_MINIMAP_BLEND(a, b, shift, weight, total) \
+    (((((((a) >> (shift)) & 0xFF)*((total) - (weight))) + ((((b) >> (shift)) & 0xFF)*(weight))) / (total)) << (shift))
+
+// Global Variables:
+MINE_MINIMAP_DATA minimapData = {0};
+
+/**
+    MineMinimap_Cleanup
+*//**
+    Free the minimap block counts and pixels.
+*/
+VOID
+MineMinimap_Cleanup(VOID)
+{
+    HANDLE hHeap = NULL;
+
+    hHeap = GetProcessHeap();
+    if (NULL == hHeap)
+    {
+        MineDebug_PrintWarning("Getting process heap: %lu\n", GetLastError());
+    }
+    else
+    {
+        if (NULL != minimapData.pBlocks)
+        {
+            if (0 == HeapFree(hHeap, 0, minimapData.pBlocks))
+            {
+                MineDebug_PrintWarning("Unable to free minimap blocks: %lu\n", GetLastError());
+            }
+            minimapData.pBlocks = NULL;
+        }
+
+        if (NULL != minimapData.pPixels)
+        {
+            if (0 == HeapFree(hHeap, 0, minimapData.pPixels))
+            {
+                MineDebug_PrintWarning("Unable to free minimap pixels: %lu\n", GetLastError());
+            }
+            minimapData.pPixels = NULL;
+        }
+    }
+
+    minimapData.blockTiles = 0;
+    minimapData.width = 0;
+    minimapData.height = 0;
+
+    return;
+}
+
+/**
+    MineMinimap_GetBlockColor
+*//**
+    Choose the color that sums up the state of a block.
+
+    @param[in] pBlock - Block counts.
+
+    @return Color (0x00RRGGBB) of the block.
+*/
+UINT32
+MineMinimap_GetBlockColor(_In_ const MINE_MINIMAP_BLOCK* pBlock)
+{
+    UINT32 color = MINE_MINIMAP_COLOR_HIDDEN;
+    UINT32 flagWeight = 0;
+    UINT32 total = 0;
+
+    if ((NULL == pBlock) || (0 == pBlock->tiles))
+    {
+        MineDebug_PrintWarning("Invalid parameter to MineMinimap_GetBlockColor\n");
+    }
+    /** A clicked mine stands out no matter what else is in the block. */
+    else if (0 != pBlock->exploded)
+    {
+        color = MINE_MINIMAP_COLOR_EXPLODED;
+    }
+    else
+    {
+        total = (UINT32) pBlock->tiles;
+
+        //Shade from hidden to revealed by the fraction of tiles revealed
+        color = MINE_MINIMAP_BLEND(MINE_MINIMAP_COLOR_HIDDEN, MINE_MINIMAP_COLOR_REVEALED, 16,
+                                   (UINT32) pBlock->revealed, total) |
+                MINE_MINIMAP_BLEND(MINE_MINIMAP_COLOR_HIDDEN, MINE_MINIMAP_COLOR_REVEALED, 8,
+                                   (UINT32) pBlock->revealed, total) |
+                MINE_MINIMAP_BLEND(MINE_MINIMAP_COLOR_HIDDEN, MINE_MINIMAP_COLOR_REVEALED, 0,
+                                   (UINT32) pBlock->revealed, total);
+
+        /** Any flag tints the block at least half way, so single flags stay visible. */
+        if (0 != pBlock->flagged)
+        {
+            flagWeight = total + (UINT32) pBlock->flagged;
+            total *= 2;
+
+            color = MINE_MINIMAP_BLEND(color, MINE_MINIMAP_COLOR_FLAG, 16, flagWeight, total) |
+                    MINE_MINIMAP_BLEND(color, MINE_MINIMAP_COLOR_FLAG, 8, flagWeight, total) |
+                    MINE_MINIMAP_BLEND(color, MINE_MINIMAP_COLOR_FLAG, 0, flagWeight, total);
+        }
+    }
+
+    return color;
+}
+
+/**
+    MineMinimap_Reset
+*//**
+    Size the minimap for the board stored in gameData and mark every tile as
+    hidden. Must be called whenever tileStatus is cleared for a new game.
+
+    @return Mine error code (MINE_ERROR_SUCCESS upon success).
+*/
+MINE_ERROR
+MineMinimap_Reset(VOID)
+{
+    BOOLEAN    bFalse = FALSE;
+    LONG       blockTiles = 0;
+    LONG       height = 0;
+    HANDLE     hHeap = NULL;
+    LONG       ix = 0;
+    LONG       jx = 0;
+    MINE_ERROR status = MINE_ERROR_SUCCESS;
+    LONG       width = 0;
+
+    do
+    {
+        if ((0 == gameData.width) || (0 == gameData.height))
+        {
+            MineDebug_PrintError("Board size has not been set\n");
+            status = MINE_ERROR_PARAMETER;
+            break;
+        }
+
+        //One pixel per tile if the board is small enough, otherwise one per square block
+        blockTiles = ((LONG) max(gameData.width, gameData.height) + MINE_MINIMAP_MAX_PIXELS - 1) /
+                     MINE_MINIMAP_MAX_PIXELS;
+        width = ((LONG) gameData.width + blockTiles - 1) / blockTiles;
+        height = ((LONG) gameData.height + blockTiles - 1) / blockTiles;
+
+        /** Only reallocate if the number of blocks changed. */
+        if ((NULL == minimapData.pBlocks) || (width != minimapData.width) || (height != minimapData.height))
+        {
+            MineMinimap_Cleanup();
+
+            hHeap = GetProcessHeap();
+            if (NULL == hHeap)
+            {
+                MineDebug_PrintError("Getting process heap: %lu\n", GetLastError());
+                status = MINE_ERROR_HEAP;
+                break;
+            }
+
+            minimapData.pBlocks = (MINE_MINIMAP_BLOCK*) HeapAlloc(hHeap, 0, ((SIZE_T) width)*((SIZE_T) height)*
+                                                                              sizeof(MINE_MINIMAP_BLOCK));
+            if (NULL == minimapData.pBlocks)
+            {
+                MineDebug_PrintError("Allocating minimap blocks\n");
+                status = MINE_ERROR_MEMORY;
+                break;
+            }
+
+            minimapData.pPixels = (UINT32*) HeapAlloc(hHeap, 0, ((SIZE_T) width)*((SIZE_T) height)*sizeof(UINT32));
+            if (NULL == minimapData.pPixels)
+            {
+                MineDebug_PrintError("Allocating minimap pixels\n");
+                status = MINE_ERROR_MEMORY;
+                break;
+            }
+
+            minimapData.width = width;
+            minimapData.height = height;
+        }
+
+        minimapData.blockTiles = blockTiles;
+
+        /** Start with every tile hidden. Blocks along the right and bottom edges
+            may hang off the board, so they hold fewer tiles. */
+        for (jx = 0; jx < height; jx++)
+        {
+            for (ix = 0; ix < width; ix++)
+            {
+                minimapData.pBlocks[jx*width + ix].tiles =
+                    (WORD) (min(blockTiles, (LONG) gameData.width - ix*blockTiles)*
+                            min(blockTiles, (LONG) gameData.height - jx*blockTiles));
+                minimapData.pBlocks[jx*width + ix].revealed = 0;
+                minimapData.pBlocks[jx*width + ix].flagged = 0;
+                minimapData.pBlocks[jx*width + ix].exploded = 0;
+
+                minimapData.pPixels[jx*width + ix] = MINE_MINIMAP_COLOR_HIDDEN;
+            }
+        }
+
+        __assume(FALSE == bFalse);
+    } while (bFalse);
+
+    return status;
+}
+
+/**
+    MineMinimap_UpdateTile
+*//**
+    Apply the change in status of one tile to the counts and pixel of its block.
+
+    @param[in] xGrid     - X coordinate of tile in grid.
+    @param[in] yGrid     - Y coordinate of tile in grid.
+    @param[in] oldStatus - Status of the tile before the change (MINE_TILE_STATUS_*).
+    @param[in] newStatus - Status of the tile after the change (MINE_TILE_STATUS_*).
+
+    @return TRUE if the pixel of the block changed color. FALSE otherwise.
+*/
+BOOLEAN
+MineMinimap_UpdateTile(LONG xGrid, LONG yGrid, CHAR oldStatus, CHAR newStatus)
+{
+    LONG                block = 0;
+    UINT32              color = 0;
+    BOOLEAN             isMine = FALSE;
+    MINE_MINIMAP_BLOCK* pBlock = NULL;
+    BOOLEAN             returnValue = FALSE;
+
+    //Held tiles look the same as hidden ones from far away
+    if ((NULL != minimapData.pBlocks) && (oldStatus != newStatus))
+    {
+        block = (yGrid / minimapData.blockTiles)*minimapData.width + xGrid / minimapData.blockTiles;
+        pBlock = &(minimapData.pBlocks[block]);
+        isMine = (MINE_BOMB_VALUE == gameData.gameBoard[MINE_INDEX(xGrid, yGrid)]) ? (BOOLEAN) TRUE : (BOOLEAN) FALSE;
+
+        /** Take the old status out of the counts, then add the new one. */
+        if (MINE_TILE_STATUS_REVEALED == oldStatus)
+        {
+            pBlock->revealed -= 1;
+            pBlock->exploded -= isMine ? 1 : 0;
+        }
+        else if (MINE_TILE_STATUS_FLAG == oldStatus)
+        {
+            pBlock->flagged -= 1;
+        }
+
+        if (MINE_TILE_STATUS_REVEALED == newStatus)
+        {
+            pBlock->revealed += 1;
+            pBlock->exploded += isMine ? 1 : 0;
+        }
+        else if (MINE_TILE_STATUS_FLAG == newStatus)
+        {
+            pBlock->flagged += 1;
+        }
+
+        color = MineMinimap_GetBlockColor(pBlock);
+        if (color != minimapData.pPixels[block])
+        {
+            minimapData.pPixels[block] = color;
+            returnValue = TRUE;
+        }
+    }
+
+    return returnValue;
+}
@@ -0,0 +1,143 @@
+/**
+    @file MineMinimap.h
+
+    @author Craig Burkhart
+
+    @brief Header file for the board overview minimap.
+*//*
+    Copyright (C) 2014 - Craig Burkhart
+
+    This file is part of Minesweeper Deluxe.
+
+    Minesweeper Deluxe is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Minesweeper Deluxe is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Minesweeper Deluxe.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#pragma once
+
+#include "Mine.h"
+
+//--------------------------------------------------------------
+//    Macros
+//--------------------------------------------------------------
+
+/** Largest width or height (in pixels) of the minimap. */
+#define MINE_MINIMAP_MAX_PIXELS 160
+/** Pixels between the board view and the minimap. */
+#define MINE_MINIMAP_GAP_PIXELS 8
+
+/** Color (0x00RRGGBB) of a block with no tiles revealed. */
+#define MINE_MINIMAP_COLOR_HIDDEN   0x00808080
+/** Color (0x00RRGGBB) of a block with every tile revealed. */
+#define MINE_MINIMAP_COLOR_REVEALED 0x00F0F0F0
+/** Color (0x00RRGGBB) blended into blocks holding flags. */
+#define MINE_MINIMAP_COLOR_FLAG     0x00E08000
+/** Color (0x00RRGGBB) of a block holding a mine that was clicked. */
+#define MINE_MINIMAP_COLOR_EXPLODED 0x00FF0000
+/** Color (0x00RRGGBB) of the outline showing the board view. */
+#define MINE_MINIMAP_COLOR_VIEW     0x000000FF
+
+//--------------------------------------------------------------
+//    Structures
+//--------------------------------------------------------------
+
+struct _MINE_MINIMAP_BLOCK
+{
+    /** Number of tiles in the block, less than blockTiles squared along the board edges. */
+    WORD tiles;
+    /** Number of revealed tiles in the block. */
+    WORD revealed;
+    /** Number of flagged tiles in the block. */
+    WORD flagged;
+    /** Number of revealed mines in the block. */
+    WORD exploded;
+};
+
+struct _MINE_MINIMAP_DATA
+{
+    /** Counts for each block, width blocks per row. */
+    struct _MINE_MINIMAP_BLOCK* pBlocks;
+    /** Pixels (0x00RRGGBB) of the minimap, one per block, width pixels per row. */
+    UINT32*                     pPixels;
+    /** Number of tiles along each side of a block. */
+    LONG                        blockTiles;
+    /** Width (in blocks) of the minimap. */
+    LONG                        width;
+    /** Height (in blocks) of the minimap. */
+    LONG                        height;
+};
+
+//--------------------------------------------------------------
+//    Typedefs
+//--------------------------------------------------------------
+
+/** Tile counts for one pixel of the minimap. */
+typedef struct _MINE_MINIMAP_BLOCK MINE_MINIMAP_BLOCK;
+
+/** Reduced resolution overview of the whole board. */
+typedef struct _MINE_MINIMAP_DATA MINE_MINIMAP_DATA;
+
+//--------------------------------------------------------------
+//    Global Variable Externs
+//--------------------------------------------------------------
+
+extern MINE_MINIMAP_DATA minimapData;
+
+//--------------------------------------------------------------
+//    Function Prototypes
+//--------------------------------------------------------------
+
+/**
+    MineMinimap_Cleanup
+*//**
+    Free the minimap block counts and pixels.
+*/
+VOID
+MineMinimap_Cleanup(VOID);
+
+/**
+    MineMinimap_GetBlockColor
+*//**
+    Choose the color that sums up the state of a block.
+
+    @param[in] pBlock - Block counts.
+
+    @return Color (0x00RRGGBB) of the block.
+*/
+UINT32
+MineMinimap_GetBlockColor(_In_ const MINE_MINIMAP_BLOCK* pBlock);
+
+/**
+    MineMinimap_Reset
+*//**
+    Size the minimap for the board stored in gameData and mark every tile as
+    hidden. Must be called whenever tileStatus is cleared for a new game.
+
+    @return Mine error code (MINE_ERROR_SUCCESS upon success).
+*/
+MINE_ERROR
+MineMinimap_Reset(VOID);
+
+/**
+    MineMinimap_UpdateTile
+*//**
+    Apply the change in status of one tile to the counts and pixel of its block.
+
+    @param[in] xGrid     - X coordinate of tile in grid.
+    @param[in] yGrid     - Y coordinate of tile in grid.
+    @param[in] oldStatus - Status of the tile before the change (MINE_TILE_STATUS_*).
+    @param[in] newStatus - Status of the tile after the change (MINE_TILE_STATUS_*).
+
+    @return TRUE if the pixel of the block changed color. FALSE otherwise.
+*/
+BOOLEAN
+MineMinimap_UpdateTile(LONG xGrid, LONG yGrid, CHAR oldStatus, CHAR newStatus);
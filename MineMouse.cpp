@@ -24,6 +24,7 @@
 */
 #include "stdafx.h"
 #include "MineMouse.h"
+#include "MineDamage.h"
 #include "MineDebug.h"
 
 /**
@@ -51,7 +52,6 @@ MineMouse_FirstClick(LONG xGrid, LONG yGrid)
         /** If first click is a mine, move mine to a different random tile. */
         if (MINE_BOMB_VALUE == gameData.gameBoard[MINE_INDEX(xGrid, yGrid)])
         {
-            gameData.gameBoard[MINE_INDEX(xGrid, yGrid)] = 0;
             needToPlace = TRUE;
         }
     
@@ -72,10 +72,10 @@ MineMouse_FirstClick(LONG xGrid, LONG yGrid)
                 break;
             }
 
-            if ((MINE_BOMB_VALUE != gameData.gameBoard[MINE_INDEX(newXGrid, newYGrid)]) && 
-                (MINE_INDEX(xGrid, yGrid) != MINE_INDEX(newXGrid, newYGrid)))
+            //The clicked tile still holds its mine, so it is never chosen
+            if (MINE_BOMB_VALUE != gameData.gameBoard[MINE_INDEX(newXGrid, newYGrid)])
             {
-                gameData.gameBoard[MINE_INDEX(newXGrid, newYGrid)] = MINE_BOMB_VALUE;
+                Mine_MoveMine(MINE_INDEX(xGrid, yGrid), MINE_INDEX(newXGrid, newYGrid));
                 needToPlace = FALSE;
             }
         }
@@ -117,10 +117,8 @@ MINE_ERROR
 MineMouse_MoveDoubleClick(short xMouse, short yMouse)
 {
     BOOLEAN    bFalse = FALSE;
-    HDC        hDC = NULL;
     LONG       ix = 0;
     LONG       jx = 0;
-    HDC        memoryDC = NULL;
     MINE_ERROR status = MINE_ERROR_SUCCESS;
     LONG       xGrid = -1;
     LONG       xGridUpdate = 0;
@@ -130,11 +128,7 @@ MineMouse_MoveDoubleClick(short xMouse, short yMouse)
     do
     {
         //Convert from mouse coordinates to grid coordinates
-        if (Mine_PointInRect(xMouse, yMouse, &windowData.boardRegion))
-        {
-            xGrid = ((((LONG) xMouse) - windowData.boardRegion.left) / MINE_TILE_PIXELS);
-            yGrid = ((((LONG) yMouse) - windowData.boardRegion.top) / MINE_TILE_PIXELS);
-        }
+        (void) Mine_PointToGrid(xMouse, yMouse, &xGrid, &yGrid);
 
         //If mouse hasn't moved to new tile, do nothing
         if ((gameData.prevGridX == xGrid) && (gameData.prevGridY == yGrid))
@@ -142,33 +136,9 @@ MineMouse_MoveDoubleClick(short xMouse, short yMouse)
             break;
         }
 
-        //Handle all graphics in this function
-        hDC = GetDC(hwnd);
-        if (NULL == hDC)
-        {
-            MineDebug_PrintError("Obtaining device context\n");
-            status = MINE_ERROR_DC;
-            break;
-        }
-
-        memoryDC = CreateCompatibleDC(hDC);
-        if (NULL == memoryDC)
-        {
-            MineDebug_PrintError("Creating compatible memory DC\n");
-            status = MINE_ERROR_DC;
-            break;
-        }
-
         /** If mouse was previously on grid, unhighlight previously held tiles. */
         if ((-1 != gameData.prevGridX) && (-1 != gameData.prevGridY))
         {
-            if (NULL == SelectObject(memoryDC, imageData.unclicked))
-            {
-                MineDebug_PrintError("Selecting unclicked into memory DC\n");
-                status = MINE_ERROR_OBJECT;
-                break;
-            }
-
             //All surrounding squares could have been highlighted in a double click
             for (ix = -1; ix <= 1; ix++)
             {
@@ -229,26 +199,9 @@ MineMouse_MoveDoubleClick(short xMouse, short yMouse)
                     //Only change tiles in the HELD state
                     if (MINE_TILE_STATUS_HELD == gameData.tileStatus[MINE_INDEX(xGridUpdate, yGridUpdate)])
                     {
-                        gameData.tileStatus[MINE_INDEX(xGridUpdate, yGridUpdate)] = MINE_TILE_STATUS_NORMAL;
-
-                        if (0 == BitBlt(hDC, windowData.boardRegion.left+xGridUpdate*MINE_TILE_PIXELS,
-                                        windowData.boardRegion.top+yGridUpdate*MINE_TILE_PIXELS,
-                                        MINE_TILE_PIXELS, MINE_TILE_PIXELS, memoryDC, 0, 0, SRCCOPY))
-                        {
-                            MineDebug_PrintError("Copying unclicked to screen: %lu\n", GetLastError());
-                            status = MINE_ERROR_PAINT;
-                            break;
-                        }
+                        Mine_SetTileStatus(xGridUpdate, yGridUpdate, MINE_TILE_STATUS_NORMAL);
                     }
                 }
-                if (MINE_ERROR_SUCCESS != status)
-                {
-                    break;
-                }
-            }
-            if (MINE_ERROR_SUCCESS != status)
-            {
-                break;
             }
 
             gameData.prevGridX = -1;
@@ -258,13 +211,6 @@ MineMouse_MoveDoubleClick(short xMouse, short yMouse)
         /** If mouse is now on grid, highlight held tiles. */
         if (Mine_PointInRect(xMouse, yMouse, &windowData.boardRegion))
         {
-            if (NULL == SelectObject(memoryDC, imageData.held))
-            {
-                MineDebug_PrintError("Selecting held into memory DC\n");
-                status = MINE_ERROR_OBJECT;
-                break;
-            }
-
             for (ix = -1; ix <= 1; ix++)
             {
                 xGridUpdate = xGrid + ix;
@@ -324,26 +270,9 @@ MineMouse_MoveDoubleClick(short xMouse, short yMouse)
                     //Only change tiles in the NORMAL state
                     if (MINE_TILE_STATUS_NORMAL == gameData.tileStatus[MINE_INDEX(xGridUpdate, yGridUpdate)])
                     {
-                        gameData.tileStatus[MINE_INDEX(xGridUpdate, yGridUpdate)] = MINE_TILE_STATUS_HELD;
-
-                        if (0 == BitBlt(hDC, windowData.boardRegion.left+xGridUpdate*MINE_TILE_PIXELS,
-                                        windowData.boardRegion.top+yGridUpdate*MINE_TILE_PIXELS, 
-                                        MINE_TILE_PIXELS, MINE_TILE_PIXELS, memoryDC, 0, 0, SRCCOPY))
-                        {
-                            MineDebug_PrintError("Copying held to screen: %lu\n", GetLastError());
-                            status = MINE_ERROR_PAINT;
-                            break;
-                        }
+                        Mine_SetTileStatus(xGridUpdate, yGridUpdate, MINE_TILE_STATUS_HELD);
                     }
                 }
-                if (MINE_ERROR_SUCCESS != status)
-                {
-                    break;
-                }
-            }
-            if (MINE_ERROR_SUCCESS != status)
-            {
-                break;
             }
 
             gameData.prevGridX = xGrid;
@@ -353,25 +282,6 @@ MineMouse_MoveDoubleClick(short xMouse, short yMouse)
         __assume(FALSE == bFalse);
     } while (bFalse);
 
-    //Clean up
-    if (NULL != memoryDC)
-    {
-        if (0 == DeleteDC(memoryDC))
-        {
-            MineDebug_PrintWarning("Unable to delete memory device context\n");
-        }
-        memoryDC = NULL;
-    }
-
-    if (NULL != hDC)
-    {
-        if (0 == ReleaseDC(hwnd, hDC))
-        {
-            MineDebug_PrintWarning("Unable to release device context\n");
-        }
-        hDC = NULL;
-    }
-
     return status;
 }
 
@@ -390,8 +300,6 @@ MINE_ERROR
 MineMouse_MoveLeftClick(short xMouse, short yMouse)
 {
     BOOLEAN    bFalse = FALSE;
-    HDC        hDC = NULL;
-    HDC        memoryDC = NULL;
     MINE_ERROR status = MINE_ERROR_SUCCESS;
     LONG       xGrid = -1;
     LONG       yGrid = -1;
@@ -399,11 +307,7 @@ MineMouse_MoveLeftClick(short xMouse, short yMouse)
     do
     {
         //Convert from mouse coordinates to grid coordinates
-        if (Mine_PointInRect(xMouse, yMouse, &windowData.boardRegion))
-        {
-            xGrid = ((((LONG) xMouse) - windowData.boardRegion.left) / MINE_TILE_PIXELS);
-            yGrid = ((((LONG) yMouse) - windowData.boardRegion.top) / MINE_TILE_PIXELS);
-        }
+        (void) Mine_PointToGrid(xMouse, yMouse, &xGrid, &yGrid);
 
         //If mouse hasn't moved to new tile, do nothing
         if ((gameData.prevGridX == xGrid) && (gameData.prevGridY == yGrid))
@@ -411,46 +315,13 @@ MineMouse_MoveLeftClick(short xMouse, short yMouse)
             break;
         }
 
-        //Handle all graphics in this function
-        hDC = GetDC(hwnd);
-        if (NULL == hDC)
-        {
-            MineDebug_PrintError("Obtaining device context\n");
-            status = MINE_ERROR_DC;
-            break;
-        }
-
-        memoryDC = CreateCompatibleDC(hDC);
-        if (NULL == memoryDC)
-        {
-            MineDebug_PrintError("Creating compatible memory DC\n");
-            status = MINE_ERROR_DC;
-            break;
-        }
-
         /** If mouse was previously on grid, unhighlight previously held tile. */
         if ((-1 != gameData.prevGridX) && (-1 != gameData.prevGridY))
         {
             //Only change a tile in the HELD state
             if (MINE_TILE_STATUS_HELD == gameData.tileStatus[MINE_INDEX(gameData.prevGridX, gameData.prevGridY)])
             {
-                if (NULL == SelectObject(memoryDC, imageData.unclicked))
-                {
-                    MineDebug_PrintError("Selecting unclicked into memory DC\n");
-                    status = MINE_ERROR_OBJECT;
-                    break;
-                }
-
-                if (0 == BitBlt(hDC, windowData.boardRegion.left+gameData.prevGridX*MINE_TILE_PIXELS,
-                                windowData.boardRegion.top+gameData.prevGridY*MINE_TILE_PIXELS, 
-                                MINE_TILE_PIXELS, MINE_TILE_PIXELS, memoryDC, 0, 0, SRCCOPY))
-                {
-                    MineDebug_PrintError("Copying unclicked to screen: %i\n", GetLastError());
-                    status = MINE_ERROR_PAINT;
-                    break;
-                }
-
-                gameData.tileStatus[MINE_INDEX(gameData.prevGridX, gameData.prevGridY)] = MINE_TILE_STATUS_NORMAL;
+                Mine_SetTileStatus(gameData.prevGridX, gameData.prevGridY, MINE_TILE_STATUS_NORMAL);
             }
 
             gameData.prevGridX = -1;
@@ -463,23 +334,7 @@ MineMouse_MoveLeftClick(short xMouse, short yMouse)
             //Only change a tile in the NORMAL state
             if (MINE_TILE_STATUS_NORMAL == gameData.tileStatus[MINE_INDEX(xGrid, yGrid)])
             {
-                if (NULL == SelectObject(memoryDC, imageData.held))
-                {
-                    MineDebug_PrintError("Selecting held into memory DC\n");
-                    status = MINE_ERROR_OBJECT;
-                    break;
-                }
-
-                if (0 == BitBlt(hDC, windowData.boardRegion.left+xGrid*MINE_TILE_PIXELS,
-                                windowData.boardRegion.top+yGrid*MINE_TILE_PIXELS, 
-                                MINE_TILE_PIXELS, MINE_TILE_PIXELS, memoryDC, 0, 0, SRCCOPY))
-                {
-                    MineDebug_PrintError("Copying held to screen: %i\n", GetLastError());
-                    status = MINE_ERROR_PAINT;
-                    break;
-                }
-
-                gameData.tileStatus[MINE_INDEX(xGrid, yGrid)] = MINE_TILE_STATUS_HELD;
+                Mine_SetTileStatus(xGrid, yGrid, MINE_TILE_STATUS_HELD);
             }
 
             gameData.prevGridX = xGrid;
@@ -489,25 +344,6 @@ MineMouse_MoveLeftClick(short xMouse, short yMouse)
         __assume(FALSE == bFalse);
     } while (bFalse);
 
-    //Clean up
-    if (NULL != memoryDC)
-    {
-        if (0 == DeleteDC(memoryDC))
-        {
-            MineDebug_PrintWarning("Unable to delete memory device context\n");
-        }
-        memoryDC = NULL;
-    }
-
-    if (NULL != hDC)
-    {
-        if (0 == ReleaseDC(hwnd, hDC))
-        {
-            MineDebug_PrintWarning("Unable to release device context\n");
-        }
-        hDC = NULL;
-    }
-
     return status;
 }
 
@@ -526,12 +362,8 @@ MINE_ERROR
 MineMouse_ProcessDoubleClick(short xMouse, short yMouse)
 {
     BOOLEAN    bFalse = FALSE;
-    CHAR       boardNumber = 0;
-    CHAR       flagCount = 0;
-    HDC        hDC = NULL;
     LONG       ix = 0;
     LONG       jx = 0;
-    HDC        memoryDC = NULL;
     MINE_ERROR status = MINE_ERROR_SUCCESS;
     LONG       xGrid = 0;
     LONG       xGridUpdate = 0;
@@ -540,33 +372,9 @@ MineMouse_ProcessDoubleClick(short xMouse, short yMouse)
 
     do
     {
-        //Handle all graphics in this function
-        hDC = GetDC(hwnd);
-        if (NULL == hDC)
-        {
-            MineDebug_PrintError("Obtaining device context\n");
-            status = MINE_ERROR_DC;
-            break;
-        }
-
-        memoryDC = CreateCompatibleDC(hDC);
-        if (NULL == memoryDC)
-        {
-            MineDebug_PrintError("Creating compatible memory DC\n");
-            status = MINE_ERROR_DC;
-            break;
-        }
-
         /** If mouse was previously in board region, unhighlight held tiles. */
         if ((-1 != gameData.prevGridX) && (-1 != gameData.prevGridY))
         {
-            if (NULL == SelectObject(memoryDC, imageData.unclicked))
-            {
-                MineDebug_PrintError("Selecting unclicked into memory DC\n");
-                status = MINE_ERROR_OBJECT;
-                break;
-            }
-
             for (ix = -1; ix <= 1; ix++)
             {
                 //Allow wrapping for x coordinates if in wrap horizontal mode
@@ -626,26 +434,57 @@ MineMouse_ProcessDoubleClick(short xMouse, short yMouse)
                     //Unhighlight held tiles
                     if (MINE_TILE_STATUS_HELD == gameData.tileStatus[MINE_INDEX(xGridUpdate, yGridUpdate)])
                     {
-                        gameData.tileStatus[MINE_INDEX(xGridUpdate, yGridUpdate)] = MINE_TILE_STATUS_NORMAL;
-
-                        if (0 == BitBlt(hDC, windowData.boardRegion.left+xGridUpdate*MINE_TILE_PIXELS,
-                                        windowData.boardRegion.top+yGridUpdate*MINE_TILE_PIXELS, 
-                                        MINE_TILE_PIXELS, MINE_TILE_PIXELS, memoryDC, 0, 0, SRCCOPY))
-                        {
-                            MineDebug_PrintError("Copying unclicked to screen: %lu\n", GetLastError());
-                            status = MINE_ERROR_PAINT;
-                            break;
-                        }
+                        Mine_SetTileStatus(xGridUpdate, yGridUpdate, MINE_TILE_STATUS_NORMAL);
                     }
                 }
-                if (MINE_ERROR_SUCCESS != status)
-                {
-                    break;
-                }
             }
-            if (MINE_ERROR_SUCCESS != status)
+
+            //Store that no tiles are currently being highlighted
+            gameData.prevGridX = -1;
+            gameData.prevGridY = -1;
+        }
+
+        (void) Mine_PointToGrid(xMouse, yMouse, &xGrid, &yGrid);
+
+        status = MineMouse_RevealAround(xGrid, yGrid);
+        if (MINE_ERROR_SUCCESS != status)
+        {
+            MineDebug_PrintError("In function MineMouse_RevealAround: %i\n", (int) status);
+            break;
+        }
+
+        __assume(FALSE == bFalse);
+    } while (bFalse);
+
+    return status;
+}
+
+/**
+    MineMouse_ProcessLeftClick
+*//**
+    Process the release of a left click. Reveal if tile unclicked.
+
+    @param[in] xMouse - X coordinate of mouse in client area pixels.
+    @param[in] yMouse - Y coordinate of mouse in client area pixels.
+
+    @return Mine error code (MINE_ERROR_SUCCESS upon success).
+*/
+MINE_ERROR 
+MineMouse_ProcessLeftClick(short xMouse, short yMouse)
+{
+    BOOLEAN    bFalse = FALSE;
+    MINE_ERROR status = MINE_ERROR_SUCCESS;
+    LONG       xGrid = 0;
+    LONG       yGrid = 0;
+
+    do
+    {
+        /** If mouse was previously in board region, unhighlight previously held tile. */
+        if ((-1 != gameData.prevGridX) && (-1 != gameData.prevGridY))
+        {
+            if (MINE_TILE_STATUS_HELD == gameData.tileStatus[MINE_INDEX(gameData.prevGridX, gameData.prevGridY)])
             {
-                break;
+                Mine_SetTileStatus(gameData.prevGridX, gameData.prevGridY, MINE_TILE_STATUS_NORMAL);
             }
 
             //Store that no tiles are currently being highlighted
@@ -653,9 +492,78 @@ MineMouse_ProcessDoubleClick(short xMouse, short yMouse)
             gameData.prevGridY = -1;
         }
 
-        xGrid = ((((LONG) xMouse) - windowData.boardRegion.left) / MINE_TILE_PIXELS);
-        yGrid = ((((LONG) yMouse) - windowData.boardRegion.top) / MINE_TILE_PIXELS);
+        //Convert from mouse coordinates to grid coordinates
+        (void) Mine_PointToGrid(xMouse, yMouse, &xGrid, &yGrid);
+
+        status = MineMouse_RevealTile(xGrid, yGrid);
+        if (MINE_ERROR_SUCCESS != status)
+        {
+            MineDebug_PrintError("In function MineMouse_RevealTile: %i\n", (int) status);
+            break;
+        }
+
+        __assume(FALSE == bFalse);
+    } while (bFalse);
+
+    return status;
+}
+
+/**
+    MineMouse_ProcessRightDown
+*//**
+    Process the initial press of a right click. Flags or un-flags a tile.
+
+    @param[in] xMouse - X coordinate of mouse in client area pixels.
+    @param[in] yMouse - Y coordinate of mouse in client area pixels.
+
+    @return Mine error code (MINE_ERROR_SUCCESS upon success).
+*/
+MINE_ERROR 
+MineMouse_ProcessRightDown(short xMouse, short yMouse)
+{
+    BOOLEAN    bFalse = FALSE;
+    MINE_ERROR status = MINE_ERROR_SUCCESS;
+    LONG       xGrid = 0;
+    LONG       yGrid = 0;
+
+    do
+    {
+        //Convert from mouse coordinates to grid coordinates
+        (void) Mine_PointToGrid(xMouse, yMouse, &xGrid, &yGrid);
+
+        MineMouse_ToggleFlag(xGrid, yGrid);
+
+        __assume(FALSE == bFalse);
+    } while (bFalse);
+
+    return status;
+}
+
+/**
+    MineMouse_RevealAround
+*//**
+    Reveal the tiles around a revealed number once as many flags surround it
+    as the number shows.
+
+    @param[in] xGrid - X coordinate of tile in grid.
+    @param[in] yGrid - Y coordinate of tile in grid.
+
+    @return Mine error code (MINE_ERROR_SUCCESS upon success).
+*/
+MINE_ERROR
+MineMouse_RevealAround(LONG xGrid, LONG yGrid)
+{
+    BOOLEAN    bFalse = FALSE;
+    CHAR       boardNumber = 0;
+    CHAR       flagCount = 0;
+    LONG       ix = 0;
+    LONG       jx = 0;
+    MINE_ERROR status = MINE_ERROR_SUCCESS;
+    LONG       xGridUpdate = 0;
+    LONG       yGridUpdate = 0;
 
+    do
+    {
         if (MINE_TILE_STATUS_REVEALED == gameData.tileStatus[MINE_INDEX(xGrid, yGrid)])
         {
             boardNumber = gameData.gameBoard[MINE_INDEX(xGrid, yGrid)];
@@ -786,7 +694,7 @@ MineMouse_ProcessDoubleClick(short xMouse, short yMouse)
                         //Uncover all unclicked tiles surrounding clicked tile
                         if (MINE_TILE_STATUS_NORMAL == gameData.tileStatus[MINE_INDEX(xGridUpdate, yGridUpdate)])
                         {
-                            status = MineMouse_UncoverTile(xGridUpdate, yGridUpdate, hDC, memoryDC);
+                            status = MineMouse_UncoverTile(xGridUpdate, yGridUpdate);
                             if (MINE_ERROR_SUCCESS != status)
                             {
                                 MineDebug_PrintError("In function MineMouse_UncoverTile: %i\n", (int) status);
@@ -809,261 +717,47 @@ MineMouse_ProcessDoubleClick(short xMouse, short yMouse)
         __assume(FALSE == bFalse);
     } while (bFalse);
 
-    //Clean up
-    if (NULL != memoryDC)
-    {
-        if (0 == DeleteDC(memoryDC))
-        {
-            MineDebug_PrintWarning("Unable to delete memory device context\n");
-        }
-        memoryDC = NULL;
-    }
-
-    if (NULL != hDC)
-    {
-        if (0 == ReleaseDC(hwnd, hDC))
-        {
-            MineDebug_PrintWarning("Unable to release DC\n");
-        }
-        hDC = NULL;
-    }
-    
     return status;
 }
 
 /**
-    MineMouse_ProcessLeftClick
+    MineMouse_RevealTile
 *//**
-    Process the release of a left click. Reveal if tile unclicked.
+    Reveal a tile that has not been clicked, starting the game first if this
+    is the first tile revealed.
 
-    @param[in] xMouse - X coordinate of mouse in client area pixels.
-    @param[in] yMouse - Y coordinate of mouse in client area pixels.
+    @param[in] xGrid - X coordinate of tile in grid.
+    @param[in] yGrid - Y coordinate of tile in grid.
 
     @return Mine error code (MINE_ERROR_SUCCESS upon success).
 */
-MINE_ERROR 
-MineMouse_ProcessLeftClick(short xMouse, short yMouse)
+MINE_ERROR
+MineMouse_RevealTile(LONG xGrid, LONG yGrid)
 {
     BOOLEAN    bFalse = FALSE;
-    HDC        hDC = NULL;
-    HDC        memoryDC = NULL;
     MINE_ERROR status = MINE_ERROR_SUCCESS;
-    LONG       xGrid = 0;
-    LONG       yGrid = 0;
 
     do
     {
-        //Handle all graphics in this function
-        hDC = GetDC(hwnd);
-        if (NULL == hDC)
+        //Check if this is the first left click of the game
+        if (!gameData.gameStarted)
         {
-            MineDebug_PrintError("Obtaining device context\n");
-            status = MINE_ERROR_DC;
-            break;
+            MineMouse_FirstClick(xGrid, yGrid);
         }
 
-        memoryDC = CreateCompatibleDC(hDC);
-        if (NULL == memoryDC)
+        /** Reveal the tile if the tile has not been clicked. */
+        if (MINE_TILE_STATUS_NORMAL == gameData.tileStatus[MINE_INDEX(xGrid, yGrid)])
         {
-            MineDebug_PrintError("Creating compatible memory DC\n");
-            status = MINE_ERROR_DC;
-            break;
+            status = MineMouse_UncoverTile(xGrid, yGrid);
+            if (MINE_ERROR_SUCCESS != status)
+            {
+                MineDebug_PrintError("In function MineMouse_UncoverTile: %i\n", (int) status);
+                break;
+            }
         }
 
-        /** If mouse was previously in board region, unhighlight previously held tile. */
-        if ((-1 != gameData.prevGridX) && (-1 != gameData.prevGridY))
-        {
-            if (MINE_TILE_STATUS_HELD == gameData.tileStatus[MINE_INDEX(gameData.prevGridX, gameData.prevGridY)])
-            {
-                if (NULL == SelectObject(memoryDC, imageData.unclicked))
-                {
-                    MineDebug_PrintError("Selecting unclicked into memory DC\n");
-                    status = MINE_ERROR_OBJECT;
-                    break;
-                }
-
-                if (0 == BitBlt(hDC, windowData.boardRegion.left+gameData.prevGridX*MINE_TILE_PIXELS,
-                                windowData.boardRegion.top+gameData.prevGridY*MINE_TILE_PIXELS, 
-                                MINE_TILE_PIXELS, MINE_TILE_PIXELS, memoryDC, 0, 0, SRCCOPY))
-                {
-                    MineDebug_PrintError("Copying unclicked to screen: %lu\n", GetLastError());
-                    status = MINE_ERROR_PAINT;
-                    break;
-                }
-
-                gameData.tileStatus[MINE_INDEX(gameData.prevGridX, gameData.prevGridY)] = MINE_TILE_STATUS_NORMAL;
-            }
-
-            //Store that no tiles are currently being highlighted
-            gameData.prevGridX = -1;
-            gameData.prevGridY = -1;
-        }
-
-        //Convert from mouse coordinates to grid coordinates
-        xGrid = ((((LONG) xMouse) - windowData.boardRegion.left) / MINE_TILE_PIXELS);
-        yGrid = ((((LONG) yMouse) - windowData.boardRegion.top) / MINE_TILE_PIXELS);
-
-        //Check if this is the first left click of the game
-        if (!gameData.gameStarted)
-        {
-            MineMouse_FirstClick(xGrid, yGrid);
-        }
-
-        /** Reveal the tile if the tile has not been clicked. */
-        if (MINE_TILE_STATUS_NORMAL == gameData.tileStatus[MINE_INDEX(xGrid, yGrid)])
-        {
-            status = MineMouse_UncoverTile(xGrid, yGrid, hDC, memoryDC);
-            if (MINE_ERROR_SUCCESS != status)
-            {
-                MineDebug_PrintError("In function MineMouse_UncoverTile: %i\n", (int) status);
-                break;
-            }
-        }
-
-        __assume(FALSE == bFalse);
-    } while (bFalse);
-
-    //Clean up
-    if (NULL != memoryDC)
-    {
-        if (0 == DeleteDC(memoryDC))
-        {
-            MineDebug_PrintWarning("Unable to delete memory device context\n");
-        }
-        memoryDC = NULL;
-    }
-
-    if (NULL != hDC)
-    {
-        if (0 == ReleaseDC(hwnd, hDC))
-        {
-            MineDebug_PrintWarning("Unable to release DC\n");
-        }
-        hDC = NULL;
-    }
-
-    return status;
-}
-
-/**
-    MineMouse_ProcessRightDown
-*//**
-    Process the initial press of a right click. Flags or un-flags a tile.
-
-    @param[in] xMouse - X coordinate of mouse in client area pixels.
-    @param[in] yMouse - Y coordinate of mouse in client area pixels.
-
-    @return Mine error code (MINE_ERROR_SUCCESS upon success).
-*/
-MINE_ERROR 
-MineMouse_ProcessRightDown(short xMouse, short yMouse)
-{
-    BOOLEAN    bFalse = FALSE;
-    HDC        hDC = NULL;
-    HDC        memoryDC = NULL;
-    MINE_ERROR status = MINE_ERROR_SUCCESS;
-    LONG       xGrid = 0;
-    LONG       yGrid = 0;
-
-    do
-    {
-        //Convert from mouse coordinates to grid coordinates
-        xGrid = (((LONG) xMouse) - windowData.boardRegion.left) / MINE_TILE_PIXELS;
-        yGrid = (((LONG) yMouse) - windowData.boardRegion.top) / MINE_TILE_PIXELS;
-
-        //Handle all graphics in this function
-        hDC = GetDC(hwnd);
-        if (NULL == hDC)
-        {
-            MineDebug_PrintError("Obtaining device context\n");
-            status = MINE_ERROR_DC;
-            break;
-        }
-
-        memoryDC = CreateCompatibleDC(hDC);
-        if (NULL == memoryDC)
-        {
-            MineDebug_PrintError("Creating compatible memory DC\n");
-            status = MINE_ERROR_DC;
-            break;
-        }
-
-        /** If tile is unclicked, place a flag. */
-        if (MINE_TILE_STATUS_NORMAL == gameData.tileStatus[MINE_INDEX(xGrid, yGrid)])
-        {
-            gameData.tileStatus[MINE_INDEX(xGrid, yGrid)] = MINE_TILE_STATUS_FLAG;
-            gameData.numFlagged += 1;
-
-            if (NULL == SelectObject(memoryDC, imageData.flag))
-            {
-                MineDebug_PrintError("Selecting flag into memory DC\n");
-                status = MINE_ERROR_OBJECT;
-                break;
-            }
-
-            if (0 == BitBlt(hDC, windowData.boardRegion.left + xGrid * MINE_TILE_PIXELS,
-                            windowData.boardRegion.top + yGrid * MINE_TILE_PIXELS, MINE_TILE_PIXELS,
-                            MINE_TILE_PIXELS, memoryDC, 0, 0, SRCCOPY))
-            {
-                MineDebug_PrintError("Copying flag to screen: %lu\n", GetLastError());
-                status = MINE_ERROR_PAINT;
-                break;
-            }
-
-            if (0 == InvalidateRect(hwnd, &(windowData.mineCountRegion), FALSE))
-            {
-                MineDebug_PrintWarning("Unable to invalidate rectangle\n");
-            }
-        }
-        /** If tile already has a flag, remove the flag. */
-        else if (MINE_TILE_STATUS_FLAG == gameData.tileStatus[MINE_INDEX(xGrid, yGrid)])
-        {
-            gameData.tileStatus[MINE_INDEX(xGrid, yGrid)] = MINE_TILE_STATUS_NORMAL;
-            gameData.numFlagged -= 1;
-
-            if (NULL == SelectObject(memoryDC, imageData.unclicked))
-            {
-                MineDebug_PrintError("Selecting unclicked into memory DC\n");
-                status = MINE_ERROR_OBJECT;
-                break;
-            }
-
-            if (0 == BitBlt(hDC, windowData.boardRegion.left + xGrid * MINE_TILE_PIXELS,
-                            windowData.boardRegion.top + yGrid * MINE_TILE_PIXELS, MINE_TILE_PIXELS,
-                            MINE_TILE_PIXELS, memoryDC, 0, 0, SRCCOPY))
-            {
-                MineDebug_PrintError("Copying unclicked to screen: %lu\n", GetLastError());
-                status = MINE_ERROR_PAINT;
-                break;
-            }
-
-            if (0 == InvalidateRect(hwnd, &(windowData.mineCountRegion), FALSE))
-            {
-                MineDebug_PrintWarning("Unable to invalidate rectangle\n");
-            }
-        }
-
-        __assume(FALSE == bFalse);
-    } while (bFalse);
-
-    //Clean up
-    if (NULL != memoryDC)
-    {
-        if (0 == DeleteDC(memoryDC))
-        {
-            MineDebug_PrintWarning("Unable to delete memory device context\n");
-        }
-        memoryDC = NULL;
-    }
-
-    if (NULL != hDC)
-    {
-        if (0 == ReleaseDC(hwnd, hDC))
-        {
-            MineDebug_PrintWarning("Unable to release DC\n");
-        }
-        hDC = NULL;
-    }
+        __assume(FALSE == bFalse);
+    } while (bFalse);
 
     return status;
 }
@@ -1082,10 +776,8 @@ MINE_ERROR
 MineMouse_StartDoubleClick(short xMouse, short yMouse)
 {
     BOOLEAN    bFalse = FALSE;
-    HDC        hDC = NULL;
     LONG       ix = 0;
     LONG       jx = 0;
-    HDC        memoryDC = NULL;
     MINE_ERROR status = MINE_ERROR_SUCCESS;
     LONG       xGrid = 0;
     LONG       xGridUpdate = 0;
@@ -1094,34 +786,8 @@ MineMouse_StartDoubleClick(short xMouse, short yMouse)
 
     do
     {
-        //Handle all graphics in this function
-        hDC = GetDC(hwnd);
-        if (NULL == hDC)
-        {
-            MineDebug_PrintError("Obtaining device context\n");
-            status = MINE_ERROR_DC;
-            break;
-        }
-
-        memoryDC = CreateCompatibleDC(hDC);
-        if (NULL == memoryDC)
-        {
-            MineDebug_PrintError("Creating compatible memory DC\n");
-            status = MINE_ERROR_DC;
-            break;
-        }
-
-        //The only new image we need is the tile held image
-        if (NULL == SelectObject(memoryDC, imageData.held))
-        {
-            MineDebug_PrintError("Selecting held into memory DC\n");
-            status = MINE_ERROR_OBJECT;
-            break;
-        }
-
         //Convert from mouse coordinates to grid coordinates
-        xGrid = ((((LONG) xMouse) - windowData.boardRegion.left) / MINE_TILE_PIXELS);
-        yGrid = ((((LONG) yMouse) - windowData.boardRegion.top) / MINE_TILE_PIXELS);
+        (void) Mine_PointToGrid(xMouse, yMouse, &xGrid, &yGrid);
 
         /** Allow wrapping for x coordinates if in wrap horizontal mode. */
         for (ix = -1; ix <= 1; ix++)
@@ -1182,26 +848,9 @@ MineMouse_StartDoubleClick(short xMouse, short yMouse)
                 /** Highlight newly held tiles. */
                 if (MINE_TILE_STATUS_NORMAL == gameData.tileStatus[MINE_INDEX(xGridUpdate, yGridUpdate)])
                 {
-                    if (0 == BitBlt(hDC, windowData.boardRegion.left+xGridUpdate*MINE_TILE_PIXELS,
-                                    windowData.boardRegion.top+yGridUpdate*MINE_TILE_PIXELS, 
-                                    MINE_TILE_PIXELS, MINE_TILE_PIXELS, memoryDC, 0, 0, SRCCOPY))
-                    {
-                        MineDebug_PrintError("Copying held to screen: %lu\n", GetLastError());
-                        status = MINE_ERROR_PAINT;
-                        break;
-                    }
-
-                    gameData.tileStatus[MINE_INDEX(xGridUpdate, yGridUpdate)] = MINE_TILE_STATUS_HELD;
+                    Mine_SetTileStatus(xGridUpdate, yGridUpdate, MINE_TILE_STATUS_HELD);
                 }
             }
-            if (MINE_ERROR_SUCCESS != status)
-            {
-                break;
-            }
-        }
-        if (MINE_ERROR_SUCCESS != status)
-        {
-            break;
         }
 
         //Store location of mouse so highlighted tiles can be unhighlighted later
@@ -1211,26 +860,6 @@ MineMouse_StartDoubleClick(short xMouse, short yMouse)
         __assume(FALSE == bFalse);
     } while (bFalse);
 
-    //Clean up
-
-    if (NULL != memoryDC)
-    {
-        if (0 == DeleteDC(memoryDC))
-        {
-            MineDebug_PrintWarning("Unable to delete memory device context\n");
-        }
-        memoryDC = NULL;
-    }
-
-    if (NULL != hDC)
-    {
-        if (0 == ReleaseDC(hwnd, hDC))
-        {
-            MineDebug_PrintWarning("Unable to release DC\n");
-        }
-        hDC = NULL;
-    }
-
     return status;
 }
 
@@ -1248,8 +877,6 @@ MINE_ERROR
 MineMouse_StartLeftClick(short xMouse, short yMouse)
 {
     BOOLEAN    bFalse = FALSE;
-    HDC        hDC = NULL;
-    HDC        memoryDC = NULL;
     MINE_ERROR status = MINE_ERROR_SUCCESS;
     LONG       xGrid = 0;
     LONG       yGrid = 0;
@@ -1257,46 +884,12 @@ MineMouse_StartLeftClick(short xMouse, short yMouse)
     do
     {
         //Convert from mouse coordinates to grid coordinates
-        xGrid = ((((LONG) xMouse) - windowData.boardRegion.left) / MINE_TILE_PIXELS);
-        yGrid = ((((LONG) yMouse) - windowData.boardRegion.top) / MINE_TILE_PIXELS);
+        (void) Mine_PointToGrid(xMouse, yMouse, &xGrid, &yGrid);
 
         if (MINE_TILE_STATUS_NORMAL == gameData.tileStatus[MINE_INDEX(xGrid, yGrid)])
         {
-            //Handle all graphics in this function
-            hDC = GetDC(hwnd);
-            if (NULL == hDC)
-            {
-                MineDebug_PrintError("Obtaining device context\n");
-                status = MINE_ERROR_DC;
-                break;
-            }
-
-            memoryDC = CreateCompatibleDC(hDC);
-            if (NULL == memoryDC)
-            {
-                MineDebug_PrintError("Creating compatible memory DC\n");
-                status = MINE_ERROR_DC;
-                break;
-            }
-
-            if (NULL == SelectObject(memoryDC, imageData.held))
-            {
-                MineDebug_PrintError("Selecting held into memory DC\n");
-                status = MINE_ERROR_OBJECT;
-                break;
-            }
-
             /** Highlight newly held tile. */
-            if (0 == BitBlt(hDC, windowData.boardRegion.left+xGrid*MINE_TILE_PIXELS,
-                            windowData.boardRegion.top+yGrid*MINE_TILE_PIXELS, 
-                            MINE_TILE_PIXELS, MINE_TILE_PIXELS, memoryDC, 0, 0, SRCCOPY))
-            {
-                MineDebug_PrintError("Copying held to screen: %lu\n", GetLastError());
-                status = MINE_ERROR_PAINT;
-                break;
-            }
-
-            gameData.tileStatus[MINE_INDEX(xGrid, yGrid)] = MINE_TILE_STATUS_HELD;
+            Mine_SetTileStatus(xGrid, yGrid, MINE_TILE_STATUS_HELD);
 
             //Store location of mouse so highlighted tiles can be unhighlighted later
             gameData.prevGridX = xGrid;
@@ -1306,26 +899,38 @@ MineMouse_StartLeftClick(short xMouse, short yMouse)
         __assume(FALSE == bFalse);
     } while (bFalse);
 
-    //Clean up
-    if (NULL != memoryDC)
+    return status;
+}
+
+/**
+    MineMouse_ToggleFlag
+*//**
+    Place a flag on a tile that has not been clicked, or take a flag back off.
+
+    @param[in] xGrid - X coordinate of tile in grid.
+    @param[in] yGrid - Y coordinate of tile in grid.
+*/
+VOID
+MineMouse_ToggleFlag(LONG xGrid, LONG yGrid)
+{
+    /** If tile is unclicked, place a flag. */
+    if (MINE_TILE_STATUS_NORMAL == gameData.tileStatus[MINE_INDEX(xGrid, yGrid)])
     {
-        if (0 == DeleteDC(memoryDC))
-        {
-            MineDebug_PrintWarning("Unable to delete memory device context\n");
-        }
-        memoryDC = NULL;
-    }
+        Mine_SetTileStatus(xGrid, yGrid, MINE_TILE_STATUS_FLAG);
+        gameData.numFlagged += 1;
 
-    if (NULL != hDC)
+        MineDamage_AddRect(&(windowData.mineCountRegion));
+    }
+    /** If tile already has a flag, remove the flag. */
+    else if (MINE_TILE_STATUS_FLAG == gameData.tileStatus[MINE_INDEX(xGrid, yGrid)])
     {
-        if (0 == ReleaseDC(hwnd, hDC))
-        {
-            MineDebug_PrintWarning("Unable to release DC\n");
-        }
-        hDC = NULL;
+        Mine_SetTileStatus(xGrid, yGrid, MINE_TILE_STATUS_NORMAL);
+        gameData.numFlagged -= 1;
+
+        MineDamage_AddRect(&(windowData.mineCountRegion));
     }
 
-    return status;
+    return;
 }
 
 /**
@@ -1335,101 +940,106 @@ MineMouse_StartLeftClick(short xMouse, short yMouse)
 
     @param[in] xGrid  - X coordinate of tile in grid coordinates.
     @param[in] yGrid  - Y coordinate of tile in grid coordinates.
-    @param[in] hDC    - Handle to device context for main window.
-    @param[in] hMemDC - Handle to memory device context to hold bitmap
-                        before it is transfered to screen.
 
     @return Mine error code (MINE_ERROR_SUCCESS on success).
 */
 MINE_ERROR 
-MineMouse_UncoverTile(LONG xGrid, LONG yGrid, _In_ HDC hDC, _In_ HDC hMemDC)
+MineMouse_UncoverTile(LONG xGrid, LONG yGrid)
 {
     BOOLEAN    bFalse = FALSE;
     CHAR       boardNumber = 0;
     LONG       ix = 0;
     LONG       jx = 0;
+    UINT       numCascade = 0;
     MINE_ERROR status = MINE_ERROR_SUCCESS;
+    LONG       tile = 0;
     LONG       xGridUpdate = 0;
     LONG       yGridUpdate = 0;
 
     do
     {
-        if (NULL == hDC)
-        {
-            MineDebug_PrintError("Partameter hDC is NULL\n");
-            status = MINE_ERROR_PARAMETER;
-            break;
-        }
-
-        if (NULL == hMemDC)
-        {
-            MineDebug_PrintError("Parameter memDC is NULL\n");
-            status = MINE_ERROR_PARAMETER;
-            break;
-        }
-
         /** Determine the number to be displayed. */
         boardNumber = gameData.gameBoard[MINE_INDEX(xGrid, yGrid)];
 
         //Set tile status to revealed
-        gameData.tileStatus[MINE_INDEX(xGrid, yGrid)] = MINE_TILE_STATUS_REVEALED;
+        Mine_SetTileStatus(xGrid, yGrid, MINE_TILE_STATUS_REVEALED);
 
         /** If a mine was revealed, the game was lost. */
         if (MINE_BOMB_VALUE == boardNumber)
         {
             gameData.gameOver = TRUE;
             gameData.gameWon = FALSE;
-            if (0 == InvalidateRect(hwnd, NULL, FALSE))
-            {
-                MineDebug_PrintWarning("Unable to invalidate rectangle\n");
-            }
+            //Every mine and misplaced flag is shown once the game is lost
+            MineDamage_AddAll();
+            break;
         }
-        else
+
+        //Increment a counter which holds the number of tile uncovered thus far
+        gameData.numUncovered++;
+
+        if (0 == boardNumber)
         {
-            //Increment a counter which holds the number of tile uncovered thus far
-            gameData.numUncovered++;
+            gameData.cascadeTiles[numCascade++] = MINE_INDEX(xGrid, yGrid);
+        }
 
-            /* Display the number image for the newly revealed tile. */
-            if (NULL == SelectObject(hMemDC, imageData.numbers[boardNumber]))
-            {
-                MineDebug_PrintError("Selecting numbers %i into memory DC\n", (int) boardNumber);
-                status = MINE_ERROR_OBJECT;
-                break;
-            }
+        /** If a tile has zero surrounding mines, reveal all surrounding tiles as
+            well. A tile is listed when it is revealed, so it is listed at most
+            once and the list never outgrows the board. */
+        while (0 < numCascade)
+        {
+            tile = gameData.cascadeTiles[--numCascade];
+            xGrid = tile % (LONG) gameData.width;
+            yGrid = tile / (LONG) gameData.width;
 
-            if (0 == BitBlt(hDC, windowData.boardRegion.left+xGrid*MINE_TILE_PIXELS,
-                            windowData.boardRegion.top+yGrid*MINE_TILE_PIXELS, MINE_TILE_PIXELS,
-                            MINE_TILE_PIXELS, hMemDC, 0, 0, SRCCOPY))
+            /** Allow wrapping for x coordinates if in wrap horizontal mode. */
+            for (ix = -1; ix <= 1; ix++)
             {
-                MineDebug_PrintError("Copying numbers %i to screen: %lu\n", (int) boardNumber, GetLastError());
-                status = MINE_ERROR_PAINT;
-                break;
-            }
+                xGridUpdate = xGrid + ix;
 
-            /** If the tile has zero surrounding mines, reveal all surrounding tiles as well. */
-            if (0 == boardNumber)
-            {
-                /** Allow wrapping for x coordinates if in wrap horizontal mode. */
-                for (ix = -1; ix <= 1; ix++)
+                if (xGridUpdate < 0)
                 {
-                    xGridUpdate = xGrid + ix;
+                    if (menuData.wrapHorz)
+                    {
+                        xGridUpdate = (LONG) gameData.width - 1;
+                    }
+                    else
+                    {
+                        continue;
+                    }
+                }
+                else if (xGridUpdate > (LONG) (gameData.width - 1))
+                {
+                    if (menuData.wrapHorz)
+                    {
+                        xGridUpdate = 0;
+                    }
+                    else
+                    {
+                        continue;
+                    }
+                }
 
-                    if (xGridUpdate < 0)
+                /** Allow wrapping for y coordinates if in wrap vertical mode. */
+                for (jx = -1; jx <= 1; jx++)
+                {
+                    yGridUpdate = yGrid + jx;
+
+                    if (yGridUpdate < 0)
                     {
-                        if (menuData.wrapHorz)
+                        if (menuData.wrapVert)
                         {
-                            xGridUpdate = (LONG) gameData.width - 1;
+                            yGridUpdate = (LONG) gameData.height - 1;
                         }
                         else
                         {
                             continue;
                         }
                     }
-                    else if (xGridUpdate > (LONG) (gameData.width - 1))
+                    else if (yGridUpdate > (LONG) (gameData.height - 1))
                     {
-                        if (menuData.wrapHorz)
+                        if (menuData.wrapVert)
                         {
-                            xGridUpdate = 0;
+                            yGridUpdate = 0;
                         }
                         else
                         {
@@ -1437,53 +1047,17 @@ MineMouse_UncoverTile(LONG xGrid, LONG yGrid, _In_ HDC hDC, _In_ HDC hMemDC)
                         }
                     }
 
-                    /** Allow wrapping for y coordinates if in wrap vertical mode. */
-                    for (jx = -1; jx <= 1; jx++)
+                    //Tiles around a zero are never mines
+                    if (MINE_TILE_STATUS_NORMAL == gameData.tileStatus[MINE_INDEX(xGridUpdate, yGridUpdate)])
                     {
-                        yGridUpdate = yGrid + jx;
-
-                        if (yGridUpdate < 0)
-                        {
-                            if (menuData.wrapVert)
-                            {
-                                yGridUpdate = (LONG) gameData.height - 1;
-                            }
-                            else
-                            {
-                                continue;
-                            }
-                        }
-                        else if (yGridUpdate > (LONG) (gameData.height - 1))
-                        {
-                            if (menuData.wrapVert)
-                            {
-                                yGridUpdate = 0;
-                            }
-                            else
-                            {
-                                continue;
-                            }
-                        }
+                        Mine_SetTileStatus(xGridUpdate, yGridUpdate, MINE_TILE_STATUS_REVEALED);
+                        gameData.numUncovered++;
 
-                        if (MINE_TILE_STATUS_NORMAL == gameData.tileStatus[MINE_INDEX(xGridUpdate, yGridUpdate)])
+                        if (0 == gameData.gameBoard[MINE_INDEX(xGridUpdate, yGridUpdate)])
                         {
-                            //Recursive call to uncover surrounding tiles
-                            status = MineMouse_UncoverTile(xGridUpdate, yGridUpdate, hDC, hMemDC);
-                            if (MINE_ERROR_SUCCESS != status)
-                            {
-                                MineDebug_PrintError("In function MineMouse_UncoverTile: %i\n", (int) status);
-                                break;
-                            }
+                            gameData.cascadeTiles[numCascade++] = MINE_INDEX(xGridUpdate, yGridUpdate);
                         }
                     }
-                    if (MINE_ERROR_SUCCESS != status)
-                    {
-                        break;
-                    }
-                }
-                if (MINE_ERROR_SUCCESS != status)
-                {
-                    break;
                 }
             }
         }
@@ -1491,18 +1065,6 @@ MineMouse_UncoverTile(LONG xGrid, LONG yGrid, _In_ HDC hDC, _In_ HDC hMemDC)
         /** If all non-mine tiles have been uncovered, the game has been won. */
         if (gameData.height*gameData.width-gameData.mines == gameData.numUncovered)
         {
-            //This is a hack. When a dialog is created in Mine_GameWon a WM_PAINT message
-            //gets sent to the window procedure without this function returning first. This
-            //causes a second memory device context to be created while this memory device 
-            //context still exists. Since a bitmap can only be loaded in one device context
-            //at a time, we load a bitmap that the other device context will not need.
-            if (NULL == SelectObject(hMemDC, imageData.mineHit))
-            {
-                MineDebug_PrintError("Selecting mineHit into memory DC\n");
-                status = MINE_ERROR_OBJECT;
-                break;
-            }
-
             Mine_GameWon();
         }
 
@@ -108,6 +108,34 @@ MineMouse_ProcessLeftClick(short xMouse, short yMouse);
 MINE_ERROR
 MineMouse_ProcessRightDown(short xMouse, short yMouse);
 
+/**
+    MineMouse_RevealAround
+*//**
+    Reveal the tiles around a revealed number once as many flags surround it
+    as the number shows.
+
+    @param[in] xGrid - X coordinate of tile in grid.
+    @param[in] yGrid - Y coordinate of tile in grid.
+
+    @return Mine error code (MINE_ERROR_SUCCESS upon success).
+*/
+MINE_ERROR
+MineMouse_RevealAround(LONG xGrid, LONG yGrid);
+
+/**
+    MineMouse_RevealTile
+*//**
+    Reveal a tile that has not been clicked, starting the game first if this
+    is the first tile revealed.
+
+    @param[in] xGrid - X coordinate of tile in grid.
+    @param[in] yGrid - Y coordinate of tile in grid.
+
+    @return Mine error code (MINE_ERROR_SUCCESS upon success).
+*/
+MINE_ERROR
+MineMouse_RevealTile(LONG xGrid, LONG yGrid);
+
 /**
     MineMouse_StartDoubleClick
 *//**
@@ -134,6 +162,17 @@ MineMouse_StartDoubleClick(short xMouse, short yMouse);
 MINE_ERROR
 MineMouse_StartLeftClick(short xMouse, short yMouse);
 
+/**
+    MineMouse_ToggleFlag
+*//**
+    Place a flag on a tile that has not been clicked, or take a flag back off.
+
+    @param[in] xGrid - X coordinate of tile in grid.
+    @param[in] yGrid - Y coordinate of tile in grid.
+*/
+VOID
+MineMouse_ToggleFlag(LONG xGrid, LONG yGrid);
+
 /**
     MineMouse_UncoverTile
 *//**
@@ -141,11 +180,8 @@ MineMouse_StartLeftClick(short xMouse, short yMouse);
 
     @param[in] xGrid  - X coordinate of tile in grid coordinates.
     @param[in] yGrid  - Y coordinate of tile in grid coordinates.
-    @param[in] hDC    - Handle to device context for main window.
-    @param[in] hMemDC - Handle to memory device context to hold bitmap
-                        before it is transfered to screen.
 
     @return Mine error code (MINE_ERROR_SUCCESS on success).
 */
 MINE_ERROR
-MineMouse_UncoverTile(LONG xGrid, LONG yGrid, _In_ HDC hDC, _In_ HDC memDC);
\ No newline at end of file
+MineMouse_UncoverTile(LONG xGrid, LONG yGrid);
\ No newline at end of file
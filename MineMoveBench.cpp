@@ -0,0 +1,533 @@
+/**
+    @file MineMoveBench.cpp
+
+    @author Craig Burkhart
+
+    @brief Headless benchmark of mine movement, timing movement ticks and
+           counting the number and redraw work each one causes.
+*//*
+    Copyright (C) 2014 - Craig Burkhart
+
+    This file is part of Minesweeper Deluxe.
+
+    Minesweeper Deluxe is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Minesweeper Deluxe is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Minesweeper Deluxe.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#include "stdafx.h"
+#include "MineMoveBench.h"
+#include "MineArena.h"
+#include "MineDamage.h"
+#include "MineDebug.h"
+#include "MineMinimap.h"
+#include "MineMovement.h"
+
+/** Board sizes moved on by the benchmark. */
+static const MINE_MOVEBENCH_SIZE benchSizes[MINE_MOVEBENCH_NUM_SIZES] =
+{
+    {"beginner", MINE_BEGINNER_WIDTH, MINE_BEGINNER_HEIGHT, MINE_BEGINNER_MINES},
+    {"expert",   MINE_EXPERT_WIDTH,   MINE_EXPERT_HEIGHT,   MINE_EXPERT_MINES},
+    {"maximum",  MINE_MAX_WIDTH,      MINE_MAX_HEIGHT,      min((MINE_MAX_WIDTH - 1)*(MINE_MAX_HEIGHT - 1)/5, MINE_MAX_MINES)}
+};
+
+/** Names of the wrap modes, indexed by the wrap flag. */
+static const LPCSTR wrapNames[MINE_MOVEBENCH_NUM_WRAPS] = {"nowrap", "wrap"};
+
+/**
+    main
+*//**
+    Run every size, wrap mode and aggressiveness, report tick times and the
+    work done per tick, and check the numbers left on the board.
+
+    Usage: minemovebench [-t ticks] [-p policy] [-b batch, or percent with a trailing %]
+                         [-k to keep revealed numbers]
+
+    @param[in] argc - Number of command line arguments.
+    @param[in] argv - Command line arguments.
+
+    @return 0 if every scenario ran and left correct numbers, 1 otherwise.
+*/
+int
+main(int argc, char* argv[])
+{
+    DWORD                 aggressiveness = 0;
+    BOOLEAN               bFalse = FALSE;
+    DWORD                 batch = MINE_MOVEMENT_DEFAULT_BATCH;
+    BOOLEAN               batchPercent = FALSE;
+    BOOLEAN               consistent = FALSE;
+    INT                   ix = 0;
+    DWORD                 policy = MINE_MOVEMENT_POLICY_WALK;
+    MINE_MOVEBENCH_RESULT result = {0};
+    MINE_ERROR            status = MINE_ERROR_SUCCESS;
+    UINT                  ticks = MINE_MOVEBENCH_DEFAULT_TICKS;
+    ULONGLONG             totalTicks = 0;
+    ULONGLONG             totalTime = 0;
+    UINT                  wrap = 0;
+
+    do
+    {
+        for (ix = 1; ix < argc; ix++)
+        {
+            if ((0 == strcmp(argv[ix], "-t")) && (ix + 1 < argc))
+            {
+                ix++;
+                ticks = (UINT) max(1, atoi(argv[ix]));
+            }
+            else if ((0 == strcmp(argv[ix], "-p")) && (ix + 1 < argc))
+            {
+                ix++;
+                policy = (DWORD) max(0, min(MINE_MOVEMENT_POLICIES - 1, atoi(argv[ix])));
+            }
+            else if ((0 == strcmp(argv[ix], "-b")) && (ix + 1 < argc))
+            {
+                ix++;
+                batch = (DWORD) max(1, atoi(argv[ix]));
+                batchPercent = ('%' == argv[ix][strlen(argv[ix]) - 1]) ? (BOOLEAN) TRUE : (BOOLEAN) FALSE;
+            }
+            else if (0 == strcmp(argv[ix], "-k"))
+            {
+                consistent = TRUE;
+            }
+            else
+            {
+                (void) fprintf(stderr, "Usage: %s [-t ticks] [-p policy] [-b batch[%%]] [-k]\n", argv[0]);
+                status = MINE_ERROR_PARAMETER;
+                break;
+            }
+        }
+        if (MINE_ERROR_SUCCESS != status)
+        {
+            break;
+        }
+
+        menuData.useMovement = TRUE;
+        menuData.movementPolicy = policy;
+        menuData.movementBatch = batchPercent ? min(batch, 100) : min(batch, MINE_MOVEMENT_MAX_BATCH);
+        menuData.movementBatchPercent = batchPercent;
+        menuData.movementConsistent = consistent;
+
+        (void) printf("policy %u, batch %u%s, %u ticks per scenario%s\n\n", (UINT) policy,
+                      (UINT) menuData.movementBatch, batchPercent ? "%" : "", ticks,
+                      consistent ? ", revealed numbers kept" : "");
+
+        (void) printf("%-22s %6s %10s %8s %8s %8s %8s %7s %8s %8s %7s %8s\n", "scenario", "ticks", "ticks/s",
+                      "p50 us", "p90 us", "p99 us", "max us", "moves", "visited", "numbers", "rects", "kpixels");
+
+        /** Every size with and without wrapping, at every aggressiveness. */
+        for (ix = 0; ix < MINE_MOVEBENCH_NUM_SIZES; ix++)
+        {
+            for (wrap = 0; wrap < MINE_MOVEBENCH_NUM_WRAPS; wrap++)
+            {
+                for (aggressiveness = 1; aggressiveness <= MINE_MOVEBENCH_NUM_LEVELS; aggressiveness++)
+                {
+                    status = MineMoveBench_RunScenario(&benchSizes[ix], (BOOLEAN) wrap, aggressiveness, ticks, &result);
+                    if (MINE_ERROR_SUCCESS != status)
+                    {
+                        (void) fprintf(stderr, "Scenario %s-%s-a%u failed: %i\n", benchSizes[ix].name,
+                                       wrapNames[wrap], (UINT) aggressiveness, (int) status);
+                        break;
+                    }
+
+                    //Work counts are per tick, so scenarios with different tick counts compare
+                    (void) printf("%-22s %6u %10.1f %8.2f %8.2f %8.2f %8.2f %7.2f %8.2f %8.2f %7.2f %8.2f\n",
+                                  result.name, result.ticks,
+                                  (1e9*result.ticks)/(double) max(1, result.totalTime),
+                                  result.p50/1e3, result.p90/1e3, result.p99/1e3, result.worst/1e3,
+                                  result.moves/(double) result.ticks,
+                                  result.neighborsVisited/(double) result.ticks,
+                                  result.numbersChanged/(double) result.ticks,
+                                  result.damageRects/(double) result.ticks,
+                                  result.damagePixels/(1e3*result.ticks));
+
+                    totalTicks += result.ticks;
+                    totalTime += result.totalTime;
+                }
+                if (MINE_ERROR_SUCCESS != status)
+                {
+                    break;
+                }
+            }
+            if (MINE_ERROR_SUCCESS != status)
+            {
+                break;
+            }
+        }
+        if (MINE_ERROR_SUCCESS != status)
+        {
+            break;
+        }
+
+        (void) printf("%-22s %6llu %10.1f\n", "all", (unsigned long long) totalTicks,
+                      (1e9*totalTicks)/(double) max(1, totalTime));
+
+        __assume(FALSE == bFalse);
+    } while (bFalse);
+
+    //Clean up
+    MineMinimap_Cleanup();
+    Mine_FreeBoard();
+
+    return (MINE_ERROR_SUCCESS == status) ? 0 : 1;
+}
+
+/**
+    MineMoveBench_CheckNumbers
+*//**
+    Check that the numbers left by movement match a full recount of the board.
+
+    @return TRUE if every number matches, FALSE otherwise.
+*/
+BOOLEAN
+MineMoveBench_CheckNumbers(VOID)
+{
+    LONG    ix = 0;
+    BOOLEAN match = TRUE;
+    CHAR*   pMoved = NULL;
+    LONG    tiles = (LONG) (gameData.width*gameData.height);
+
+    //The arena was sized with room for this copy and the one taken before the first tick
+    pMoved = (CHAR*) MineArena_Alloc((SIZE_T) tiles);
+    if (NULL == pMoved)
+    {
+        match = FALSE;
+    }
+    else
+    {
+        CopyMemory(pMoved, gameData.gameBoard, (SIZE_T) tiles);
+
+        if (MINE_ERROR_SUCCESS != Mine_AssignNumbers(0, (LONG) gameData.width - 1, 0, (LONG) gameData.height - 1))
+        {
+            match = FALSE;
+        }
+
+        for (ix = 0; match && (ix < tiles); ix++)
+        {
+            if (pMoved[ix] != gameData.gameBoard[ix])
+            {
+                (void) fprintf(stderr, "Tile %i is %i after movement, %i on recount\n", (int) ix,
+                               (int) pMoved[ix], (int) gameData.gameBoard[ix]);
+                match = FALSE;
+            }
+        }
+    }
+
+    return match;
+}
+
+/**
+    MineMoveBench_CheckRevealed
+*//**
+    Check that movement left the number on every revealed tile as it was.
+
+    @param[in] pStart - Copy of the board taken before the first tick.
+
+    @return TRUE if no revealed number changed, FALSE otherwise.
+*/
+BOOLEAN
+MineMoveBench_CheckRevealed(_In_ const CHAR* pStart)
+{
+    LONG    ix = 0;
+    BOOLEAN match = TRUE;
+    LONG    tiles = (LONG) (gameData.width*gameData.height);
+
+    for (ix = 0; match && (ix < tiles); ix++)
+    {
+        if ((MINE_TILE_STATUS_REVEALED == gameData.tileStatus[ix]) && (pStart[ix] != gameData.gameBoard[ix]))
+        {
+            (void) fprintf(stderr, "Revealed tile %i changed from %i to %i\n", (int) ix,
+                           (int) pStart[ix], (int) gameData.gameBoard[ix]);
+            match = FALSE;
+        }
+    }
+
+    return match;
+}
+
+/**
+    MineMoveBench_CompareTimes
+*//**
+    Order two tick times for qsort.
+
+    @param[in] pFirst  - Pointer to a ULONGLONG.
+    @param[in] pSecond - Pointer to a ULONGLONG.
+
+    @return Negative, zero or positive as first is less, equal or greater.
+*/
+int
+MineMoveBench_CompareTimes(_In_ const void* pFirst, _In_ const void* pSecond)
+{
+    ULONGLONG first = *((const ULONGLONG*) pFirst);
+    ULONGLONG second = *((const ULONGLONG*) pSecond);
+
+    return (first < second) ? -1 : ((first > second) ? 1 : 0);
+}
+
+/**
+    MineMoveBench_Now
+*//**
+    Read a monotonic clock.
+
+    @return Current time in nanoseconds.
+*/
+ULONGLONG
+MineMoveBench_Now(VOID)
+{
+#ifdef _WIN32
+    static LARGE_INTEGER frequency = {0};
+    LARGE_INTEGER        now = {0};
+
+    if (0 == frequency.QuadPart)
+    {
+        (void) QueryPerformanceFrequency(&frequency);
+    }
+
+    (void) QueryPerformanceCounter(&now);
+
+    return (ULONGLONG) ((now.QuadPart/frequency.QuadPart)*1000000000LL +
+                        ((now.QuadPart%frequency.QuadPart)*1000000000LL)/frequency.QuadPart);
+#else /* _WIN32 */
+    struct timespec now;
+
+    (void) clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return ((ULONGLONG) now.tv_sec)*1000000000ULL + (ULONGLONG) now.tv_nsec;
+#endif /* _WIN32 */
+}
+
+/**
+    MineMoveBench_RunScenario
+*//**
+    Run movement ticks on one board, timing every tick and counting the work
+    each one caused.
+
+    @param[in]  pSize          - Board size to move mines on.
+    @param[in]  wrap           - Flag for if the board wraps across both edges.
+    @param[in]  aggressiveness - Movement aggressiveness, from 1 to 10.
+    @param[in]  ticks          - Number of ticks to run.
+    @param[out] pResult        - Timing and work counts of the scenario.
+
+    @return Mine error code (MINE_ERROR_SUCCESS upon success).
+*/
+MINE_ERROR
+MineMoveBench_RunScenario(_In_ const MINE_MOVEBENCH_SIZE* pSize, BOOLEAN wrap, DWORD aggressiveness,
+                          UINT ticks, _Out_ MINE_MOVEBENCH_RESULT* pResult)
+{
+    BOOLEAN    bFalse = FALSE;
+    HANDLE     hHeap = NULL;
+    UINT       ix = 0;
+    UINT       jx = 0;
+    UINT       numRects = 0;
+    CHAR*      pStart = NULL;
+    ULONGLONG* pTimes = NULL;
+    RECT       rects[MINE_DAMAGE_MAX_RECTS];
+    ULONGLONG  start = 0;
+    MINE_ERROR status = MINE_ERROR_SUCCESS;
+
+    do
+    {
+        if ((NULL == pSize) || (NULL == pResult) || (1 > aggressiveness) ||
+            (MINE_MOVEBENCH_NUM_LEVELS < aggressiveness) || (0 == ticks))
+        {
+            MineDebug_PrintError("Invalid parameter to MineMoveBench_RunScenario\n");
+            status = MINE_ERROR_PARAMETER;
+            break;
+        }
+
+        ZeroMemory(pResult, sizeof(MINE_MOVEBENCH_RESULT));
+        (void) snprintf(pResult->name, MINE_MOVEBENCH_NAME_CHARS, "%s-%s-a%u", pSize->name,
+                        wrapNames[wrap ? 1 : 0], (UINT) aggressiveness);
+
+        hHeap = GetProcessHeap();
+        if (NULL == hHeap)
+        {
+            status = MINE_ERROR_HEAP;
+            break;
+        }
+
+        pTimes = (ULONGLONG*) HeapAlloc(hHeap, 0, ticks*sizeof(ULONGLONG));
+        if (NULL == pTimes)
+        {
+            status = MINE_ERROR_MEMORY;
+            break;
+        }
+
+        //Same board at every aggressiveness so only the moves differ
+        status = MineMoveBench_SetupBoard(pSize, wrap,
+                                          ((ULONGLONG) pSize->width << 32) | ((ULONGLONG) pSize->height << 16) |
+                                          (ULONGLONG) (wrap ? 2 : 1));
+        if (MINE_ERROR_SUCCESS != status)
+        {
+            break;
+        }
+
+        menuData.movementAggressive = aggressiveness;
+        ZeroMemory(&movementData, sizeof(MINE_MOVEMENT_DATA));
+
+        //Kept to check the revealed numbers against, the arena has room for it
+        pStart = (CHAR*) MineArena_Alloc(gameData.width*gameData.height);
+        if (NULL == pStart)
+        {
+            status = MINE_ERROR_MEMORY;
+            break;
+        }
+
+        CopyMemory(pStart, gameData.gameBoard, gameData.width*gameData.height);
+
+        /** Only the tick is timed, the damage it left is collected afterwards as
+            the next frame would. */
+        for (ix = 0; ix < ticks; ix++)
+        {
+            start = MineMoveBench_Now();
+            status = MineMovement_ProcessMovement();
+            pTimes[ix] = MineMoveBench_Now() - start;
+            if (MINE_ERROR_SUCCESS != status)
+            {
+                break;
+            }
+
+            pResult->totalTime += pTimes[ix];
+
+            numRects = MineDamage_Take(rects);
+            pResult->damageRects += numRects;
+
+            for (jx = 0; jx < numRects; jx++)
+            {
+                pResult->damagePixels += (ULONGLONG) ((rects[jx].right - rects[jx].left)*
+                                                      (rects[jx].bottom - rects[jx].top));
+            }
+        }
+        if (MINE_ERROR_SUCCESS != status)
+        {
+            break;
+        }
+
+        if (!MineMoveBench_CheckNumbers())
+        {
+            (void) fprintf(stderr, "Scenario %s left numbers that do not match the mines\n", pResult->name);
+            status = MINE_ERROR_PARAMETER;
+            break;
+        }
+
+        if (menuData.movementConsistent && !MineMoveBench_CheckRevealed(pStart))
+        {
+            (void) fprintf(stderr, "Scenario %s changed revealed numbers\n", pResult->name);
+            status = MINE_ERROR_PARAMETER;
+            break;
+        }
+
+        qsort(pTimes, ticks, sizeof(ULONGLONG), MineMoveBench_CompareTimes);
+
+        pResult->ticks = ticks;
+        pResult->p50 = pTimes[((ticks - 1)*50)/100];
+        pResult->p90 = pTimes[((ticks - 1)*90)/100];
+        pResult->p99 = pTimes[((ticks - 1)*99)/100];
+        pResult->worst = pTimes[ticks - 1];
+        pResult->moves = movementData.movesApplied;
+        pResult->neighborsVisited = movementData.neighborsVisited;
+        pResult->numbersChanged = movementData.numbersChanged;
+
+        __assume(FALSE == bFalse);
+    } while (bFalse);
+
+    if (NULL != pTimes)
+    {
+        (void) HeapFree(hHeap, 0, pTimes);
+        pTimes = NULL;
+    }
+
+    return status;
+}
+
+/**
+    MineMoveBench_SetupBoard
+*//**
+    Allocate and fill a new board with a repeatable mine layout, part of it
+    revealed as in a game under way.
+
+    @param[in] pSize - Board size to create.
+    @param[in] wrap  - Flag for if the board wraps across both edges.
+    @param[in] seed  - Seed for the mine layout and the moves.
+
+    @return Mine error code (MINE_ERROR_SUCCESS upon success).
+*/
+MINE_ERROR
+MineMoveBench_SetupBoard(_In_ const MINE_MOVEBENCH_SIZE* pSize, BOOLEAN wrap, ULONGLONG seed)
+{
+    BOOLEAN    bFalse = FALSE;
+    RECT       rects[MINE_DAMAGE_MAX_RECTS];
+    MINE_ERROR status = MINE_ERROR_SUCCESS;
+    LONG       xGrid = 0;
+    LONG       yGrid = 0;
+
+    do
+    {
+        //The board arrays belong to the arena, so they can be dropped with the rest
+        ZeroMemory(&gameData, sizeof(MINE_GAME_SETTINGS));
+        gameData.width = pSize->width;
+        gameData.height = pSize->height;
+        gameData.mines = pSize->mines;
+
+        menuData.wrapHorz = wrap;
+        menuData.wrapVert = wrap;
+        windowData.zoom = MINE_ZOOM_STEPS;
+
+        //Room for the copies of the board the numbers are checked against
+        status = Mine_AllocBoard(2*MINE_ARENA_BYTES(((SIZE_T) gameData.width)*((SIZE_T) gameData.height)));
+        if (MINE_ERROR_SUCCESS != status)
+        {
+            break;
+        }
+
+        status = MineMinimap_Reset();
+        if (MINE_ERROR_SUCCESS != status)
+        {
+            break;
+        }
+
+        Mine_SeedRandom(seed);
+
+        status = Mine_NewRandomBoard();
+        if (MINE_ERROR_SUCCESS != status)
+        {
+            break;
+        }
+
+        status = Mine_AssignNumbers(0, (LONG) gameData.width - 1, 0, (LONG) gameData.height - 1);
+        if (MINE_ERROR_SUCCESS != status)
+        {
+            break;
+        }
+
+        Mine_SetupWindow();
+
+        /** Reveal the safe tiles of every few rows, so policies that steer by
+            revealed tiles have edges to steer by. */
+        for (yGrid = 0; yGrid < (LONG) gameData.height; yGrid += MINE_MOVEBENCH_REVEAL_ROWS)
+        {
+            for (xGrid = 0; xGrid < (LONG) gameData.width; xGrid++)
+            {
+                if (MINE_BOMB_VALUE != gameData.gameBoard[yGrid*gameData.width + xGrid])
+                {
+                    Mine_SetTileStatus(xGrid, yGrid, MINE_TILE_STATUS_REVEALED);
+                    gameData.numUncovered++;
+                }
+            }
+        }
+
+        //Setup damage is not the work of any tick
+        (void) MineDamage_Take(rects);
+
+        __assume(FALSE == bFalse);
+    } while (bFalse);
+
+    return status;
+}
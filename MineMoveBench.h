@@ -0,0 +1,181 @@
+/**
+    @file MineMoveBench.h
+
+    @author Craig Burkhart
+
+    @brief Header file for the headless mine movement benchmark.
+*//*
+    Copyright (C) 2014 - Craig Burkhart
+
+    This file is part of Minesweeper Deluxe.
+
+    Minesweeper Deluxe is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Minesweeper Deluxe is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Minesweeper Deluxe.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#pragma once
+
+#include "Mine.h"
+
+//--------------------------------------------------------------
+//    Macros
+//--------------------------------------------------------------
+
+/** Default number of movement ticks timed in each scenario. */
+#define MINE_MOVEBENCH_DEFAULT_TICKS 1000
+/** Number of board sizes in the benchmark. */
+#define MINE_MOVEBENCH_NUM_SIZES 3
+/** Number of wrap modes in the benchmark, none and both edges. */
+#define MINE_MOVEBENCH_NUM_WRAPS 2
+/** Number of aggressiveness levels in the benchmark, 1 to 10. */
+#define MINE_MOVEBENCH_NUM_LEVELS 10
+/** Number of characters in a scenario name. */
+#define MINE_MOVEBENCH_NAME_CHARS 64
+/** One in this many rows of the board starts revealed, so policies that follow
+    revealed tiles have something to follow. */
+#define MINE_MOVEBENCH_REVEAL_ROWS 3
+
+//--------------------------------------------------------------
+//    Structures
+//--------------------------------------------------------------
+
+struct _MINE_MOVEBENCH_SIZE
+{
+    /** Name used in scenario names. */
+    LPCSTR name;
+    /** Width (in tiles) of the board. */
+    DWORD  width;
+    /** Height (in tiles) of the board. */
+    DWORD  height;
+    /** Number of mines on the board. */
+    DWORD  mines;
+};
+
+struct _MINE_MOVEBENCH_RESULT
+{
+    /** Name of the scenario, i.e. "expert-wrap-a5". */
+    CHAR      name[MINE_MOVEBENCH_NAME_CHARS];
+    /** Number of ticks timed. */
+    UINT      ticks;
+    /** Total time (in nanoseconds) spent in movement ticks. */
+    ULONGLONG totalTime;
+    /** Median tick time in nanoseconds. */
+    ULONGLONG p50;
+    /** 90th percentile tick time in nanoseconds. */
+    ULONGLONG p90;
+    /** 99th percentile tick time in nanoseconds. */
+    ULONGLONG p99;
+    /** Slowest tick time in nanoseconds. */
+    ULONGLONG worst;
+    /** Number of moves made. */
+    ULONGLONG moves;
+    /** Number of neighboring tiles read while updating numbers. */
+    ULONGLONG neighborsVisited;
+    /** Number of tile numbers changed. */
+    ULONGLONG numbersChanged;
+    /** Number of damage rectangles handed to the renderer. */
+    ULONGLONG damageRects;
+    /** Number of client area pixels marked to be redrawn. */
+    ULONGLONG damagePixels;
+};
+
+//--------------------------------------------------------------
+//    Typedefs
+//--------------------------------------------------------------
+
+/** Board size moved on by the benchmark. */
+typedef struct _MINE_MOVEBENCH_SIZE MINE_MOVEBENCH_SIZE;
+
+/** Timing and work counts of a single movement scenario. */
+typedef struct _MINE_MOVEBENCH_RESULT MINE_MOVEBENCH_RESULT;
+
+//--------------------------------------------------------------
+//    Function Prototypes
+//--------------------------------------------------------------
+
+/**
+    MineMoveBench_CheckNumbers
+*//**
+    Check that the numbers left by movement match a full recount of the board.
+
+    @return TRUE if every number matches, FALSE otherwise.
+*/
+BOOLEAN
+MineMoveBench_CheckNumbers(VOID);
+
+/**
+    MineMoveBench_CheckRevealed
+*//**
+    Check that movement left the number on every revealed tile as it was.
+
+    @param[in] pStart - Copy of the board taken before the first tick.
+
+    @return TRUE if no revealed number changed, FALSE otherwise.
+*/
+BOOLEAN
+MineMoveBench_CheckRevealed(_In_ const CHAR* pStart);
+
+/**
+    MineMoveBench_CompareTimes
+*//**
+    Order two tick times for qsort.
+
+    @param[in] pFirst  - Pointer to a ULONGLONG.
+    @param[in] pSecond - Pointer to a ULONGLONG.
+
+    @return Negative, zero or positive as first is less, equal or greater.
+*/
+int
+MineMoveBench_CompareTimes(_In_ const void* pFirst, _In_ const void* pSecond);
+
+/**
+    MineMoveBench_Now
+*//**
+    Read a monotonic clock.
+
+    @return Current time in nanoseconds.
+*/
+ULONGLONG
+MineMoveBench_Now(VOID);
+
+/**
+    MineMoveBench_RunScenario
+*//**
+    Run movement ticks on one board, timing every tick and counting the work
+    each one caused.
+
+    @param[in]  pSize          - Board size to move mines on.
+    @param[in]  wrap           - Flag for if the board wraps across both edges.
+    @param[in]  aggressiveness - Movement aggressiveness, from 1 to 10.
+    @param[in]  ticks          - Number of ticks to run.
+    @param[out] pResult        - Timing and work counts of the scenario.
+
+    @return Mine error code (MINE_ERROR_SUCCESS upon success).
+*/
+MINE_ERROR
+MineMoveBench_RunScenario(_In_ const MINE_MOVEBENCH_SIZE* pSize, BOOLEAN wrap, DWORD aggressiveness,
+                          UINT ticks, _Out_ MINE_MOVEBENCH_RESULT* pResult);
+
+/**
+    MineMoveBench_SetupBoard
+*//**
+    Allocate and fill a new board with a repeatable mine layout, part of it
+    revealed as in a game under way.
+
+    @param[in] pSize - Board size to create.
+    @param[in] wrap  - Flag for if the board wraps across both edges.
+    @param[in] seed  - Seed for the mine layout and the moves.
+
+    @return Mine error code (MINE_ERROR_SUCCESS upon success).
+*/
+MINE_ERROR
+MineMoveBench_SetupBoard(_In_ const MINE_MOVEBENCH_SIZE* pSize, BOOLEAN wrap, ULONGLONG seed);
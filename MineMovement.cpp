@@ -24,8 +24,17 @@
 */
 #include "stdafx.h"
 #include "Mine.h"
+#ifdef _WIN32
 #include "MineAbout.h"
+#endif /* _WIN32 */
+#include "MineDamage.h"
 #include "MineDebug.h"
+#include "MineMovement.h"
+
+// Global Variables:
+MINE_MOVEMENT_DATA movementData = {0};
+
+#ifdef _WIN32
 
 /**
     MineMovement_Dialog
@@ -42,13 +51,22 @@
 INT_PTR CALLBACK 
 MineMovement_Dialog(_In_ HWND hDlg, UINT message, WPARAM wParam, LPARAM lParam)
 {
-    static HWND aggressiveHwnd = NULL;
-    BOOL        bReturn = TRUE;
-    static HWND checkHwnd = NULL;
-    static HWND freqHwnd = NULL;
-    INT_PTR     returnValue = (INT_PTR) FALSE;
-    MINE_ERROR  status = MINE_ERROR_SUCCESS;
-    UINT        value = 0;
+    static HWND    aggressiveHwnd = NULL;
+    static HWND    batchHwnd = NULL;
+    BOOL           bReturn = TRUE;
+    static HWND    checkHwnd = NULL;
+    static HWND    consistentHwnd = NULL;
+    static HWND    freqHwnd = NULL;
+    UINT           ix = 0;
+    UINT           maxBatch = 0;
+    static HWND    percentHwnd = NULL;
+    static HWND    policyHwnd = NULL;
+    static LPCWSTR policyNames[MINE_MOVEMENT_POLICIES] = {L"Random walk", L"Away from revealed",
+                                                          L"Toward frontier", L"Levy flight"};
+    INT_PTR        returnValue = (INT_PTR) FALSE;
+    int            selection = 0;
+    MINE_ERROR     status = MINE_ERROR_SUCCESS;
+    UINT           value = 0;
 
     UNREFERENCED_PARAMETER(lParam);
 
@@ -96,6 +114,64 @@ MineMovement_Dialog(_In_ HWND hDlg, UINT message, WPARAM wParam, LPARAM lParam)
             break;
         }
 
+        batchHwnd = GetDlgItem(hDlg, IDC_MOVEMENT_BATCH);
+        if (NULL == batchHwnd)
+        {
+            status = MINE_ERROR_CONTROL;
+            MineDebug_PrintError("Getting batch edit control handle: %lu\n", GetLastError());
+            if (0 == EndDialog(hDlg, MINE_DIALOG_ERROR_OFFSET + (INT_PTR) status))
+            {
+                MineDebug_PrintWarning("Unable to end dialog window: %lu\n", GetLastError());
+            }
+            break;
+        }
+
+        percentHwnd = GetDlgItem(hDlg, IDC_MOVEMENT_PERCENT);
+        if (NULL == percentHwnd)
+        {
+            status = MINE_ERROR_CONTROL;
+            MineDebug_PrintError("Getting percent check control handle: %lu\n", GetLastError());
+            if (0 == EndDialog(hDlg, MINE_DIALOG_ERROR_OFFSET + (INT_PTR) status))
+            {
+                MineDebug_PrintWarning("Unable to end dialog window: %lu\n", GetLastError());
+            }
+            break;
+        }
+
+        policyHwnd = GetDlgItem(hDlg, IDC_MOVEMENT_POLICY);
+        if (NULL == policyHwnd)
+        {
+            status = MINE_ERROR_CONTROL;
+            MineDebug_PrintError("Getting policy combo box handle: %lu\n", GetLastError());
+            if (0 == EndDialog(hDlg, MINE_DIALOG_ERROR_OFFSET + (INT_PTR) status))
+            {
+                MineDebug_PrintWarning("Unable to end dialog window: %lu\n", GetLastError());
+            }
+            break;
+        }
+
+        consistentHwnd = GetDlgItem(hDlg, IDC_MOVEMENT_CONSISTENT);
+        if (NULL == consistentHwnd)
+        {
+            status = MINE_ERROR_CONTROL;
+            MineDebug_PrintError("Getting consistent check control handle: %lu\n", GetLastError());
+            if (0 == EndDialog(hDlg, MINE_DIALOG_ERROR_OFFSET + (INT_PTR) status))
+            {
+                MineDebug_PrintWarning("Unable to end dialog window: %lu\n", GetLastError());
+            }
+            break;
+        }
+
+        /** List the policies in MINE_MOVEMENT_POLICY_* order, so the selection is the policy. */
+        for (ix = 0; ix < MINE_MOVEMENT_POLICIES; ix++)
+        {
+            if (0 > ComboBox_AddString(policyHwnd, policyNames[ix]))
+            {
+                MineDebug_PrintWarning("Adding movement policy to combo box: %u\n", ix);
+            }
+        }
+        (void) ComboBox_SetCurSel(policyHwnd, (int) menuData.movementPolicy);
+
         /** Upon initialization, set edit controls to show previous value. */
         if (0 == SetDlgItemInt(hDlg, IDC_MOVEMENT_FREQ, (UINT) menuData.movementFreq, FALSE))
         {
@@ -107,6 +183,21 @@ MineMovement_Dialog(_In_ HWND hDlg, UINT message, WPARAM wParam, LPARAM lParam)
             MineDebug_PrintWarning("Setting movement aggressiveness int: %lu\n", GetLastError);
         }
 
+        if (0 == SetDlgItemInt(hDlg, IDC_MOVEMENT_BATCH, (UINT) menuData.movementBatch, FALSE))
+        {
+            MineDebug_PrintWarning("Setting movement batch int: %lu\n", GetLastError());
+        }
+
+        if (menuData.movementBatchPercent)
+        {
+            (void) Button_SetCheck(percentHwnd, BST_CHECKED);
+        }
+
+        if (menuData.movementConsistent)
+        {
+            (void) Button_SetCheck(consistentHwnd, BST_CHECKED);
+        }
+
         if (menuData.useMovement)
         {
             (void) Button_SetCheck(checkHwnd, BST_CHECKED);
@@ -117,6 +208,14 @@ MineMovement_Dialog(_In_ HWND hDlg, UINT message, WPARAM wParam, LPARAM lParam)
             (void) Edit_Enable(aggressiveHwnd, FALSE);
 
             (void) Edit_Enable(freqHwnd, FALSE);
+
+            (void) Edit_Enable(batchHwnd, FALSE);
+
+            (void) Button_Enable(percentHwnd, FALSE);
+
+            (void) ComboBox_Enable(policyHwnd, FALSE);
+
+            (void) Button_Enable(consistentHwnd, FALSE);
         }
 
         break;
@@ -140,10 +239,10 @@ MineMovement_Dialog(_In_ HWND hDlg, UINT message, WPARAM wParam, LPARAM lParam)
                     value = MINE_SECOND;
                 }
                 //Check bounds on movement frequency value
-                else if (MINE_QUARTER_SECOND > value)
+                else if (MINE_MOVEMENT_MIN_FREQ > value)
                 {
                     MineDebug_PrintWarning("Movement frequency too small: %u\n", value);
-                    value = MINE_QUARTER_SECOND;
+                    value = MINE_MOVEMENT_MIN_FREQ;
                 }
                 else if (MINE_MAX_TIME*MINE_SECOND < value)
                 {
@@ -187,22 +286,73 @@ MineMovement_Dialog(_In_ HWND hDlg, UINT message, WPARAM wParam, LPARAM lParam)
                     MineDebug_PrintWarning("In function Mine_SetRegDword\n");
                 }
 
-                //Set the flag that indicates movement is to occur
-                menuData.useMovement = (DWORD) TRUE;
+                /** The batch is either a number of mines, or a percentage of all of them. */
+                menuData.movementBatchPercent = (BST_CHECKED == Button_GetCheck(percentHwnd)) ? TRUE : FALSE;
+                maxBatch = menuData.movementBatchPercent ? 100 : MINE_MOVEMENT_MAX_BATCH;
 
-                if (MINE_ERROR_SUCCESS != Mine_SetRegDword(L"Movement", (DWORD) TRUE))
+                //Retrieve and set movement batch value
+                value = GetDlgItemInt(hDlg, IDC_MOVEMENT_BATCH, &bReturn, FALSE);
+                if (FALSE == bReturn)
+                {
+                    MineDebug_PrintWarning("Getting movement batch int: %lu\n", GetLastError());
+                    //Upon error getting value from edit control, use default value as backup
+                    value = MINE_MOVEMENT_DEFAULT_BATCH;
+                }
+                //Check bounds on movement batch value
+                else if (1 > value)
+                {
+                    MineDebug_PrintWarning("Movement batch too small: %u\n", value);
+                    value = 1;
+                }
+                else if (maxBatch < value)
+                {
+                    MineDebug_PrintWarning("Movement batch too big: %u\n", value);
+                    value = maxBatch;
+                }
+
+                menuData.movementBatch = (DWORD) value;
+
+                //Store movement batch values in registry
+                if (MINE_ERROR_SUCCESS != Mine_SetRegDword(L"MovementBatch", menuData.movementBatch))
                 {
                     MineDebug_PrintWarning("In function Mine_SetRegDword\n");
                 }
 
-                //Set a timer to perform the actual movement
-                if (0 == SetTimer(hwnd, MINE_TIMER_MOVE, (UINT) menuData.movementFreq, NULL))
+                if (MINE_ERROR_SUCCESS != Mine_SetRegDword(L"MovementBatchPercent", menuData.movementBatchPercent))
                 {
-                    MineDebug_PrintWarning("Creating movement timer: %lu\n", GetLastError());
+                    MineDebug_PrintWarning("In function Mine_SetRegDword\n");
                 }
-                else
+
+                //Retrieve and set movement policy
+                selection = ComboBox_GetCurSel(policyHwnd);
+                if ((0 > selection) || (MINE_MOVEMENT_POLICIES <= (UINT) selection))
                 {
-                    movementTimerCreated = TRUE;
+                    MineDebug_PrintWarning("Movement policy out of range: %i\n", selection);
+                    selection = MINE_MOVEMENT_POLICY_WALK;
+                }
+
+                menuData.movementPolicy = (DWORD) selection;
+
+                if (MINE_ERROR_SUCCESS != Mine_SetRegDword(L"MovementPolicy", menuData.movementPolicy))
+                {
+                    MineDebug_PrintWarning("In function Mine_SetRegDword\n");
+                }
+
+                //Retrieve and set the flag for keeping revealed numbers
+                menuData.movementConsistent = (BST_CHECKED == Button_GetCheck(consistentHwnd)) ? TRUE : FALSE;
+
+                if (MINE_ERROR_SUCCESS != Mine_SetRegDword(L"MovementConsistent", menuData.movementConsistent))
+                {
+                    MineDebug_PrintWarning("In function Mine_SetRegDword\n");
+                }
+
+                //Set the flag that indicates movement is to occur, the movement thread
+                //picks up the new settings once the dialog returns
+                menuData.useMovement = (DWORD) TRUE;
+
+                if (MINE_ERROR_SUCCESS != Mine_SetRegDword(L"Movement", (DWORD) TRUE))
+                {
+                    MineDebug_PrintWarning("In function Mine_SetRegDword\n");
                 }
             }
             //Movement is disabled
@@ -214,16 +364,6 @@ MineMovement_Dialog(_In_ HWND hDlg, UINT message, WPARAM wParam, LPARAM lParam)
                 {
                     MineDebug_PrintWarning("In function Mine_SetRegDword\n");
                 }
-
-                //Stop the movement timer
-                if (movementTimerCreated)
-                {
-                    if (0 == KillTimer(hwnd, MINE_TIMER_MOVE))
-                    {
-                        MineDebug_PrintWarning("Unable to kill movement timer: %lu\n", GetLastError());
-                    }
-                    movementTimerCreated = FALSE;
-                }
             }
 
             if (0 == EndDialog(hDlg, LOWORD(wParam)))
@@ -250,12 +390,28 @@ MineMovement_Dialog(_In_ HWND hDlg, UINT message, WPARAM wParam, LPARAM lParam)
                 (void) Edit_Enable(aggressiveHwnd, TRUE);
 
                 (void) Edit_Enable(freqHwnd, TRUE);
+
+                (void) Edit_Enable(batchHwnd, TRUE);
+
+                (void) Button_Enable(percentHwnd, TRUE);
+
+                (void) ComboBox_Enable(policyHwnd, TRUE);
+
+                (void) Button_Enable(consistentHwnd, TRUE);
             }
             else
             {
                 (void) Edit_Enable(aggressiveHwnd, FALSE);
 
                 (void) Edit_Enable(freqHwnd, FALSE);
+
+                (void) Edit_Enable(batchHwnd, FALSE);
+
+                (void) Button_Enable(percentHwnd, FALSE);
+
+                (void) ComboBox_Enable(policyHwnd, FALSE);
+
+                (void) Button_Enable(consistentHwnd, FALSE);
             }  
         }
         break;
@@ -266,360 +422,829 @@ MineMovement_Dialog(_In_ HWND hDlg, UINT message, WPARAM wParam, LPARAM lParam)
 
     return returnValue;
 }
+#endif /* _WIN32 */
 
 /**
-    MineMovement_ProcessMovement
+    MineMovement_ApplyMoves
 *//**
-    Attempt, with specified aggressiveness, to move a mine from one tile to another.
+    Make a batch of moves on the game board. Each move is checked against the
+    board as the moves before it left it, moves that no longer fit are dropped.
+    The numbers around each move are changed by one rather than counted again,
+    so the cost is the same wherever on the board the mines are.
+
+    @param[in,out] pFromIndices - Board indices of the mines to move, the moves
+                                  made are moved to the front.
+    @param[in,out] pToIndices   - Board indices of the tiles to move them to, in
+                                  the same order as pFromIndices.
+    @param[in]     moves        - Number of moves in the batch.
+    @param[in]     consistent   - Flag for if moves that change a revealed number are dropped.
+    @param[out]    pApplied     - Number of moves made, at the front of both arrays.
 
     @return Mine error code (MINE_ERROR_SUCCESS upon success).
 */
 MINE_ERROR
-MineMovement_ProcessMovement(VOID)
+MineMovement_ApplyMoves(_Inout_updates_(moves) PLONG pFromIndices, _Inout_updates_(moves) PLONG pToIndices,
+                        UINT moves, BOOLEAN consistent, _Out_ PUINT pApplied)
+{
+    LONG               fromIndex = -1;
+    UINT               ix = 0;
+    MINE_ERROR         status = MINE_ERROR_SUCCESS;
+    MINE_MOVEMENT_TICK tick = {0};
+    LONG               tiles = (LONG) (gameData.width*gameData.height);
+    LONG               toIndex = -1;
+
+    *pApplied = 0;
+
+    tick.wrapHorz = (BOOLEAN) menuData.wrapHorz;
+    tick.wrapVert = (BOOLEAN) menuData.wrapVert;
+    tick.consistent = consistent;
+
+    for (ix = 0; ix < moves; ix++)
+    {
+        fromIndex = pFromIndices[ix];
+        toIndex = pToIndices[ix];
+
+        if ((fromIndex < 0) || (fromIndex >= tiles) || (toIndex < 0) || (toIndex >= tiles))
+        {
+            MineDebug_PrintError("Move from %i to %i is off the board\n", (int) fromIndex, (int) toIndex);
+            status = MINE_ERROR_PARAMETER;
+            break;
+        }
+
+        /** A move chosen before the player or an earlier move changed either tile is dropped. */
+        if ((MINE_BOMB_VALUE != gameData.gameBoard[fromIndex]) ||
+            (MINE_TILE_STATUS_NORMAL != gameData.tileStatus[fromIndex]) ||
+            (MINE_BOMB_VALUE == gameData.gameBoard[toIndex]) ||
+            (MINE_TILE_STATUS_NORMAL != gameData.tileStatus[toIndex]))
+        {
+            continue;
+        }
+
+        //The player may have revealed tiles next to the move since it was chosen
+        if (tick.consistent && !MineMovement_KeepsNumbers(&gameData, &tick, fromIndex, toIndex))
+        {
+            movementData.movesInconsistent++;
+            continue;
+        }
+
+        Mine_MoveMine(fromIndex, toIndex);
+
+        //Taking the mine away before adding it again keeps tiles next to both unchanged
+        (void) MineMovement_UpdateNeighbors(fromIndex, -1);
+        (void) MineMovement_UpdateNeighbors(toIndex, 1);
+        gameData.gameBoard[fromIndex] = MineMovement_UpdateNeighbors(fromIndex, 0);
+
+        pFromIndices[*pApplied] = fromIndex;
+        pToIndices[*pApplied] = toIndex;
+        *pApplied += 1;
+    }
+
+    movementData.movesApplied += *pApplied;
+
+    return status;
+}
+
+/**
+    MineMovement_BatchSize
+*//**
+    Work out how many mines each movement tick tries to move.
+
+    @param[in] mines   - Number of mines in the game.
+    @param[in] batch   - Number of mines, or percentage of mines, to move each tick.
+    @param[in] percent - Flag for if batch is a percentage of the mines.
+
+    @return Number of mines to move each tick, from 1 to MINE_MOVEMENT_MAX_BATCH.
+*/
+UINT
+MineMovement_BatchSize(DWORD mines, DWORD batch, BOOLEAN percent)
+{
+    UINT moves = (UINT) batch;
+
+    if (percent)
+    {
+        moves = (UINT) ((((ULONGLONG) mines)*((ULONGLONG) min(batch, 100))) / 100);
+    }
+
+    return max(min(moves, (UINT) MINE_MOVEMENT_MAX_BATCH), 1U);
+}
+
+/**
+    MineMovement_ChooseMoves
+*//**
+    Choose, with specified policy and aggressiveness, up to a batch of mines to
+    move and the tiles to move them to. No mine is chosen twice and no two mines
+    are sent to the same tile. Only the order of the mine list changes, the
+    board itself is left as is.
+
+    @param[in]  pGame          - Board to choose the moves on, the game board or a copy of it.
+    @param[in]  policy         - Movement policy (MINE_MOVEMENT_POLICY_*).
+    @param[in]  aggressiveness - Movement aggressiveness, from 1 to 10.
+    @param[in]  wrapHorz       - Flag for if mines can move across the left and right edges.
+    @param[in]  wrapVert       - Flag for if mines can move across the top and bottom edges.
+    @param[in]  consistent     - Flag for if only moves that leave every revealed number unchanged are chosen.
+    @param[in]  batch          - Most moves to choose, at most MINE_MOVEMENT_MAX_BATCH.
+    @param[out] pFromIndices   - Board indices of the mines to move.
+    @param[out] pToIndices     - Board indices of the tiles to move them to.
+    @param[out] pMoves         - Number of moves chosen, 0 if no mine can move.
+
+    @return Mine error code (MINE_ERROR_SUCCESS upon success).
+*/
+MINE_ERROR
+MineMovement_ChooseMoves(_Inout_ MINE_GAME_SETTINGS* pGame, DWORD policy, DWORD aggressiveness,
+                         BOOLEAN wrapHorz, BOOLEAN wrapVert, BOOLEAN consistent, UINT batch,
+                         _Out_writes_(batch) PLONG pFromIndices, _Out_writes_(batch) PLONG pToIndices,
+                         _Out_ PUINT pMoves)
 {
-    BOOLEAN    bFalse = FALSE;
-    LONG       currentX = -1;
-    LONG       currentY = -1;
-    UINT       directionsToCheck = 0;
-    BOOLEAN    finished = FALSE;
-    HANDLE     hHeap = NULL;
-    UINT       ix = 0;
-    UINT       jx = 0;
+    MINE_ERROR status = MINE_ERROR_SUCCESS;
+
+    /** The policy is picked once per tick, each one gets its own copy of the tick loop. */
+    switch (policy)
+    {
+    case MINE_MOVEMENT_POLICY_FLEE:
+        status = MineMovement_ChooseMovesWith<MINE_MOVEMENT_FLEE>(pGame, aggressiveness, wrapHorz, wrapVert,
+                                                                  consistent, batch, pFromIndices, pToIndices,
+                                                                  pMoves);
+        break;
+    case MINE_MOVEMENT_POLICY_FRONTIER:
+        status = MineMovement_ChooseMovesWith<MINE_MOVEMENT_FRONTIER>(pGame, aggressiveness, wrapHorz, wrapVert,
+                                                                      consistent, batch, pFromIndices, pToIndices,
+                                                                      pMoves);
+        break;
+    case MINE_MOVEMENT_POLICY_LEVY:
+        status = MineMovement_ChooseMovesWith<MINE_MOVEMENT_LEVY>(pGame, aggressiveness, wrapHorz, wrapVert,
+                                                                  consistent, batch, pFromIndices, pToIndices,
+                                                                  pMoves);
+        break;
+    default:
+        status = MineMovement_ChooseMovesWith<MINE_MOVEMENT_WALK>(pGame, aggressiveness, wrapHorz, wrapVert,
+                                                                  consistent, batch, pFromIndices, pToIndices,
+                                                                  pMoves);
+        break;
+    }
+
+    return status;
+}
+
+/**
+    MINE_MOVEMENT_FLEE::Target
+*//**
+    Move the mine to the neighbor with the fewest revealed tiles around it, as
+    long as that is no more than around the mine now.
+
+    @param[in]  pGame  - Board the move is chosen on.
+    @param[in]  pTick  - Settings shared by every mine this tick.
+    @param[in]  index  - Board index of the mine.
+    @param[out] pIndex - Board index of the tile to move to, -1 to stay put.
+
+    @return Mine error code (MINE_ERROR_SUCCESS upon success).
+*/
+MINE_ERROR
+MINE_MOVEMENT_FLEE::Target(_In_ const MINE_GAME_SETTINGS* pGame, _In_ const MINE_MOVEMENT_TICK* pTick,
+                           LONG index, _Out_ PLONG pIndex)
+{
+    UINT bestRevealed = MineMovement_RevealedAround(pGame, pTick, index);
+    UINT kx = 0;
+    LONG newIndex = -1;
+    UINT revealed = 0;
+
+    *pIndex = -1;
+
+    for (kx = 0; kx < pTick->directions; kx++)
+    {
+        newIndex = MineMovement_Step(pGame, pTick, index, pTick->moveOrder[kx], 1);
+        if ((0 <= newIndex) && MineMovement_IsOpen(pGame, newIndex))
+        {
+            revealed = MineMovement_RevealedAround(pGame, pTick, newIndex);
+            if (revealed <= bestRevealed)
+            {
+                bestRevealed = revealed;
+                *pIndex = newIndex;
+            }
+        }
+    }
+
+    return MINE_ERROR_SUCCESS;
+}
+
+/**
+    MINE_MOVEMENT_FRONTIER::Target
+*//**
+    Move the mine to the neighbor with the most revealed tiles around it, as
+    long as that is no fewer than around the mine now, so mines gather along
+    the unflagged edge of the revealed area. Tiles next to a flag are never
+    chosen, and a mine next to a flag moves off to any tile that is not.
+
+    @param[in]  pGame  - Board the move is chosen on.
+    @param[in]  pTick  - Settings shared by every mine this tick.
+    @param[in]  index  - Board index of the mine.
+    @param[out] pIndex - Board index of the tile to move to, -1 to stay put.
+
+    @return Mine error code (MINE_ERROR_SUCCESS upon success).
+*/
+MINE_ERROR
+MINE_MOVEMENT_FRONTIER::Target(_In_ const MINE_GAME_SETTINGS* pGame, _In_ const MINE_MOVEMENT_TICK* pTick,
+                               LONG index, _Out_ PLONG pIndex)
+{
+    UINT bestRevealed = 0;
+    UINT kx = 0;
+    LONG newIndex = -1;
+    UINT revealed = 0;
+
+    *pIndex = -1;
+
+    //A mine already next to a flag is better off anywhere else
+    if (0 == MineMovement_FlaggedAround(pGame, pTick, index))
+    {
+        bestRevealed = MineMovement_RevealedAround(pGame, pTick, index);
+    }
+
+    for (kx = 0; kx < pTick->directions; kx++)
+    {
+        newIndex = MineMovement_Step(pGame, pTick, index, pTick->moveOrder[kx], 1);
+        if ((0 <= newIndex) && MineMovement_IsOpen(pGame, newIndex) &&
+            (0 == MineMovement_FlaggedAround(pGame, pTick, newIndex)))
+        {
+            revealed = MineMovement_RevealedAround(pGame, pTick, newIndex);
+            if (revealed >= bestRevealed)
+            {
+                bestRevealed = revealed;
+                *pIndex = newIndex;
+            }
+        }
+    }
+
+    return MINE_ERROR_SUCCESS;
+}
+
+/**
+    MINE_MOVEMENT_LEVY::Target
+*//**
+    Jump the mine a heavy tailed distance in one of the tick's directions. Most
+    jumps are a tile or two, but one in every n jumps is at least n tiles long.
+
+    @param[in]  pGame  - Board the move is chosen on.
+    @param[in]  pTick  - Settings shared by every mine this tick.
+    @param[in]  index  - Board index of the mine.
+    @param[out] pIndex - Board index of the tile to move to, -1 to stay put.
+
+    @return Mine error code (MINE_ERROR_SUCCESS upon success).
+*/
+MINE_ERROR
+MINE_MOVEMENT_LEVY::Target(_In_ const MINE_GAME_SETTINGS* pGame, _In_ const MINE_MOVEMENT_TICK* pTick,
+                           LONG index, _Out_ PLONG pIndex)
+{
+    LONG       distance = 0;
     UINT       kx = 0;
-    UINT       minesChecked = 0;
-    UINT       minesToCheck = 0;
-    BOOLEAN    mineWillMove = FALSE;
-    LONG       newX = -1;
-    LONG       newY = -1;
-    UINT *     pMoveOrder = NULL;
-    UINT *     pXOrder = NULL;
-    UINT *     pYOrder = NULL;
+    LONG       newIndex = -1;
+    UINT       random = 0;
     MINE_ERROR status = MINE_ERROR_SUCCESS;
-    RECT       windowUpdate = {0};
 
-    do
+    *pIndex = -1;
+
+    status = Mine_Random(MINE_MOVEMENT_LEVY_RANGE, &random);
+    if (MINE_ERROR_SUCCESS != status)
     {
-        hHeap = GetProcessHeap();
-        if (NULL == hHeap)
+        MineDebug_PrintError("In function Mine_Random: %i\n", (int) status);
+    }
+    else
+    {
+        //Chance of a jump of at least n tiles falls off as 1/n
+        distance = (LONG) (MINE_MOVEMENT_LEVY_RANGE / (random + 1));
+        distance = max(min(distance, pTick->reach), 1);
+
+        for (kx = 0; kx < pTick->directions; kx++)
         {
-            MineDebug_PrintError("Getting process heap: %lu\n", GetLastError());
-            status = MINE_ERROR_HEAP;
+            newIndex = MineMovement_Step(pGame, pTick, index, pTick->moveOrder[kx], distance);
+            if ((0 <= newIndex) && MineMovement_IsOpen(pGame, newIndex))
+            {
+                *pIndex = newIndex;
+                break;
+            }
+        }
+    }
+
+    return status;
+}
+
+/**
+    MINE_MOVEMENT_WALK::Target
+*//**
+    Move the mine to the first open neighbor in the tick's random order of
+    directions.
+
+    @param[in]  pGame  - Board the move is chosen on.
+    @param[in]  pTick  - Settings shared by every mine this tick.
+    @param[in]  index  - Board index of the mine.
+    @param[out] pIndex - Board index of the tile to move to, -1 to stay put.
+
+    @return Mine error code (MINE_ERROR_SUCCESS upon success).
+*/
+MINE_ERROR
+MINE_MOVEMENT_WALK::Target(_In_ const MINE_GAME_SETTINGS* pGame, _In_ const MINE_MOVEMENT_TICK* pTick,
+                           LONG index, _Out_ PLONG pIndex)
+{
+    UINT kx = 0;
+    LONG newIndex = -1;
+
+    *pIndex = -1;
+
+    for (kx = 0; kx < pTick->directions; kx++)
+    {
+        newIndex = MineMovement_Step(pGame, pTick, index, pTick->moveOrder[kx], 1);
+        if ((0 <= newIndex) && MineMovement_IsOpen(pGame, newIndex))
+        {
+            *pIndex = newIndex;
             break;
         }
+    }
+
+    return MINE_ERROR_SUCCESS;
+}
+
+/**
+    MineMovement_ChooseMovesWith
+*//**
+    Tick loop of MineMovement_ChooseMoves for one movement policy. POLICY is a
+    type with a static Target function, which picks where one mine moves to,
+    and is inlined here rather than called through a pointer.
+
+    @param[in]  pGame          - Board to choose the moves on, the game board or a copy of it.
+    @param[in]  aggressiveness - Movement aggressiveness, from 1 to 10.
+    @param[in]  wrapHorz       - Flag for if mines can move across the left and right edges.
+    @param[in]  wrapVert       - Flag for if mines can move across the top and bottom edges.
+    @param[in]  consistent     - Flag for if only moves that leave every revealed number unchanged are chosen.
+    @param[in]  batch          - Most moves to choose, at most MINE_MOVEMENT_MAX_BATCH.
+    @param[out] pFromIndices   - Board indices of the mines to move.
+    @param[out] pToIndices     - Board indices of the tiles to move them to.
+    @param[out] pMoves         - Number of moves chosen, 0 if no mine can move.
+
+    @return Mine error code (MINE_ERROR_SUCCESS upon success).
+*/
+template <typename POLICY>
+MINE_ERROR
+MineMovement_ChooseMovesWith(_Inout_ MINE_GAME_SETTINGS* pGame, DWORD aggressiveness, BOOLEAN wrapHorz,
+                             BOOLEAN wrapVert, BOOLEAN consistent, UINT batch,
+                             _Out_writes_(batch) PLONG pFromIndices, _Out_writes_(batch) PLONG pToIndices,
+                             _Out_ PUINT pMoves)
+{
+    BOOLEAN            bFalse = FALSE;
+    LONG               currentIndex = -1;
+    UINT               ix = 0;
+    UINT               minesToCheck = 0;
+    LONG               newIndex = -1;
+    UINT               pick = 0;
+    MINE_ERROR         status = MINE_ERROR_SUCCESS;
+    MINE_MOVEMENT_TICK tick = {0};
 
+    *pMoves = 0;
+
+    do
+    {
         /** The more aggressive, the more directions of movement will be checked. */
-        switch (menuData.movementAggressive)
+        switch (aggressiveness)
         {
         case 1:
         case 2:
-            directionsToCheck = 2;
+            tick.directions = 2;
             break;
         case 3:
         case 4:
         case 5:
-            directionsToCheck = 4;
+            tick.directions = 4;
             break;
         case 6:
         case 7:
         case 8:
-            directionsToCheck = 6;
+            tick.directions = 6;
             break;
         case 9:
         case 10:
-            directionsToCheck = 8;
+            tick.directions = 8;
             break;
         default:
             __assume(0);
             break;
         }
 
-        /** The more aggressive, the more mines will try to move. */
-        minesToCheck = ((UINT) gameData.mines) * ((UINT) menuData.movementAggressive) / 10;
+        tick.reach = (LONG) max(pGame->width, pGame->height);
+        tick.wrapHorz = wrapHorz;
+        tick.wrapVert = wrapVert;
+        tick.consistent = consistent;
+
+        /** The more aggressive, the more mines will try to move. At least a batch always tries. */
+        minesToCheck = max(((UINT) pGame->mines) * ((UINT) aggressiveness) / 10, batch);
+        minesToCheck = min(minesToCheck, (UINT) pGame->mines);
 
-        pXOrder = (UINT *) HeapAlloc(hHeap, 0, gameData.width*sizeof(UINT));
-        if (NULL == pXOrder)
+        for (ix = 0; ix < 8; ix++)
         {
-            MineDebug_PrintError("Unable to allocate memory\n");
-            status = MINE_ERROR_MEMORY;
-            break;
+            tick.moveOrder[ix] = ix;
         }
 
-        pYOrder = (UINT *) HeapAlloc(hHeap, 0, gameData.height*sizeof(UINT));
-        if (NULL == pYOrder)
+        status = Mine_RandomPerm(tick.moveOrder, 8, tick.directions);
+        if (MINE_ERROR_SUCCESS != status)
         {
-            MineDebug_PrintError("Unable to allocate memory\n");
-            status = MINE_ERROR_MEMORY;
+            MineDebug_PrintError("In function Mine_RandomPerm: %i\n", (int) status);
             break;
         }
 
-        pMoveOrder = (UINT *) HeapAlloc(hHeap, 0, 8*sizeof(UINT));
-        if (NULL == pMoveOrder)
+        /** Check mines in a random order, drawn straight from the list of mine positions. */
+        //Each pick swaps a random unchecked mine to the front of the list, so every
+        //mine is equally likely to be checked and only the mines checked are touched
+        for (ix = 0; (ix < minesToCheck) && (*pMoves < batch); ix++)
         {
-            MineDebug_PrintError("Unable to allocate memory\n");
-            status = MINE_ERROR_MEMORY;
-            break;
+            status = Mine_Random((UINT) pGame->mines - ix, &pick);
+            if (MINE_ERROR_SUCCESS != status)
+            {
+                MineDebug_PrintError("In function Mine_Random: %i\n", (int) status);
+                break;
+            }
+
+            pick += ix;
+            currentIndex = pGame->mineTiles[pick];
+            pGame->mineTiles[pick] = pGame->mineTiles[ix];
+            pGame->mineTiles[ix] = currentIndex;
+            pGame->mineSlots[pGame->mineTiles[pick]] = (LONG) pick;
+            pGame->mineSlots[currentIndex] = (LONG) ix;
+
+            //Only check tiles that are not flagged or currently held down
+            if (MINE_TILE_STATUS_NORMAL != pGame->tileStatus[currentIndex])
+            {
+                continue;
+            }
+
+            status = POLICY::Target(pGame, &tick, currentIndex, &newIndex);
+            if (MINE_ERROR_SUCCESS != status)
+            {
+                break;
+            }
+
+            //A mine that cannot move without changing a revealed number stays put
+            if ((0 <= newIndex) && tick.consistent &&
+                !MineMovement_KeepsNumbers(pGame, &tick, currentIndex, newIndex))
+            {
+                newIndex = -1;
+            }
+
+            //A tile taken by an earlier move in the batch is marked in mineSlots
+            if (0 <= newIndex)
+            {
+                pFromIndices[*pMoves] = currentIndex;
+                pToIndices[*pMoves] = newIndex;
+                pGame->mineSlots[newIndex] = -2;
+                *pMoves += 1;
+            }
         }
 
-        for (ix = 0; ix < gameData.width; ix++)
+        /** Give back the tiles taken during the batch. */
+        for (ix = 0; ix < *pMoves; ix++)
         {
-            pXOrder[ix] = ix;
+            pGame->mineSlots[pToIndices[ix]] = -1;
         }
 
-        for (ix = 0; ix < gameData.height; ix++)
+        __assume(FALSE == bFalse);
+    } while (bFalse);
+
+    return status;
+}
+
+/**
+    MineMovement_FlaggedAround
+*//**
+    Count the flagged tiles around a tile, across wrapped edges where the
+    board wraps.
+
+    @param[in] pGame - Board the move is chosen on.
+    @param[in] pTick - Settings shared by every mine this tick.
+    @param[in] index - Board index of the tile.
+
+    @return Number of flagged neighbors, from 0 to 8.
+*/
+UINT
+MineMovement_FlaggedAround(_In_ const MINE_GAME_SETTINGS* pGame, _In_ const MINE_MOVEMENT_TICK* pTick, LONG index)
+{
+    UINT direction = 0;
+    UINT flagged = 0;
+    LONG neighbor = -1;
+
+    for (direction = 0; direction < 8; direction++)
+    {
+        neighbor = MineMovement_Step(pGame, pTick, index, direction, 1);
+        if ((0 <= neighbor) && (MINE_TILE_STATUS_FLAG == pGame->tileStatus[neighbor]))
         {
-            pYOrder[ix] = ix;
+            flagged++;
         }
+    }
 
-        for (ix = 0; ix < 8; ix++)
+    return flagged;
+}
+
+/**
+    MineMovement_IsOpen
+*//**
+    Check if a mine can move onto a tile: it holds no mine, is not revealed,
+    flagged or held down, and no earlier move in the batch is headed there.
+
+    @param[in] pGame - Board the move is chosen on.
+    @param[in] index - Board index of the tile.
+
+    @return TRUE if a mine can move onto the tile, FALSE otherwise.
+*/
+BOOLEAN
+MineMovement_IsOpen(_In_ const MINE_GAME_SETTINGS* pGame, LONG index)
+{
+    return ((MINE_BOMB_VALUE != pGame->gameBoard[index]) &&
+            (MINE_TILE_STATUS_NORMAL == pGame->tileStatus[index]) &&
+            (-1 == pGame->mineSlots[index])) ? (BOOLEAN) TRUE : (BOOLEAN) FALSE;
+}
+
+/**
+    MineMovement_KeepsNumbers
+*//**
+    Check if a move leaves every revealed number unchanged. Only tiles next to
+    one end of the move and not the other change, so just the two 3x3 blocks
+    around the ends are looked at, however many tiles are revealed.
+
+    @param[in] pGame     - Board the move is checked on.
+    @param[in] pTick     - Settings shared by every mine this tick.
+    @param[in] fromIndex - Board index of the mine.
+    @param[in] toIndex   - Board index of the tile it moves to.
+
+    @return TRUE if no revealed number changes, FALSE otherwise.
+*/
+BOOLEAN
+MineMovement_KeepsNumbers(_In_ const MINE_GAME_SETTINGS* pGame, _In_ const MINE_MOVEMENT_TICK* pTick,
+                          LONG fromIndex, LONG toIndex)
+{
+    UINT    direction = 0;
+    BOOLEAN keeps = TRUE;
+    LONG    neighbor = -1;
+
+    //Directions 0 to 7 walk around the mine, 8 to 15 around the tile it moves to
+    for (direction = 0; keeps && (direction < 16); direction++)
+    {
+        neighbor = MineMovement_Step(pGame, pTick, (8 > direction) ? fromIndex : toIndex, direction % 8, 1);
+        if ((0 > neighbor) || (MINE_TILE_STATUS_REVEALED != pGame->tileStatus[neighbor]))
         {
-            pMoveOrder[ix] = ix;
+            continue;
         }
 
-        /** Try to moves mines based on a random order of the X coordinate. */
-        status = Mine_RandomPerm(pXOrder, (UINT) gameData.width, (UINT) gameData.width);
-        if (MINE_ERROR_SUCCESS != status)
+        /** A revealed tile keeps its number if it is next to both ends equally often. */
+        if (MineMovement_NeighborCount(pGame, pTick, fromIndex, neighbor) !=
+            MineMovement_NeighborCount(pGame, pTick, toIndex, neighbor))
         {
-            MineDebug_PrintError("In function Mine_RandomPerm: %i\n", (int) status);
-            break;
+            keeps = FALSE;
         }
+    }
 
-        /** Try to move mines based on a random order of the Y coordinate. */
-        status = Mine_RandomPerm(pYOrder, (UINT) gameData.height, (UINT) gameData.height);
-        if (MINE_ERROR_SUCCESS != status)
+    return keeps;
+}
+
+/**
+    MineMovement_NeighborCount
+*//**
+    Count how many times a tile is next to another. Across wrapped edges of a
+    board one or two tiles wide, a tile can be next to another more than once.
+
+    @param[in] pGame - Board the move is checked on.
+    @param[in] pTick - Settings shared by every mine this tick.
+    @param[in] index - Board index of the tile in the middle.
+    @param[in] tile  - Board index of the tile to look for.
+
+    @return Number of directions in which tile is next to index, from 0 to 8.
+*/
+UINT
+MineMovement_NeighborCount(_In_ const MINE_GAME_SETTINGS* pGame, _In_ const MINE_MOVEMENT_TICK* pTick,
+                           LONG index, LONG tile)
+{
+    UINT count = 0;
+    UINT direction = 0;
+    LONG height = (LONG) pGame->height;
+    LONG width = (LONG) pGame->width;
+    LONG xDistance = labs((tile % width) - (index % width));
+    LONG yDistance = labs((tile / width) - (index / width));
+
+    if ((3 <= width) && (3 <= height))
+    {
+        //Every neighbor is a different tile, so the tiles only need to be close
+        xDistance = pTick->wrapHorz ? min(xDistance, width - xDistance) : xDistance;
+        yDistance = pTick->wrapVert ? min(yDistance, height - yDistance) : yDistance;
+
+        count = ((tile != index) && (1 >= xDistance) && (1 >= yDistance)) ? 1 : 0;
+    }
+    else
+    {
+        for (direction = 0; direction < 8; direction++)
         {
-            MineDebug_PrintError("In function Mine_RandomPerm: %i\n", (int) status);
-            break;
+            if (tile == MineMovement_Step(pGame, pTick, index, direction, 1))
+            {
+                count++;
+            }
         }
+    }
 
-        status = Mine_RandomPerm(pMoveOrder, 8, directionsToCheck);
-        if (MINE_ERROR_SUCCESS != status)
+    return count;
+}
+
+/**
+    MineMovement_ProcessMovement
+*//**
+    Attempt, with specified policy and aggressiveness, to move a batch of mines
+    on the game board, without going through the movement thread.
+
+    @return Mine error code (MINE_ERROR_SUCCESS upon success).
+*/
+MINE_ERROR
+MineMovement_ProcessMovement(VOID)
+{
+    UINT       applied = 0;
+    UINT       batch = 0;
+    LONG       fromIndices[MINE_MOVEMENT_MAX_BATCH] = {0};
+    UINT       moves = 0;
+    MINE_ERROR status = MINE_ERROR_SUCCESS;
+    LONG       toIndices[MINE_MOVEMENT_MAX_BATCH] = {0};
+
+    movementData.ticks++;
+
+    batch = MineMovement_BatchSize(gameData.mines, menuData.movementBatch, (BOOLEAN) menuData.movementBatchPercent);
+
+    status = MineMovement_ChooseMoves(&gameData, menuData.movementPolicy, menuData.movementAggressive,
+                                      (BOOLEAN) menuData.wrapHorz, (BOOLEAN) menuData.wrapVert,
+                                      (BOOLEAN) menuData.movementConsistent, batch, fromIndices, toIndices, &moves);
+    if (MINE_ERROR_SUCCESS != status)
+    {
+        MineDebug_PrintError("In function MineMovement_ChooseMoves: %i\n", (int) status);
+    }
+    else if (0 < moves)
+    {
+        movementData.movesChosen += moves;
+
+        status = MineMovement_ApplyMoves(fromIndices, toIndices, moves, (BOOLEAN) menuData.movementConsistent,
+                                         &applied);
+    }
+
+    return status;
+}
+
+/**
+    MineMovement_RevealedAround
+*//**
+    Count the revealed tiles around a tile, across wrapped edges where the
+    board wraps.
+
+    @param[in] pGame - Board the move is chosen on.
+    @param[in] pTick - Settings shared by every mine this tick.
+    @param[in] index - Board index of the tile.
+
+    @return Number of revealed neighbors, from 0 to 8.
+*/
+UINT
+MineMovement_RevealedAround(_In_ const MINE_GAME_SETTINGS* pGame, _In_ const MINE_MOVEMENT_TICK* pTick, LONG index)
+{
+    UINT direction = 0;
+    LONG neighbor = -1;
+    UINT revealed = 0;
+
+    for (direction = 0; direction < 8; direction++)
+    {
+        neighbor = MineMovement_Step(pGame, pTick, index, direction, 1);
+        if ((0 <= neighbor) && (MINE_TILE_STATUS_REVEALED == pGame->tileStatus[neighbor]))
         {
-            MineDebug_PrintError("In function Mine_RandomPerm: %i\n", (int) status);
-            break;
+            revealed++;
         }
+    }
 
-        /** Check mines a random column at a time, randomly amongst each column. */
-        //This might make it slightly more likely that a specific mine that is in a column
-        //by itself will move versus a mine in a column with other mines. This slight
-        //imbalance is not large enough to justify a more complicated randomness scheme.
-        for (ix = 0; ix < gameData.width; ix++)
-        {
-            for (jx = 0; jx < gameData.height; jx++)
-            {
-                //Only check tiles that contain mines
-                if (MINE_BOMB_VALUE != gameData.gameBoard[MINE_INDEX(pXOrder[ix], pYOrder[jx])])
-                {
-                    continue;
-                }
+    return revealed;
+}
 
-                minesChecked++;
+/**
+    MineMovement_Step
+*//**
+    Find the tile a number of tiles away from another in one of the eight
+    directions, wrapping around the edges where the board wraps.
 
-                //Only check tiles that are not flagged or currently held down
-                if (MINE_TILE_STATUS_NORMAL != gameData.tileStatus[MINE_INDEX(pXOrder[ix], pYOrder[jx])])
-                {
-                    continue;
-                }
+    @param[in] pGame     - Board the move is chosen on.
+    @param[in] pTick     - Settings shared by every mine this tick.
+    @param[in] index     - Board index of the tile to start from.
+    @param[in] direction - Direction to step in, from 0 (up and left) to 7 (down and right).
+    @param[in] distance  - Number of tiles to step.
 
-                currentX = (LONG) pXOrder[ix];
-                currentY = (LONG) pYOrder[jx];
-                //Check if the current mine can move in one of the random directions.
-                for (kx = 0; kx < directionsToCheck; kx++)
-                {
-                    switch (pMoveOrder[kx])
-                    {
-                    case 0:
-                        newX = currentX - 1;
-                        newY = currentY - 1;
-                        break;
-                    case 1:
-                        newX = currentX;
-                        newY = currentY - 1;
-                        break;
-                    case 2:
-                        newX = currentX + 1;
-                        newY = currentY - 1;
-                        break;
-                    case 3:
-                        newX = currentX - 1;
-                        newY = currentY;
-                        break;
-                    case 4:
-                        newX = currentX + 1;
-                        newY = currentY;
-                        break;
-                    case 5:
-                        newX = currentX - 1;
-                        newY = currentY + 1;
-                        break;
-                    case 6:
-                        newX = currentX;
-                        newY = currentY + 1;
-                        break;
-                    case 7:
-                        newX = currentX + 1;
-                        newY = currentY + 1;
-                        break;
-                    default:
-                        __assume(0);
-                        break;
-                    }
-
-                    //If wrapHorz flag is set, allow mine to move across horizontal boundary
-                    if (newX < 0)
-                    {
-                        if (menuData.wrapHorz)
-                        {
-                            newX = (LONG) gameData.width - 1;
-                        }
-                        else
-                        {
-                            continue;
-                        }
-                    }
-                    else if (newX >= (LONG) gameData.width)
-                    {
-                        if (menuData.wrapHorz)
-                        {
-                            newX = 0;
-                        }
-                        else
-                        {
-                            continue;
-                        }
-                    }
-
-                    //If wrap vert flag is set, allow mine to move across vertical boundary
-                    if (newY < 0)
-                    {
-                        if (menuData.wrapVert)
-                        {
-                            newY = (LONG) gameData.height - 1;
-                        }
-                        else
-                        {
-                            continue;
-                        }
-                    }
-                    else if (newY >= (LONG) gameData.height)
-                    {
-                        if (menuData.wrapVert)
-                        {
-                            newY = 0;
-                        }
-                        else
-                        {
-                            continue;
-                        }
-                    }
-
-                    /** Check if the mine can move to the tile in the randomly chosen direction. */
-                    if ((MINE_BOMB_VALUE != gameData.gameBoard[MINE_INDEX(newX, newY)]) &&
-                        (MINE_TILE_STATUS_NORMAL == gameData.tileStatus[MINE_INDEX(newX, newY)]))
-                    {
-                        mineWillMove = TRUE;
-                        finished = TRUE;
-                        break;
-                    }
-
-                    //Stop checking after limit has been reached
-                    if (minesChecked >= minesToCheck)
-                    {
-                        finished = TRUE;
-                        break;
-                    }
-                }
-                if (finished)
-                {
-                    break;
-                }
-            }
-            if (finished)
+    @return Board index of the tile, -1 if the step leaves a board that does not wrap.
+*/
+LONG
+MineMovement_Step(_In_ const MINE_GAME_SETTINGS* pGame, _In_ const MINE_MOVEMENT_TICK* pTick,
+                  LONG index, UINT direction, LONG distance)
+{
+    static const LONG xSteps[8] = {-1, 0, 1, -1, 1, -1, 0, 1};
+    static const LONG ySteps[8] = {-1, -1, -1, 0, 0, 1, 1, 1};
+    LONG              height = (LONG) pGame->height;
+    LONG              newIndex = -1;
+    LONG              width = (LONG) pGame->width;
+    LONG              xGrid = (index % width) + xSteps[direction]*distance;
+    LONG              yGrid = (index / width) + ySteps[direction]*distance;
+
+    //A step off an edge that does not wrap goes nowhere
+    if ((xGrid < 0) || (xGrid >= width))
+    {
+        xGrid = pTick->wrapHorz ? (((xGrid % width) + width) % width) : -1;
+    }
+
+    if ((yGrid < 0) || (yGrid >= height))
+    {
+        yGrid = pTick->wrapVert ? (((yGrid % height) + height) % height) : -1;
+    }
+
+    if ((0 <= xGrid) && (0 <= yGrid))
+    {
+        newIndex = xGrid + yGrid*width;
+    }
+
+    return newIndex;
+}
+
+/**
+    MineMovement_UpdateNeighbors
+*//**
+    Add to the number on every tile around a tile that is not a mine, and mark
+    the tile and its neighbors to be redrawn. Neighbors across a wrapped edge
+    are counted as many times as Mine_AssignNumbers counts them.
+
+    @param[in] index - Board index of the tile.
+    @param[in] delta - Amount to add to each neighbor, 0 to only count.
+
+    @return Number of mines around the tile.
+*/
+CHAR
+MineMovement_UpdateNeighbors(LONG index, CHAR delta)
+{
+    LONG    ix = 0;
+    LONG    jx = 0;
+    CHAR    mines = 0;
+    LONG    neighbor = 0;
+    BOOLEAN wrapped = FALSE;
+    LONG    xGrid = index % (LONG) gameData.width;
+    LONG    xGridPos = 0;
+    LONG    yGrid = index / (LONG) gameData.width;
+    LONG    yGridPos = 0;
+
+    for (ix = -1; ix <= 1; ix++)
+    {
+        for (jx = -1; jx <= 1; jx++)
+        {
+            if ((0 == ix) && (0 == jx))
             {
-                break;
+                continue;
             }
-        }
 
-        if (mineWillMove)
-        {
-            gameData.gameBoard[MINE_INDEX(currentX, currentY)] = 0;
-            gameData.gameBoard[MINE_INDEX(newX, newY)] = MINE_BOMB_VALUE;
+            xGridPos = xGrid + ix;
+            yGridPos = yGrid + jx;
+            wrapped = FALSE;
 
-            /** If mine moved, update screen to reflect new tile numbers. */
-            if ((menuData.wrapHorz && ((min(currentX - 1, newX - 1) < 0) || 
-                                       (max(currentX + 1, newX + 1) > (LONG) gameData.width - 1 ))) ||
-                (menuData.wrapVert && ((min(currentY - 1, newY - 1) < 0) || 
-                                       (max(currentY + 1, newY + 1) > (LONG) gameData.height - 1))))
+            if ((xGridPos < 0) || (xGridPos >= (LONG) gameData.width))
             {
-                //In the case of wrapping and mines moving near borders, simplify by updating entire board
-                status = Mine_AssignNumbers(0, (LONG) gameData.width - 1, 0, (LONG) gameData.height - 1);
-                if (MINE_ERROR_SUCCESS != status)
+                if (!menuData.wrapHorz)
                 {
-                    MineDebug_PrintError("In function Mine_AssignNumbers: %i\n", (int) status);
-                    break;
-                }
-
-                if (0 == InvalidateRect(hwnd, &(windowData.boardRegion), FALSE))
-                {
-                    MineDebug_PrintWarning("Unable to invalidate rectangle\n");
+                    continue;
                 }
+                xGridPos = (xGridPos < 0) ? ((LONG) gameData.width - 1) : 0;
+                wrapped = TRUE;
             }
-            else
+
+            if ((yGridPos < 0) || (yGridPos >= (LONG) gameData.height))
             {
-                //Otherwise, only update affected region
-                status = Mine_AssignNumbers(max(min(currentX - 1, newX - 1), 0),
-                                            min(max(currentX + 1, newX + 1), (LONG) gameData.width - 1),
-                                            max(min(currentY - 1, newY - 1), 0),
-                                            min(max(currentY + 1, newY + 1), (LONG) gameData.height - 1));
-                
-                windowUpdate.left = max(min(currentX - 1, newX - 1), 0) * MINE_TILE_PIXELS + 
-                                    windowData.boardRegion.left;
-                windowUpdate.right = min(max(currentX + 2, newX + 2), (LONG) gameData.width) * MINE_TILE_PIXELS +
-                                     windowData.boardRegion.left;
-                windowUpdate.top = max(min(currentY - 1, newY - 1), 0) * MINE_TILE_PIXELS +
-                                   windowData.boardRegion.top;
-                windowUpdate.bottom = min(max(currentY + 2, newY + 2), (LONG) gameData.height) * MINE_TILE_PIXELS +
-                                      windowData.boardRegion.top;
-
-                if (0 == InvalidateRect(hwnd, &windowUpdate, FALSE))
+                if (!menuData.wrapVert)
                 {
-                    MineDebug_PrintWarning("Unable to invalidate rectangle\n");
+                    continue;
                 }
+                yGridPos = (yGridPos < 0) ? ((LONG) gameData.height - 1) : 0;
+                wrapped = TRUE;
             }
-        }
 
-        __assume(FALSE == bFalse);
-    } while (bFalse);
+            neighbor = MINE_INDEX(xGridPos, yGridPos);
+            movementData.neighborsVisited++;
 
-    //Clean up
-    if (NULL != hHeap)
-    {
-        if (NULL != pXOrder)
-        {
-            if (0 == HeapFree(hHeap, 0, pXOrder))
+            if (MINE_BOMB_VALUE == gameData.gameBoard[neighbor])
             {
-                MineDebug_PrintWarning("Unable to free pXOrder: %lu\n", GetLastError());
+                mines++;
             }
-            pXOrder = NULL;
-        }
-
-        if (NULL != pYOrder)
-        {
-            if (0 != HeapFree(hHeap, 0, pYOrder))
+            else if (0 != delta)
             {
-                MineDebug_PrintWarning("Unable to free pYOrder: %lu\n", GetLastError());
-            }
-            pYOrder = NULL;
-        }
+                gameData.gameBoard[neighbor] += delta;
+                movementData.numbersChanged++;
 
-        if (NULL != pMoveOrder)
-        {
-            if (0 != HeapFree(hHeap, 0, pMoveOrder))
-            {
-                MineDebug_PrintWarning("Unable to free pMoveOrder: %lu\n", GetLastError());
+                //Neighbors inside the board are covered by the block below
+                if (wrapped)
+                {
+                    MineDamage_AddGrid(xGridPos, xGridPos, yGridPos, yGridPos);
+                }
             }
-            pMoveOrder = NULL;
         }
     }
 
-    return status;
-}
\ No newline at end of file
+    if (0 != delta)
+    {
+        MineDamage_AddGrid(max(xGrid - 1, 0), min(xGrid + 1, (LONG) gameData.width - 1),
+                           max(yGrid - 1, 0), min(yGrid + 1, (LONG) gameData.height - 1));
+    }
+
+    return mines;
+}
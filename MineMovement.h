@@ -3,7 +3,7 @@
 
     @author Craig Burkhart
 
-    @brief Header file for the movement dialog window.
+    @brief Header file for mine movement, its policies and the movement dialog window.
 *//*
     Copyright (C) 2014 - Craig Burkhart
     
@@ -26,6 +26,261 @@
 
 #include "Mine.h"
 
+//--------------------------------------------------------------
+//    Macros
+//--------------------------------------------------------------
+
+/** Number of jump lengths a Levy flight draws from, also the longest jump before clamping. */
+#define MINE_MOVEMENT_LEVY_RANGE 65536
+
+//--------------------------------------------------------------
+//    Structures
+//--------------------------------------------------------------
+
+struct _MINE_MOVEMENT_TICK
+{
+    /** Directions (0 to 7) in random order, the first directions of which are checked. */
+    UINT    moveOrder[8];
+    /** Number of directions checked for each mine. */
+    UINT    directions;
+    /** Longest jump (in tiles) a mine can make. */
+    LONG    reach;
+    /** Flag for if mines can move across the left and right edges. */
+    BOOLEAN wrapHorz;
+    /** Flag for if mines can move across the top and bottom edges. */
+    BOOLEAN wrapVert;
+    /** Flag for if only moves that leave every revealed number unchanged are made. */
+    BOOLEAN consistent;
+};
+
+struct _MINE_MOVEMENT_DATA
+{
+    /** Number of movement ticks run on the game board without the movement thread. */
+    ULONGLONG ticks;
+    /** Number of moves chosen by those ticks. */
+    ULONGLONG movesChosen;
+    /** Number of moves made on the game board. */
+    ULONGLONG movesApplied;
+    /** Number of moves dropped because tiles revealed since they were chosen made them
+        change a revealed number. */
+    ULONGLONG movesInconsistent;
+    /** Number of neighboring tiles read while updating numbers. */
+    ULONGLONG neighborsVisited;
+    /** Number of tile numbers changed by one. */
+    ULONGLONG numbersChanged;
+};
+
+//--------------------------------------------------------------
+//    Typedefs
+//--------------------------------------------------------------
+
+/** Settings shared by every mine in one movement tick. */
+typedef struct _MINE_MOVEMENT_TICK MINE_MOVEMENT_TICK;
+
+/** Counts of the work mine movement has done. */
+typedef struct _MINE_MOVEMENT_DATA MINE_MOVEMENT_DATA;
+
+//--------------------------------------------------------------
+//    Global Variable Externs
+//--------------------------------------------------------------
+
+extern MINE_MOVEMENT_DATA movementData;
+
+//--------------------------------------------------------------
+//    Policies
+//--------------------------------------------------------------
+
+//Each policy is a type with a static Target function, handed to
+//MineMovement_ChooseMovesWith as a template parameter
+
+struct _MINE_MOVEMENT_FLEE
+{
+    /**
+        MINE_MOVEMENT_FLEE::Target
+    *//**
+        Move the mine to the neighbor with the fewest revealed tiles around it, as
+        long as that is no more than around the mine now.
+
+        @param[in]  pGame  - Board the move is chosen on.
+        @param[in]  pTick  - Settings shared by every mine this tick.
+        @param[in]  index  - Board index of the mine.
+        @param[out] pIndex - Board index of the tile to move to, -1 to stay put.
+
+        @return Mine error code (MINE_ERROR_SUCCESS upon success).
+    */
+    static MINE_ERROR
+    Target(_In_ const MINE_GAME_SETTINGS* pGame, _In_ const MINE_MOVEMENT_TICK* pTick,
+           LONG index, _Out_ PLONG pIndex);
+};
+
+struct _MINE_MOVEMENT_FRONTIER
+{
+    /**
+        MINE_MOVEMENT_FRONTIER::Target
+    *//**
+        Move the mine to the neighbor with the most revealed tiles around it, as
+        long as that is no fewer than around the mine now, so mines gather along
+        the unflagged edge of the revealed area. Tiles next to a flag are never
+        chosen, and a mine next to a flag moves off to any tile that is not.
+
+        @param[in]  pGame  - Board the move is chosen on.
+        @param[in]  pTick  - Settings shared by every mine this tick.
+        @param[in]  index  - Board index of the mine.
+        @param[out] pIndex - Board index of the tile to move to, -1 to stay put.
+
+        @return Mine error code (MINE_ERROR_SUCCESS upon success).
+    */
+    static MINE_ERROR
+    Target(_In_ const MINE_GAME_SETTINGS* pGame, _In_ const MINE_MOVEMENT_TICK* pTick,
+           LONG index, _Out_ PLONG pIndex);
+};
+
+struct _MINE_MOVEMENT_LEVY
+{
+    /**
+        MINE_MOVEMENT_LEVY::Target
+    *//**
+        Jump the mine a heavy tailed distance in one of the tick's directions. Most
+        jumps are a tile or two, but one in every n jumps is at least n tiles long.
+
+        @param[in]  pGame  - Board the move is chosen on.
+        @param[in]  pTick  - Settings shared by every mine this tick.
+        @param[in]  index  - Board index of the mine.
+        @param[out] pIndex - Board index of the tile to move to, -1 to stay put.
+
+        @return Mine error code (MINE_ERROR_SUCCESS upon success).
+    */
+    static MINE_ERROR
+    Target(_In_ const MINE_GAME_SETTINGS* pGame, _In_ const MINE_MOVEMENT_TICK* pTick,
+           LONG index, _Out_ PLONG pIndex);
+};
+
+struct _MINE_MOVEMENT_WALK
+{
+    /**
+        MINE_MOVEMENT_WALK::Target
+    *//**
+        Move the mine to the first open neighbor in the tick's random order of
+        directions.
+
+        @param[in]  pGame  - Board the move is chosen on.
+        @param[in]  pTick  - Settings shared by every mine this tick.
+        @param[in]  index  - Board index of the mine.
+        @param[out] pIndex - Board index of the tile to move to, -1 to stay put.
+
+        @return Mine error code (MINE_ERROR_SUCCESS upon success).
+    */
+    static MINE_ERROR
+    Target(_In_ const MINE_GAME_SETTINGS* pGame, _In_ const MINE_MOVEMENT_TICK* pTick,
+           LONG index, _Out_ PLONG pIndex);
+};
+
+/** Movement policy that moves mines away from revealed tiles. */
+typedef struct _MINE_MOVEMENT_FLEE MINE_MOVEMENT_FLEE;
+
+/** Movement policy that moves mines toward the unflagged edge of the revealed area. */
+typedef struct _MINE_MOVEMENT_FRONTIER MINE_MOVEMENT_FRONTIER;
+
+/** Movement policy that jumps mines heavy tailed distances. */
+typedef struct _MINE_MOVEMENT_LEVY MINE_MOVEMENT_LEVY;
+
+/** Movement policy that moves mines one tile in a random direction. */
+typedef struct _MINE_MOVEMENT_WALK MINE_MOVEMENT_WALK;
+
+//--------------------------------------------------------------
+//    Function Prototypes
+//--------------------------------------------------------------
+
+/**
+    MineMovement_ApplyMoves
+*//**
+    Make a batch of moves on the game board. Each move is checked against the
+    board as the moves before it left it, moves that no longer fit are dropped.
+    The numbers around each move are changed by one rather than counted again,
+    so the cost is the same wherever on the board the mines are.
+
+    @param[in,out] pFromIndices - Board indices of the mines to move, the moves
+                                  made are moved to the front.
+    @param[in,out] pToIndices   - Board indices of the tiles to move them to, in
+                                  the same order as pFromIndices.
+    @param[in]     moves        - Number of moves in the batch.
+    @param[in]     consistent   - Flag for if moves that change a revealed number are dropped.
+    @param[out]    pApplied     - Number of moves made, at the front of both arrays.
+
+    @return Mine error code (MINE_ERROR_SUCCESS upon success).
+*/
+MINE_ERROR
+MineMovement_ApplyMoves(_Inout_updates_(moves) PLONG pFromIndices, _Inout_updates_(moves) PLONG pToIndices,
+                        UINT moves, BOOLEAN consistent, _Out_ PUINT pApplied);
+
+/**
+    MineMovement_BatchSize
+*//**
+    Work out how many mines each movement tick tries to move.
+
+    @param[in] mines   - Number of mines in the game.
+    @param[in] batch   - Number of mines, or percentage of mines, to move each tick.
+    @param[in] percent - Flag for if batch is a percentage of the mines.
+
+    @return Number of mines to move each tick, from 1 to MINE_MOVEMENT_MAX_BATCH.
+*/
+UINT
+MineMovement_BatchSize(DWORD mines, DWORD batch, BOOLEAN percent);
+
+/**
+    MineMovement_ChooseMoves
+*//**
+    Choose, with specified policy and aggressiveness, up to a batch of mines to
+    move and the tiles to move them to. No mine is chosen twice and no two mines
+    are sent to the same tile. Only the order of the mine list changes, the
+    board itself is left as is.
+
+    @param[in]  pGame          - Board to choose the moves on, the game board or a copy of it.
+    @param[in]  policy         - Movement policy (MINE_MOVEMENT_POLICY_*).
+    @param[in]  aggressiveness - Movement aggressiveness, from 1 to 10.
+    @param[in]  wrapHorz       - Flag for if mines can move across the left and right edges.
+    @param[in]  wrapVert       - Flag for if mines can move across the top and bottom edges.
+    @param[in]  consistent     - Flag for if only moves that leave every revealed number unchanged are chosen.
+    @param[in]  batch          - Most moves to choose, at most MINE_MOVEMENT_MAX_BATCH.
+    @param[out] pFromIndices   - Board indices of the mines to move.
+    @param[out] pToIndices     - Board indices of the tiles to move them to.
+    @param[out] pMoves         - Number of moves chosen, 0 if no mine can move.
+
+    @return Mine error code (MINE_ERROR_SUCCESS upon success).
+*/
+MINE_ERROR
+MineMovement_ChooseMoves(_Inout_ MINE_GAME_SETTINGS* pGame, DWORD policy, DWORD aggressiveness,
+                         BOOLEAN wrapHorz, BOOLEAN wrapVert, BOOLEAN consistent, UINT batch,
+                         _Out_writes_(batch) PLONG pFromIndices, _Out_writes_(batch) PLONG pToIndices,
+                         _Out_ PUINT pMoves);
+
+/**
+    MineMovement_ChooseMovesWith
+*//**
+    Tick loop of MineMovement_ChooseMoves for one movement policy. POLICY is a
+    type with a static Target function, which picks where one mine moves to,
+    and is inlined here rather than called through a pointer.
+
+    @param[in]  pGame          - Board to choose the moves on, the game board or a copy of it.
+    @param[in]  aggressiveness - Movement aggressiveness, from 1 to 10.
+    @param[in]  wrapHorz       - Flag for if mines can move across the left and right edges.
+    @param[in]  wrapVert       - Flag for if mines can move across the top and bottom edges.
+    @param[in]  consistent     - Flag for if only moves that leave every revealed number unchanged are chosen.
+    @param[in]  batch          - Most moves to choose, at most MINE_MOVEMENT_MAX_BATCH.
+    @param[out] pFromIndices   - Board indices of the mines to move.
+    @param[out] pToIndices     - Board indices of the tiles to move them to.
+    @param[out] pMoves         - Number of moves chosen, 0 if no mine can move.
+
+    @return Mine error code (MINE_ERROR_SUCCESS upon success).
+*/
+template <typename POLICY>
+MINE_ERROR
+MineMovement_ChooseMovesWith(_Inout_ MINE_GAME_SETTINGS* pGame, DWORD aggressiveness, BOOLEAN wrapHorz,
+                             BOOLEAN wrapVert, BOOLEAN consistent, UINT batch,
+                             _Out_writes_(batch) PLONG pFromIndices, _Out_writes_(batch) PLONG pToIndices,
+                             _Out_ PUINT pMoves);
+
+#ifdef _WIN32
 /**
     MineMovement_Dialog
 *//**
@@ -40,13 +295,127 @@
 */
 INT_PTR CALLBACK
 MineMovement_Dialog(_In_ HWND hDlg, UINT message, WPARAM wParam, LPARAM lParam);
+#endif /* _WIN32 */
+
+/**
+    MineMovement_FlaggedAround
+*//**
+    Count the flagged tiles around a tile, across wrapped edges where the
+    board wraps.
+
+    @param[in] pGame - Board the move is chosen on.
+    @param[in] pTick - Settings shared by every mine this tick.
+    @param[in] index - Board index of the tile.
+
+    @return Number of flagged neighbors, from 0 to 8.
+*/
+UINT
+MineMovement_FlaggedAround(_In_ const MINE_GAME_SETTINGS* pGame, _In_ const MINE_MOVEMENT_TICK* pTick, LONG index);
+
+/**
+    MineMovement_IsOpen
+*//**
+    Check if a mine can move onto a tile: it holds no mine, is not revealed,
+    flagged or held down, and no earlier move in the batch is headed there.
+
+    @param[in] pGame - Board the move is chosen on.
+    @param[in] index - Board index of the tile.
+
+    @return TRUE if a mine can move onto the tile, FALSE otherwise.
+*/
+BOOLEAN
+MineMovement_IsOpen(_In_ const MINE_GAME_SETTINGS* pGame, LONG index);
+
+/**
+    MineMovement_KeepsNumbers
+*//**
+    Check if a move leaves every revealed number unchanged. Only tiles next to
+    one end of the move and not the other change, so just the two 3x3 blocks
+    around the ends are looked at, however many tiles are revealed.
+
+    @param[in] pGame     - Board the move is checked on.
+    @param[in] pTick     - Settings shared by every mine this tick.
+    @param[in] fromIndex - Board index of the mine.
+    @param[in] toIndex   - Board index of the tile it moves to.
+
+    @return TRUE if no revealed number changes, FALSE otherwise.
+*/
+BOOLEAN
+MineMovement_KeepsNumbers(_In_ const MINE_GAME_SETTINGS* pGame, _In_ const MINE_MOVEMENT_TICK* pTick,
+                          LONG fromIndex, LONG toIndex);
+
+/**
+    MineMovement_NeighborCount
+*//**
+    Count how many times a tile is next to another. Across wrapped edges of a
+    board one or two tiles wide, a tile can be next to another more than once.
+
+    @param[in] pGame - Board the move is checked on.
+    @param[in] pTick - Settings shared by every mine this tick.
+    @param[in] index - Board index of the tile in the middle.
+    @param[in] tile  - Board index of the tile to look for.
+
+    @return Number of directions in which tile is next to index, from 0 to 8.
+*/
+UINT
+MineMovement_NeighborCount(_In_ const MINE_GAME_SETTINGS* pGame, _In_ const MINE_MOVEMENT_TICK* pTick,
+                           LONG index, LONG tile);
 
 /**
     MineMovement_ProcessMovement
 *//**
-    Attempt, with specified aggressiveness, to move a mine from one tile to another.
+    Attempt, with specified policy and aggressiveness, to move a batch of mines
+    on the game board, without going through the movement thread.
 
     @return Mine error code (MINE_ERROR_SUCCESS upon success).
 */
 MINE_ERROR
-MineMovement_ProcessMovement(VOID);
\ No newline at end of file
+MineMovement_ProcessMovement(VOID);
+
+/**
+    MineMovement_RevealedAround
+*//**
+    Count the revealed tiles around a tile, across wrapped edges where the
+    board wraps.
+
+    @param[in] pGame - Board the move is chosen on.
+    @param[in] pTick - Settings shared by every mine this tick.
+    @param[in] index - Board index of the tile.
+
+    @return Number of revealed neighbors, from 0 to 8.
+*/
+UINT
+MineMovement_RevealedAround(_In_ const MINE_GAME_SETTINGS* pGame, _In_ const MINE_MOVEMENT_TICK* pTick, LONG index);
+
+/**
+    MineMovement_Step
+*//**
+    Find the tile a number of tiles away from another in one of the eight
+    directions, wrapping around the edges where the board wraps.
+
+    @param[in] pGame     - Board the move is chosen on.
+    @param[in] pTick     - Settings shared by every mine this tick.
+    @param[in] index     - Board index of the tile to start from.
+    @param[in] direction - Direction to step in, from 0 (up and left) to 7 (down and right).
+    @param[in] distance  - Number of tiles to step.
+
+    @return Board index of the tile, -1 if the step leaves a board that does not wrap.
+*/
+LONG
+MineMovement_Step(_In_ const MINE_GAME_SETTINGS* pGame, _In_ const MINE_MOVEMENT_TICK* pTick,
+                  LONG index, UINT direction, LONG distance);
+
+/**
+    MineMovement_UpdateNeighbors
+*//**
+    Add to the number on every tile around a tile that is not a mine, and mark
+    the tile and its neighbors to be redrawn. Neighbors across a wrapped edge
+    are counted as many times as Mine_AssignNumbers counts them.
+
+    @param[in] index - Board index of the tile.
+    @param[in] delta - Amount to add to each neighbor, 0 to only count.
+
+    @return Number of mines around the tile.
+*/
+CHAR
+MineMovement_UpdateNeighbors(LONG index, CHAR delta);
\ No newline at end of file
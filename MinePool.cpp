@@ -0,0 +1,257 @@
+/**
+    @file MinePool.cpp
+
+    @author Craig Burkhart
+
+    @brief Worker thread pool, which runs a batch of independent jobs across
+           every processor. The calling thread takes jobs alongside the
+           workers, so a pool of one thread is the plain serial loop.
+*//*
+    Copyright (C) 2014 - Craig Burkhart
+
+    This file is part of Minesweeper Deluxe.
+
+    Minesweeper Deluxe is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Minesweeper Deluxe is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Minesweeper Deluxe.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#include "stdafx.h"
+#include "MinePool.h"
+#include "MineDebug.h"
+
+// Global Variables:
+MINE_POOL_DATA poolData = {0};
+
+/**
+    MinePool_Cleanup
+*//**
+    End the worker threads and close their handles.
+*/
+VOID
+MinePool_Cleanup(VOID)
+{
+    UINT ix = 0;
+
+    if (0 < poolData.numThreads)
+    {
+        /** Every worker wakes once more, sees quit and returns. */
+        (void) InterlockedExchange(&(poolData.quit), 1);
+        if (0 == ReleaseSemaphore(poolData.hStart, (LONG) poolData.numThreads, NULL))
+        {
+            MineDebug_PrintWarning("Waking pool threads: %lu\n", GetLastError());
+        }
+
+        for (ix = 0; ix < poolData.numThreads; ix++)
+        {
+            if (WAIT_OBJECT_0 != WaitForSingleObject(poolData.hThreads[ix], INFINITE))
+            {
+                MineDebug_PrintWarning("Waiting for pool thread: %lu\n", GetLastError());
+            }
+
+            (void) CloseHandle(poolData.hThreads[ix]);
+            poolData.hThreads[ix] = NULL;
+        }
+    }
+
+    if (NULL != poolData.hStart)
+    {
+        (void) CloseHandle(poolData.hStart);
+        poolData.hStart = NULL;
+    }
+
+    if (NULL != poolData.hDone)
+    {
+        (void) CloseHandle(poolData.hDone);
+        poolData.hDone = NULL;
+    }
+
+    poolData.numThreads = 0;
+    poolData.quit = 0;
+
+    return;
+}
+
+/**
+    MinePool_Run
+*//**
+    Run a batch of jobs and wait for all of them to finish. The calling thread
+    takes jobs too, so with no workers the batch simply runs in order.
+
+    @param[in] pJob     - Job to run.
+    @param[in] pContext - Context passed to every job.
+    @param[in] jobs     - Number of jobs, numbered from 0.
+*/
+VOID
+MinePool_Run(MINE_POOL_JOB pJob, _In_opt_ PVOID pContext, UINT jobs)
+{
+    poolData.pJob = pJob;
+    poolData.pContext = pContext;
+    poolData.numJobs = (LONG) jobs;
+    poolData.nextJob = 0;
+    poolData.batches++;
+    poolData.jobs += jobs;
+
+    //A batch of one job is not worth waking anyone for
+    if ((0 == poolData.numThreads) || (1 >= jobs))
+    {
+        MinePool_TakeJobs();
+    }
+    else
+    {
+        /** Each wake is matched by one leave, whichever worker takes it, so the
+            count reaches zero only once every wake has been used. */
+        (void) InterlockedExchange(&(poolData.working), (LONG) poolData.numThreads + 1);
+        if (0 == ReleaseSemaphore(poolData.hStart, (LONG) poolData.numThreads, NULL))
+        {
+            MineDebug_PrintWarning("Waking pool threads: %lu\n", GetLastError());
+            (void) InterlockedExchange(&(poolData.working), 1);
+        }
+
+        MinePool_TakeJobs();
+
+        if (0 != InterlockedDecrement(&(poolData.working)))
+        {
+            if (WAIT_OBJECT_0 != WaitForSingleObject(poolData.hDone, INFINITE))
+            {
+                MineDebug_PrintWarning("Waiting for pool batch: %lu\n", GetLastError());
+            }
+        }
+    }
+
+    return;
+}
+
+/**
+    MinePool_Startup
+*//**
+    Start the worker threads. Until the pool is started, or when it is started
+    with a single thread, batches run on the calling thread alone.
+
+    @param[in] threads - Number of threads to run batches on, the caller
+                         included, 0 for one per processor.
+
+    @return Mine error code (MINE_ERROR_SUCCESS upon success).
+*/
+MINE_ERROR
+MinePool_Startup(UINT threads)
+{
+    BOOLEAN     bFalse = FALSE;
+    UINT        ix = 0;
+    MINE_ERROR  status = MINE_ERROR_SUCCESS;
+    SYSTEM_INFO systemInfo = {0};
+
+    do
+    {
+        MinePool_Cleanup();
+
+        if (0 == threads)
+        {
+            GetSystemInfo(&systemInfo);
+            threads = (UINT) systemInfo.dwNumberOfProcessors;
+        }
+
+        //The caller is one of the threads
+        threads = (threads > MINE_POOL_MAX_THREADS + 1) ? MINE_POOL_MAX_THREADS : threads - 1;
+        if (0 == threads)
+        {
+            break;
+        }
+
+        poolData.hStart = CreateSemaphoreW(NULL, 0, MINE_POOL_MAX_THREADS, NULL);
+        if (NULL == poolData.hStart)
+        {
+            MineDebug_PrintError("Creating pool start semaphore: %lu\n", GetLastError());
+            status = MINE_ERROR_GET_DATA;
+            break;
+        }
+
+        poolData.hDone = CreateEventW(NULL, FALSE, FALSE, NULL);
+        if (NULL == poolData.hDone)
+        {
+            MineDebug_PrintError("Creating pool done event: %lu\n", GetLastError());
+            status = MINE_ERROR_GET_DATA;
+            break;
+        }
+
+        for (ix = 0; ix < threads; ix++)
+        {
+            poolData.hThreads[ix] = CreateThread(NULL, 0, MinePool_ThreadProc, NULL, 0, NULL);
+            if (NULL == poolData.hThreads[ix])
+            {
+                MineDebug_PrintError("Creating pool thread: %lu\n", GetLastError());
+                status = MINE_ERROR_GET_DATA;
+                break;
+            }
+            poolData.numThreads++;
+        }
+
+        __assume(FALSE == bFalse);
+    } while (bFalse);
+
+    if (MINE_ERROR_SUCCESS != status)
+    {
+        MinePool_Cleanup();
+    }
+
+    return status;
+}
+
+/**
+    MinePool_TakeJobs
+*//**
+    Run jobs of the current batch until none are left.
+*/
+VOID
+MinePool_TakeJobs(VOID)
+{
+    LONG job = InterlockedIncrement(&(poolData.nextJob)) - 1;
+
+    while (job < poolData.numJobs)
+    {
+        poolData.pJob(poolData.pContext, (UINT) job);
+        job = InterlockedIncrement(&(poolData.nextJob)) - 1;
+    }
+
+    return;
+}
+
+/**
+    MinePool_ThreadProc
+*//**
+    Body of a worker thread. Waits for a batch, helps run it, and waits again.
+
+    @param[in] pParameter - Unused.
+
+    @return 0 when the thread is told to quit.
+*/
+DWORD WINAPI
+MinePool_ThreadProc(_In_opt_ LPVOID pParameter)
+{
+    UNREFERENCED_PARAMETER(pParameter);
+
+    while (WAIT_OBJECT_0 == WaitForSingleObject(poolData.hStart, INFINITE))
+    {
+        if (0 != poolData.quit)
+        {
+            break;
+        }
+
+        MinePool_TakeJobs();
+
+        if (0 == InterlockedDecrement(&(poolData.working)))
+        {
+            (void) SetEvent(poolData.hDone);
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,143 @@
+/**
+    @file MinePool.h
+
+    @author Craig Burkhart
+
+    @brief Header file for the worker thread pool, which runs a batch of
+           independent jobs across every processor. Only the probability
+           engine uses it, so only the headless programs start it.
+*//*
+    Copyright (C) 2014 - Craig Burkhart
+
+    This file is part of Minesweeper Deluxe.
+
+    Minesweeper Deluxe is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Minesweeper Deluxe is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Minesweeper Deluxe.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#pragma once
+
+#include "Mine.h"
+
+//--------------------------------------------------------------
+//    Macros
+//--------------------------------------------------------------
+
+/** Most worker threads the pool will start. */
+#define MINE_POOL_MAX_THREADS 31
+
+//--------------------------------------------------------------
+//    Structures
+//--------------------------------------------------------------
+
+struct _MINE_POOL_DATA
+{
+    /** Worker threads. */
+    HANDLE        hThreads[MINE_POOL_MAX_THREADS];
+    /** Number of worker threads running. */
+    UINT          numThreads;
+    /** Semaphore released once per worker when a batch is ready. */
+    HANDLE        hStart;
+    /** Auto reset event set by the last worker to leave a batch. */
+    HANDLE        hDone;
+    /** Job of the current batch. */
+    VOID          (*pJob)(PVOID pContext, UINT job);
+    /** Context passed to every job of the current batch. */
+    PVOID         pContext;
+    /** Number of jobs in the current batch. */
+    LONG          numJobs;
+    /** Number of jobs of the current batch taken so far. */
+    volatile LONG nextJob;
+    /** Number of threads, the caller included, still in the current batch. */
+    volatile LONG working;
+    /** Flag for if the workers should return. */
+    volatile LONG quit;
+    /** Number of batches run. */
+    ULONGLONG     batches;
+    /** Number of jobs run. */
+    ULONGLONG     jobs;
+};
+
+//--------------------------------------------------------------
+//    Typedefs
+//--------------------------------------------------------------
+
+/** Job run by the pool, given the batch context and the job number. */
+typedef VOID (*MINE_POOL_JOB)(PVOID pContext, UINT job);
+
+/** Worker threads and the batch they are running. */
+typedef struct _MINE_POOL_DATA MINE_POOL_DATA;
+
+//--------------------------------------------------------------
+//    Global Variable Externs
+//--------------------------------------------------------------
+
+extern MINE_POOL_DATA poolData;
+
+//--------------------------------------------------------------
+//    Function Prototypes
+//--------------------------------------------------------------
+
+/**
+    MinePool_Cleanup
+*//**
+    End the worker threads and close their handles.
+*/
+VOID
+MinePool_Cleanup(VOID);
+
+/**
+    MinePool_Run
+*//**
+    Run a batch of jobs and wait for all of them to finish. The calling thread
+    takes jobs too, so with no workers the batch simply runs in order.
+
+    @param[in] pJob     - Job to run.
+    @param[in] pContext - Context passed to every job.
+    @param[in] jobs     - Number of jobs, numbered from 0.
+*/
+VOID
+MinePool_Run(MINE_POOL_JOB pJob, _In_opt_ PVOID pContext, UINT jobs);
+
+/**
+    MinePool_Startup
+*//**
+    Start the worker threads. Until the pool is started, or when it is started
+    with a single thread, batches run on the calling thread alone.
+
+    @param[in] threads - Number of threads to run batches on, the caller
+                         included, 0 for one per processor.
+
+    @return Mine error code (MINE_ERROR_SUCCESS upon success).
+*/
+MINE_ERROR
+MinePool_Startup(UINT threads);
+
+/**
+    MinePool_TakeJobs
+*//**
+    Run jobs of the current batch until none are left.
+*/
+VOID
+MinePool_TakeJobs(VOID);
+
+/**
+    MinePool_ThreadProc
+*//**
+    Body of a worker thread. Waits for a batch, helps run it, and waits again.
+
+    @param[in] pParameter - Unused.
+
+    @return 0 when the thread is told to quit.
+*/
+DWORD WINAPI
+MinePool_ThreadProc(_In_opt_ LPVOID pParameter);
@@ -0,0 +1,497 @@
+/**
+    @file MinePortable.h
+
+    @author Craig Burkhart
+
+    @brief Windows type and API stand-ins for building the game core without windows.h.
+*//*
+    Copyright (C) 2014 - Craig Burkhart
+
+    This file is part of Minesweeper Deluxe.
+
+    Minesweeper Deluxe is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Minesweeper Deluxe is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Minesweeper Deluxe.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#pragma once
+
+#include <errno.h>
+#include <limits.h>
+#include <math.h>
+#include <pthread.h>
+#include <stdarg.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <wchar.h>
+
+//--------------------------------------------------------------
+//    Macros
+//--------------------------------------------------------------
+
+#ifndef TRUE
+/** Boolean true value. */
+#define TRUE  1
+#endif /* TRUE */
+#ifndef FALSE
+/** Boolean false value. */
+#define FALSE 0
+#endif /* FALSE */
+
+/** Empty parameter list or return type. */
+#define VOID void
+/** Calling convention is the platform default. */
+#define CALLBACK
+/** Calling convention is the platform default. */
+#define APIENTRY
+/** Calling convention is the platform default. */
+#define WINAPI
+
+/** Source annotations are only checked by the Microsoft compiler. */
+#define _In_
+#define _In_opt_
+#define _In_z_
+#define _In_opt_z_
+#define _In_reads_(size)
+#define _In_reads_bytes_(size)
+#define _Inout_
+#define _Inout_updates_(size)
+#define _Inout_updates_to_(size, count)
+#define _Out_
+#define _Out_opt_
+#define _Out_writes_(size)
+#define _Out_writes_bytes_(size)
+#define _Printf_format_string_
+#define _Return_type_success_(expr)
+
+/** Optimizer hint, only meaningful to the Microsoft compiler. */
+#define __assume(expr) ((void) 0)
+
+/** Silence unused parameter warnings. */
+#define UNREFERENCED_PARAMETER(param) ((void) (param))
+
+/** Fill a block of memory with zeros. */
+#define ZeroMemory(dest, length)      memset((dest), 0, (length))
+/** Copy a block of memory. */
+#define CopyMemory(dest, src, length) memcpy((dest), (src), (length))
+
+#ifndef min
+/** Smaller of two values. */
+#define min(a,b) (((a) < (b)) ? (a) : (b))
+#endif /* min */
+#ifndef max
+/** Larger of two values. */
+#define max(a,b) (((a) > (b)) ? (a) : (b))
+#endif /* max */
+
+/** Flag for HeapAlloc to zero the allocated memory. */
+#define HEAP_ZERO_MEMORY 0x00000008
+
+/** Wait with no time limit. */
+#define INFINITE      0xFFFFFFFF
+/** The object waited on was signaled. */
+#define WAIT_OBJECT_0 0x00000000
+/** The wait ran out of time. */
+#define WAIT_TIMEOUT  0x00000102
+/** The wait could not be made. */
+#define WAIT_FAILED   0xFFFFFFFF
+
+//--------------------------------------------------------------
+//    Typedefs
+//--------------------------------------------------------------
+
+typedef int            BOOL;
+typedef unsigned char  BOOLEAN;
+typedef unsigned char  BYTE;
+typedef char           CHAR;
+typedef uint32_t       DWORD;
+typedef float          FLOAT;
+typedef void*          HANDLE;
+typedef int            INT;
+typedef int32_t        INT32;
+typedef int64_t        INT64;
+typedef int32_t        LONG;
+typedef int32_t*       PLONG;
+typedef int64_t        LONGLONG;
+typedef const char*    LPCSTR;
+typedef const wchar_t* LPCWSTR;
+typedef char*          LPSTR;
+typedef void*          LPVOID;
+typedef wchar_t*       LPWSTR;
+typedef unsigned int*  PUINT;
+typedef void*          PVOID;
+typedef short          SHORT;
+typedef size_t         SIZE_T;
+typedef unsigned char  UCHAR;
+typedef unsigned int   UINT;
+typedef uint32_t       UINT32;
+typedef uint64_t       UINT64;
+typedef uint32_t       ULONG;
+typedef uint64_t       ULONGLONG;
+typedef unsigned short USHORT;
+typedef wchar_t        WCHAR;
+typedef unsigned short WORD;
+
+/** Function a thread starts in. */
+typedef DWORD (WINAPI *LPTHREAD_START_ROUTINE)(LPVOID pParameter);
+
+//--------------------------------------------------------------
+//    Structures
+//--------------------------------------------------------------
+
+/** Rectangle with exclusive right and bottom edges. */
+typedef struct tagRECT
+{
+    LONG left;
+    LONG top;
+    LONG right;
+    LONG bottom;
+} RECT, *PRECT, *LPRECT;
+
+/** Processor information, only the processor count is filled in. */
+typedef struct _SYSTEM_INFO
+{
+    DWORD dwNumberOfProcessors;
+} SYSTEM_INFO, *LPSYSTEM_INFO;
+
+/** Thread, semaphore or event behind a HANDLE. Semaphores and events are a
+    count guarded by a mutex, a thread's count is set once it returns. */
+struct _MINE_PORTABLE_OBJECT
+{
+    pthread_mutex_t        lock;
+    pthread_cond_t         changed;
+    pthread_t              thread;
+    LPTHREAD_START_ROUTINE pStart;
+    LPVOID                 pParameter;
+    LONG                   count;
+    LONG                   maxCount;
+    BOOL                   isThread;
+    BOOL                   manualReset;
+};
+
+//--------------------------------------------------------------
+//    Inline Functions
+//--------------------------------------------------------------
+
+/** Last error code set by the C runtime. */
+static inline DWORD
+GetLastError(VOID)
+{
+    return (DWORD) errno;
+}
+
+/** Milliseconds since an arbitrary fixed point, never decreasing. */
+static inline ULONGLONG
+GetTickCount64(VOID)
+{
+    struct timespec now;
+
+    (void) clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return ((ULONGLONG) now.tv_sec)*1000 + ((ULONGLONG) now.tv_nsec)/1000000;
+}
+
+/** The C runtime heap stands in for the process heap. */
+static inline HANDLE
+GetProcessHeap(VOID)
+{
+    static int processHeap = 0;
+
+    return (HANDLE) &processHeap;
+}
+
+/** Allocate from the C runtime heap. */
+static inline LPVOID
+HeapAlloc(HANDLE hHeap, DWORD flags, SIZE_T bytes)
+{
+    UNREFERENCED_PARAMETER(hHeap);
+
+    return (flags & HEAP_ZERO_MEMORY) ? calloc(1, bytes) : malloc(bytes);
+}
+
+/** Return memory to the C runtime heap. */
+static inline BOOL
+HeapFree(HANDLE hHeap, DWORD flags, LPVOID pMemory)
+{
+    UNREFERENCED_PARAMETER(hHeap);
+    UNREFERENCED_PARAMETER(flags);
+
+    free(pMemory);
+
+    return TRUE;
+}
+
+/** Secure CRT version of fopen. */
+static inline int
+fopen_s(FILE** ppFile, const char* pFileName, const char* pMode)
+{
+    *ppFile = fopen(pFileName, pMode);
+
+    return (NULL == *ppFile) ? errno : 0;
+}
+
+/** Allocate a thread, semaphore or event object. */
+static inline struct _MINE_PORTABLE_OBJECT*
+MinePortable_NewObject(LONG count, LONG maxCount)
+{
+    struct _MINE_PORTABLE_OBJECT* pObject = (struct _MINE_PORTABLE_OBJECT*)
+                                            calloc(1, sizeof(struct _MINE_PORTABLE_OBJECT));
+
+    if (NULL != pObject)
+    {
+        (void) pthread_mutex_init(&(pObject->lock), NULL);
+        (void) pthread_cond_init(&(pObject->changed), NULL);
+        pObject->count = count;
+        pObject->maxCount = maxCount;
+    }
+
+    return pObject;
+}
+
+/** Run a thread's start function, then mark the thread signaled. */
+static inline void*
+MinePortable_ThreadStart(void* pParameter)
+{
+    struct _MINE_PORTABLE_OBJECT* pObject = (struct _MINE_PORTABLE_OBJECT*) pParameter;
+
+    (void) pObject->pStart(pObject->pParameter);
+
+    (void) pthread_mutex_lock(&(pObject->lock));
+    pObject->count = 1;
+    (void) pthread_cond_broadcast(&(pObject->changed));
+    (void) pthread_mutex_unlock(&(pObject->lock));
+
+    return NULL;
+}
+
+/** Free a thread, semaphore or event. A thread is waited for, so it must have
+    been told to return first. */
+static inline BOOL
+CloseHandle(HANDLE hObject)
+{
+    struct _MINE_PORTABLE_OBJECT* pObject = (struct _MINE_PORTABLE_OBJECT*) hObject;
+
+    if (NULL == pObject)
+    {
+        return FALSE;
+    }
+
+    if (pObject->isThread)
+    {
+        (void) pthread_join(pObject->thread, NULL);
+    }
+
+    (void) pthread_cond_destroy(&(pObject->changed));
+    (void) pthread_mutex_destroy(&(pObject->lock));
+    free(pObject);
+
+    return TRUE;
+}
+
+/** Create an event, signaled by SetEvent. An auto reset event lets one wait
+    through, then clears. */
+static inline HANDLE
+CreateEventW(LPVOID pAttributes, BOOL manualReset, BOOL initialState, LPCWSTR pName)
+{
+    struct _MINE_PORTABLE_OBJECT* pObject = MinePortable_NewObject(initialState ? 1 : 0, 1);
+
+    UNREFERENCED_PARAMETER(pAttributes);
+    UNREFERENCED_PARAMETER(pName);
+
+    if (NULL != pObject)
+    {
+        pObject->manualReset = manualReset;
+    }
+
+    return (HANDLE) pObject;
+}
+
+/** Create a semaphore, each wait takes one from its count. */
+static inline HANDLE
+CreateSemaphoreW(LPVOID pAttributes, LONG initialCount, LONG maximumCount, LPCWSTR pName)
+{
+    UNREFERENCED_PARAMETER(pAttributes);
+    UNREFERENCED_PARAMETER(pName);
+
+    return (HANDLE) MinePortable_NewObject(initialCount, maximumCount);
+}
+
+/** Start a thread running pStart(pParameter). */
+static inline HANDLE
+CreateThread(LPVOID pAttributes, SIZE_T stackSize, LPTHREAD_START_ROUTINE pStart, LPVOID pParameter,
+             DWORD flags, DWORD* pThreadId)
+{
+    struct _MINE_PORTABLE_OBJECT* pObject = MinePortable_NewObject(0, 1);
+
+    UNREFERENCED_PARAMETER(pAttributes);
+    UNREFERENCED_PARAMETER(stackSize);
+    UNREFERENCED_PARAMETER(flags);
+
+    if (NULL != pObject)
+    {
+        pObject->pStart = pStart;
+        pObject->pParameter = pParameter;
+        pObject->isThread = TRUE;
+
+        if (0 != pthread_create(&(pObject->thread), NULL, MinePortable_ThreadStart, pObject))
+        {
+            pObject->isThread = FALSE;
+            (void) CloseHandle((HANDLE) pObject);
+            pObject = NULL;
+        }
+        else if (NULL != pThreadId)
+        {
+            *pThreadId = 0;
+        }
+    }
+
+    return (HANDLE) pObject;
+}
+
+/** Number of processors online. */
+static inline VOID
+GetSystemInfo(LPSYSTEM_INFO pInfo)
+{
+    long processors = sysconf(_SC_NPROCESSORS_ONLN);
+
+    pInfo->dwNumberOfProcessors = (0 < processors) ? (DWORD) processors : 1;
+}
+
+/** Atomically subtract one, returning the new value. */
+static inline LONG
+InterlockedDecrement(LONG volatile* pValue)
+{
+    return __atomic_sub_fetch(pValue, 1, __ATOMIC_SEQ_CST);
+}
+
+/** Atomically store a value, returning the old one. */
+static inline LONG
+InterlockedExchange(LONG volatile* pTarget, LONG value)
+{
+    return __atomic_exchange_n(pTarget, value, __ATOMIC_SEQ_CST);
+}
+
+/** Atomically add one, returning the new value. */
+static inline LONG
+InterlockedIncrement(LONG volatile* pValue)
+{
+    return __atomic_add_fetch(pValue, 1, __ATOMIC_SEQ_CST);
+}
+
+/** Add to a semaphore's count, waking as many waiters. */
+static inline BOOL
+ReleaseSemaphore(HANDLE hSemaphore, LONG releaseCount, PLONG pPreviousCount)
+{
+    BOOL                          bReturn = FALSE;
+    struct _MINE_PORTABLE_OBJECT* pObject = (struct _MINE_PORTABLE_OBJECT*) hSemaphore;
+
+    (void) pthread_mutex_lock(&(pObject->lock));
+    if ((0 < releaseCount) && (pObject->count <= pObject->maxCount - releaseCount))
+    {
+        if (NULL != pPreviousCount)
+        {
+            *pPreviousCount = pObject->count;
+        }
+        pObject->count += releaseCount;
+        (void) pthread_cond_broadcast(&(pObject->changed));
+        bReturn = TRUE;
+    }
+    (void) pthread_mutex_unlock(&(pObject->lock));
+
+    return bReturn;
+}
+
+/** Signal an event. */
+static inline BOOL
+SetEvent(HANDLE hEvent)
+{
+    struct _MINE_PORTABLE_OBJECT* pObject = (struct _MINE_PORTABLE_OBJECT*) hEvent;
+
+    (void) pthread_mutex_lock(&(pObject->lock));
+    pObject->count = 1;
+    (void) pthread_cond_broadcast(&(pObject->changed));
+    (void) pthread_mutex_unlock(&(pObject->lock));
+
+    return TRUE;
+}
+
+/** Wait for a thread to return, an event to be signaled or a semaphore count
+    to be above zero. Semaphores and auto reset events are taken by the wait. */
+static inline DWORD
+WaitForSingleObject(HANDLE hObject, DWORD milliseconds)
+{
+    struct timespec               deadline;
+    struct _MINE_PORTABLE_OBJECT* pObject = (struct _MINE_PORTABLE_OBJECT*) hObject;
+    DWORD                         result = WAIT_OBJECT_0;
+
+    if (NULL == pObject)
+    {
+        return WAIT_FAILED;
+    }
+
+    if (INFINITE != milliseconds)
+    {
+        (void) clock_gettime(CLOCK_REALTIME, &deadline);
+        deadline.tv_sec += milliseconds/1000;
+        deadline.tv_nsec += (long) (milliseconds%1000)*1000000L;
+        if (1000000000L <= deadline.tv_nsec)
+        {
+            deadline.tv_sec++;
+            deadline.tv_nsec -= 1000000000L;
+        }
+    }
+
+    (void) pthread_mutex_lock(&(pObject->lock));
+    while ((0 == pObject->count) && (WAIT_OBJECT_0 == result))
+    {
+        if (INFINITE == milliseconds)
+        {
+            (void) pthread_cond_wait(&(pObject->changed), &(pObject->lock));
+        }
+        else if (ETIMEDOUT == pthread_cond_timedwait(&(pObject->changed), &(pObject->lock), &deadline))
+        {
+            result = WAIT_TIMEOUT;
+        }
+    }
+
+    if ((WAIT_OBJECT_0 == result) && !pObject->isThread && !pObject->manualReset)
+    {
+        pObject->count--;
+    }
+    (void) pthread_mutex_unlock(&(pObject->lock));
+
+    return result;
+}
+
+/** Find the lowest set bit, returning 0 if there is none. */
+static inline BOOLEAN
+_BitScanForward64(DWORD* pIndex, UINT64 mask)
+{
+    if (0 == mask)
+    {
+        return FALSE;
+    }
+
+    *pIndex = (DWORD) __builtin_ctzll(mask);
+
+    return TRUE;
+}
+
+/** Number of set bits. */
+static inline UINT64
+__popcnt64(UINT64 value)
+{
+    return (UINT64) __builtin_popcountll(value);
+}
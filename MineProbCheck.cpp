@@ -0,0 +1,492 @@
+/**
+    @file MineProbCheck.cpp
+
+    @author Craig Burkhart
+
+    @brief Headless probability check. Lays mines on small boards in every
+           wrap mode, shows part of each board, and compares the chance the
+           probability engine gives every hidden tile with a count over every
+           mine layout that fits what is shown.
+*//*
+    Copyright (C) 2014 - Craig Burkhart
+
+    This file is part of Minesweeper Deluxe.
+
+    Minesweeper Deluxe is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Minesweeper Deluxe is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Minesweeper Deluxe.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#include "stdafx.h"
+#include "MineProbCheck.h"
+#include "MineDebug.h"
+#include "MineFrontier.h"
+#include "MineMinimap.h"
+#include "MinePool.h"
+#include "MineProbability.h"
+#include "MineSolver.h"
+
+/** Board sizes checked. A board one or two tiles across that wraps reaches
+    the same tile from more than one side, so its numbers count some
+    neighbours twice or three times. */
+static const MINE_PROB_CHECK_SIZE checkSizes[MINE_PROB_CHECK_NUM_SIZES] =
+{
+    {2, 2, 1},
+    {3, 3, 2},
+    {4, 3, 3},
+    {3, 4, 3},
+    {4, 4, 4},
+    {2, 5, 3},
+    {5, 2, 3},
+    {1, 6, 2},
+    {6, 1, 2},
+    {2, 8, 4}
+};
+
+/** Names of the wrap modes, bit 0 for horizontal and bit 1 for vertical wrapping. */
+static const LPCSTR wrapNames[MINE_PROB_CHECK_NUM_WRAPS] = {"nowrap", "horz", "vert", "wrap"};
+
+/**
+    main
+*//**
+    Check every board size in every wrap mode and report how far the engine
+    was from the count.
+
+    Usage: mineprobcheck [-n boards] [-s seed] [-t threads]
+
+    @param[in] argc - Number of command line arguments.
+    @param[in] argv - Command line arguments.
+
+    @return 0 if every board matched the count, 1 otherwise.
+*/
+int
+main(int argc, char* argv[])
+{
+    BOOLEAN                bFalse = FALSE;
+    UINT                   boards = MINE_PROB_CHECK_DEFAULT_BOARDS;
+    UINT                   failures = 0;
+    INT                    ix = 0;
+    UINT                   jx = 0;
+    UINT                   kx = 0;
+    CHAR                   name[MINE_PROB_CHECK_NAME_CHARS];
+    MINE_PROB_CHECK_RESULT result;
+    ULONGLONG              seed = MINE_PROB_CHECK_DEFAULT_SEED;
+    MINE_ERROR             status = MINE_ERROR_SUCCESS;
+    UINT                   threads = MINE_PROB_CHECK_DEFAULT_THREADS;
+    UINT                   wrap = 0;
+
+    do
+    {
+        for (ix = 1; ix < argc; ix++)
+        {
+            if ((0 == strcmp(argv[ix], "-n")) && (ix + 1 < argc))
+            {
+                ix++;
+                boards = (UINT) max(1, atoi(argv[ix]));
+            }
+            else if ((0 == strcmp(argv[ix], "-s")) && (ix + 1 < argc))
+            {
+                ix++;
+                seed = (ULONGLONG) strtoull(argv[ix], NULL, 0);
+            }
+            else if ((0 == strcmp(argv[ix], "-t")) && (ix + 1 < argc))
+            {
+                ix++;
+                threads = (UINT) max(0, atoi(argv[ix]));
+            }
+            else
+            {
+                (void) fprintf(stderr, "Usage: %s [-n boards] [-s seed] [-t threads]\n", argv[0]);
+                status = MINE_ERROR_PARAMETER;
+                break;
+            }
+        }
+        if (MINE_ERROR_SUCCESS != status)
+        {
+            break;
+        }
+
+        status = MinePool_Startup(threads);
+        if (MINE_ERROR_SUCCESS != status)
+        {
+            (void) fprintf(stderr, "Unable to start the worker pool: %i\n", (int) status);
+            break;
+        }
+
+        (void) printf("%u boards per scenario, seed %llu, %u worker threads\n\n", boards,
+                      (unsigned long long) seed, (UINT) poolData.numThreads);
+        (void) printf("%-16s %6s %6s %8s %8s %10s\n", "scenario", "boards", "none", "tiles", "failed", "max error");
+
+        /** Every size in every wrap mode, each from its own seed. */
+        for (jx = 0; jx < MINE_PROB_CHECK_NUM_SIZES; jx++)
+        {
+            for (wrap = 0; wrap < MINE_PROB_CHECK_NUM_WRAPS; wrap++)
+            {
+                ZeroMemory(&result, sizeof(MINE_PROB_CHECK_RESULT));
+                (void) snprintf(name, MINE_PROB_CHECK_NAME_CHARS, "%ux%u-%s", (UINT) checkSizes[jx].width,
+                                (UINT) checkSizes[jx].height, wrapNames[wrap]);
+
+                //Set before the frontier is reset, which counts neighbors across the wrapped edges
+                menuData.wrapHorz = (0 != (wrap & 1)) ? (BOOLEAN) TRUE : (BOOLEAN) FALSE;
+                menuData.wrapVert = (0 != (wrap & 2)) ? (BOOLEAN) TRUE : (BOOLEAN) FALSE;
+
+                Mine_SeedRandom(seed + jx*MINE_PROB_CHECK_NUM_WRAPS + wrap);
+
+                for (kx = 0; kx < boards; kx++)
+                {
+                    status = MineProbCheck_Board(&checkSizes[jx], kx, &result);
+                    if (MINE_ERROR_SUCCESS != status)
+                    {
+                        (void) fprintf(stderr, "Scenario %s failed: %i\n", name, (int) status);
+                        break;
+                    }
+                }
+                if (MINE_ERROR_SUCCESS != status)
+                {
+                    break;
+                }
+
+                (void) printf("%-16s %6u %6u %8u %8u %10.2e\n", name, result.boards, result.contradictions,
+                              result.tiles, result.failures, result.maxError);
+                failures += result.failures;
+            }
+            if (MINE_ERROR_SUCCESS != status)
+            {
+                break;
+            }
+        }
+        if (MINE_ERROR_SUCCESS != status)
+        {
+            break;
+        }
+
+        (void) printf("\n%u boards did not match the count\n", failures);
+
+        __assume(FALSE == bFalse);
+    } while (bFalse);
+
+    //Clean up
+    MineProbability_Cleanup();
+    MinePool_Cleanup();
+    MineMinimap_Cleanup();
+    Mine_FreeBoard();
+
+    return ((MINE_ERROR_SUCCESS == status) && (0 == failures)) ? 0 : 1;
+}
+
+/**
+    Mine_GameWon
+*//**
+    Process a win of the game.
+*/
+VOID
+Mine_GameWon(VOID)
+{
+    gameData.numFlagged = gameData.mines;
+    gameData.gameOver = TRUE;
+    gameData.gameWon = TRUE;
+
+    return;
+}
+
+/**
+    MineProbCheck_Board
+*//**
+    Check the engine on one board: lay the mines, reveal some safe tiles and
+    flag some tiles, solve, and compare every hidden tile with the count.
+
+    @param[in]     pSize   - Board size to create.
+    @param[in]     board   - Number of the board in its scenario, for reports.
+    @param[in,out] pResult - Scenario counts the board is added to.
+
+    @return Mine error code (MINE_ERROR_SUCCESS upon success).
+*/
+MINE_ERROR
+MineProbCheck_Board(_In_ const MINE_PROB_CHECK_SIZE* pSize, UINT board, _Inout_ MINE_PROB_CHECK_RESULT* pResult)
+{
+    BOOLEAN    bFalse = FALSE;
+    double     chance = 0.0;
+    double     error = 0.0;
+    BOOLEAN    failed = FALSE;
+    LONG       ix = 0;
+    ULONGLONG  layouts = 0;
+    ULONGLONG  mines[MINE_PROB_CHECK_MAX_TILES] = {0};
+    UINT       rand = 0;
+    MINE_ERROR status = MINE_ERROR_SUCCESS;
+    LONG       tiles = 0;
+
+    do
+    {
+        if ((NULL == pSize) || (NULL == pResult) ||
+            (MINE_PROB_CHECK_MAX_TILES < pSize->width*pSize->height) || (pSize->width*pSize->height <= pSize->mines))
+        {
+            MineDebug_PrintError("Invalid parameter to MineProbCheck_Board\n");
+            status = MINE_ERROR_PARAMETER;
+            break;
+        }
+
+        //The board arrays belong to the arena, so they can be dropped with the rest
+        ZeroMemory(&gameData, sizeof(MINE_GAME_SETTINGS));
+        gameData.width = pSize->width;
+        gameData.height = pSize->height;
+        gameData.mines = pSize->mines;
+        tiles = (LONG) (pSize->width*pSize->height);
+
+        status = Mine_AllocBoard(MineFrontier_ArenaBytes() + MineSolver_ArenaBytes() +
+                                 MineProbability_ArenaBytes());
+        if (MINE_ERROR_SUCCESS != status)
+        {
+            break;
+        }
+
+        status = MineMinimap_Reset();
+        if (MINE_ERROR_SUCCESS != status)
+        {
+            break;
+        }
+
+        status = MineFrontier_Reset();
+        if (MINE_ERROR_SUCCESS != status)
+        {
+            break;
+        }
+
+        status = MineSolver_Reset();
+        if (MINE_ERROR_SUCCESS != status)
+        {
+            break;
+        }
+
+        status = MineProbability_Reset();
+        if (MINE_ERROR_SUCCESS != status)
+        {
+            break;
+        }
+
+        status = Mine_NewRandomBoard();
+        if (MINE_ERROR_SUCCESS != status)
+        {
+            break;
+        }
+
+        status = Mine_AssignNumbers(0, (LONG) pSize->width - 1, 0, (LONG) pSize->height - 1);
+        if (MINE_ERROR_SUCCESS != status)
+        {
+            break;
+        }
+
+        /** Show part of the board. Revealing goes through the tile status alone,
+            without a cascade, so a zero can sit next to hidden tiles. */
+        for (ix = 0; ix < tiles; ix++)
+        {
+            status = Mine_Random(100, &rand);
+            if (MINE_ERROR_SUCCESS != status)
+            {
+                MineDebug_PrintError("In function Mine_Random: %i\n", (int) status);
+                break;
+            }
+
+            if (MINE_BOMB_VALUE == gameData.gameBoard[ix])
+            {
+                if (MINE_PROB_CHECK_FLAG_PERCENT > rand)
+                {
+                    Mine_SetTileStatus(ix % (LONG) pSize->width, ix/(LONG) pSize->width, MINE_TILE_STATUS_FLAG);
+                }
+            }
+            else if (MINE_PROB_CHECK_REVEAL_PERCENT > rand)
+            {
+                Mine_SetTileStatus(ix % (LONG) pSize->width, ix/(LONG) pSize->width, MINE_TILE_STATUS_REVEALED);
+                gameData.numUncovered++;
+            }
+            else if (MINE_PROB_CHECK_REVEAL_PERCENT + MINE_PROB_CHECK_WRONG_PERCENT > rand)
+            {
+                Mine_SetTileStatus(ix % (LONG) pSize->width, ix/(LONG) pSize->width, MINE_TILE_STATUS_FLAG);
+            }
+        }
+        if (MINE_ERROR_SUCCESS != status)
+        {
+            break;
+        }
+
+        status = MineProbability_Solve();
+        if (MINE_ERROR_SUCCESS != status)
+        {
+            MineDebug_PrintError("In function MineProbability_Solve: %i\n", (int) status);
+            break;
+        }
+
+        status = MineProbCheck_Count(&layouts, mines);
+        if (MINE_ERROR_SUCCESS != status)
+        {
+            break;
+        }
+
+        pResult->boards++;
+
+        /** With no layout that fits there is nothing to compare against,
+            the engine only has to notice. */
+        if (0 == layouts)
+        {
+            pResult->contradictions++;
+            failed = !probabilityData.contradiction;
+        }
+        else if (probabilityData.contradiction || !probabilityData.exact)
+        {
+            failed = TRUE;
+        }
+        else
+        {
+            for (ix = 0; ix < tiles; ix++)
+            {
+                if (MINE_TILE_STATUS_NORMAL != gameData.tileStatus[ix])
+                {
+                    continue;
+                }
+
+                chance = ((double) mines[ix])/((double) layouts);
+                error = fabs(chance - (double) probabilityData.pProbabilities[ix]);
+                pResult->maxError = max(pResult->maxError, error);
+                pResult->tiles++;
+
+                if (MINE_PROB_CHECK_TOLERANCE < error)
+                {
+                    failed = TRUE;
+                }
+            }
+        }
+
+        if (failed)
+        {
+            (void) fprintf(stderr, "Board %u of %ux%u (wrap %i/%i) does not match: %llu layouts, "
+                           "contradiction %i, exact %i\n", board, (UINT) pSize->width,
+                           (UINT) pSize->height, (int) menuData.wrapHorz, (int) menuData.wrapVert,
+                           (unsigned long long) layouts, (int) probabilityData.contradiction,
+                           (int) probabilityData.exact);
+            pResult->failures++;
+        }
+
+        __assume(FALSE == bFalse);
+    } while (bFalse);
+
+    return status;
+}
+
+/**
+    MineProbCheck_Count
+*//**
+    Count every mine layout that fits the visible board, and how many of them
+    put a mine on each tile. A layout fits when numbering it from scratch
+    gives every revealed tile its number, so wrapped edges and tiles that
+    neighbour a number more than once are counted the way the game counts them.
+
+    @param[out] pLayouts - Number of layouts that fit.
+    @param[out] pMines   - Number of fitting layouts with a mine on each tile.
+
+    @return Mine error code (MINE_ERROR_SUCCESS upon success).
+*/
+MINE_ERROR
+MineProbCheck_Count(_Out_ ULONGLONG* pLayouts, _Out_writes_(MINE_PROB_CHECK_MAX_TILES) ULONGLONG* pMines)
+{
+    BOOLEAN    bFalse = FALSE;
+    BOOLEAN    fits = FALSE;
+    LONG       hidden[MINE_PROB_CHECK_MAX_TILES] = {0};
+    LONG       ix = 0;
+    UINT64     layout = 0;
+    LONG       minesLeft = (LONG) gameData.mines;
+    UINT       numHidden = 0;
+    CHAR*      pBoard = gameData.gameBoard;
+    CHAR       scratch[MINE_PROB_CHECK_MAX_TILES] = {0};
+    MINE_ERROR status = MINE_ERROR_SUCCESS;
+    LONG       tiles = (LONG) (gameData.width*gameData.height);
+
+    do
+    {
+        if ((NULL == pLayouts) || (NULL == pMines) || (MINE_PROB_CHECK_MAX_TILES < tiles))
+        {
+            MineDebug_PrintError("Invalid parameter to MineProbCheck_Count\n");
+            status = MINE_ERROR_PARAMETER;
+            break;
+        }
+
+        *pLayouts = 0;
+        ZeroMemory(pMines, MINE_PROB_CHECK_MAX_TILES*sizeof(ULONGLONG));
+
+        for (ix = 0; ix < tiles; ix++)
+        {
+            if (MINE_TILE_STATUS_FLAG == gameData.tileStatus[ix])
+            {
+                minesLeft--;
+            }
+            else if (MINE_TILE_STATUS_NORMAL == gameData.tileStatus[ix])
+            {
+                hidden[numHidden++] = ix;
+            }
+        }
+
+        /** Flags are taken as mines and the rest of the mines are spread over
+            the hidden tiles every way they can be. */
+        for (layout = 0; layout < (((UINT64) 1) << numHidden); layout++)
+        {
+            if ((UINT64) minesLeft != __popcnt64(layout))
+            {
+                continue;
+            }
+
+            for (ix = 0; ix < tiles; ix++)
+            {
+                scratch[ix] = (MINE_TILE_STATUS_FLAG == gameData.tileStatus[ix]) ? MINE_BOMB_VALUE : 0;
+            }
+            for (ix = 0; ix < (LONG) numHidden; ix++)
+            {
+                if (0 != (layout & (((UINT64) 1) << ix)))
+                {
+                    scratch[hidden[ix]] = MINE_BOMB_VALUE;
+                }
+            }
+
+            //Number the layout with the game's own numbering, then put the real board back
+            gameData.gameBoard = scratch;
+            status = Mine_AssignNumbers(0, (LONG) gameData.width - 1, 0, (LONG) gameData.height - 1);
+            gameData.gameBoard = pBoard;
+            if (MINE_ERROR_SUCCESS != status)
+            {
+                MineDebug_PrintError("In function Mine_AssignNumbers: %i\n", (int) status);
+                break;
+            }
+
+            fits = TRUE;
+            for (ix = 0; (ix < tiles) && fits; ix++)
+            {
+                if ((MINE_TILE_STATUS_REVEALED == gameData.tileStatus[ix]) && (scratch[ix] != pBoard[ix]))
+                {
+                    fits = FALSE;
+                }
+            }
+            if (!fits)
+            {
+                continue;
+            }
+
+            (*pLayouts)++;
+            for (ix = 0; ix < tiles; ix++)
+            {
+                if (MINE_BOMB_VALUE == scratch[ix])
+                {
+                    pMines[ix]++;
+                }
+            }
+        }
+
+        __assume(FALSE == bFalse);
+    } while (bFalse);
+
+    return status;
+}
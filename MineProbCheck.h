@@ -0,0 +1,132 @@
+/**
+    @file MineProbCheck.h
+
+    @author Craig Burkhart
+
+    @brief Header file for the headless probability check, which compares the
+           chance the probability engine gives each hidden tile against a count
+           of every mine layout on small boards.
+*//*
+    Copyright (C) 2014 - Craig Burkhart
+
+    This file is part of Minesweeper Deluxe.
+
+    Minesweeper Deluxe is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Minesweeper Deluxe is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Minesweeper Deluxe.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#pragma once
+
+#include "Mine.h"
+
+//--------------------------------------------------------------
+//    Macros
+//--------------------------------------------------------------
+
+/** Default number of boards checked in each scenario. */
+#define MINE_PROB_CHECK_DEFAULT_BOARDS  200
+/** Default seed the mine layouts of every scenario are made from. */
+#define MINE_PROB_CHECK_DEFAULT_SEED    1
+/** Default number of threads in the worker pool, more than one so the
+    components are counted on the workers too. */
+#define MINE_PROB_CHECK_DEFAULT_THREADS 2
+/** Most tiles on a checked board, every layout of them is counted. */
+#define MINE_PROB_CHECK_MAX_TILES       16
+/** Number of board sizes in the check. */
+#define MINE_PROB_CHECK_NUM_SIZES       10
+/** Number of wrap modes in the check, none, horizontal, vertical and both. */
+#define MINE_PROB_CHECK_NUM_WRAPS       4
+/** Number of characters in a scenario name. */
+#define MINE_PROB_CHECK_NAME_CHARS      32
+/** Largest difference allowed between a counted and an engine chance. */
+#define MINE_PROB_CHECK_TOLERANCE       1e-4
+
+/** Chance (in percent) of each safe tile being revealed. */
+#define MINE_PROB_CHECK_REVEAL_PERCENT 50
+/** Chance (in percent) of each mine being flagged. */
+#define MINE_PROB_CHECK_FLAG_PERCENT   25
+/** Chance (in percent) of each hidden safe tile being flagged by mistake,
+    which can leave no layout that fits. */
+#define MINE_PROB_CHECK_WRONG_PERCENT  4
+
+//--------------------------------------------------------------
+//    Structures
+//--------------------------------------------------------------
+
+struct _MINE_PROB_CHECK_SIZE
+{
+    /** Width (in tiles) of the board. */
+    DWORD width;
+    /** Height (in tiles) of the board. */
+    DWORD height;
+    /** Number of mines on the board. */
+    DWORD mines;
+};
+
+struct _MINE_PROB_CHECK_RESULT
+{
+    /** Number of boards checked. */
+    UINT   boards;
+    /** Number of boards no mine layout fits. */
+    UINT   contradictions;
+    /** Number of hidden tiles compared. */
+    UINT   tiles;
+    /** Number of boards the engine got wrong. */
+    UINT   failures;
+    /** Largest difference between a counted and an engine chance. */
+    double maxError;
+};
+
+//--------------------------------------------------------------
+//    Typedefs
+//--------------------------------------------------------------
+
+/** Board size checked. */
+typedef struct _MINE_PROB_CHECK_SIZE MINE_PROB_CHECK_SIZE;
+
+/** Counts and worst error of a single scenario. */
+typedef struct _MINE_PROB_CHECK_RESULT MINE_PROB_CHECK_RESULT;
+
+//--------------------------------------------------------------
+//    Function Prototypes
+//--------------------------------------------------------------
+
+/**
+    MineProbCheck_Board
+*//**
+    Check the engine on one board: lay the mines, reveal some safe tiles and
+    flag some tiles, solve, and compare every hidden tile with the count.
+
+    @param[in]     pSize   - Board size to create.
+    @param[in]     board   - Number of the board in its scenario, for reports.
+    @param[in,out] pResult - Scenario counts the board is added to.
+
+    @return Mine error code (MINE_ERROR_SUCCESS upon success).
+*/
+MINE_ERROR
+MineProbCheck_Board(_In_ const MINE_PROB_CHECK_SIZE* pSize, UINT board, _Inout_ MINE_PROB_CHECK_RESULT* pResult);
+
+/**
+    MineProbCheck_Count
+*//**
+    Count every mine layout that fits the visible board, and how many of them
+    put a mine on each tile. A layout fits when numbering it from scratch
+    gives every revealed tile its number, so wrapped edges and tiles that
+    neighbour a number more than once are counted the way the game counts them.
+
+    @param[out] pLayouts - Number of layouts that fit.
+    @param[out] pMines   - Number of fitting layouts with a mine on each tile.
+
+    @return Mine error code (MINE_ERROR_SUCCESS upon success).
+*/
+MINE_ERROR
+MineProbCheck_Count(_Out_ ULONGLONG* pLayouts, _Out_writes_(MINE_PROB_CHECK_MAX_TILES) ULONGLONG* pMines);
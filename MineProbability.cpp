@@ -0,0 +1,1169 @@
+/**
+    @file MineProbability.cpp
+
+    @author Craig Burkhart
+
+    @brief Mine probability engine. The hidden tiles next to revealed numbers
+           are split into components that share no number, the mine layouts
+           of each component are counted by backtracking over bit sets, and
+           the counts are combined with the number of ways the remaining
+           mines can sit among the tiles next to no number. Only the headless
+           programs use it, the game never asks for probabilities.
+*//*
+    Copyright (C) 2014 - Craig Burkhart
+
+    This file is part of Minesweeper Deluxe.
+
+    Minesweeper Deluxe is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Minesweeper Deluxe is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Minesweeper Deluxe.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#include "stdafx.h"
+#include "MineProbability.h"
+#include "MineArena.h"
+#include "MineDebug.h"
+#include "MinePool.h"
+#include "MineSolver.h"
+
+// Global Variables:
+MINE_PROBABILITY_DATA probabilityData = {0};
+
+/**
+    MineProbability_ArenaBytes
+*//**
+    Number of bytes the tile and component arrays for the board in gameData
+    take from the arena, to be added to what Mine_AllocBoard is asked for.
+
+    @return Number of bytes.
+*/
+SIZE_T
+MineProbability_ArenaBytes(VOID)
+{
+    SIZE_T tiles = ((SIZE_T) gameData.width)*((SIZE_T) gameData.height);
+
+    /** The frontier, its components and the live constraints can each hold
+        every tile at most, so the arrays are sized for that. */
+    return MINE_ARENA_BYTES(tiles*sizeof(FLOAT)) + 10*MINE_ARENA_BYTES(tiles*sizeof(LONG)) +
+           MINE_ARENA_BYTES(tiles*sizeof(MINE_PROBABILITY_COMPONENT)) +
+           MINE_ARENA_BYTES(tiles*MINE_PROBABILITY_WORDS*sizeof(UINT64)) +
+           MINE_ARENA_BYTES(tiles*MINE_SOLVER_MAX_NEIGHBORS*sizeof(LONG)) +
+           MINE_ARENA_BYTES(tiles*MINE_SOLVER_MAX_NEIGHBORS) + MINE_ARENA_BYTES(tiles);
+}
+
+/**
+    MineProbability_Assign
+*//**
+    Give a tile of the component being searched a value, and take it out of the
+    constraints next to it.
+
+    @param[in] pSearch - Search state.
+    @param[in] bit     - Bit of the tile in its component.
+    @param[in] mine    - TRUE if the tile is a mine, FALSE if it is safe.
+
+    @return TRUE if every constraint next to the tile can still be met, FALSE otherwise.
+*/
+BOOLEAN
+MineProbability_Assign(_Inout_ MINE_PROBABILITY_SEARCH* pSearch, UINT bit, BOOLEAN mine)
+{
+    UINT    constraint = 0;
+    UINT    ix = 0;
+    BOOLEAN ok = TRUE;
+    UINT    position = pSearch->pComponent->firstTile + bit;
+    LONG    weight = 0;
+
+    pSearch->assigned[bit/64] |= ((UINT64) 1) << (bit%64);
+    if (mine)
+    {
+        pSearch->mines[bit/64] |= ((UINT64) 1) << (bit%64);
+    }
+    probabilityData.pTrail[pSearch->pComponent->firstTile + pSearch->trailCount] = (LONG) bit;
+    pSearch->trailCount++;
+
+    //Every constraint is updated, even past a failure, so undoing stays simple
+    for (ix = 0; ix < (UINT) probabilityData.pTileNumConstraints[position]; ix++)
+    {
+        constraint = (UINT) probabilityData.pTileConstraints[position*MINE_SOLVER_MAX_NEIGHBORS + ix];
+        weight = (LONG) probabilityData.pTileWeights[position*MINE_SOLVER_MAX_NEIGHBORS + ix];
+
+        probabilityData.pFree[constraint] -= weight;
+        if (mine)
+        {
+            probabilityData.pNeed[constraint] -= weight;
+        }
+
+        if ((0 > probabilityData.pNeed[constraint]) ||
+            (probabilityData.pNeed[constraint] > probabilityData.pFree[constraint]))
+        {
+            ok = FALSE;
+        }
+    }
+
+    return ok;
+}
+
+/**
+    MineProbability_Cleanup
+*//**
+    Free the layout counts and combining tables. The rest of the storage goes
+    with the arena.
+*/
+VOID
+MineProbability_Cleanup(VOID)
+{
+    HANDLE hHeap = GetProcessHeap();
+    PVOID  pBlocks[2] = {probabilityData.pCounts, probabilityData.pTables};
+    UINT   ix = 0;
+
+    for (ix = 0; ix < sizeof(pBlocks)/sizeof(pBlocks[0]); ix++)
+    {
+        if (NULL == pBlocks[ix])
+        {
+            continue;
+        }
+
+        if (NULL == hHeap)
+        {
+            MineDebug_PrintWarning("Getting process heap: %lu\n", GetLastError());
+            break;
+        }
+
+        if (0 == HeapFree(hHeap, 0, pBlocks[ix]))
+        {
+            MineDebug_PrintWarning("Unable to free probability storage: %lu\n", GetLastError());
+        }
+    }
+
+    probabilityData.pCounts = NULL;
+    probabilityData.countCapacity = 0;
+    probabilityData.pTables = NULL;
+    probabilityData.tableCapacity = 0;
+
+    return;
+}
+
+/**
+    MineProbability_Combine
+*//**
+    Weigh the layouts of every component by the number of ways the mines left
+    over can sit among the interior tiles, C(interior, mines left over), and
+    set the chance of each frontier tile and of the interior. Components that
+    were given up on join the interior. When the tables would be too large the
+    components are weighed one at a time against the mine density, and the
+    result is no longer exact.
+
+    @return Mine error code (MINE_ERROR_SUCCESS upon success).
+*/
+MINE_ERROR
+MineProbability_Combine(VOID)
+{
+    BOOLEAN                     bFalse = FALSE;
+    UINT                        bit = 0;
+    double                      chance = 0.0;
+    UINT                        complete = 0;
+    double                      density = 0.0;
+    double                      expected = 0.0;
+    LONG                        interior = (LONG) probabilityData.numInterior;
+    UINT                        ix = 0;
+    UINT                        jx = 0;
+    LONG                        kx = 0;
+    LONG                        length = 0;
+    double                      logMax = 0.0;
+    double                      logOdds = 0.0;
+    LONG                        minesLeft = (LONG) gameData.mines - (LONG) solverData.numFlagged -
+                                            (LONG) solverData.numMines;
+    LONG                        mx = 0;
+    UINT                        numTiles = 0;
+    PVOID                       pBlock = NULL;
+    MINE_PROBABILITY_COMPONENT* pComponent = NULL;
+    double*                     pCount = NULL;
+    double*                     pPrefix = NULL;
+    double*                     pRow = NULL;
+    double*                     pSuffix = NULL;
+    double*                     pWays = NULL;
+    double                      remaining[MINE_PROBABILITY_MAX_TILES + 1] = {0};
+    SIZE_T                      rows = 0;
+    MINE_ERROR                  status = MINE_ERROR_SUCCESS;
+    double                      total = 0.0;
+    LONG                        undecided = (LONG) solverData.numUnknown - (LONG) solverData.numSafe -
+                                            (LONG) solverData.numMines;
+    UINT                        used = 0;
+
+    do
+    {
+        /** Count layouts as shares of each component, so products stay in range. */
+        for (ix = 0; ix < probabilityData.numComponents; ix++)
+        {
+            pComponent = &probabilityData.pComponents[ix];
+            numTiles = pComponent->numTiles;
+
+            if (!pComponent->complete)
+            {
+                interior += (LONG) numTiles;
+            }
+            else if (0 == pComponent->solutions)
+            {
+                probabilityData.contradiction = TRUE;
+            }
+            else
+            {
+                pCount = probabilityData.pCounts + pComponent->firstCount;
+                for (jx = 0; jx < (numTiles + 1)*(numTiles + 1); jx++)
+                {
+                    pCount[jx] /= (double) pComponent->solutions;
+                }
+
+                used += numTiles;
+                complete++;
+            }
+        }
+
+        if ((0 > minesLeft) || (minesLeft > undecided))
+        {
+            probabilityData.contradiction = TRUE;
+        }
+
+        density = (0 < undecided) ? ((double) minesLeft)/((double) undecided) : 0.0;
+        density = (0.0 > density) ? 0.0 : ((1.0 < density) ? 1.0 : density);
+        probabilityData.interiorProbability = (FLOAT) density;
+
+        if (probabilityData.contradiction)
+        {
+            //No layout fits, every undecided tile is left at the mine density
+            for (ix = 0; ix < probabilityData.numFrontier; ix++)
+            {
+                probabilityData.pProbabilities[probabilityData.pTiles[ix]] = (FLOAT) density;
+            }
+            break;
+        }
+
+        /** A row of ways, a row for each prefix of the components and a row for the suffix. */
+        length = ((LONG) used < minesLeft) ? (LONG) used + 1 : minesLeft + 1;
+        rows = (SIZE_T) complete + 3;
+        probabilityData.exact = (rows*((SIZE_T) length) <= MINE_PROBABILITY_MAX_TABLE) &&
+                                (0 == probabilityData.incompleteComponents) ? (BOOLEAN) TRUE : (BOOLEAN) FALSE;
+
+        if (rows*((SIZE_T) length) <= MINE_PROBABILITY_MAX_TABLE)
+        {
+            pBlock = probabilityData.pTables;
+            status = MineProbability_Grow(&pBlock, &probabilityData.tableCapacity, rows*((SIZE_T) length)*sizeof(double));
+            probabilityData.pTables = (double*) pBlock;
+            if (MINE_ERROR_SUCCESS != status)
+            {
+                MineDebug_PrintError("In function MineProbability_Grow: %i\n", (int) status);
+                break;
+            }
+
+            /** Ways for the interior to hold what a frontier with kx mines leaves
+                over, scaled by the largest so none overflows. */
+            pWays = probabilityData.pTables;
+            logMax = -HUGE_VAL;
+            for (kx = 0; kx < length; kx++)
+            {
+                if (minesLeft - kx <= interior)
+                {
+                    pWays[kx] = lgamma((double) interior + 1.0) - lgamma((double) (minesLeft - kx) + 1.0) -
+                                lgamma((double) (interior - minesLeft + kx) + 1.0);
+                    logMax = (pWays[kx] > logMax) ? pWays[kx] : logMax;
+                }
+            }
+            for (kx = 0; kx < length; kx++)
+            {
+                pWays[kx] = (minesLeft - kx <= interior) ? exp(pWays[kx] - logMax) : 0.0;
+            }
+
+            /** Mine count shares of the first jx components, in row jx. */
+            pPrefix = pWays + length;
+            ZeroMemory(pPrefix, ((SIZE_T) length)*sizeof(double));
+            pPrefix[0] = 1.0;
+            pRow = pPrefix;
+            for (ix = 0; ix < probabilityData.numComponents; ix++)
+            {
+                pComponent = &probabilityData.pComponents[ix];
+                if (!pComponent->complete)
+                {
+                    continue;
+                }
+
+                pCount = probabilityData.pCounts + pComponent->firstCount;
+                ZeroMemory(pRow + length, ((SIZE_T) length)*sizeof(double));
+                for (kx = 0; kx < length; kx++)
+                {
+                    for (mx = 0; (mx <= (LONG) pComponent->numTiles) && (kx + mx < length); mx++)
+                    {
+                        pRow[length + kx + mx] += pRow[kx]*pCount[mx];
+                    }
+                }
+                pRow += length;
+            }
+
+            for (kx = 0; kx < length; kx++)
+            {
+                total += pRow[kx]*pWays[kx];
+                expected += pRow[kx]*pWays[kx]*((double) (minesLeft - kx));
+            }
+
+            if (0.0 >= total)
+            {
+                probabilityData.contradiction = TRUE;
+                probabilityData.exact = FALSE;
+                for (ix = 0; ix < probabilityData.numFrontier; ix++)
+                {
+                    probabilityData.pProbabilities[probabilityData.pTiles[ix]] = (FLOAT) density;
+                }
+                break;
+            }
+
+            probabilityData.interiorProbability = (0 < interior) ? (FLOAT) (expected/(total*(double) interior)) : 0.0f;
+
+            /** Walk back over the components. The ways for the rest of the board to
+                hold what a component leaves over are the prefix before it against
+                the suffix after it, and the suffix is folded into the interior ways
+                one component at a time. */
+            pSuffix = pRow + length;
+            (void) memcpy(pSuffix, pWays, ((SIZE_T) length)*sizeof(double));
+            for (ix = probabilityData.numComponents; 0 < ix; ix--)
+            {
+                pComponent = &probabilityData.pComponents[ix - 1];
+                if (!pComponent->complete)
+                {
+                    continue;
+                }
+
+                numTiles = pComponent->numTiles;
+                pCount = probabilityData.pCounts + pComponent->firstCount;
+                pRow -= length;
+
+                for (kx = 0; kx <= (LONG) numTiles; kx++)
+                {
+                    remaining[kx] = 0.0;
+                    for (mx = 0; mx + kx < length; mx++)
+                    {
+                        remaining[kx] += pRow[mx]*pSuffix[mx + kx];
+                    }
+                }
+
+                for (bit = 0; bit < numTiles; bit++)
+                {
+                    chance = 0.0;
+                    for (kx = 0; kx <= (LONG) numTiles; kx++)
+                    {
+                        chance += pCount[numTiles + 1 + ((UINT) kx)*numTiles + bit]*remaining[kx];
+                    }
+                    probabilityData.pProbabilities[probabilityData.pTiles[pComponent->firstTile + bit]] =
+                        (FLOAT) (chance/total);
+                }
+
+                //Fold the component into the suffix, using the row of its prefix as scratch
+                for (kx = 0; kx < length; kx++)
+                {
+                    pRow[kx] = 0.0;
+                    for (mx = 0; (mx <= (LONG) numTiles) && (kx + mx < length); mx++)
+                    {
+                        pRow[kx] += pCount[mx]*pSuffix[kx + mx];
+                    }
+                }
+                (void) memcpy(pSuffix, pRow, ((SIZE_T) length)*sizeof(double));
+            }
+        }
+        else
+        {
+            /** Too many components to combine exactly, weigh the mine counts of
+                each one by the odds of a tile being a mine at the density. */
+            chance = (1e-9 > density) ? 1e-9 : ((1.0 - 1e-9 < density) ? 1.0 - 1e-9 : density);
+            logOdds = log(chance) - log(1.0 - chance);
+
+            for (ix = 0; ix < probabilityData.numComponents; ix++)
+            {
+                pComponent = &probabilityData.pComponents[ix];
+                if (!pComponent->complete)
+                {
+                    continue;
+                }
+
+                numTiles = pComponent->numTiles;
+                pCount = probabilityData.pCounts + pComponent->firstCount;
+                logMax = -HUGE_VAL;
+                for (kx = 0; kx <= (LONG) numTiles; kx++)
+                {
+                    if ((0.0 < pCount[kx]) && (kx*logOdds > logMax))
+                    {
+                        logMax = kx*logOdds;
+                    }
+                }
+
+                total = 0.0;
+                for (kx = 0; kx <= (LONG) numTiles; kx++)
+                {
+                    remaining[kx] = (0.0 < pCount[kx]) ? exp(kx*logOdds - logMax) : 0.0;
+                    total += pCount[kx]*remaining[kx];
+                }
+
+                for (bit = 0; bit < numTiles; bit++)
+                {
+                    chance = 0.0;
+                    for (kx = 0; kx <= (LONG) numTiles; kx++)
+                    {
+                        chance += pCount[numTiles + 1 + ((UINT) kx)*numTiles + bit]*remaining[kx];
+                    }
+                    probabilityData.pProbabilities[probabilityData.pTiles[pComponent->firstTile + bit]] =
+                        (FLOAT) (chance/total);
+                    expected += chance/total;
+                }
+            }
+
+            if (0 < interior)
+            {
+                chance = (((double) minesLeft) - expected)/((double) interior);
+                probabilityData.interiorProbability = (FLOAT) ((0.0 > chance) ? 0.0 : ((1.0 < chance) ? 1.0 : chance));
+            }
+        }
+
+        /** Tiles of the components given up on are part of the interior. */
+        for (ix = 0; ix < probabilityData.numComponents; ix++)
+        {
+            pComponent = &probabilityData.pComponents[ix];
+            for (jx = 0; (!pComponent->complete) && (jx < pComponent->numTiles); jx++)
+            {
+                probabilityData.pProbabilities[probabilityData.pTiles[pComponent->firstTile + jx]] =
+                    probabilityData.interiorProbability;
+            }
+        }
+
+        __assume(FALSE == bFalse);
+    } while (bFalse);
+
+    return status;
+}
+
+/**
+    MineProbability_Component
+*//**
+    Pool job that counts the mine layouts of one component, by number of
+    mines, and how often each of its tiles is a mine in them. Components only
+    share read-only board state, and each job writes its own part of the
+    component arrays.
+
+    @param[in] pContext - Unused.
+    @param[in] job      - Index of the component.
+*/
+VOID
+MineProbability_Component(_In_opt_ PVOID pContext, UINT job)
+{
+    UINT                        constraint = 0;
+    BOOLEAN                     consistent = TRUE;
+    UINT                        numTiles = 0;
+    MINE_PROBABILITY_COMPONENT* pComponent = &probabilityData.pComponents[job];
+    MINE_SOLVER_CONSTRAINT*     pConstraint = NULL;
+    MINE_PROBABILITY_SEARCH     search = {0};
+
+    UNREFERENCED_PARAMETER(pContext);
+
+    numTiles = pComponent->numTiles;
+    pComponent->nodes = 0;
+    pComponent->solutions = 0;
+    pComponent->complete = FALSE;
+
+    if (MINE_PROBABILITY_MAX_TILES >= numTiles)
+    {
+        ZeroMemory(probabilityData.pCounts + pComponent->firstCount,
+                   ((SIZE_T) (numTiles + 1))*((SIZE_T) (numTiles + 1))*sizeof(double));
+
+        for (constraint = pComponent->firstConstraint;
+             constraint < pComponent->firstConstraint + pComponent->numConstraints; constraint++)
+        {
+            pConstraint = &solverData.pConstraints[probabilityData.pConstraints[constraint]];
+            probabilityData.pNeed[constraint] = pConstraint->remaining;
+            probabilityData.pFree[constraint] = pConstraint->total;
+
+            if ((0 > pConstraint->remaining) || (pConstraint->remaining > pConstraint->total))
+            {
+                consistent = FALSE;
+            }
+        }
+
+        //A constraint that cannot be met leaves the component with no layouts
+        pComponent->complete = TRUE;
+        if (consistent)
+        {
+            search.pComponent = pComponent;
+            MineProbability_Search(&search);
+        }
+    }
+
+    return;
+}
+
+/**
+    MineProbability_Find
+*//**
+    Find the union find root of a frontier tile, halving the path on the way.
+
+    @param[in] slot - Index into pFrontier of the tile.
+
+    @return Index into pFrontier of the root.
+*/
+LONG
+MineProbability_Find(LONG slot)
+{
+    while (probabilityData.pParent[slot] != slot)
+    {
+        probabilityData.pParent[slot] = probabilityData.pParent[probabilityData.pParent[slot]];
+        slot = probabilityData.pParent[slot];
+    }
+
+    return slot;
+}
+
+/**
+    MineProbability_Frontier
+*//**
+    Split the undecided tiles next to revealed numbers into components, tiles
+    joined by a number they are both next to, and lay out the bit sets and
+    constraint lists the search works from. Reads the constraints left by the
+    last solve.
+
+    @return Mine error code (MINE_ERROR_SUCCESS upon success).
+*/
+MINE_ERROR
+MineProbability_Frontier(VOID)
+{
+    BOOLEAN                     bFalse = FALSE;
+    LONG                        constraint = 0;
+    SIZE_T                      counts = 0;
+    LONG                        entry = 0;
+    LONG                        first = -1;
+    UINT                        ix = 0;
+    UINT                        jx = 0;
+    UINT                        numTiles = 0;
+    PVOID                       pBlock = NULL;
+    MINE_PROBABILITY_COMPONENT* pComponent = NULL;
+    MINE_SOLVER_CONSTRAINT*     pConstraint = NULL;
+    LONG                        position = 0;
+    LONG                        slot = 0;
+    MINE_ERROR                  status = MINE_ERROR_SUCCESS;
+
+    do
+    {
+        /** Numbers with undecided tiles left join those tiles into one constraint. */
+        for (ix = 0; ix < solverData.numConstraints; ix++)
+        {
+            pConstraint = &solverData.pConstraints[ix];
+            MineSolver_Build(pConstraint->center, pConstraint);
+            if (0 == pConstraint->count)
+            {
+                continue;
+            }
+
+            probabilityData.pLive[probabilityData.numLive++] = (LONG) ix;
+
+            for (jx = 0; jx < pConstraint->count; jx++)
+            {
+                slot = probabilityData.pSlotOf[pConstraint->tiles[jx]];
+                if (0 > slot)
+                {
+                    slot = (LONG) probabilityData.numFrontier++;
+                    probabilityData.pSlotOf[pConstraint->tiles[jx]] = slot;
+                    probabilityData.pFrontier[slot] = pConstraint->tiles[jx];
+                    probabilityData.pParent[slot] = slot;
+                }
+
+                if (0 == jx)
+                {
+                    first = MineProbability_Find(slot);
+                }
+                else
+                {
+                    probabilityData.pParent[MineProbability_Find(slot)] = first;
+                }
+            }
+        }
+
+        //Once every root is known, a root's parent entry is free to hold its constraint
+        for (ix = 0; ix < probabilityData.numFrontier; ix++)
+        {
+            probabilityData.pRoot[ix] = MineProbability_Find((LONG) ix);
+        }
+        for (ix = 0; ix < probabilityData.numFrontier; ix++)
+        {
+            if ((LONG) ix == probabilityData.pRoot[ix])
+            {
+                probabilityData.pParent[ix] = (LONG) probabilityData.numComponents++;
+            }
+        }
+
+        ZeroMemory(probabilityData.pComponents,
+                   ((SIZE_T) probabilityData.numComponents)*sizeof(MINE_PROBABILITY_COMPONENT));
+
+        /** Group the tiles and constraints by component, in the order they were found. */
+        for (ix = 0; ix < probabilityData.numFrontier; ix++)
+        {
+            probabilityData.pComponents[probabilityData.pParent[probabilityData.pRoot[ix]]].numTiles++;
+        }
+        for (ix = 0; ix < probabilityData.numLive; ix++)
+        {
+            slot = probabilityData.pSlotOf[solverData.pConstraints[probabilityData.pLive[ix]].tiles[0]];
+            probabilityData.pComponents[probabilityData.pParent[probabilityData.pRoot[slot]]].numConstraints++;
+        }
+
+        for (ix = 0, jx = 0, position = 0; ix < probabilityData.numComponents; ix++)
+        {
+            pComponent = &probabilityData.pComponents[ix];
+            pComponent->firstTile = (UINT) position;
+            pComponent->firstConstraint = jx;
+            position += (LONG) pComponent->numTiles;
+            jx += pComponent->numConstraints;
+            pComponent->numTiles = 0;
+            pComponent->numConstraints = 0;
+        }
+
+        for (ix = 0; ix < probabilityData.numFrontier; ix++)
+        {
+            pComponent = &probabilityData.pComponents[probabilityData.pParent[probabilityData.pRoot[ix]]];
+            probabilityData.pTiles[pComponent->firstTile + pComponent->numTiles++] = probabilityData.pFrontier[ix];
+        }
+        for (ix = 0; ix < probabilityData.numLive; ix++)
+        {
+            slot = probabilityData.pSlotOf[solverData.pConstraints[probabilityData.pLive[ix]].tiles[0]];
+            pComponent = &probabilityData.pComponents[probabilityData.pParent[probabilityData.pRoot[slot]]];
+            probabilityData.pConstraints[pComponent->firstConstraint + pComponent->numConstraints++] =
+                probabilityData.pLive[ix];
+        }
+
+        for (ix = 0; ix < probabilityData.numFrontier; ix++)
+        {
+            probabilityData.pSlotOf[probabilityData.pTiles[ix]] = (LONG) ix;
+            probabilityData.pTileNumConstraints[ix] = 0;
+        }
+
+        /** Each constraint becomes a bit set over its component, and each tile
+            lists the constraints it is in. */
+        for (ix = 0; ix < probabilityData.numComponents; ix++)
+        {
+            pComponent = &probabilityData.pComponents[ix];
+            numTiles = pComponent->numTiles;
+            probabilityData.largestComponent = (numTiles > probabilityData.largestComponent) ?
+                                               numTiles : probabilityData.largestComponent;
+
+            if (MINE_PROBABILITY_MAX_TILES < numTiles)
+            {
+                continue;
+            }
+
+            pComponent->firstCount = counts;
+            counts += ((SIZE_T) (numTiles + 1))*((SIZE_T) (numTiles + 1));
+
+            for (constraint = (LONG) pComponent->firstConstraint;
+                 constraint < (LONG) (pComponent->firstConstraint + pComponent->numConstraints); constraint++)
+            {
+                pConstraint = &solverData.pConstraints[probabilityData.pConstraints[constraint]];
+                ZeroMemory(&probabilityData.pMasks[constraint*MINE_PROBABILITY_WORDS], MINE_PROBABILITY_WORDS*sizeof(UINT64));
+
+                for (jx = 0; jx < pConstraint->count; jx++)
+                {
+                    position = probabilityData.pSlotOf[pConstraint->tiles[jx]];
+                    slot = position - (LONG) pComponent->firstTile;
+                    probabilityData.pMasks[constraint*MINE_PROBABILITY_WORDS + slot/64] |= ((UINT64) 1) << (slot%64);
+
+                    entry = position*MINE_SOLVER_MAX_NEIGHBORS + probabilityData.pTileNumConstraints[position]++;
+                    probabilityData.pTileConstraints[entry] = constraint;
+                    probabilityData.pTileWeights[entry] = pConstraint->weights[jx];
+                }
+            }
+        }
+
+        pBlock = probabilityData.pCounts;
+        status = MineProbability_Grow(&pBlock, &probabilityData.countCapacity, counts*sizeof(double));
+        probabilityData.pCounts = (double*) pBlock;
+        if (MINE_ERROR_SUCCESS != status)
+        {
+            MineDebug_PrintError("In function MineProbability_Grow: %i\n", (int) status);
+            break;
+        }
+
+        __assume(FALSE == bFalse);
+    } while (bFalse);
+
+    return status;
+}
+
+/**
+    MineProbability_Grow
+*//**
+    Make sure a block taken from the process heap holds at least the given
+    number of bytes. A block that grows loses what it held.
+
+    @param[in,out] ppBlock   - Block to grow, NULL for none yet.
+    @param[in,out] pCapacity - Number of bytes in the block.
+    @param[in]     bytes     - Number of bytes needed.
+
+    @return Mine error code (MINE_ERROR_SUCCESS upon success).
+*/
+MINE_ERROR
+MineProbability_Grow(_Inout_ PVOID* ppBlock, _Inout_ SIZE_T* pCapacity, SIZE_T bytes)
+{
+    BOOLEAN    bFalse = FALSE;
+    HANDLE     hHeap = NULL;
+    MINE_ERROR status = MINE_ERROR_SUCCESS;
+
+    do
+    {
+        if ((NULL != *ppBlock) && (bytes <= *pCapacity))
+        {
+            break;
+        }
+
+        hHeap = GetProcessHeap();
+        if (NULL == hHeap)
+        {
+            MineDebug_PrintError("Getting process heap: %lu\n", GetLastError());
+            status = MINE_ERROR_HEAP;
+            break;
+        }
+
+        if ((NULL != *ppBlock) && (0 == HeapFree(hHeap, 0, *ppBlock)))
+        {
+            MineDebug_PrintWarning("Unable to free probability storage: %lu\n", GetLastError());
+        }
+        *pCapacity = 0;
+
+        //Grow by half again, so a slowly growing frontier does not reallocate every solve
+        bytes = (0 == bytes) ? MINE_ARENA_ALIGN : bytes + bytes/2;
+        *ppBlock = HeapAlloc(hHeap, 0, bytes);
+        if (NULL == *ppBlock)
+        {
+            MineDebug_PrintError("Allocating %u bytes of probability storage\n", (UINT) bytes);
+            status = MINE_ERROR_MEMORY;
+            break;
+        }
+
+        *pCapacity = bytes;
+
+        __assume(FALSE == bFalse);
+    } while (bFalse);
+
+    return status;
+}
+
+/**
+    MineProbability_Propagate
+*//**
+    Give a value to every tile forced by the tiles assigned since a point in
+    the trail: a constraint with no mines left needs every tile it has left to
+    be safe, one with as many mines left as tiles needs them all to be mines.
+
+    @param[in] pSearch - Search state.
+    @param[in] from    - Position in the trail to start from.
+
+    @return TRUE if every constraint can still be met, FALSE otherwise.
+*/
+BOOLEAN
+MineProbability_Propagate(_Inout_ MINE_PROBABILITY_SEARCH* pSearch, UINT from)
+{
+    UINT    bit = 0;
+    UINT    constraint = 0;
+    DWORD   index = 0;
+    UINT    ix = 0;
+    BOOLEAN mine = FALSE;
+    UINT    position = 0;
+    UINT64  unassigned = 0;
+    UINT    word = 0;
+
+    //Tiles forced here join the trail, and are looked at in turn
+    for (; from < pSearch->trailCount; from++)
+    {
+        bit = (UINT) probabilityData.pTrail[pSearch->pComponent->firstTile + from];
+        position = pSearch->pComponent->firstTile + bit;
+
+        for (ix = 0; ix < (UINT) probabilityData.pTileNumConstraints[position]; ix++)
+        {
+            constraint = (UINT) probabilityData.pTileConstraints[position*MINE_SOLVER_MAX_NEIGHBORS + ix];
+            if ((0 == probabilityData.pFree[constraint]) ||
+                ((0 != probabilityData.pNeed[constraint]) &&
+                 (probabilityData.pNeed[constraint] != probabilityData.pFree[constraint])))
+            {
+                continue;
+            }
+
+            mine = (0 != probabilityData.pNeed[constraint]) ? (BOOLEAN) TRUE : (BOOLEAN) FALSE;
+            for (word = 0; word < MINE_PROBABILITY_WORDS; word++)
+            {
+                unassigned = probabilityData.pMasks[constraint*MINE_PROBABILITY_WORDS + word] & ~pSearch->assigned[word];
+                while (_BitScanForward64(&index, unassigned))
+                {
+                    unassigned &= unassigned - 1;
+                    if (!MineProbability_Assign(pSearch, word*64 + (UINT) index, mine))
+                    {
+                        return FALSE;
+                    }
+                }
+            }
+        }
+    }
+
+    return TRUE;
+}
+
+/**
+    MineProbability_Reserve
+*//**
+    Take the last solve's frontier off the tile arrays.
+
+    @return Mine error code (MINE_ERROR_SUCCESS upon success).
+*/
+MINE_ERROR
+MineProbability_Reserve(VOID)
+{
+    BOOLEAN    bFalse = FALSE;
+    UINT       ix = 0;
+    MINE_ERROR status = MINE_ERROR_SUCCESS;
+    DWORD      tiles = gameData.width*gameData.height;
+
+    do
+    {
+        if ((NULL == probabilityData.pProbabilities) || (arenaData.resets != probabilityData.arenaResets) ||
+            (tiles != probabilityData.tileCapacity))
+        {
+            MineDebug_PrintError("Probability storage has not been set up for the game\n");
+            status = MINE_ERROR_PARAMETER;
+            break;
+        }
+
+        /** Only undo the last frontier, so the cost follows the frontier rather than the board. */
+        for (ix = 0; ix < probabilityData.numFrontier; ix++)
+        {
+            probabilityData.pSlotOf[probabilityData.pFrontier[ix]] = -1;
+        }
+
+        probabilityData.numFrontier = 0;
+        probabilityData.numLive = 0;
+        probabilityData.numComponents = 0;
+        probabilityData.largestComponent = 0;
+        probabilityData.incompleteComponents = 0;
+        probabilityData.numInterior = 0;
+        probabilityData.bestTile = -1;
+        probabilityData.bestProbability = 1.0f;
+        probabilityData.exact = FALSE;
+        probabilityData.contradiction = FALSE;
+
+        __assume(FALSE == bFalse);
+    } while (bFalse);
+
+    return status;
+}
+
+/**
+    MineProbability_Reset
+*//**
+    Carve the tile and component arrays for the board in gameData out of the
+    arena. Must be called for each new game that is solved, after
+    Mine_AllocBoard was given MineProbability_ArenaBytes more bytes.
+
+    @return Mine error code (MINE_ERROR_SUCCESS upon success).
+*/
+MINE_ERROR
+MineProbability_Reset(VOID)
+{
+    BOOLEAN    bFalse = FALSE;
+    DWORD      ix = 0;
+    MINE_ERROR status = MINE_ERROR_SUCCESS;
+    DWORD      tiles = gameData.width*gameData.height;
+
+    do
+    {
+        //What was carved for the last game went with the arena reset
+        probabilityData.pProbabilities = (FLOAT*) MineArena_Alloc(((SIZE_T) tiles)*sizeof(FLOAT));
+        probabilityData.pSlotOf = (LONG*) MineArena_Alloc(((SIZE_T) tiles)*sizeof(LONG));
+        probabilityData.pFrontier = (LONG*) MineArena_Alloc(((SIZE_T) tiles)*sizeof(LONG));
+        probabilityData.pParent = (LONG*) MineArena_Alloc(((SIZE_T) tiles)*sizeof(LONG));
+        probabilityData.pRoot = (LONG*) MineArena_Alloc(((SIZE_T) tiles)*sizeof(LONG));
+        probabilityData.pTiles = (LONG*) MineArena_Alloc(((SIZE_T) tiles)*sizeof(LONG));
+        probabilityData.pLive = (LONG*) MineArena_Alloc(((SIZE_T) tiles)*sizeof(LONG));
+        probabilityData.pComponents = (MINE_PROBABILITY_COMPONENT*)
+                                      MineArena_Alloc(((SIZE_T) tiles)*sizeof(MINE_PROBABILITY_COMPONENT));
+        probabilityData.pConstraints = (LONG*) MineArena_Alloc(((SIZE_T) tiles)*sizeof(LONG));
+        probabilityData.pMasks = (UINT64*) MineArena_Alloc(((SIZE_T) tiles)*MINE_PROBABILITY_WORDS*sizeof(UINT64));
+        probabilityData.pNeed = (LONG*) MineArena_Alloc(((SIZE_T) tiles)*sizeof(LONG));
+        probabilityData.pFree = (LONG*) MineArena_Alloc(((SIZE_T) tiles)*sizeof(LONG));
+        probabilityData.pTileConstraints = (LONG*) MineArena_Alloc(((SIZE_T) tiles)*MINE_SOLVER_MAX_NEIGHBORS*
+                                                                   sizeof(LONG));
+        probabilityData.pTileWeights = (CHAR*) MineArena_Alloc(((SIZE_T) tiles)*MINE_SOLVER_MAX_NEIGHBORS);
+        probabilityData.pTileNumConstraints = (CHAR*) MineArena_Alloc(tiles);
+        probabilityData.pTrail = (LONG*) MineArena_Alloc(((SIZE_T) tiles)*sizeof(LONG));
+        probabilityData.tileCapacity = tiles;
+        probabilityData.arenaResets = arenaData.resets;
+
+        if ((NULL == probabilityData.pProbabilities) || (NULL == probabilityData.pSlotOf) ||
+            (NULL == probabilityData.pFrontier) || (NULL == probabilityData.pParent) ||
+            (NULL == probabilityData.pRoot) || (NULL == probabilityData.pTiles) || (NULL == probabilityData.pLive) ||
+            (NULL == probabilityData.pComponents) || (NULL == probabilityData.pConstraints) ||
+            (NULL == probabilityData.pMasks) || (NULL == probabilityData.pNeed) || (NULL == probabilityData.pFree) ||
+            (NULL == probabilityData.pTileConstraints) || (NULL == probabilityData.pTileWeights) ||
+            (NULL == probabilityData.pTileNumConstraints) || (NULL == probabilityData.pTrail))
+        {
+            MineDebug_PrintError("Arena has no room for the probability storage of %u tiles\n", (UINT) tiles);
+            probabilityData.pProbabilities = NULL;
+            status = MINE_ERROR_MEMORY;
+            break;
+        }
+
+        for (ix = 0; ix < tiles; ix++)
+        {
+            probabilityData.pSlotOf[ix] = -1;
+        }
+        probabilityData.numFrontier = 0;
+
+        __assume(FALSE == bFalse);
+    } while (bFalse);
+
+    return status;
+}
+
+/**
+    MineProbability_Search
+*//**
+    Count the layouts of the component that fit the values given so far, by
+    trying the first tile without a value as safe and then as a mine. Gives up
+    on the component once it has visited MINE_PROBABILITY_MAX_NODES nodes.
+
+    @param[in] pSearch - Search state.
+*/
+VOID
+MineProbability_Search(_Inout_ MINE_PROBABILITY_SEARCH* pSearch)
+{
+    UINT                        bit = 0;
+    UINT                        count = 0;
+    DWORD                       index = 0;
+    UINT                        mark = 0;
+    UINT                        mine = 0;
+    UINT                        numTiles = pSearch->pComponent->numTiles;
+    MINE_PROBABILITY_COMPONENT* pComponent = pSearch->pComponent;
+    double*                     pCount = probabilityData.pCounts + pSearch->pComponent->firstCount;
+    UINT64                      unassigned = 0;
+    UINT                        word = 0;
+
+    if (MINE_PROBABILITY_MAX_NODES < ++pComponent->nodes)
+    {
+        pComponent->complete = FALSE;
+        return;
+    }
+
+    for (word = 0; word < MINE_PROBABILITY_WORDS; word++)
+    {
+        if (numTiles > word*64)
+        {
+            unassigned = ~pSearch->assigned[word];
+            if (numTiles < (word + 1)*64)
+            {
+                unassigned &= (((UINT64) 1) << (numTiles - word*64)) - 1;
+            }
+
+            if (_BitScanForward64(&index, unassigned))
+            {
+                break;
+            }
+        }
+    }
+
+    if (MINE_PROBABILITY_WORDS == word)
+    {
+        /** Every tile has a value, count the layout. */
+        for (word = 0; word < MINE_PROBABILITY_WORDS; word++)
+        {
+            count += (UINT) __popcnt64(pSearch->mines[word]);
+        }
+
+        pCount[count] += 1.0;
+        for (word = 0; word < MINE_PROBABILITY_WORDS; word++)
+        {
+            unassigned = pSearch->mines[word];
+            while (_BitScanForward64(&index, unassigned))
+            {
+                unassigned &= unassigned - 1;
+                pCount[numTiles + 1 + count*numTiles + word*64 + index] += 1.0;
+            }
+        }
+
+        pComponent->solutions++;
+        return;
+    }
+
+    bit = word*64 + (UINT) index;
+    for (mine = 0; (mine < 2) && pComponent->complete; mine++)
+    {
+        mark = pSearch->trailCount;
+        if (MineProbability_Assign(pSearch, bit, (BOOLEAN) mine) && MineProbability_Propagate(pSearch, mark))
+        {
+            MineProbability_Search(pSearch);
+        }
+        MineProbability_Undo(pSearch, mark);
+    }
+
+    return;
+}
+
+/**
+    MineProbability_Solve
+*//**
+    Find the chance of each tile being a mine from what the player can see:
+    revealed numbers, flags and the count of mines. Runs the solver first, so
+    certain tiles come out at exactly 0 or 1. Components are counted on the
+    worker pool when it has been started. Results are left in probabilityData.
+
+    @return Mine error code (MINE_ERROR_SUCCESS upon success).
+*/
+MINE_ERROR
+MineProbability_Solve(VOID)
+{
+    BOOLEAN    bFalse = FALSE;
+    FLOAT      chance = 0.0f;
+    LONG       ix = 0;
+    MINE_ERROR status = MINE_ERROR_SUCCESS;
+    LONG       tiles = (LONG) (gameData.width*gameData.height);
+    UINT       undecided = 0;
+
+    do
+    {
+        status = MineSolver_Solve();
+        if (MINE_ERROR_SUCCESS != status)
+        {
+            MineDebug_PrintError("In function MineSolver_Solve: %i\n", (int) status);
+            break;
+        }
+
+        status = MineProbability_Reserve();
+        if (MINE_ERROR_SUCCESS != status)
+        {
+            MineDebug_PrintError("In function MineProbability_Reserve: %i\n", (int) status);
+            break;
+        }
+
+        probabilityData.solves++;
+        probabilityData.contradiction = solverData.contradiction;
+
+        status = MineProbability_Frontier();
+        if (MINE_ERROR_SUCCESS != status)
+        {
+            MineDebug_PrintError("In function MineProbability_Frontier: %i\n", (int) status);
+            break;
+        }
+
+        undecided = solverData.numUnknown - solverData.numSafe - solverData.numMines;
+        probabilityData.numInterior = undecided - probabilityData.numFrontier;
+
+        MinePool_Run(MineProbability_Component, NULL, probabilityData.numComponents);
+
+        for (ix = 0; ix < (LONG) probabilityData.numComponents; ix++)
+        {
+            probabilityData.nodes += probabilityData.pComponents[ix].nodes;
+            probabilityData.solutions += probabilityData.pComponents[ix].solutions;
+            if (!probabilityData.pComponents[ix].complete)
+            {
+                probabilityData.incompleteComponents++;
+            }
+        }
+
+        status = MineProbability_Combine();
+        if (MINE_ERROR_SUCCESS != status)
+        {
+            MineDebug_PrintError("In function MineProbability_Combine: %i\n", (int) status);
+            break;
+        }
+
+        /** Fill in every tile off the frontier, and pick the safest hidden tile. */
+        for (ix = 0; ix < tiles; ix++)
+        {
+            if (MINE_TILE_STATUS_REVEALED == gameData.tileStatus[ix])
+            {
+                probabilityData.pProbabilities[ix] = 0.0f;
+                continue;
+            }
+
+            if (MINE_TILE_STATUS_FLAG == gameData.tileStatus[ix])
+            {
+                probabilityData.pProbabilities[ix] = 1.0f;
+                continue;
+            }
+
+            if (MINE_SOLVER_MARK_SAFE == solverData.pMarks[ix])
+            {
+                chance = 0.0f;
+            }
+            else if (MINE_SOLVER_MARK_MINE == solverData.pMarks[ix])
+            {
+                chance = 1.0f;
+            }
+            else if (0 > probabilityData.pSlotOf[ix])
+            {
+                chance = probabilityData.interiorProbability;
+            }
+            else
+            {
+                chance = probabilityData.pProbabilities[ix];
+            }
+
+            probabilityData.pProbabilities[ix] = chance;
+            if ((0 > probabilityData.bestTile) || (chance < probabilityData.bestProbability))
+            {
+                probabilityData.bestTile = ix;
+                probabilityData.bestProbability = chance;
+            }
+        }
+
+        __assume(FALSE == bFalse);
+    } while (bFalse);
+
+    return status;
+}
+
+/**
+    MineProbability_Undo
+*//**
+    Take back the values given since a point in the trail.
+
+    @param[in] pSearch - Search state.
+    @param[in] mark    - Position in the trail to go back to.
+*/
+VOID
+MineProbability_Undo(_Inout_ MINE_PROBABILITY_SEARCH* pSearch, UINT mark)
+{
+    UINT    bit = 0;
+    UINT    constraint = 0;
+    UINT    ix = 0;
+    BOOLEAN mine = FALSE;
+    UINT    position = 0;
+    LONG    weight = 0;
+
+    while (pSearch->trailCount > mark)
+    {
+        pSearch->trailCount--;
+        bit = (UINT) probabilityData.pTrail[pSearch->pComponent->firstTile + pSearch->trailCount];
+        position = pSearch->pComponent->firstTile + bit;
+        mine = (0 != (pSearch->mines[bit/64] & (((UINT64) 1) << (bit%64)))) ? (BOOLEAN) TRUE : (BOOLEAN) FALSE;
+
+        for (ix = 0; ix < (UINT) probabilityData.pTileNumConstraints[position]; ix++)
+        {
+            constraint = (UINT) probabilityData.pTileConstraints[position*MINE_SOLVER_MAX_NEIGHBORS + ix];
+            weight = (LONG) probabilityData.pTileWeights[position*MINE_SOLVER_MAX_NEIGHBORS + ix];
+
+            probabilityData.pFree[constraint] += weight;
+            if (mine)
+            {
+                probabilityData.pNeed[constraint] += weight;
+            }
+        }
+
+        pSearch->assigned[bit/64] &= ~(((UINT64) 1) << (bit%64));
+        pSearch->mines[bit/64] &= ~(((UINT64) 1) << (bit%64));
+    }
+
+    return;
+}
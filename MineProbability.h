@@ -0,0 +1,363 @@
+/**
+    @file MineProbability.h
+
+    @author Craig Burkhart
+
+    @brief Header file for the mine probability engine, which finds the exact
+           chance of each hidden tile being a mine from what the player can see.
+           The game does not use it, only the headless autoplay benchmark and
+           the probability check do.
+*//*
+    Copyright (C) 2014 - Craig Burkhart
+
+    This file is part of Minesweeper Deluxe.
+
+    Minesweeper Deluxe is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Minesweeper Deluxe is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Minesweeper Deluxe.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#pragma once
+
+#include "Mine.h"
+
+//--------------------------------------------------------------
+//    Macros
+//--------------------------------------------------------------
+
+/** Number of 64 bit words in the bit sets of a component. */
+#define MINE_PROBABILITY_WORDS     2
+/** Most tiles in a component that is enumerated, larger ones are left to the
+    interior density. */
+#define MINE_PROBABILITY_MAX_TILES (64*MINE_PROBABILITY_WORDS)
+/** Most search nodes spent on one component before it is given up on. */
+#define MINE_PROBABILITY_MAX_NODES (1 << 20)
+/** Most entries in the tables that combine the components, beyond which they
+    are weighed one at a time against the mine density instead. */
+#define MINE_PROBABILITY_MAX_TABLE (1 << 22)
+
+//--------------------------------------------------------------
+//    Structures
+//--------------------------------------------------------------
+
+struct _MINE_PROBABILITY_COMPONENT
+{
+    /** Position in pTiles of the first tile. */
+    UINT      firstTile;
+    /** Number of tiles. */
+    UINT      numTiles;
+    /** Position in pConstraints of the first constraint. */
+    UINT      firstConstraint;
+    /** Number of constraints. */
+    UINT      numConstraints;
+    /** Position in pCounts of the layout counts by number of mines, followed by
+        the counts of each tile being a mine by number of mines. */
+    SIZE_T    firstCount;
+    /** Search nodes visited. */
+    ULONGLONG nodes;
+    /** Mine layouts found. */
+    ULONGLONG solutions;
+    /** Flag for if every layout was found. */
+    BOOLEAN   complete;
+};
+
+struct _MINE_PROBABILITY_SEARCH
+{
+    /** Component being searched. */
+    struct _MINE_PROBABILITY_COMPONENT* pComponent;
+    /** Tiles given a value, bit n for tile firstTile + n. */
+    UINT64                              assigned[MINE_PROBABILITY_WORDS];
+    /** Tiles given a mine. */
+    UINT64                              mines[MINE_PROBABILITY_WORDS];
+    /** Number of tiles in the trail. */
+    UINT                                trailCount;
+};
+
+struct _MINE_PROBABILITY_DATA
+{
+    /** Chance of each tile being a mine, 0 for revealed tiles and 1 for flags. */
+    FLOAT*                              pProbabilities;
+    /** Position in pTiles of each tile, -1 if it is not on the frontier. */
+    LONG*                               pSlotOf;
+    /** Frontier tiles, in the order they were found. */
+    LONG*                               pFrontier;
+    /** Union find parent of each frontier tile, later its component. */
+    LONG*                               pParent;
+    /** Union find root of each frontier tile. */
+    LONG*                               pRoot;
+    /** Frontier tiles, grouped by component. */
+    LONG*                               pTiles;
+    /** Indexes into solverData.pConstraints of the constraints with undecided
+        tiles, in the order they were found. */
+    LONG*                               pLive;
+    /** Number of tiles the tile and component arrays have room for. */
+    DWORD                               tileCapacity;
+    /** Value of arenaData.resets when the tile and component arrays were
+        carved out of the arena, they are gone once it is reset again. */
+    UINT                                arenaResets;
+    /** Components of the frontier. */
+    struct _MINE_PROBABILITY_COMPONENT* pComponents;
+    /** Indexes into solverData.pConstraints, grouped by component. */
+    LONG*                               pConstraints;
+    /** Tiles of each constraint, as bits of its component. */
+    UINT64*                             pMasks;
+    /** Mines each constraint still needs during the search. */
+    LONG*                               pNeed;
+    /** Weight of the tiles each constraint has without a value during the search. */
+    LONG*                               pFree;
+    /** Constraints next to each tile, MINE_SOLVER_MAX_NEIGHBORS per tile. */
+    LONG*                               pTileConstraints;
+    /** Weights of each tile in its constraints. */
+    CHAR*                               pTileWeights;
+    /** Number of constraints next to each tile. */
+    CHAR*                               pTileNumConstraints;
+    /** Tiles in the order they were given a value, for undoing. */
+    LONG*                               pTrail;
+    /** Layout counts of every component. Sized by the shape of the frontier
+        rather than the board, so it is taken from the process heap and only
+        grows when a solve needs more than any before it. */
+    double*                             pCounts;
+    /** Number of bytes in pCounts. */
+    SIZE_T                              countCapacity;
+    /** Tables that combine the components with the interior, taken from the
+        process heap like pCounts. */
+    double*                             pTables;
+    /** Number of bytes in pTables. */
+    SIZE_T                              tableCapacity;
+    /** Number of frontier tiles. */
+    UINT                                numFrontier;
+    /** Number of constraints with undecided tiles. */
+    UINT                                numLive;
+    /** Number of components. */
+    UINT                                numComponents;
+    /** Number of tiles in the largest component. */
+    UINT                                largestComponent;
+    /** Number of components given up on. */
+    UINT                                incompleteComponents;
+    /** Number of undecided tiles next to no revealed number. */
+    UINT                                numInterior;
+    /** Chance of each interior tile being a mine. */
+    FLOAT                               interiorProbability;
+    /** Board index of the hidden tile least likely to be a mine, -1 if none. */
+    LONG                                bestTile;
+    /** Chance of bestTile being a mine. */
+    FLOAT                               bestProbability;
+    /** Flag for if the probabilities are exact. */
+    BOOLEAN                             exact;
+    /** Flag for if no mine layout fits the visible board. */
+    BOOLEAN                             contradiction;
+    /** Number of solves run. */
+    ULONGLONG                           solves;
+    /** Search nodes visited since the program started. */
+    ULONGLONG                           nodes;
+    /** Mine layouts found since the program started. */
+    ULONGLONG                           solutions;
+};
+
+//--------------------------------------------------------------
+//    Typedefs
+//--------------------------------------------------------------
+
+/** Frontier tiles joined by shared revealed numbers, with their layout counts. */
+typedef struct _MINE_PROBABILITY_COMPONENT MINE_PROBABILITY_COMPONENT;
+
+/** State of the backtracking search over one component. */
+typedef struct _MINE_PROBABILITY_SEARCH MINE_PROBABILITY_SEARCH;
+
+/** Working storage and results of the probability engine. */
+typedef struct _MINE_PROBABILITY_DATA MINE_PROBABILITY_DATA;
+
+//--------------------------------------------------------------
+//    Global Variable Externs
+//--------------------------------------------------------------
+
+extern MINE_PROBABILITY_DATA probabilityData;
+
+//--------------------------------------------------------------
+//    Function Prototypes
+//--------------------------------------------------------------
+
+/**
+    MineProbability_ArenaBytes
+*//**
+    Number of bytes the tile and component arrays for the board in gameData
+    take from the arena, to be added to what Mine_AllocBoard is asked for.
+
+    @return Number of bytes.
+*/
+SIZE_T
+MineProbability_ArenaBytes(VOID);
+
+/**
+    MineProbability_Assign
+*//**
+    Give a tile of the component being searched a value, and take it out of the
+    constraints next to it.
+
+    @param[in] pSearch - Search state.
+    @param[in] bit     - Bit of the tile in its component.
+    @param[in] mine    - TRUE if the tile is a mine, FALSE if it is safe.
+
+    @return TRUE if every constraint next to the tile can still be met, FALSE otherwise.
+*/
+BOOLEAN
+MineProbability_Assign(_Inout_ MINE_PROBABILITY_SEARCH* pSearch, UINT bit, BOOLEAN mine);
+
+/**
+    MineProbability_Cleanup
+*//**
+    Free the layout counts and combining tables. The rest of the storage goes
+    with the arena.
+*/
+VOID
+MineProbability_Cleanup(VOID);
+
+/**
+    MineProbability_Combine
+*//**
+    Weigh the layouts of every component by the number of ways the mines left
+    over can sit among the interior tiles, C(interior, mines left over), and
+    set the chance of each frontier tile and of the interior. Components that
+    were given up on join the interior. When the tables would be too large the
+    components are weighed one at a time against the mine density, and the
+    result is no longer exact.
+
+    @return Mine error code (MINE_ERROR_SUCCESS upon success).
+*/
+MINE_ERROR
+MineProbability_Combine(VOID);
+
+/**
+    MineProbability_Component
+*//**
+    Pool job that counts the mine layouts of one component, by number of
+    mines, and how often each of its tiles is a mine in them. Components only
+    share read-only board state, and each job writes its own part of the
+    component arrays.
+
+    @param[in] pContext - Unused.
+    @param[in] job      - Index of the component.
+*/
+VOID
+MineProbability_Component(_In_opt_ PVOID pContext, UINT job);
+
+/**
+    MineProbability_Find
+*//**
+    Find the union find root of a frontier tile, halving the path on the way.
+
+    @param[in] slot - Index into pFrontier of the tile.
+
+    @return Index into pFrontier of the root.
+*/
+LONG
+MineProbability_Find(LONG slot);
+
+/**
+    MineProbability_Frontier
+*//**
+    Split the undecided tiles next to revealed numbers into components, tiles
+    joined by a number they are both next to, and lay out the bit sets and
+    constraint lists the search works from. Reads the constraints left by the
+    last solve.
+
+    @return Mine error code (MINE_ERROR_SUCCESS upon success).
+*/
+MINE_ERROR
+MineProbability_Frontier(VOID);
+
+/**
+    MineProbability_Grow
+*//**
+    Make sure a block taken from the process heap holds at least the given
+    number of bytes. A block that grows loses what it held.
+
+    @param[in,out] ppBlock   - Block to grow, NULL for none yet.
+    @param[in,out] pCapacity - Number of bytes in the block.
+    @param[in]     bytes     - Number of bytes needed.
+
+    @return Mine error code (MINE_ERROR_SUCCESS upon success).
+*/
+MINE_ERROR
+MineProbability_Grow(_Inout_ PVOID* ppBlock, _Inout_ SIZE_T* pCapacity, SIZE_T bytes);
+
+/**
+    MineProbability_Propagate
+*//**
+    Give a value to every tile forced by the tiles assigned since a point in
+    the trail: a constraint with no mines left needs every tile it has left to
+    be safe, one with as many mines left as tiles needs them all to be mines.
+
+    @param[in] pSearch - Search state.
+    @param[in] from    - Position in the trail to start from.
+
+    @return TRUE if every constraint can still be met, FALSE otherwise.
+*/
+BOOLEAN
+MineProbability_Propagate(_Inout_ MINE_PROBABILITY_SEARCH* pSearch, UINT from);
+
+/**
+    MineProbability_Reserve
+*//**
+    Take the last solve's frontier off the tile arrays.
+
+    @return Mine error code (MINE_ERROR_SUCCESS upon success).
+*/
+MINE_ERROR
+MineProbability_Reserve(VOID);
+
+/**
+    MineProbability_Reset
+*//**
+    Carve the tile and component arrays for the board in gameData out of the
+    arena. Must be called for each new game that is solved, after
+    Mine_AllocBoard was given MineProbability_ArenaBytes more bytes.
+
+    @return Mine error code (MINE_ERROR_SUCCESS upon success).
+*/
+MINE_ERROR
+MineProbability_Reset(VOID);
+
+/**
+    MineProbability_Search
+*//**
+    Count the layouts of the component that fit the values given so far, by
+    trying the first tile without a value as safe and then as a mine. Gives up
+    on the component once it has visited MINE_PROBABILITY_MAX_NODES nodes.
+
+    @param[in] pSearch - Search state.
+*/
+VOID
+MineProbability_Search(_Inout_ MINE_PROBABILITY_SEARCH* pSearch);
+
+/**
+    MineProbability_Solve
+*//**
+    Find the chance of each tile being a mine from what the player can see:
+    revealed numbers, flags and the count of mines. Runs the solver first, so
+    certain tiles come out at exactly 0 or 1. Components are counted on the
+    worker pool when it has been started. Results are left in probabilityData.
+
+    @return Mine error code (MINE_ERROR_SUCCESS upon success).
+*/
+MINE_ERROR
+MineProbability_Solve(VOID);
+
+/**
+    MineProbability_Undo
+*//**
+    Take back the values given since a point in the trail.
+
+    @param[in] pSearch - Search state.
+    @param[in] mark    - Position in the trail to go back to.
+*/
+VOID
+MineProbability_Undo(_Inout_ MINE_PROBABILITY_SEARCH* pSearch, UINT mark);
@@ -0,0 +1,1282 @@
+/**
+    @file MineRender.cpp
+
+    @author Craig Burkhart
+
+    @brief Software renderer that draws the window into a 32 bit pixel buffer.
+*//*
+    Copyright (C) 2014 - Craig Burkhart
+
+    This file is part of Minesweeper Deluxe.
+
+    Minesweeper Deluxe is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Minesweeper Deluxe is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Minesweeper Deluxe.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#include "stdafx.h"
+#include "MineRender.h"
+#include "MineAtlasData.h"
+#include "MineDamage.h"
+#include "MineDebug.h"
+#include "MineMinimap.h"
+
+// Global Variables:
+MINE_RENDER_DATA renderData = {mineAtlasPixels};
+
+/**
+    MineRender_BlitSprite
+*//**
+    Copy a sprite from the atlas into the frame one row at a time.
+
+    @param[in] sprite - Sprite identifier (MINE_SPRITE_*).
+    @param[in] x      - X coordinate of destination in pixels.
+    @param[in] y      - Y coordinate of destination in pixels.
+    @param[in] pClip  - Only pixels inside this rectangle are written.
+
+    @return Mine error code (MINE_ERROR_SUCCESS upon success).
+*/
+MINE_ERROR
+MineRender_BlitSprite(UINT sprite, LONG x, LONG y, _In_ PRECT pClip)
+{
+    BOOLEAN                 bFalse = FALSE;
+    LONG                    bottom = 0;
+    LONG                    left = 0;
+    UINT32*                 pDest = NULL;
+    const MINE_SPRITE_INFO* pInfo = NULL;
+    const UINT32*           pSource = NULL;
+    LONG                    right = 0;
+    MINE_ERROR              status = MINE_ERROR_SUCCESS;
+    LONG                    top = 0;
+
+    do
+    {
+        pInfo = MineSprite_GetInfo(sprite);
+        if ((NULL == pInfo) || (NULL == pClip))
+        {
+            MineDebug_PrintError("Invalid parameter to MineRender_BlitSprite, sprite: %u\n", sprite);
+            status = MINE_ERROR_PARAMETER;
+            break;
+        }
+
+        left = max(x, pClip->left);
+        top = max(y, pClip->top);
+        right = min(x + pInfo->width, pClip->right);
+        bottom = min(y + pInfo->height, pClip->bottom);
+
+        //Sprite is entirely outside of the clipping rectangle
+        if ((left >= right) || (top >= bottom))
+        {
+            break;
+        }
+
+        pSource = renderData.pAtlas + (pInfo->y + top - y)*MINE_ATLAS_WIDTH + (pInfo->x + left - x);
+        pDest = renderData.pFrame + top*renderData.frameWidth + left;
+
+        /** Both buffers hold 32 bit pixels, so every row is one contiguous copy. */
+        for (; top < bottom; top++)
+        {
+            CopyMemory(pDest, pSource, (SIZE_T) (right - left)*sizeof(UINT32));
+            pSource += MINE_ATLAS_WIDTH;
+            pDest += renderData.frameWidth;
+        }
+
+        __assume(FALSE == bFalse);
+    } while (bFalse);
+
+    return status;
+}
+
+/**
+    MineRender_BuildChrome
+*//**
+    Draw the background and bevel lines for the layout stored in windowData,
+    and keep them to be copied into the frame from then on.
+*/
+VOID
+MineRender_BuildChrome(VOID)
+{
+    RECT frame = {0};
+    INT  ix = 0;
+
+    if ((NULL == renderData.pFrame) || (NULL == renderData.pChrome))
+    {
+        MineDebug_PrintWarning("Frame or chrome pixels have not been allocated\n");
+    }
+    else
+    {
+        frame.right = renderData.frameWidth;
+        frame.bottom = renderData.frameHeight;
+
+        /** Draw into the frame with the usual routines, then keep a copy. */
+        MineRender_FillRect(&frame, MINE_RENDER_COLOR_BACKGROUND);
+
+        //Draw each of the white lines, then each of the grey lines on top
+        for (ix = 0; ix < MINE_NUM_WHITE_LINES; ix++)
+        {
+            MineRender_DrawLine(&windowData.whiteLines[ix], MINE_RENDER_COLOR_WHITE, &frame);
+            renderData.chromeWhiteLines[ix] = windowData.whiteLines[ix];
+        }
+
+        for (ix = 0; ix < MINE_NUM_GREY_LINES; ix++)
+        {
+            MineRender_DrawLine(&windowData.greyLines[ix], MINE_RENDER_COLOR_GREY, &frame);
+            renderData.chromeGreyLines[ix] = windowData.greyLines[ix];
+        }
+
+        CopyMemory(renderData.pChrome, renderData.pFrame,
+                   ((SIZE_T) renderData.frameWidth)*((SIZE_T) renderData.frameHeight)*sizeof(UINT32));
+    }
+
+    return;
+}
+
+/**
+    MineRender_Cleanup
+*//**
+    Free the frame, chrome, ring and scaled tile pixel buffers.
+*/
+VOID
+MineRender_Cleanup(VOID)
+{
+    HANDLE hHeap = NULL;
+    LONG   ix = 0;
+
+    hHeap = GetProcessHeap();
+    if (NULL == hHeap)
+    {
+        MineDebug_PrintWarning("Getting process heap: %lu\n", GetLastError());
+    }
+    else
+    {
+        if (NULL != renderData.pFrame)
+        {
+            if (0 == HeapFree(hHeap, 0, renderData.pFrame))
+            {
+                MineDebug_PrintWarning("Unable to free frame pixels: %lu\n", GetLastError());
+            }
+            renderData.pFrame = NULL;
+        }
+
+        if (NULL != renderData.pChrome)
+        {
+            if (0 == HeapFree(hHeap, 0, renderData.pChrome))
+            {
+                MineDebug_PrintWarning("Unable to free chrome pixels: %lu\n", GetLastError());
+            }
+            renderData.pChrome = NULL;
+        }
+
+        if (NULL != renderData.pRing)
+        {
+            if (0 == HeapFree(hHeap, 0, renderData.pRing))
+            {
+                MineDebug_PrintWarning("Unable to free ring pixels: %lu\n", GetLastError());
+            }
+            renderData.pRing = NULL;
+        }
+
+        if (NULL != renderData.pRingTiles)
+        {
+            if (0 == HeapFree(hHeap, 0, renderData.pRingTiles))
+            {
+                MineDebug_PrintWarning("Unable to free ring tiles: %lu\n", GetLastError());
+            }
+            renderData.pRingTiles = NULL;
+        }
+
+        if (NULL != renderData.pRingSprites)
+        {
+            if (0 == HeapFree(hHeap, 0, renderData.pRingSprites))
+            {
+                MineDebug_PrintWarning("Unable to free ring sprites: %lu\n", GetLastError());
+            }
+            renderData.pRingSprites = NULL;
+        }
+
+        for (ix = 0; ix < MINE_NUM_ZOOMS; ix++)
+        {
+            if (NULL != renderData.pScaledTiles[ix])
+            {
+                if (0 == HeapFree(hHeap, 0, renderData.pScaledTiles[ix]))
+                {
+                    MineDebug_PrintWarning("Unable to free scaled tiles: %lu\n", GetLastError());
+                }
+                renderData.pScaledTiles[ix] = NULL;
+            }
+        }
+    }
+
+    renderData.frameWidth = 0;
+    renderData.frameHeight = 0;
+    renderData.ringColumns = 0;
+    renderData.ringRows = 0;
+    renderData.ringTilePixels = 0;
+    renderData.pRingSource = NULL;
+
+    return;
+}
+
+/**
+    MineRender_CopyChrome
+*//**
+    Copy the background and bevel lines into the frame, one band at a time
+    around the board view. The board view is left alone since the board is
+    drawn over all of it.
+
+    @param[in] pClip - Rectangle to copy, already clipped to the frame.
+*/
+VOID
+MineRender_CopyChrome(_In_ PRECT pClip)
+{
+    RECT bands[4] = {0};
+    LONG ix = 0;
+    LONG jx = 0;
+    LONG offset = 0;
+
+    if ((NULL == pClip) || (NULL == renderData.pChrome))
+    {
+        MineDebug_PrintWarning("Invalid parameter to MineRender_CopyChrome\n");
+    }
+    else
+    {
+        //Above and below the board view, then to either side of it
+        bands[0] = *pClip;
+        bands[0].bottom = min(pClip->bottom, windowData.boardRegion.top);
+        bands[1] = *pClip;
+        bands[1].top = max(pClip->top, windowData.boardRegion.bottom);
+        bands[2].left = pClip->left;
+        bands[2].top = max(pClip->top, windowData.boardRegion.top);
+        bands[2].right = min(pClip->right, windowData.boardRegion.left);
+        bands[2].bottom = min(pClip->bottom, windowData.boardRegion.bottom);
+        bands[3] = bands[2];
+        bands[3].left = max(pClip->left, windowData.boardRegion.right);
+        bands[3].right = pClip->right;
+
+        for (ix = 0; ix < 4; ix++)
+        {
+            if (bands[ix].left >= bands[ix].right)
+            {
+                continue;
+            }
+
+            for (jx = bands[ix].top; jx < bands[ix].bottom; jx++)
+            {
+                offset = jx*renderData.frameWidth + bands[ix].left;
+
+                CopyMemory(renderData.pFrame + offset, renderData.pChrome + offset,
+                           ((SIZE_T) (bands[ix].right - bands[ix].left))*sizeof(UINT32));
+            }
+        }
+    }
+
+    return;
+}
+
+/**
+    MineRender_DrawBoard
+*//**
+    Copy the board view into the frame from the ring, at the current scroll
+    offsets. Only tiles that changed or newly came into view are drawn into the
+    ring first, so the cost depends on the size of the view, not the board.
+
+    @param[in] pClip - Only pixels inside this rectangle are written.
+*/
+VOID
+MineRender_DrawBoard(_In_ PRECT pClip)
+{
+    RECT          board = {0};
+    LONG          boardX = 0;
+    LONG          boardY = 0;
+    LONG          bottom = 0;
+    LONG          ix = 0;
+    LONG          jx = 0;
+    UINT32*       pDest = NULL;
+    const UINT32* pSource = NULL;
+    LONG          right = 0;
+    LONG          ringStride = renderData.ringColumns*renderData.ringTilePixels;
+    LONG          ringX = 0;
+    LONG          ringY = 0;
+    LONG          spanX = ((LONG) gameData.width)*renderData.ringTilePixels;
+    LONG          spanY = ((LONG) gameData.height)*renderData.ringTilePixels;
+    LONG          tilePixels = renderData.ringTilePixels;
+    LONG          viewX = 0;
+    LONG          viewY = 0;
+    LONG          x = 0;
+    LONG          y = 0;
+
+    if ((NULL == pClip) || (NULL == renderData.pRing) || (tilePixels != windowData.tilePixels))
+    {
+        MineDebug_PrintWarning("Invalid parameter to MineRender_DrawBoard\n");
+    }
+    else
+    {
+        board.left = max(pClip->left, windowData.boardRegion.left);
+        board.top = max(pClip->top, windowData.boardRegion.top);
+        board.right = min(pClip->right, windowData.boardRegion.right);
+        board.bottom = min(pClip->bottom, windowData.boardRegion.bottom);
+
+        /** Split the dirty rectangle wherever it crosses an edge of the board or of the
+            ring, so that every piece is a plain row copy out of the ring. */
+        for (y = board.top; y < board.bottom; y = bottom)
+        {
+            //Offset into the board before wrapping, which picks the ring slot
+            viewY = y - windowData.boardRegion.top + windowData.scrollY;
+            boardY = viewY % spanY;
+            ringY = ((viewY / tilePixels) % renderData.ringRows)*tilePixels + viewY % tilePixels;
+            bottom = min(board.bottom, y + min(spanY - boardY, renderData.ringRows*tilePixels - ringY));
+
+            for (x = board.left; x < board.right; x = right)
+            {
+                viewX = x - windowData.boardRegion.left + windowData.scrollX;
+                boardX = viewX % spanX;
+                ringX = ((viewX / tilePixels) % renderData.ringColumns)*tilePixels + viewX % tilePixels;
+                right = min(board.right, x + min(spanX - boardX, ringStride - ringX));
+
+                //Bring every tile under this piece up to date before copying it
+                for (jx = 0; jx <= (ringY % tilePixels + bottom - y - 1) / tilePixels; jx++)
+                {
+                    for (ix = 0; ix <= (ringX % tilePixels + right - x - 1) / tilePixels; ix++)
+                    {
+                        MineRender_SyncRingTile(ringX / tilePixels + ix, ringY / tilePixels + jx,
+                                                boardX / tilePixels + ix, boardY / tilePixels + jx);
+                    }
+                }
+
+                pSource = renderData.pRing + ringY*ringStride + ringX;
+                pDest = renderData.pFrame + y*renderData.frameWidth + x;
+
+                for (jx = y; jx < bottom; jx++)
+                {
+                    CopyMemory(pDest, pSource, (SIZE_T) (right - x)*sizeof(UINT32));
+                    pSource += ringStride;
+                    pDest += renderData.frameWidth;
+                }
+            }
+        }
+    }
+
+    return;
+}
+
+/**
+    MineRender_DrawFrame
+*//**
+    Draw the chrome, timer, mine counter, face, board and minimap into the frame
+    using the layout stored in windowData.
+
+    @param[in] pDirty - Region of the frame to redraw, NULL for the whole frame.
+
+    @return Mine error code (MINE_ERROR_SUCCESS upon success).
+*/
+MINE_ERROR
+MineRender_DrawFrame(_In_opt_ PRECT pDirty)
+{
+    BOOLEAN    bFalse = FALSE;
+    RECT       clip = {0};
+    INT        divisor = 0;
+    INT        index = 0;
+    INT        ix = 0;
+    DWORD      minesLeft = 0;
+    UINT       sprite = 0;
+    MINE_ERROR status = MINE_ERROR_SUCCESS;
+
+    do
+    {
+        if ((NULL == renderData.pFrame) || (NULL == renderData.pChrome) || (NULL == renderData.pAtlas) ||
+            (NULL == renderData.pRing))
+        {
+            MineDebug_PrintError("Frame, chrome, atlas or ring pixels have not been allocated\n");
+            status = MINE_ERROR_PARAMETER;
+            break;
+        }
+
+        /** Everything drawn below is clipped to the dirty part of the frame. */
+        clip.right = renderData.frameWidth;
+        clip.bottom = renderData.frameHeight;
+
+        if (NULL != pDirty)
+        {
+            clip.left = max(clip.left, pDirty->left);
+            clip.top = max(clip.top, pDirty->top);
+            clip.right = min(clip.right, pDirty->right);
+            clip.bottom = min(clip.bottom, pDirty->bottom);
+        }
+
+        if ((clip.left >= clip.right) || (clip.top >= clip.bottom))
+        {
+            break;
+        }
+
+        //Background and bevel lines come from the chrome drawn for this layout
+        MineRender_CopyChrome(&clip);
+
+        /** If dirty region overlaps timer, draw the timer. */
+        if (Mine_DoRectOverlap(&windowData.timerRegion, &clip))
+        {
+            //Timer has max value of 999, it will always be displayed with three digits
+            for (ix = 0, divisor = 100; ix < 3; ix++, divisor /= 10)
+            {
+                index = (((INT) gameData.time) / divisor) % 10;
+
+                status = MineRender_BlitSprite(MINE_SPRITE_TIMER0 + (UINT) index,
+                                               windowData.timerRegion.left + ix*MINE_TIMER_WIDTH,
+                                               windowData.timerRegion.top, &clip);
+                if (MINE_ERROR_SUCCESS != status)
+                {
+                    MineDebug_PrintError("Drawing timer digit %i: %i\n", index, (int) status);
+                    break;
+                }
+            }
+            if (MINE_ERROR_SUCCESS != status)
+            {
+                break;
+            }
+        }
+
+        /** If dirty region overlaps the mine counter region, draw the mine counter. */
+        if (Mine_DoRectOverlap(&windowData.mineCountRegion, &clip))
+        {
+            /** Use a negative sign if more tiles flagged than there are mines. */
+            if (gameData.numFlagged > gameData.mines)
+            {
+                minesLeft = gameData.numFlagged - gameData.mines;
+                sprite = MINE_SPRITE_TIMERDASH;
+            }
+            else
+            {
+                minesLeft = gameData.mines - gameData.numFlagged;
+                sprite = MINE_SPRITE_TIMER0 + (((UINT) minesLeft) / 1000) % 10; //Thousands digit
+            }
+
+            status = MineRender_BlitSprite(sprite, windowData.mineCountRegion.left,
+                                           windowData.mineCountRegion.top, &clip);
+            if (MINE_ERROR_SUCCESS != status)
+            {
+                MineDebug_PrintError("Drawing mine counter sprite %u: %i\n", sprite, (int) status);
+                break;
+            }
+
+            //Hundreds, tens and units digits follow the sign or thousands digit
+            for (ix = 1, divisor = 100; ix < 4; ix++, divisor /= 10)
+            {
+                index = (((INT) minesLeft) / divisor) % 10;
+
+                status = MineRender_BlitSprite(MINE_SPRITE_TIMER0 + (UINT) index,
+                                               windowData.mineCountRegion.left + ix*MINE_TIMER_WIDTH,
+                                               windowData.mineCountRegion.top, &clip);
+                if (MINE_ERROR_SUCCESS != status)
+                {
+                    MineDebug_PrintError("Drawing mine counter digit %i: %i\n", index, (int) status);
+                    break;
+                }
+            }
+            if (MINE_ERROR_SUCCESS != status)
+            {
+                break;
+            }
+        }
+
+        /** If dirty region overlaps face, draw the smiley face. */
+        if (Mine_DoRectOverlap(&windowData.faceRegion, &clip))
+        {
+            if (gameData.gameOver)
+            {
+                sprite = gameData.gameWon ? MINE_SPRITE_FACEWON : MINE_SPRITE_FACELOST;
+            }
+            else
+            {
+                sprite = gameData.leftDown ? MINE_SPRITE_FACECLICKED : MINE_SPRITE_FACENORMAL;
+            }
+
+            status = MineRender_BlitSprite(sprite, windowData.faceRegion.left,
+                                           windowData.faceRegion.top, &clip);
+            if (MINE_ERROR_SUCCESS != status)
+            {
+                MineDebug_PrintError("Drawing face sprite %u: %i\n", sprite, (int) status);
+                break;
+            }
+        }
+
+        /** If the dirty region overlaps the board, copy it from the ring. */
+        if (Mine_DoRectOverlap(&windowData.boardRegion, &clip))
+        {
+            MineRender_DrawBoard(&clip);
+        }
+
+        /** If the dirty region overlaps the minimap, draw it with the view outlined. */
+        if (Mine_DoRectOverlap(&windowData.minimapRegion, &clip))
+        {
+            MineRender_DrawMinimap(&clip);
+        }
+
+        __assume(FALSE == bFalse);
+    } while (bFalse);
+
+    return status;
+}
+
+/**
+    MineRender_DrawLine
+*//**
+    Draw a horizontal or vertical line the same way MoveToEx and LineTo would,
+    leaving out the final pixel.
+
+    @param[in] pLine - Start (left, top) and end (right, bottom) of the line.
+    @param[in] color - Color (0x00RRGGBB) of the line.
+    @param[in] pClip - Only pixels inside this rectangle are written.
+*/
+VOID
+MineRender_DrawLine(_In_ PRECT pLine, UINT32 color, _In_ PRECT pClip)
+{
+    RECT line = {0};
+
+    if ((NULL == pLine) || (NULL == pClip))
+    {
+        MineDebug_PrintWarning("Input parameter to MineRender_DrawLine is NULL\n");
+    }
+    else
+    {
+        //Layout lines always run left to right or top to bottom, so the
+        //pixels covered form a one pixel wide rectangle
+        line.left = pLine->left;
+        line.top = pLine->top;
+
+        if (pLine->top == pLine->bottom)
+        {
+            line.right = pLine->right;
+            line.bottom = pLine->top + 1;
+        }
+        else
+        {
+            line.right = pLine->left + 1;
+            line.bottom = pLine->bottom;
+        }
+
+        line.left = max(line.left, pClip->left);
+        line.top = max(line.top, pClip->top);
+        line.right = min(line.right, pClip->right);
+        line.bottom = min(line.bottom, pClip->bottom);
+
+        if ((line.left < line.right) && (line.top < line.bottom))
+        {
+            MineRender_FillRect(&line, color);
+        }
+    }
+
+    return;
+}
+
+/**
+    MineRender_DrawMinimap
+*//**
+    Copy the minimap pixels into the frame and outline the blocks the board
+    view currently shows.
+
+    @param[in] pClip - Only pixels inside this rectangle are written.
+*/
+VOID
+MineRender_DrawMinimap(_In_ PRECT pClip)
+{
+    LONG          blockPixels = minimapData.blockTiles*windowData.tilePixels;
+    LONG          jx = 0;
+    RECT          part = {0};
+    UINT32*       pDest = NULL;
+    const UINT32* pSource = NULL;
+    LONG          xLength = 0;
+    LONG          xStart = 0;
+    LONG          yLength = 0;
+    LONG          yStart = 0;
+
+    if ((NULL == pClip) || (NULL == minimapData.pPixels) || (0 >= blockPixels))
+    {
+        MineDebug_PrintWarning("Invalid parameter to MineRender_DrawMinimap\n");
+    }
+    else
+    {
+        part.left = max(pClip->left, windowData.minimapRegion.left);
+        part.top = max(pClip->top, windowData.minimapRegion.top);
+        part.right = min(pClip->right, windowData.minimapRegion.right);
+        part.bottom = min(pClip->bottom, windowData.minimapRegion.bottom);
+
+        for (jx = part.top; jx < part.bottom; jx++)
+        {
+            pSource = minimapData.pPixels + (jx - windowData.minimapRegion.top)*minimapData.width +
+                      (part.left - windowData.minimapRegion.left);
+            pDest = renderData.pFrame + jx*renderData.frameWidth + part.left;
+
+            CopyMemory(pDest, pSource, (SIZE_T) (part.right - part.left)*sizeof(UINT32));
+        }
+
+        /** Blocks the view touches, counted from the block holding its top left corner. */
+        xStart = windowData.scrollX / blockPixels;
+        xLength = min(minimapData.width, (windowData.scrollX + windowData.boardRegion.right -
+                                          windowData.boardRegion.left - 1) / blockPixels - xStart + 1);
+        yStart = windowData.scrollY / blockPixels;
+        yLength = min(minimapData.height, (windowData.scrollY + windowData.boardRegion.bottom -
+                                           windowData.boardRegion.top - 1) / blockPixels - yStart + 1);
+
+        MineRender_DrawMinimapSpan(xStart, xLength, yStart, TRUE, pClip);
+        MineRender_DrawMinimapSpan(xStart, xLength, (yStart + yLength - 1) % minimapData.height, TRUE, pClip);
+        MineRender_DrawMinimapSpan(yStart, yLength, xStart, FALSE, pClip);
+        MineRender_DrawMinimapSpan(yStart, yLength, (xStart + xLength - 1) % minimapData.width, FALSE, pClip);
+    }
+
+    return;
+}
+
+/**
+    MineRender_DrawMinimapSpan
+*//**
+    Draw one side of the view outline on the minimap. A wrapped board can carry
+    the side past the far edge of the minimap, then it carries on from the near edge.
+
+    @param[in] start      - First block along the side.
+    @param[in] length     - Number of blocks along the side.
+    @param[in] across     - Block the side runs through in the other direction.
+    @param[in] horizontal - TRUE for a side running left to right, FALSE for top to bottom.
+    @param[in] pClip      - Only pixels inside this rectangle are written.
+*/
+VOID
+MineRender_DrawMinimapSpan(LONG start, LONG length, LONG across, BOOLEAN horizontal, _In_ PRECT pClip)
+{
+    LONG end = 0;
+    LONG limit = horizontal ? minimapData.width : minimapData.height;
+    RECT line = {0};
+
+    start %= limit;
+
+    while (0 < length)
+    {
+        end = min(limit, start + length);
+
+        if (horizontal)
+        {
+            line.left = windowData.minimapRegion.left + start;
+            line.right = windowData.minimapRegion.left + end;
+            line.top = windowData.minimapRegion.top + across;
+            line.bottom = line.top;
+        }
+        else
+        {
+            line.left = windowData.minimapRegion.left + across;
+            line.right = line.left;
+            line.top = windowData.minimapRegion.top + start;
+            line.bottom = windowData.minimapRegion.top + end;
+        }
+
+        MineRender_DrawLine(&line, MINE_MINIMAP_COLOR_VIEW, pClip);
+
+        length -= end - start;
+        start = 0;
+    }
+
+    return;
+}
+
+/**
+    MineRender_FillRect
+*//**
+    Fill a rectangle of the frame with a solid color.
+
+    @param[in] pRect - Rectangle to fill, already clipped to the frame.
+    @param[in] color - Color (0x00RRGGBB) to fill with.
+*/
+VOID
+MineRender_FillRect(_In_ PRECT pRect, UINT32 color)
+{
+    LONG    ix = 0;
+    LONG    jx = 0;
+    UINT32* pDest = NULL;
+
+    if (NULL == pRect)
+    {
+        MineDebug_PrintWarning("Input parameter to MineRender_FillRect is NULL\n");
+    }
+    else
+    {
+        for (jx = pRect->top; jx < pRect->bottom; jx++)
+        {
+            pDest = renderData.pFrame + jx*renderData.frameWidth;
+
+            for (ix = pRect->left; ix < pRect->right; ix++)
+            {
+                pDest[ix] = color;
+            }
+        }
+    }
+
+    return;
+}
+
+/**
+    MineRender_GetTileSprite
+*//**
+    Choose the sprite that shows the current state of a tile.
+
+    @param[in] index - Index of tile in the board arrays.
+
+    @return Sprite identifier (MINE_SPRITE_*).
+*/
+UINT
+MineRender_GetTileSprite(LONG index)
+{
+    INT  number = gameData.gameBoard[index];
+    UINT sprite = MINE_SPRITE_UNCLICKED;
+    CHAR tileStatus = gameData.tileStatus[index];
+
+    if (gameData.gameOver)
+    {
+        if (gameData.gameWon) //---------- Game won ----------
+        {
+            //If game won, all mines are shown as flags and all 
+            //non-mines must have been uncovered
+            sprite = (MINE_BOMB_VALUE == number) ? MINE_SPRITE_FLAG : imageData.numbers[number];
+        }
+        else //---------- Game lost ----------
+        {
+            if (MINE_TILE_STATUS_REVEALED == tileStatus)
+            {
+                //A mine marked as revealed is shown as being hit
+                sprite = (MINE_BOMB_VALUE == number) ? MINE_SPRITE_MINEHIT : imageData.numbers[number];
+            }
+            else if (MINE_TILE_STATUS_FLAG == tileStatus)
+            {
+                //Display locations of incorrectly flagged tiles
+                sprite = (MINE_BOMB_VALUE == number) ? MINE_SPRITE_FLAG : MINE_SPRITE_FALSEFLAG;
+            }
+            else
+            {
+                //If game lost, display the location of all hidden mines
+                sprite = (MINE_BOMB_VALUE == number) ? MINE_SPRITE_MINE : MINE_SPRITE_UNCLICKED;
+            }
+        }
+    }
+    else //---------- Game still in progress ----------
+    {
+        if (MINE_TILE_STATUS_REVEALED == tileStatus)
+        {
+            sprite = imageData.numbers[number];
+        }
+        else if (MINE_TILE_STATUS_FLAG == tileStatus)
+        {
+            sprite = MINE_SPRITE_FLAG;
+        }
+        else if (MINE_TILE_STATUS_HELD == tileStatus)
+        {
+            sprite = MINE_SPRITE_HELD;
+        }
+    }
+
+    return sprite;
+}
+
+#ifdef _WIN32
+/**
+    MineRender_Present
+*//**
+    Copy the frame to a device context with a single SetDIBitsToDevice call.
+    The clipping region of the device context limits what is actually copied.
+
+    @param[in] hDC - Handle to destination device context.
+
+    @return Mine error code (MINE_ERROR_SUCCESS upon success).
+*/
+MINE_ERROR
+MineRender_Present(_In_ HDC hDC)
+{
+    BITMAPINFO bitmapInfo = {0};
+    MINE_ERROR status = MINE_ERROR_SUCCESS;
+
+    //Negative height marks the frame as stored top row first
+    bitmapInfo.bmiHeader.biSize = sizeof(BITMAPINFOHEADER);
+    bitmapInfo.bmiHeader.biWidth = renderData.frameWidth;
+    bitmapInfo.bmiHeader.biHeight = -renderData.frameHeight;
+    bitmapInfo.bmiHeader.biPlanes = 1;
+    bitmapInfo.bmiHeader.biBitCount = 32;
+    bitmapInfo.bmiHeader.biCompression = BI_RGB;
+
+    if ((NULL == hDC) || (NULL == renderData.pFrame))
+    {
+        MineDebug_PrintError("Invalid parameter to MineRender_Present\n");
+        status = MINE_ERROR_PARAMETER;
+    }
+    else if (0 == SetDIBitsToDevice(hDC, 0, 0, (DWORD) renderData.frameWidth,
+                                    (DWORD) renderData.frameHeight, 0, 0, 0,
+                                    (UINT) renderData.frameHeight, renderData.pFrame,
+                                    &bitmapInfo, DIB_RGB_COLORS))
+    {
+        MineDebug_PrintError("Copying frame to screen: %lu\n", GetLastError());
+        status = MINE_ERROR_PAINT;
+    }
+
+    return status;
+}
+#endif /* _WIN32 */
+
+/**
+    MineRender_ResizeFrame
+*//**
+    Make sure the frame matches the client area size stored in windowData, the
+    ring has enough slots to cover the board view and the tile sprites are scaled
+    for the current zoom level.
+
+    @return Mine error code (MINE_ERROR_SUCCESS upon success).
+*/
+MINE_ERROR
+MineRender_ResizeFrame(VOID)
+{
+    BOOLEAN    bFalse = FALSE;
+    BOOLEAN    buildChrome = FALSE;
+    LONG       height = (LONG) windowData.clientHeight;
+    HANDLE     hHeap = NULL;
+    LONG       ringColumns = 0;
+    LONG       ringRows = 0;
+    MINE_ERROR status = MINE_ERROR_SUCCESS;
+    LONG       width = (LONG) windowData.clientWidth;
+
+    do
+    {
+        if (0 >= windowData.tilePixels)
+        {
+            MineDebug_PrintError("Window layout has not been set up\n");
+            status = MINE_ERROR_PARAMETER;
+            break;
+        }
+
+        //One slot more than the view holds covers a view that is not lined up with the tiles
+        ringColumns = min((LONG) gameData.width,
+                          (windowData.boardRegion.right - windowData.boardRegion.left) / windowData.tilePixels + 1);
+        ringRows = min((LONG) gameData.height,
+                       (windowData.boardRegion.bottom - windowData.boardRegion.top) / windowData.tilePixels + 1);
+
+        hHeap = GetProcessHeap();
+        if (NULL == hHeap)
+        {
+            MineDebug_PrintError("Getting process heap: %lu\n", GetLastError());
+            status = MINE_ERROR_HEAP;
+            break;
+        }
+
+        if ((NULL == renderData.pFrame) || (width != renderData.frameWidth) ||
+            (height != renderData.frameHeight))
+        {
+            if (NULL != renderData.pFrame)
+            {
+                if (0 == HeapFree(hHeap, 0, renderData.pFrame))
+                {
+                    MineDebug_PrintWarning("Unable to free frame pixels: %lu\n", GetLastError());
+                }
+                renderData.pFrame = NULL;
+            }
+
+            if (NULL != renderData.pChrome)
+            {
+                if (0 == HeapFree(hHeap, 0, renderData.pChrome))
+                {
+                    MineDebug_PrintWarning("Unable to free chrome pixels: %lu\n", GetLastError());
+                }
+                renderData.pChrome = NULL;
+            }
+
+            renderData.frameWidth = 0;
+            renderData.frameHeight = 0;
+
+            renderData.pFrame = (UINT32*) HeapAlloc(hHeap, HEAP_ZERO_MEMORY,
+                                                    ((SIZE_T) width)*((SIZE_T) height)*sizeof(UINT32));
+            if (NULL == renderData.pFrame)
+            {
+                MineDebug_PrintError("Allocating frame pixels\n");
+                status = MINE_ERROR_MEMORY;
+                break;
+            }
+
+            renderData.pChrome = (UINT32*) HeapAlloc(hHeap, 0, ((SIZE_T) width)*((SIZE_T) height)*sizeof(UINT32));
+            if (NULL == renderData.pChrome)
+            {
+                MineDebug_PrintError("Allocating chrome pixels\n");
+                status = MINE_ERROR_MEMORY;
+                break;
+            }
+
+            renderData.frameWidth = width;
+            renderData.frameHeight = height;
+            buildChrome = TRUE;
+        }
+
+        /** The chrome only changes when the window is laid out differently, which
+            nearly always changes its size as well. */
+        if (buildChrome ||
+            (0 != memcmp(renderData.chromeWhiteLines, windowData.whiteLines, sizeof(windowData.whiteLines))) ||
+            (0 != memcmp(renderData.chromeGreyLines, windowData.greyLines, sizeof(windowData.greyLines))))
+        {
+            MineRender_BuildChrome();
+
+            //The chrome was drawn through the frame, so all of it has to be drawn again
+            MineDamage_AddAll();
+        }
+
+        if ((NULL == renderData.pRing) || (ringColumns != renderData.ringColumns) ||
+            (ringRows != renderData.ringRows) || (windowData.tilePixels != renderData.ringTilePixels))
+        {
+            if (NULL != renderData.pRing)
+            {
+                if (0 == HeapFree(hHeap, 0, renderData.pRing))
+                {
+                    MineDebug_PrintWarning("Unable to free ring pixels: %lu\n", GetLastError());
+                }
+                renderData.pRing = NULL;
+            }
+
+            if (NULL != renderData.pRingTiles)
+            {
+                if (0 == HeapFree(hHeap, 0, renderData.pRingTiles))
+                {
+                    MineDebug_PrintWarning("Unable to free ring tiles: %lu\n", GetLastError());
+                }
+                renderData.pRingTiles = NULL;
+            }
+
+            if (NULL != renderData.pRingSprites)
+            {
+                if (0 == HeapFree(hHeap, 0, renderData.pRingSprites))
+                {
+                    MineDebug_PrintWarning("Unable to free ring sprites: %lu\n", GetLastError());
+                }
+                renderData.pRingSprites = NULL;
+            }
+
+            renderData.ringColumns = 0;
+            renderData.ringRows = 0;
+            renderData.ringTilePixels = 0;
+
+            renderData.pRing = (UINT32*) HeapAlloc(hHeap, 0, ((SIZE_T) ringColumns)*((SIZE_T) ringRows)*
+                                                   ((SIZE_T) windowData.tilePixels)*
+                                                   ((SIZE_T) windowData.tilePixels)*sizeof(UINT32));
+            if (NULL == renderData.pRing)
+            {
+                MineDebug_PrintError("Allocating ring pixels\n");
+                status = MINE_ERROR_MEMORY;
+                break;
+            }
+
+            //Zeroed memory marks every slot as empty
+            renderData.pRingTiles = (UINT32*) HeapAlloc(hHeap, HEAP_ZERO_MEMORY,
+                                                        ((SIZE_T) ringColumns)*((SIZE_T) ringRows)*sizeof(UINT32));
+            if (NULL == renderData.pRingTiles)
+            {
+                MineDebug_PrintError("Allocating ring tiles\n");
+                status = MINE_ERROR_MEMORY;
+                break;
+            }
+
+            renderData.pRingSprites = (BYTE*) HeapAlloc(hHeap, HEAP_ZERO_MEMORY,
+                                                        ((SIZE_T) ringColumns)*((SIZE_T) ringRows));
+            if (NULL == renderData.pRingSprites)
+            {
+                MineDebug_PrintError("Allocating ring sprites\n");
+                status = MINE_ERROR_MEMORY;
+                break;
+            }
+
+            renderData.ringColumns = ringColumns;
+            renderData.ringRows = ringRows;
+            renderData.ringTilePixels = windowData.tilePixels;
+        }
+
+        status = MineRender_ScaleTiles(windowData.zoom);
+        if (MINE_ERROR_SUCCESS != status)
+        {
+            MineDebug_PrintError("In function MineRender_ScaleTiles: %i\n", (int) status);
+            break;
+        }
+
+        renderData.pRingSource = renderData.pScaledTiles[windowData.zoom - MINE_ZOOM_STEPS];
+
+        __assume(FALSE == bFalse);
+    } while (bFalse);
+
+    return status;
+}
+
+/**
+    MineRender_ScaleTiles
+*//**
+    Scale every board tile sprite for a zoom level, unless that zoom level has
+    been scaled before. Whole magnifications repeat each sprite pixel, others
+    average the sprite pixels each scaled pixel covers.
+
+    @param[in] zoom - Magnification in zoom steps, from MINE_ZOOM_STEPS to
+                      MINE_MAX_ZOOM*MINE_ZOOM_STEPS.
+
+    @return Mine error code (MINE_ERROR_SUCCESS upon success).
+*/
+MINE_ERROR
+MineRender_ScaleTiles(LONG zoom)
+{
+    BOOLEAN                 bFalse = FALSE;
+    UINT32                  blue = 0;
+    UINT32                  green = 0;
+    HANDLE                  hHeap = NULL;
+    LONG                    ix = 0;
+    LONG                    jx = 0;
+    UINT32*                 pDest = NULL;
+    const MINE_SPRITE_INFO* pInfo = NULL;
+    const UINT32*           pSource = NULL;
+    UINT32                  red = 0;
+    UINT                    sprite = 0;
+    MINE_ERROR              status = MINE_ERROR_SUCCESS;
+    LONG                    sx = 0;
+    LONG                    sy = 0;
+    LONG                    tilePixels = MINE_ZOOM_TILE_PIXELS(zoom);
+    UINT32                  weight = 0;
+    LONG                    weightX = 0;
+    LONG                    weightY = 0;
+
+    do
+    {
+        if ((MINE_ZOOM_STEPS > zoom) || (MINE_MAX_ZOOM*MINE_ZOOM_STEPS < zoom))
+        {
+            MineDebug_PrintError("Parameter zoom is out of range: %i\n", (int) zoom);
+            status = MINE_ERROR_PARAMETER;
+            break;
+        }
+
+        if (NULL != renderData.pScaledTiles[zoom - MINE_ZOOM_STEPS])
+        {
+            break;
+        }
+
+        hHeap = GetProcessHeap();
+        if (NULL == hHeap)
+        {
+            MineDebug_PrintError("Getting process heap: %lu\n", GetLastError());
+            status = MINE_ERROR_HEAP;
+            break;
+        }
+
+        pDest = (UINT32*) HeapAlloc(hHeap, 0, ((SIZE_T) MINE_SPRITE_TILES)*((SIZE_T) tilePixels)*
+                                    ((SIZE_T) tilePixels)*sizeof(UINT32));
+        if (NULL == pDest)
+        {
+            MineDebug_PrintError("Allocating scaled tiles\n");
+            status = MINE_ERROR_MEMORY;
+            break;
+        }
+
+        renderData.pScaledTiles[zoom - MINE_ZOOM_STEPS] = pDest;
+
+        for (sprite = 0; sprite < MINE_SPRITE_TILES; sprite++)
+        {
+            pInfo = MineSprite_GetInfo(sprite);
+
+            for (jx = 0; jx < tilePixels; jx++)
+            {
+                for (ix = 0; ix < tilePixels; ix++)
+                {
+                    if (0 == tilePixels % MINE_TILE_PIXELS)
+                    {
+                        //Each sprite pixel becomes a square block of scaled pixels
+                        pSource = renderData.pAtlas + (pInfo->y + (jx*MINE_TILE_PIXELS) / tilePixels)*MINE_ATLAS_WIDTH +
+                                  pInfo->x + (ix*MINE_TILE_PIXELS) / tilePixels;
+                        *pDest = *pSource;
+                    }
+                    else
+                    {
+                        /** Scaled pixel ix covers sprite pixels ix*MINE_TILE_PIXELS/tilePixels
+                            up to (ix + 1)*MINE_TILE_PIXELS/tilePixels. Measured in 1/tilePixels
+                            of a sprite pixel, the overlap with each one is a whole number and
+                            the overlaps add up to MINE_TILE_PIXELS in each direction. */
+                        red = 0;
+                        green = 0;
+                        blue = 0;
+
+                        for (sy = (jx*MINE_TILE_PIXELS) / tilePixels;
+                             sy*tilePixels < (jx + 1)*MINE_TILE_PIXELS; sy++)
+                        {
+                            weightY = min((jx + 1)*MINE_TILE_PIXELS, (sy + 1)*tilePixels) -
+                                      max(jx*MINE_TILE_PIXELS, sy*tilePixels);
+
+                            for (sx = (ix*MINE_TILE_PIXELS) / tilePixels;
+                                 sx*tilePixels < (ix + 1)*MINE_TILE_PIXELS; sx++)
+                            {
+                                weightX = min((ix + 1)*MINE_TILE_PIXELS, (sx + 1)*tilePixels) -
+                                          max(ix*MINE_TILE_PIXELS, sx*tilePixels);
+
+                                pSource = renderData.pAtlas + (pInfo->y + sy)*MINE_ATLAS_WIDTH + pInfo->x + sx;
+                                weight = (UINT32) (weightX*weightY);
+
+                                red += weight*((*pSource >> 16) & 0xFF);
+                                green += weight*((*pSource >> 8) & 0xFF);
+                                blue += weight*(*pSource & 0xFF);
+                            }
+                        }
+
+                        //Round to the nearest value after dividing out the total weight
+                        weight = MINE_TILE_PIXELS*MINE_TILE_PIXELS;
+                        *pDest = (((red + weight/2) / weight) << 16) | (((green + weight/2) / weight) << 8) |
+                                 ((blue + weight/2) / weight);
+                    }
+
+                    pDest++;
+                }
+            }
+        }
+
+        __assume(FALSE == bFalse);
+    } while (bFalse);
+
+    return status;
+}
+
+/**
+    MineRender_SyncRingTile
+*//**
+    Copy the scaled sprite of a tile into a ring slot, unless the slot already
+    shows the tile with its current sprite.
+
+    @param[in] xSlot - X coordinate of slot in the ring.
+    @param[in] ySlot - Y coordinate of slot in the ring.
+    @param[in] xGrid - X coordinate of tile in grid.
+    @param[in] yGrid - Y coordinate of tile in grid.
+*/
+VOID
+MineRender_SyncRingTile(LONG xSlot, LONG ySlot, LONG xGrid, LONG yGrid)
+{
+    LONG          index = MINE_INDEX(xGrid, yGrid);
+    LONG          jx = 0;
+    UINT32*       pDest = NULL;
+    const UINT32* pSource = NULL;
+    LONG          ringStride = renderData.ringColumns*renderData.ringTilePixels;
+    LONG          slot = ySlot*renderData.ringColumns + xSlot;
+    UINT          sprite = 0;
+
+    sprite = MineRender_GetTileSprite(index);
+
+    if ((renderData.pRingTiles[slot] != (UINT32) index + 1) || ((UINT) renderData.pRingSprites[slot] != sprite + 1))
+    {
+        pDest = renderData.pRing + ySlot*renderData.ringTilePixels*ringStride + xSlot*renderData.ringTilePixels;
+        pSource = renderData.pRingSource + sprite*renderData.ringTilePixels*renderData.ringTilePixels;
+
+        /** The sprite was scaled when the zoom level was first used, so every zoom
+            level is a plain copy of each row. */
+        for (jx = 0; jx < renderData.ringTilePixels; jx++)
+        {
+            CopyMemory(pDest, pSource, renderData.ringTilePixels*sizeof(UINT32));
+            pDest += ringStride;
+            pSource += renderData.ringTilePixels;
+        }
+
+        renderData.pRingTiles[slot] = (UINT32) index + 1;
+        renderData.pRingSprites[slot] = (BYTE) (sprite + 1);
+    }
+
+    return;
+}
+
+/**
+    MineRender_WritePpm
+*//**
+    Save the frame as a binary PPM image.
+
+    @param[in] pFileName - Name of file to create.
+
+    @return Mine error code (MINE_ERROR_SUCCESS upon success).
+*/
+MINE_ERROR
+MineRender_WritePpm(_In_z_ LPCSTR pFileName)
+{
+    BOOLEAN       bFalse = FALSE;
+    HANDLE        hHeap = NULL;
+    LONG          ix = 0;
+    LONG          jx = 0;
+    FILE*         pFile = NULL;
+    BYTE*         pRow = NULL;
+    const UINT32* pSource = NULL;
+    MINE_ERROR    status = MINE_ERROR_SUCCESS;
+
+    do
+    {
+        if ((NULL == pFileName) || (NULL == renderData.pFrame))
+        {
+            MineDebug_PrintError("Invalid parameter to MineRender_WritePpm\n");
+            status = MINE_ERROR_PARAMETER;
+            break;
+        }
+
+        hHeap = GetProcessHeap();
+        if (NULL == hHeap)
+        {
+            MineDebug_PrintError("Getting process heap: %lu\n", GetLastError());
+            status = MINE_ERROR_HEAP;
+            break;
+        }
+
+        pRow = (BYTE*) HeapAlloc(hHeap, 0, ((SIZE_T) renderData.frameWidth)*3);
+        if (NULL == pRow)
+        {
+            MineDebug_PrintError("Allocating PPM row buffer\n");
+            status = MINE_ERROR_MEMORY;
+            break;
+        }
+
+        if ((0 != fopen_s(&pFile, pFileName, "wb")) || (NULL == pFile))
+        {
+            MineDebug_PrintError("Opening PPM file %s\n", pFileName);
+            status = MINE_ERROR_PARAMETER;
+            break;
+        }
+
+        if (0 > fprintf(pFile, "P6\n%d %d\n255\n", (int) renderData.frameWidth, (int) renderData.frameHeight))
+        {
+            MineDebug_PrintError("Writing PPM header\n");
+            status = MINE_ERROR_PAINT;
+            break;
+        }
+
+        /** PPM pixels are stored red, green, blue. */
+        for (jx = 0; jx < renderData.frameHeight; jx++)
+        {
+            pSource = renderData.pFrame + jx*renderData.frameWidth;
+
+            for (ix = 0; ix < renderData.frameWidth; ix++)
+            {
+                pRow[3*ix] = (BYTE) (pSource[ix] >> 16);
+                pRow[3*ix + 1] = (BYTE) (pSource[ix] >> 8);
+                pRow[3*ix + 2] = (BYTE) pSource[ix];
+            }
+
+            if ((SIZE_T) renderData.frameWidth != fwrite(pRow, 3, (SIZE_T) renderData.frameWidth, pFile))
+            {
+                MineDebug_PrintError("Writing PPM row %li\n", jx);
+                status = MINE_ERROR_PAINT;
+                break;
+            }
+        }
+
+        __assume(FALSE == bFalse);
+    } while (bFalse);
+
+    //Clean up
+    if (NULL != pFile)
+    {
+        (void) fclose(pFile);
+        pFile = NULL;
+    }
+
+    if (NULL != pRow)
+    {
+        (void) HeapFree(hHeap, 0, pRow);
+        pRow = NULL;
+    }
+
+    return status;
+}
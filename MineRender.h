@@ -0,0 +1,301 @@
+/**
+    @file MineRender.h
+
+    @author Craig Burkhart
+
+    @brief Header file for the software frame renderer.
+*//*
+    Copyright (C) 2014 - Craig Burkhart
+
+    This file is part of Minesweeper Deluxe.
+
+    Minesweeper Deluxe is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Minesweeper Deluxe is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Minesweeper Deluxe.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#pragma once
+
+#include "Mine.h"
+#include "MineSprite.h"
+
+//--------------------------------------------------------------
+//    Macros
+//--------------------------------------------------------------
+
+/** Color (0x00RRGGBB) of the window background. */
+#define MINE_RENDER_COLOR_BACKGROUND 0x00C0C0C0
+/** Color (0x00RRGGBB) of the highlight lines. */
+#define MINE_RENDER_COLOR_WHITE      0x00FFFFFF
+/** Color (0x00RRGGBB) of the shadow lines. */
+#define MINE_RENDER_COLOR_GREY       0x00808080
+
+/** Maximum number of characters in a file path. */
+#define MINE_RENDER_PATH_CHARS 260
+
+//--------------------------------------------------------------
+//    Structures
+//--------------------------------------------------------------
+
+struct _MINE_RENDER_DATA
+{
+    /** Sprite atlas pixels (0x00RRGGBB), MINE_ATLAS_WIDTH pixels per row, compiled
+        into the program from MineAtlasData.h. */
+    const UINT32* pAtlas;
+    /** Frame pixels (0x00RRGGBB), frameWidth pixels per row, top row first. */
+    UINT32*       pFrame;
+    /** Width (in pixels) of the frame. */
+    LONG          frameWidth;
+    /** Height (in pixels) of the frame. */
+    LONG          frameHeight;
+    /** Background and bevel lines (0x00RRGGBB) of the window, drawn once for each
+        layout, frameWidth pixels per row. */
+    UINT32*       pChrome;
+    /** White lines the chrome was drawn with. */
+    RECT          chromeWhiteLines[MINE_NUM_WHITE_LINES];
+    /** Grey lines the chrome was drawn with. */
+    RECT          chromeGreyLines[MINE_NUM_GREY_LINES];
+    /** Pixels (0x00RRGGBB) of the tiles in and just around the board view, held in a
+        ring of ringColumns by ringRows tile slots that wraps in both directions. */
+    UINT32*       pRing;
+    /** One plus the board index of the tile held in each ring slot, zero if empty. */
+    UINT32*       pRingTiles;
+    /** One plus the sprite drawn in each ring slot. */
+    BYTE*         pRingSprites;
+    /** Number of tile slots across the ring. */
+    LONG          ringColumns;
+    /** Number of tile slots down the ring. */
+    LONG          ringRows;
+    /** Size (in pixels) of the tiles in the ring. */
+    LONG          ringTilePixels;
+    /** Board tile sprites scaled once for each zoom level, MINE_SPRITE_TILES square
+        tiles of MINE_ZOOM_TILE_PIXELS pixels across one after another, indexed by
+        zoom steps above MINE_ZOOM_STEPS. NULL until the zoom level is first used. */
+    UINT32*       pScaledTiles[MINE_NUM_ZOOMS];
+    /** Scaled tile sprites the ring is filled from, sized for ringTilePixels. */
+    const UINT32* pRingSource;
+};
+
+//--------------------------------------------------------------
+//    Typedefs
+//--------------------------------------------------------------
+
+/** Pixel buffers used to render the window without GDI. */
+typedef struct _MINE_RENDER_DATA MINE_RENDER_DATA;
+
+//--------------------------------------------------------------
+//    Global Variable Externs
+//--------------------------------------------------------------
+
+extern MINE_RENDER_DATA renderData;
+
+//--------------------------------------------------------------
+//    Function Prototypes
+//--------------------------------------------------------------
+
+/**
+    MineRender_BlitSprite
+*//**
+    Copy a sprite from the atlas into the frame one row at a time.
+
+    @param[in] sprite - Sprite identifier (MINE_SPRITE_*).
+    @param[in] x      - X coordinate of destination in pixels.
+    @param[in] y      - Y coordinate of destination in pixels.
+    @param[in] pClip  - Only pixels inside this rectangle are written.
+
+    @return Mine error code (MINE_ERROR_SUCCESS upon success).
+*/
+MINE_ERROR
+MineRender_BlitSprite(UINT sprite, LONG x, LONG y, _In_ PRECT pClip);
+
+/**
+    MineRender_BuildChrome
+*//**
+    Draw the background and bevel lines for the layout stored in windowData,
+    and keep them to be copied into the frame from then on.
+*/
+VOID
+MineRender_BuildChrome(VOID);
+
+/**
+    MineRender_Cleanup
+*//**
+    Free the frame, chrome, ring and scaled tile pixel buffers.
+*/
+VOID
+MineRender_Cleanup(VOID);
+
+/**
+    MineRender_CopyChrome
+*//**
+    Copy the background and bevel lines into the frame, one band at a time
+    around the board view. The board view is left alone since the board is
+    drawn over all of it.
+
+    @param[in] pClip - Rectangle to copy, already clipped to the frame.
+*/
+VOID
+MineRender_CopyChrome(_In_ PRECT pClip);
+
+/**
+    MineRender_DrawBoard
+*//**
+    Copy the board view into the frame from the ring, at the current scroll
+    offsets. Only tiles that changed or newly came into view are drawn into the
+    ring first, so the cost depends on the size of the view, not the board.
+
+    @param[in] pClip - Only pixels inside this rectangle are written.
+*/
+VOID
+MineRender_DrawBoard(_In_ PRECT pClip);
+
+/**
+    MineRender_DrawFrame
+*//**
+    Draw the chrome, timer, mine counter, face, board and minimap into the frame
+    using the layout stored in windowData.
+
+    @param[in] pDirty - Region of the frame to redraw, NULL for the whole frame.
+
+    @return Mine error code (MINE_ERROR_SUCCESS upon success).
+*/
+MINE_ERROR
+MineRender_DrawFrame(_In_opt_ PRECT pDirty);
+
+/**
+    MineRender_DrawLine
+*//**
+    Draw a horizontal or vertical line the same way MoveToEx and LineTo would,
+    leaving out the final pixel.
+
+    @param[in] pLine - Start (left, top) and end (right, bottom) of the line.
+    @param[in] color - Color (0x00RRGGBB) of the line.
+    @param[in] pClip - Only pixels inside this rectangle are written.
+*/
+VOID
+MineRender_DrawLine(_In_ PRECT pLine, UINT32 color, _In_ PRECT pClip);
+
+/**
+    MineRender_DrawMinimap
+*//**
+    Copy the minimap pixels into the frame and outline the blocks the board
+    view currently shows.
+
+    @param[in] pClip - Only pixels inside this rectangle are written.
+*/
+VOID
+MineRender_DrawMinimap(_In_ PRECT pClip);
+
+/**
+    MineRender_DrawMinimapSpan
+*//**
+    Draw one side of the view outline on the minimap. A wrapped board can carry
+    the side past the far edge of the minimap, then it carries on from the near edge.
+
+    @param[in] start      - First block along the side.
+    @param[in] length     - Number of blocks along the side.
+    @param[in] across     - Block the side runs through in the other direction.
+    @param[in] horizontal - TRUE for a side running left to right, FALSE for top to bottom.
+    @param[in] pClip      - Only pixels inside this rectangle are written.
+*/
+VOID
+MineRender_DrawMinimapSpan(LONG start, LONG length, LONG across, BOOLEAN horizontal, _In_ PRECT pClip);
+
+/**
+    MineRender_FillRect
+*//**
+    Fill a rectangle of the frame with a solid color.
+
+    @param[in] pRect - Rectangle to fill, already clipped to the frame.
+    @param[in] color - Color (0x00RRGGBB) to fill with.
+*/
+VOID
+MineRender_FillRect(_In_ PRECT pRect, UINT32 color);
+
+/**
+    MineRender_GetTileSprite
+*//**
+    Choose the sprite that shows the current state of a tile.
+
+    @param[in] index - Index of tile in the board arrays.
+
+    @return Sprite identifier (MINE_SPRITE_*).
+*/
+UINT
+MineRender_GetTileSprite(LONG index);
+
+#ifdef _WIN32
+/**
+    MineRender_Present
+*//**
+    Copy the frame to a device context with a single SetDIBitsToDevice call.
+    The clipping region of the device context limits what is actually copied.
+
+    @param[in] hDC - Handle to destination device context.
+
+    @return Mine error code (MINE_ERROR_SUCCESS upon success).
+*/
+MINE_ERROR
+MineRender_Present(_In_ HDC hDC);
+#endif /* _WIN32 */
+
+/**
+    MineRender_ResizeFrame
+*//**
+    Make sure the frame matches the client area size stored in windowData, the
+    ring has enough slots to cover the board view and the tile sprites are scaled
+    for the current zoom level.
+
+    @return Mine error code (MINE_ERROR_SUCCESS upon success).
+*/
+MINE_ERROR
+MineRender_ResizeFrame(VOID);
+
+/**
+    MineRender_ScaleTiles
+*//**
+    Scale every board tile sprite for a zoom level, unless that zoom level has
+    been scaled before. Whole magnifications repeat each sprite pixel, others
+    average the sprite pixels each scaled pixel covers.
+
+    @param[in] zoom - Magnification in zoom steps, from MINE_ZOOM_STEPS to
+                      MINE_MAX_ZOOM*MINE_ZOOM_STEPS.
+
+    @return Mine error code (MINE_ERROR_SUCCESS upon success).
+*/
+MINE_ERROR
+MineRender_ScaleTiles(LONG zoom);
+
+/**
+    MineRender_SyncRingTile
+*//**
+    Copy the scaled sprite of a tile into a ring slot, unless the slot already
+    shows the tile with its current sprite.
+
+    @param[in] xSlot - X coordinate of slot in the ring.
+    @param[in] ySlot - Y coordinate of slot in the ring.
+    @param[in] xGrid - X coordinate of tile in grid.
+    @param[in] yGrid - Y coordinate of tile in grid.
+*/
+VOID
+MineRender_SyncRingTile(LONG xSlot, LONG ySlot, LONG xGrid, LONG yGrid);
+
+/**
+    MineRender_WritePpm
+*//**
+    Save the frame as a binary PPM image.
+
+    @param[in] pFileName - Name of file to create.
+
+    @return Mine error code (MINE_ERROR_SUCCESS upon success).
+*/
+MINE_ERROR
+MineRender_WritePpm(_In_z_ LPCSTR pFileName);
@@ -0,0 +1,766 @@
+/**
+    @file MineSim.cpp
+
+    @author Craig Burkhart
+
+    @brief Movement thread, which chooses mine moves on a fixed time step
+           instead of waiting on WM_TIMER. It keeps its own copy of the board,
+           kept up to date by commands from the window thread, and hands each
+           move back through a lock-free queue to be made on the game board.
+*//*
+    Copyright (C) 2014 - Craig Burkhart
+
+    This file is part of Minesweeper Deluxe.
+
+    Minesweeper Deluxe is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Minesweeper Deluxe is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Minesweeper Deluxe.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#include "stdafx.h"
+#include "MineSim.h"
+#include "MineDebug.h"
+#include "MineMovement.h"
+
+// Global Variables:
+MINE_SIM_DATA simData = {0};
+
+/**
+    MineSim_ApplyMoves
+*//**
+    Make the moves queued by the movement thread on the game board, as many at
+    a time as a tick can choose. Moves that no longer fit the board, because
+    the player revealed or flagged a tile in the meantime, are dropped.
+
+    @return Mine error code (MINE_ERROR_SUCCESS upon success).
+*/
+MINE_ERROR
+MineSim_ApplyMoves(VOID)
+{
+    UINT             applied = 0;
+    LONG             fromIndices[MINE_MOVEMENT_MAX_BATCH] = {0};
+    UINT             ix = 0;
+    MINE_SIM_MESSAGE move = {0};
+    UINT             moves = 0;
+    MINE_ERROR       status = MINE_ERROR_SUCCESS;
+    LONG             toIndices[MINE_MOVEMENT_MAX_BATCH] = {0};
+
+    //Moves queued after this point post a new message
+    (void) InterlockedExchange(&(simData.notifyPending), 0);
+
+    do
+    {
+        moves = 0;
+
+        while ((moves < MINE_MOVEMENT_MAX_BATCH) && MineSim_Pop(&(simData.moves), &move))
+        {
+            //Moves chosen for an earlier game, or after the game ended, are dropped
+            if (simData.running && (move.generation == simData.generation))
+            {
+                fromIndices[moves] = move.fromIndex;
+                toIndices[moves] = move.toIndex;
+                moves++;
+            }
+        }
+
+        if (0 == moves)
+        {
+            break;
+        }
+
+        /** The movement thread chose the moves on a board that may be a message behind. */
+        status = MineMovement_ApplyMoves(fromIndices, toIndices, moves, (BOOLEAN) simData.runningConsistent,
+                                         &applied);
+        if (MINE_ERROR_SUCCESS != status)
+        {
+            MineDebug_PrintError("In function MineMovement_ApplyMoves: %i\n", (int) status);
+            break;
+        }
+
+        simData.movesApplied += applied;
+        simData.movesRejected += moves - applied;
+
+        //The movement thread only changes its board once the moves are made here
+        for (ix = 0; ix < applied; ix++)
+        {
+            (void) MineSim_SendCommand(MINE_SIM_MOVED, fromIndices[ix], toIndices[ix], NULL);
+        }
+    } while (MINE_MOVEMENT_MAX_BATCH == moves);
+
+    return status;
+}
+
+/**
+    MineSim_Cleanup
+*//**
+    End the movement thread and close its handles at program close.
+*/
+VOID
+MineSim_Cleanup(VOID)
+{
+    if (NULL != simData.hThread)
+    {
+        /** Commands are always taken before the thread sleeps, so the queue empties. */
+        while (!MineSim_SendCommand(MINE_SIM_QUIT, 0, 0, NULL))
+        {
+            Sleep(1);
+        }
+
+        if (WAIT_OBJECT_0 != WaitForSingleObject(simData.hThread, INFINITE))
+        {
+            MineDebug_PrintWarning("Waiting for movement thread: %lu\n", GetLastError());
+        }
+
+        (void) CloseHandle(simData.hThread);
+        simData.hThread = NULL;
+    }
+
+    if (NULL != simData.hTimer)
+    {
+        (void) CloseHandle(simData.hTimer);
+        simData.hTimer = NULL;
+    }
+
+    if (NULL != simData.hWake)
+    {
+        (void) CloseHandle(simData.hWake);
+        simData.hWake = NULL;
+    }
+
+    simData.running = FALSE;
+
+    return;
+}
+
+/**
+    MineSim_LoadSnapshot
+*//**
+    Copy a snapshot into the movement thread's board and free the snapshot.
+    Called on the movement thread.
+
+    @param[in] pSnapshot - Snapshot to start from.
+
+    @return Mine error code (MINE_ERROR_SUCCESS upon success).
+*/
+MINE_ERROR
+MineSim_LoadSnapshot(_In_ MINE_SIM_SNAPSHOT* pSnapshot)
+{
+    BOOLEAN    bFalse = FALSE;
+    HANDLE     hHeap = NULL;
+    DWORD      ix = 0;
+    LONG       minesFound = 0;
+    MINE_ERROR status = MINE_ERROR_SUCCESS;
+    DWORD      tiles = pSnapshot->width*pSnapshot->height;
+
+    do
+    {
+        hHeap = GetProcessHeap();
+        if (NULL == hHeap)
+        {
+            MineDebug_PrintError("Getting process heap: %lu\n", GetLastError());
+            status = MINE_ERROR_HEAP;
+            break;
+        }
+
+        /** The board copy only goes back to the heap for a bigger board than any before. */
+        if ((tiles > simData.tileCapacity) || (pSnapshot->mines > simData.mineCapacity))
+        {
+            if (NULL != simData.board.gameBoard)
+            {
+                (void) HeapFree(hHeap, 0, simData.board.gameBoard);
+            }
+            if (NULL != simData.board.tileStatus)
+            {
+                (void) HeapFree(hHeap, 0, simData.board.tileStatus);
+            }
+            if (NULL != simData.board.mineTiles)
+            {
+                (void) HeapFree(hHeap, 0, simData.board.mineTiles);
+            }
+            if (NULL != simData.board.mineSlots)
+            {
+                (void) HeapFree(hHeap, 0, simData.board.mineSlots);
+            }
+
+            simData.tileCapacity = max(tiles, simData.tileCapacity);
+            simData.mineCapacity = max(pSnapshot->mines, simData.mineCapacity);
+
+            simData.board.gameBoard = (CHAR*) HeapAlloc(hHeap, 0, simData.tileCapacity);
+            simData.board.tileStatus = (CHAR*) HeapAlloc(hHeap, 0, simData.tileCapacity);
+            simData.board.mineTiles = (LONG*) HeapAlloc(hHeap, 0, simData.mineCapacity*sizeof(LONG));
+            simData.board.mineSlots = (LONG*) HeapAlloc(hHeap, 0, simData.tileCapacity*sizeof(LONG));
+            if ((NULL == simData.board.gameBoard) || (NULL == simData.board.tileStatus) ||
+                (NULL == simData.board.mineTiles) || (NULL == simData.board.mineSlots))
+            {
+                MineDebug_PrintError("Allocating memory for movement board\n");
+                simData.tileCapacity = 0;
+                simData.mineCapacity = 0;
+                status = MINE_ERROR_MEMORY;
+                break;
+            }
+        }
+
+        simData.board.width = pSnapshot->width;
+        simData.board.height = pSnapshot->height;
+        simData.board.mines = pSnapshot->mines;
+        simData.aggressiveness = pSnapshot->aggressiveness;
+        simData.batch = pSnapshot->batch;
+        simData.policy = pSnapshot->policy;
+        simData.wrapHorz = pSnapshot->wrapHorz;
+        simData.wrapVert = pSnapshot->wrapVert;
+        simData.consistent = pSnapshot->consistent;
+
+        CopyMemory(simData.board.gameBoard, pSnapshot->gameBoard, tiles);
+        CopyMemory(simData.board.tileStatus, pSnapshot->tileStatus, tiles);
+
+        //List the mines again, in board order
+        for (ix = 0; ix < tiles; ix++)
+        {
+            simData.board.mineSlots[ix] = -1;
+            if ((MINE_BOMB_VALUE == simData.board.gameBoard[ix]) && (minesFound < (LONG) simData.board.mines))
+            {
+                simData.board.mineTiles[minesFound] = (LONG) ix;
+                simData.board.mineSlots[ix] = minesFound;
+                minesFound++;
+            }
+        }
+        simData.board.mines = (DWORD) minesFound;
+
+        __assume(FALSE == bFalse);
+    } while (bFalse);
+
+    if (NULL != hHeap)
+    {
+        (void) HeapFree(hHeap, 0, pSnapshot);
+    }
+
+    return status;
+}
+
+/**
+    MineSim_Pop
+*//**
+    Take the oldest message off a queue. Only one thread may pop from a queue.
+
+    @param[in]  pQueue   - Queue to pop from.
+    @param[out] pMessage - Message taken off the queue.
+
+    @return TRUE if a message was taken, FALSE if the queue was empty.
+*/
+BOOLEAN
+MineSim_Pop(_Inout_ MINE_SIM_QUEUE* pQueue, _Out_ MINE_SIM_MESSAGE* pMessage)
+{
+    BOOLEAN returnValue = FALSE;
+    LONG    tail = pQueue->tail;
+
+    if (pQueue->head != tail)
+    {
+        //The message has to be read after the head that published it
+        MemoryBarrier();
+
+        *pMessage = pQueue->messages[((ULONG) tail) & (MINE_SIM_QUEUE_SIZE - 1)];
+
+        /** Moving the tail on hands the slot back to the producer. */
+        (void) InterlockedExchange(&(pQueue->tail), (LONG) (((ULONG) tail) + 1));
+        returnValue = TRUE;
+    }
+
+    return returnValue;
+}
+
+/**
+    MineSim_PostStatus
+*//**
+    Tell the movement thread a tile changed status, if it is moving mines.
+
+    @param[in] index  - Board index of the tile.
+    @param[in] status - New status of the tile (MINE_TILE_STATUS_*).
+*/
+VOID
+MineSim_PostStatus(LONG index, CHAR status)
+{
+    if (simData.running)
+    {
+        (void) MineSim_SendCommand(MINE_SIM_STATUS, index, (LONG) status, NULL);
+    }
+
+    return;
+}
+
+/**
+    MineSim_Push
+*//**
+    Add a message to a queue. Only one thread may push to a queue.
+
+    @param[in] pQueue   - Queue to push to.
+    @param[in] pMessage - Message to add.
+
+    @return TRUE if the message was added, FALSE if the queue was full.
+*/
+BOOLEAN
+MineSim_Push(_Inout_ MINE_SIM_QUEUE* pQueue, _In_ const MINE_SIM_MESSAGE* pMessage)
+{
+    LONG    head = pQueue->head;
+    BOOLEAN returnValue = FALSE;
+
+    if (((ULONG) head) - ((ULONG) pQueue->tail) < MINE_SIM_QUEUE_SIZE)
+    {
+        pQueue->messages[((ULONG) head) & (MINE_SIM_QUEUE_SIZE - 1)] = *pMessage;
+
+        /** Moving the head on publishes the message, the exchange orders the writes before it. */
+        (void) InterlockedExchange(&(pQueue->head), (LONG) (((ULONG) head) + 1));
+        returnValue = TRUE;
+    }
+
+    return returnValue;
+}
+
+/**
+    MineSim_SendCommand
+*//**
+    Queue a command for the movement thread and wake it. A command lost to a
+    full queue marks the game to be sent again.
+
+    @param[in] type      - Kind of command (MINE_SIM_*).
+    @param[in] fromIndex - First board index or value of the command.
+    @param[in] toIndex   - Second board index or value of the command.
+    @param[in] pSnapshot - Snapshot for MINE_SIM_START, NULL otherwise.
+
+    @return TRUE if the command was queued, FALSE if the queue was full.
+*/
+BOOLEAN
+MineSim_SendCommand(UINT type, LONG fromIndex, LONG toIndex, _In_opt_ MINE_SIM_SNAPSHOT* pSnapshot)
+{
+    MINE_SIM_MESSAGE command = {0};
+    BOOLEAN          returnValue = FALSE;
+
+    command.type = type;
+    command.generation = simData.generation;
+    command.fromIndex = fromIndex;
+    command.toIndex = toIndex;
+    command.pSnapshot = pSnapshot;
+
+    returnValue = MineSim_Push(&(simData.commands), &command);
+    if (returnValue)
+    {
+        if (0 == SetEvent(simData.hWake))
+        {
+            MineDebug_PrintWarning("Waking movement thread: %lu\n", GetLastError());
+        }
+    }
+    else
+    {
+        MineDebug_PrintWarning("Movement command queue is full\n");
+        simData.resync = TRUE;
+    }
+
+    return returnValue;
+}
+
+/**
+    MineSim_Startup
+*//**
+    Create the movement thread, which waits for a game to be started.
+
+    @return Mine error code (MINE_ERROR_SUCCESS upon success).
+*/
+MINE_ERROR
+MineSim_Startup(VOID)
+{
+    BOOLEAN    bFalse = FALSE;
+    UINT       random = 0;
+    MINE_ERROR status = MINE_ERROR_SUCCESS;
+
+    do
+    {
+        /** The random number generator sets itself up on its first call. That
+            call is made here, before the movement thread can also make it. */
+        status = Mine_Random(1, &random);
+        if (MINE_ERROR_SUCCESS != status)
+        {
+            MineDebug_PrintError("In function Mine_Random: %i\n", (int) status);
+            break;
+        }
+
+        simData.hWake = CreateEventW(NULL, FALSE, FALSE, NULL);
+        if (NULL == simData.hWake)
+        {
+            MineDebug_PrintError("Creating movement wake event: %lu\n", GetLastError());
+            status = MINE_ERROR_GET_DATA;
+            break;
+        }
+
+        /** A high resolution timer wakes within a millisecond of the tick, older
+            systems fall back to the regular timer resolution. */
+        simData.hTimer = CreateWaitableTimerExW(NULL, NULL, CREATE_WAITABLE_TIMER_HIGH_RESOLUTION, TIMER_ALL_ACCESS);
+        if (NULL == simData.hTimer)
+        {
+            simData.hTimer = CreateWaitableTimerExW(NULL, NULL, 0, TIMER_ALL_ACCESS);
+        }
+        if (NULL == simData.hTimer)
+        {
+            MineDebug_PrintError("Creating movement timer: %lu\n", GetLastError());
+            status = MINE_ERROR_GET_DATA;
+            break;
+        }
+
+        simData.hThread = CreateThread(NULL, 0, MineSim_ThreadProc, NULL, 0, NULL);
+        if (NULL == simData.hThread)
+        {
+            MineDebug_PrintError("Creating movement thread: %lu\n", GetLastError());
+            status = MINE_ERROR_GET_DATA;
+            break;
+        }
+
+        __assume(FALSE == bFalse);
+    } while (bFalse);
+
+    return status;
+}
+
+/**
+    MineSim_Sync
+*//**
+    Start or stop the movement thread to match the game and the movement
+    settings. Called after every window message.
+
+    @return Mine error code (MINE_ERROR_SUCCESS upon success).
+*/
+MINE_ERROR
+MineSim_Sync(VOID)
+{
+    BOOLEAN            bFalse = FALSE;
+    HANDLE             hHeap = NULL;
+    MINE_SIM_SNAPSHOT* pSnapshot = NULL;
+    MINE_ERROR         status = MINE_ERROR_SUCCESS;
+    SIZE_T             tiles = ((SIZE_T) gameData.width)*((SIZE_T) gameData.height);
+    BOOLEAN            wantRunning = FALSE;
+
+    do
+    {
+        if (NULL == simData.hThread)
+        {
+            break;
+        }
+
+        wantRunning = (menuData.useMovement && gameData.gameStarted && (!gameData.gameOver)) ?
+                      (BOOLEAN) TRUE : (BOOLEAN) FALSE;
+
+        /** Stop when the game ends, a setting changed, or a command was lost. */
+        if (simData.running &&
+            ((!wantRunning) || simData.resync ||
+             (simData.runningFreq != menuData.movementFreq) ||
+             (simData.runningAggressive != menuData.movementAggressive) ||
+             (simData.runningWrapHorz != menuData.wrapHorz) ||
+             (simData.runningWrapVert != menuData.wrapVert) ||
+             (simData.runningBatch != menuData.movementBatch) ||
+             (simData.runningBatchPercent != menuData.movementBatchPercent) ||
+             (simData.runningPolicy != menuData.movementPolicy) ||
+             (simData.runningConsistent != menuData.movementConsistent)))
+        {
+            if (!MineSim_SendCommand(MINE_SIM_STOP, 0, 0, NULL))
+            {
+                //Try again after the next message
+                break;
+            }
+
+            simData.running = FALSE;
+        }
+
+        if ((!wantRunning) || simData.running)
+        {
+            break;
+        }
+
+        /** Hand the movement thread a copy of the board to start from. */
+        hHeap = GetProcessHeap();
+        if (NULL == hHeap)
+        {
+            MineDebug_PrintError("Getting process heap: %lu\n", GetLastError());
+            status = MINE_ERROR_HEAP;
+            break;
+        }
+
+        pSnapshot = (MINE_SIM_SNAPSHOT*) HeapAlloc(hHeap, 0, sizeof(MINE_SIM_SNAPSHOT) + 2*tiles);
+        if (NULL == pSnapshot)
+        {
+            MineDebug_PrintError("Allocating memory for movement snapshot\n");
+            status = MINE_ERROR_MEMORY;
+            break;
+        }
+
+        pSnapshot->width = gameData.width;
+        pSnapshot->height = gameData.height;
+        pSnapshot->mines = gameData.mines;
+        pSnapshot->aggressiveness = menuData.movementAggressive;
+        pSnapshot->stepTime = menuData.movementFreq;
+        pSnapshot->batch = MineMovement_BatchSize(gameData.mines, menuData.movementBatch,
+                                                  (BOOLEAN) menuData.movementBatchPercent);
+        pSnapshot->policy = menuData.movementPolicy;
+        pSnapshot->wrapHorz = (BOOLEAN) menuData.wrapHorz;
+        pSnapshot->wrapVert = (BOOLEAN) menuData.wrapVert;
+        pSnapshot->consistent = (BOOLEAN) menuData.movementConsistent;
+        pSnapshot->gameBoard = (CHAR*) (pSnapshot + 1);
+        pSnapshot->tileStatus = pSnapshot->gameBoard + tiles;
+        CopyMemory(pSnapshot->gameBoard, gameData.gameBoard, tiles);
+        CopyMemory(pSnapshot->tileStatus, gameData.tileStatus, tiles);
+
+        simData.generation++;
+        simData.resync = FALSE;
+
+        if (!MineSim_SendCommand(MINE_SIM_START, 0, 0, pSnapshot))
+        {
+            (void) HeapFree(hHeap, 0, pSnapshot);
+            break;
+        }
+
+        //The snapshot belongs to the movement thread now
+        pSnapshot = NULL;
+
+        simData.running = TRUE;
+        simData.runningFreq = menuData.movementFreq;
+        simData.runningAggressive = menuData.movementAggressive;
+        simData.runningWrapHorz = menuData.wrapHorz;
+        simData.runningWrapVert = menuData.wrapVert;
+        simData.runningBatch = menuData.movementBatch;
+        simData.runningBatchPercent = menuData.movementBatchPercent;
+        simData.runningPolicy = menuData.movementPolicy;
+        simData.runningConsistent = menuData.movementConsistent;
+
+        __assume(FALSE == bFalse);
+    } while (bFalse);
+
+    return status;
+}
+
+/**
+    MineSim_TakeCommands
+*//**
+    Act on every command queued for the movement thread. Called on the
+    movement thread.
+
+    @return TRUE if the thread was told to quit, FALSE otherwise.
+*/
+BOOLEAN
+MineSim_TakeCommands(VOID)
+{
+    MINE_SIM_MESSAGE command = {0};
+    LARGE_INTEGER    frequency = {0};
+    LARGE_INTEGER    now = {0};
+    BOOLEAN          quit = FALSE;
+    LONG             slot = 0;
+
+    while ((!quit) && MineSim_Pop(&(simData.commands), &command))
+    {
+        switch (command.type)
+        {
+        case MINE_SIM_START:
+            /** Ticks are counted from the start, one step apart. */
+            (void) QueryPerformanceFrequency(&frequency);
+            (void) QueryPerformanceCounter(&now);
+            simData.stepCounts = max((frequency.QuadPart*(LONGLONG) command.pSnapshot->stepTime) / 1000, 1);
+            simData.nextTick = now.QuadPart + simData.stepCounts;
+            simData.simGeneration = command.generation;
+
+            //Frees the snapshot
+            simData.simRunning = (MINE_ERROR_SUCCESS == MineSim_LoadSnapshot(command.pSnapshot)) ?
+                                 (BOOLEAN) TRUE : (BOOLEAN) FALSE;
+            break;
+        case MINE_SIM_STOP:
+            simData.simRunning = FALSE;
+            break;
+        case MINE_SIM_STATUS:
+            if (simData.simRunning)
+            {
+                simData.board.tileStatus[command.fromIndex] = (CHAR) command.toIndex;
+            }
+            break;
+        case MINE_SIM_MOVED:
+            if (simData.simRunning)
+            {
+                slot = simData.board.mineSlots[command.fromIndex];
+                simData.board.gameBoard[command.fromIndex] = 0;
+                simData.board.gameBoard[command.toIndex] = MINE_BOMB_VALUE;
+                simData.board.mineTiles[slot] = command.toIndex;
+                simData.board.mineSlots[command.toIndex] = slot;
+                simData.board.mineSlots[command.fromIndex] = -1;
+            }
+            break;
+        case MINE_SIM_QUIT:
+            quit = TRUE;
+            break;
+        default:
+            break;
+        }
+    }
+
+    return quit;
+}
+
+/**
+    MineSim_ThreadProc
+*//**
+    Body of the movement thread. Runs a movement tick on every multiple of the
+    step time since the game started, so the pace does not depend on how busy
+    the window thread is.
+
+    @param[in] pParameter - Unused.
+
+    @return 0 when the thread is told to quit.
+*/
+DWORD WINAPI
+MineSim_ThreadProc(_In_opt_ LPVOID pParameter)
+{
+    LARGE_INTEGER dueTime = {0};
+    LARGE_INTEGER frequency = {0};
+    HANDLE        hHeap = NULL;
+    HANDLE        handles[2] = {simData.hWake, simData.hTimer};
+    UINT          ix = 0;
+    LARGE_INTEGER now = {0};
+    BOOLEAN       quit = FALSE;
+    LONGLONG      skipped = 0;
+
+    UNREFERENCED_PARAMETER(pParameter);
+
+    (void) QueryPerformanceFrequency(&frequency);
+
+    while (!quit)
+    {
+        quit = MineSim_TakeCommands();
+        if (quit)
+        {
+            break;
+        }
+
+        if (!simData.simRunning)
+        {
+            (void) WaitForSingleObject(simData.hWake, INFINITE);
+            continue;
+        }
+
+        (void) QueryPerformanceCounter(&now);
+
+        if (now.QuadPart >= simData.nextTick)
+        {
+            /** Late ticks are caught up a few at a time, the rest are skipped so the
+                next tick still lands on a whole number of steps since the start. */
+            for (ix = 0; (ix < MINE_SIM_MAX_CATCH_UP) && (now.QuadPart >= simData.nextTick); ix++)
+            {
+                MineSim_Tick();
+                simData.nextTick += simData.stepCounts;
+            }
+
+            if (now.QuadPart >= simData.nextTick)
+            {
+                skipped = (now.QuadPart - simData.nextTick) / simData.stepCounts + 1;
+                simData.skippedTicks += (ULONGLONG) skipped;
+                simData.nextTick += skipped*simData.stepCounts;
+            }
+
+            //One message wakes the window thread however many moves are waiting
+            if ((simData.moves.head != simData.moves.tail) &&
+                (0 == InterlockedExchange(&(simData.notifyPending), 1)))
+            {
+                if (0 == PostMessageW(hwnd, WM_MINE_SIM, 0, 0))
+                {
+                    (void) InterlockedExchange(&(simData.notifyPending), 0);
+                }
+            }
+        }
+        else
+        {
+            //Relative due time, in 100 nanosecond units
+            dueTime.QuadPart = -(((simData.nextTick - now.QuadPart)*10000000) / frequency.QuadPart);
+            if (0 == SetWaitableTimer(simData.hTimer, &dueTime, 0, NULL, NULL, FALSE))
+            {
+                MineDebug_PrintWarning("Setting movement timer: %lu\n", GetLastError());
+                Sleep(1);
+                continue;
+            }
+
+            /** Sleep until the tick is due or a command arrives. */
+            (void) WaitForMultipleObjects(2, handles, FALSE, INFINITE);
+        }
+    }
+
+    hHeap = GetProcessHeap();
+    if (NULL != hHeap)
+    {
+        if (NULL != simData.board.gameBoard)
+        {
+            (void) HeapFree(hHeap, 0, simData.board.gameBoard);
+            simData.board.gameBoard = NULL;
+        }
+        if (NULL != simData.board.tileStatus)
+        {
+            (void) HeapFree(hHeap, 0, simData.board.tileStatus);
+            simData.board.tileStatus = NULL;
+        }
+        if (NULL != simData.board.mineTiles)
+        {
+            (void) HeapFree(hHeap, 0, simData.board.mineTiles);
+            simData.board.mineTiles = NULL;
+        }
+        if (NULL != simData.board.mineSlots)
+        {
+            (void) HeapFree(hHeap, 0, simData.board.mineSlots);
+            simData.board.mineSlots = NULL;
+        }
+    }
+
+    return 0;
+}
+
+/**
+    MineSim_Tick
+*//**
+    Choose a batch of moves on the movement thread's board and queue them for
+    the window thread. Called on the movement thread.
+*/
+VOID
+MineSim_Tick(VOID)
+{
+    LONG             fromIndices[MINE_MOVEMENT_MAX_BATCH] = {0};
+    UINT             ix = 0;
+    MINE_SIM_MESSAGE move = {0};
+    UINT             moves = 0;
+    MINE_ERROR       status = MINE_ERROR_SUCCESS;
+    LONG             toIndices[MINE_MOVEMENT_MAX_BATCH] = {0};
+
+    simData.ticks++;
+
+    status = MineMovement_ChooseMoves(&(simData.board), simData.policy, simData.aggressiveness, simData.wrapHorz,
+                                      simData.wrapVert, simData.consistent, (UINT) simData.batch, fromIndices,
+                                      toIndices, &moves);
+    if (MINE_ERROR_SUCCESS != status)
+    {
+        MineDebug_PrintWarning("In function MineMovement_ChooseMoves: %i\n", (int) status);
+        moves = 0;
+    }
+
+    //The board copy is left alone until the window thread reports the moves made
+    move.type = MINE_SIM_MOVE;
+    move.generation = simData.simGeneration;
+
+    for (ix = 0; ix < moves; ix++)
+    {
+        move.fromIndex = fromIndices[ix];
+        move.toIndex = toIndices[ix];
+
+        if (!MineSim_Push(&(simData.moves), &move))
+        {
+            MineDebug_PrintWarning("Movement queue is full, %u moves dropped\n", moves - ix);
+            break;
+        }
+    }
+
+    return;
+}
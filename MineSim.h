@@ -0,0 +1,366 @@
+/**
+    @file MineSim.h
+
+    @author Craig Burkhart
+
+    @brief Header file for the movement thread, which chooses mine moves on a
+           fixed time step and hands them to the window thread through a pair
+           of lock-free queues.
+*//*
+    Copyright (C) 2014 - Craig Burkhart
+
+    This file is part of Minesweeper Deluxe.
+
+    Minesweeper Deluxe is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Minesweeper Deluxe is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Minesweeper Deluxe.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#pragma once
+
+#include "Mine.h"
+
+//--------------------------------------------------------------
+//    Macros
+//--------------------------------------------------------------
+
+/** Message posted to the main window when the movement thread has queued moves. */
+#define WM_MINE_SIM (WM_APP + 1)
+
+/** Number of messages each queue holds, a power of two. */
+#define MINE_SIM_QUEUE_SIZE 4096
+/** Number of bytes in a cache line, the two ends of a queue are kept on different ones. */
+#define MINE_SIM_CACHE_LINE 64
+/** Most ticks run back to back when the movement thread falls behind before the rest are skipped. */
+#define MINE_SIM_MAX_CATCH_UP 4
+
+#ifndef CREATE_WAITABLE_TIMER_HIGH_RESOLUTION
+/** Flag for a waitable timer that wakes within a millisecond, on systems that support it. */
+#define CREATE_WAITABLE_TIMER_HIGH_RESOLUTION 0x00000002
+#endif /* CREATE_WAITABLE_TIMER_HIGH_RESOLUTION */
+
+/** Command to start moving mines on the board in pSnapshot. */
+#define MINE_SIM_START  1
+/** Command to stop moving mines until the next start. */
+#define MINE_SIM_STOP   2
+/** Command to change the status of the tile at fromIndex to toIndex. */
+#define MINE_SIM_STATUS 3
+/** Command to move the mine at fromIndex to toIndex, after the window thread moved it. */
+#define MINE_SIM_MOVED  4
+/** Command to end the movement thread. */
+#define MINE_SIM_QUIT   5
+/** Move chosen by the movement thread, from fromIndex to toIndex. */
+#define MINE_SIM_MOVE   6
+
+//--------------------------------------------------------------
+//    Structures
+//--------------------------------------------------------------
+
+struct _MINE_SIM_SNAPSHOT
+{
+    /** Width (in tiles) of game board. */
+    DWORD   width;
+    /** Height (in tiles) of game board. */
+    DWORD   height;
+    /** Number of mines in game. */
+    DWORD   mines;
+    /** Movement aggressiveness, from 1 to 10. */
+    DWORD   aggressiveness;
+    /** Time (in milliseconds) between movement ticks. */
+    DWORD   stepTime;
+    /** Most mines moved each movement tick. */
+    DWORD   batch;
+    /** Movement policy (MINE_MOVEMENT_POLICY_*). */
+    DWORD   policy;
+    /** Flag for if mines can move across the left and right edges. */
+    BOOLEAN wrapHorz;
+    /** Flag for if mines can move across the top and bottom edges. */
+    BOOLEAN wrapVert;
+    /** Flag for if only moves that leave every revealed number unchanged are made. */
+    BOOLEAN consistent;
+    /** Reserved padding. */
+    CHAR    reserved[1];
+    /** Copy of the game board, followed in the same block by tileStatus. */
+    CHAR*   gameBoard;
+    /** Copy of the tile status. */
+    CHAR*   tileStatus;
+};
+
+struct _MINE_SIM_MESSAGE
+{
+    /** Kind of message (MINE_SIM_*). */
+    UINT                       type;
+    /** Game the message belongs to, moves from an earlier game are dropped. */
+    UINT                       generation;
+    /** Board index of the tile a mine moves from, or of the tile changing status. */
+    LONG                       fromIndex;
+    /** Board index of the tile a mine moves to, or the new tile status. */
+    LONG                       toIndex;
+    /** Snapshot to start from, now owned by the movement thread (MINE_SIM_START only). */
+    struct _MINE_SIM_SNAPSHOT* pSnapshot;
+};
+
+struct _MINE_SIM_QUEUE
+{
+    /** Number of messages ever pushed, only written by the producing thread. */
+    volatile LONG           head;
+    /** Keeps head and tail on different cache lines. */
+    CHAR                    headPadding[MINE_SIM_CACHE_LINE - sizeof(LONG)];
+    /** Number of messages ever popped, only written by the consuming thread. */
+    volatile LONG           tail;
+    /** Keeps tail and the messages on different cache lines. */
+    CHAR                    tailPadding[MINE_SIM_CACHE_LINE - sizeof(LONG)];
+    /** Ring of messages, indexed by count modulo MINE_SIM_QUEUE_SIZE. */
+    struct _MINE_SIM_MESSAGE messages[MINE_SIM_QUEUE_SIZE];
+};
+
+struct _MINE_SIM_DATA
+{
+    /** Commands from the window thread to the movement thread. */
+    struct _MINE_SIM_QUEUE commands;
+    /** Moves from the movement thread to the window thread. */
+    struct _MINE_SIM_QUEUE moves;
+    /** Nonzero while a WM_MINE_SIM message is posted and not yet handled. */
+    volatile LONG          notifyPending;
+    /** Handle to the movement thread. */
+    HANDLE                 hThread;
+    /** Event set whenever a command is queued. */
+    HANDLE                 hWake;
+    /** Waitable timer the movement thread sleeps on until the next tick. */
+    HANDLE                 hTimer;
+
+    //Only used by the window thread
+    /** Flag for if the movement thread was told to move mines in the current game. */
+    BOOLEAN                running;
+    /** Flag for if a command was lost to a full queue, so the game has to be sent again. */
+    BOOLEAN                resync;
+    /** Game the movement thread was last started on. */
+    UINT                   generation;
+    /** Movement frequency the current game was started with. */
+    DWORD                  runningFreq;
+    /** Movement aggressiveness the current game was started with. */
+    DWORD                  runningAggressive;
+    /** Horizontal wrap setting the current game was started with. */
+    DWORD                  runningWrapHorz;
+    /** Vertical wrap setting the current game was started with. */
+    DWORD                  runningWrapVert;
+    /** Movement batch the current game was started with. */
+    DWORD                  runningBatch;
+    /** Movement batch percentage flag the current game was started with. */
+    DWORD                  runningBatchPercent;
+    /** Movement policy the current game was started with. */
+    DWORD                  runningPolicy;
+    /** Consistent movement flag the current game was started with. */
+    DWORD                  runningConsistent;
+    /** Number of moves made on the game board. */
+    ULONGLONG              movesApplied;
+    /** Number of moves dropped because the board changed after they were chosen. */
+    ULONGLONG              movesRejected;
+
+    //Only used by the movement thread
+    /** Copy of the board the moves are chosen on. */
+    MINE_GAME_SETTINGS     board;
+    /** Number of tiles the board copy has room for. */
+    DWORD                  tileCapacity;
+    /** Number of mines the board copy has room for. */
+    DWORD                  mineCapacity;
+    /** Flag for if mines are being moved. */
+    BOOLEAN                simRunning;
+    /** Flag for if mines can move across the left and right edges. */
+    BOOLEAN                wrapHorz;
+    /** Flag for if mines can move across the top and bottom edges. */
+    BOOLEAN                wrapVert;
+    /** Flag for if only moves that leave every revealed number unchanged are chosen. */
+    BOOLEAN                consistent;
+    /** Game the moves are chosen for. */
+    UINT                   simGeneration;
+    /** Movement aggressiveness, from 1 to 10. */
+    DWORD                  aggressiveness;
+    /** Most mines moved each movement tick. */
+    DWORD                  batch;
+    /** Movement policy (MINE_MOVEMENT_POLICY_*). */
+    DWORD                  policy;
+    /** Performance counter ticks between movement ticks. */
+    LONGLONG               stepCounts;
+    /** Performance counter value the next movement tick is due at. */
+    LONGLONG               nextTick;
+    /** Number of movement ticks run. */
+    ULONGLONG              ticks;
+    /** Number of movement ticks skipped after the thread fell too far behind. */
+    ULONGLONG              skippedTicks;
+};
+
+//--------------------------------------------------------------
+//    Typedefs
+//--------------------------------------------------------------
+
+/** Command to the movement thread, or move chosen by it. */
+typedef struct _MINE_SIM_MESSAGE MINE_SIM_MESSAGE;
+
+/** Single producer, single consumer queue of messages. */
+typedef struct _MINE_SIM_QUEUE MINE_SIM_QUEUE;
+
+/** Board and settings the movement thread starts a game from. */
+typedef struct _MINE_SIM_SNAPSHOT MINE_SIM_SNAPSHOT;
+
+/** State of the movement thread. */
+typedef struct _MINE_SIM_DATA MINE_SIM_DATA;
+
+//--------------------------------------------------------------
+//    Global Variable Externs
+//--------------------------------------------------------------
+
+extern MINE_SIM_DATA simData;
+
+//--------------------------------------------------------------
+//    Function Prototypes
+//--------------------------------------------------------------
+
+/**
+    MineSim_ApplyMoves
+*//**
+    Make the moves queued by the movement thread on the game board, as many at
+    a time as a tick can choose. Moves that no longer fit the board, because
+    the player revealed or flagged a tile in the meantime, are dropped.
+
+    @return Mine error code (MINE_ERROR_SUCCESS upon success).
+*/
+MINE_ERROR
+MineSim_ApplyMoves(VOID);
+
+/**
+    MineSim_Cleanup
+*//**
+    End the movement thread and close its handles at program close.
+*/
+VOID
+MineSim_Cleanup(VOID);
+
+/**
+    MineSim_LoadSnapshot
+*//**
+    Copy a snapshot into the movement thread's board and free the snapshot.
+    Called on the movement thread.
+
+    @param[in] pSnapshot - Snapshot to start from.
+
+    @return Mine error code (MINE_ERROR_SUCCESS upon success).
+*/
+MINE_ERROR
+MineSim_LoadSnapshot(_In_ MINE_SIM_SNAPSHOT* pSnapshot);
+
+/**
+    MineSim_Pop
+*//**
+    Take the oldest message off a queue. Only one thread may pop from a queue.
+
+    @param[in]  pQueue   - Queue to pop from.
+    @param[out] pMessage - Message taken off the queue.
+
+    @return TRUE if a message was taken, FALSE if the queue was empty.
+*/
+BOOLEAN
+MineSim_Pop(_Inout_ MINE_SIM_QUEUE* pQueue, _Out_ MINE_SIM_MESSAGE* pMessage);
+
+/**
+    MineSim_PostStatus
+*//**
+    Tell the movement thread a tile changed status, if it is moving mines.
+
+    @param[in] index  - Board index of the tile.
+    @param[in] status - New status of the tile (MINE_TILE_STATUS_*).
+*/
+VOID
+MineSim_PostStatus(LONG index, CHAR status);
+
+/**
+    MineSim_Push
+*//**
+    Add a message to a queue. Only one thread may push to a queue.
+
+    @param[in] pQueue   - Queue to push to.
+    @param[in] pMessage - Message to add.
+
+    @return TRUE if the message was added, FALSE if the queue was full.
+*/
+BOOLEAN
+MineSim_Push(_Inout_ MINE_SIM_QUEUE* pQueue, _In_ const MINE_SIM_MESSAGE* pMessage);
+
+/**
+    MineSim_SendCommand
+*//**
+    Queue a command for the movement thread and wake it. A command lost to a
+    full queue marks the game to be sent again.
+
+    @param[in] type      - Kind of command (MINE_SIM_*).
+    @param[in] fromIndex - First board index or value of the command.
+    @param[in] toIndex   - Second board index or value of the command.
+    @param[in] pSnapshot - Snapshot for MINE_SIM_START, NULL otherwise.
+
+    @return TRUE if the command was queued, FALSE if the queue was full.
+*/
+BOOLEAN
+MineSim_SendCommand(UINT type, LONG fromIndex, LONG toIndex, _In_opt_ MINE_SIM_SNAPSHOT* pSnapshot);
+
+/**
+    MineSim_Startup
+*//**
+    Create the movement thread, which waits for a game to be started.
+
+    @return Mine error code (MINE_ERROR_SUCCESS upon success).
+*/
+MINE_ERROR
+MineSim_Startup(VOID);
+
+/**
+    MineSim_Sync
+*//**
+    Start or stop the movement thread to match the game and the movement
+    settings. Called after every window message.
+
+    @return Mine error code (MINE_ERROR_SUCCESS upon success).
+*/
+MINE_ERROR
+MineSim_Sync(VOID);
+
+/**
+    MineSim_TakeCommands
+*//**
+    Act on every command queued for the movement thread. Called on the
+    movement thread.
+
+    @return TRUE if the thread was told to quit, FALSE otherwise.
+*/
+BOOLEAN
+MineSim_TakeCommands(VOID);
+
+/**
+    MineSim_ThreadProc
+*//**
+    Body of the movement thread. Runs a movement tick on every multiple of the
+    step time since the game started, so the pace does not depend on how busy
+    the window thread is.
+
+    @param[in] pParameter - Unused.
+
+    @return 0 when the thread is told to quit.
+*/
+DWORD WINAPI
+MineSim_ThreadProc(_In_opt_ LPVOID pParameter);
+
+/**
+    MineSim_Tick
+*//**
+    Choose a batch of moves on the movement thread's board and queue them for
+    the window thread. Called on the movement thread.
+*/
+VOID
+MineSim_Tick(VOID);
@@ -0,0 +1,669 @@
+/**
+    @file MineSolver.cpp
+
+    @author Craig Burkhart
+
+    @brief Rule based solver. Finds the tiles that are certainly safe or
+           certainly mines from the revealed numbers, flags and mine count,
+           starting from the frontier kept as the board changes.
+*//*
+    Copyright (C) 2014 - Craig Burkhart
+
+    This file is part of Minesweeper Deluxe.
+
+    Minesweeper Deluxe is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Minesweeper Deluxe is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Minesweeper Deluxe.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#include "stdafx.h"
+#include "MineSolver.h"
+#include "MineArena.h"
+#include "MineDebug.h"
+#include "MineFrontier.h"
+
+// Global Variables:
+MINE_SOLVER_DATA solverData = {0};
+
+/**
+    MineSolver_ArenaBytes
+*//**
+    Number of bytes the solver storage for the board in gameData takes from
+    the arena, to be added to what Mine_AllocBoard is asked for.
+
+    @return Number of bytes.
+*/
+SIZE_T
+MineSolver_ArenaBytes(VOID)
+{
+    SIZE_T tiles = ((SIZE_T) gameData.width)*((SIZE_T) gameData.height);
+
+    return MINE_ARENA_BYTES(tiles*sizeof(MINE_SOLVER_CONSTRAINT)) + 4*MINE_ARENA_BYTES(tiles*sizeof(LONG)) +
+           MINE_ARENA_BYTES(tiles);
+}
+
+/**
+    MineSolver_Build
+*//**
+    Fill in the constraint around a revealed tile from the board and what the
+    solver has found so far. Flags count as mines.
+
+    @param[in]  center      - Board index of the revealed tile.
+    @param[out] pConstraint - Constraint to fill in.
+*/
+VOID
+MineSolver_Build(LONG center, _Out_ MINE_SOLVER_CONSTRAINT* pConstraint)
+{
+    UINT ix = 0;
+    UINT jx = 0;
+    LONG neighbor = -1;
+    LONG neighbors[MINE_SOLVER_MAX_NEARBY] = {0};
+    UINT numNeighbors = MineSolver_Nearby(center, 1, neighbors);
+
+    pConstraint->center = center;
+    pConstraint->remaining = (LONG) gameData.gameBoard[center];
+    pConstraint->count = 0;
+    pConstraint->total = 0;
+
+    for (ix = 0; ix < numNeighbors; ix++)
+    {
+        neighbor = neighbors[ix];
+
+        if ((MINE_TILE_STATUS_FLAG == gameData.tileStatus[neighbor]) ||
+            (MINE_SOLVER_MARK_MINE == solverData.pMarks[neighbor]))
+        {
+            pConstraint->remaining--;
+        }
+        else if ((MINE_TILE_STATUS_REVEALED != gameData.tileStatus[neighbor]) &&
+                 (MINE_SOLVER_MARK_SAFE != solverData.pMarks[neighbor]))
+        {
+            //A tile next to center more than once adds to its weight
+            for (jx = 0; jx < pConstraint->count; jx++)
+            {
+                if (neighbor == pConstraint->tiles[jx])
+                {
+                    break;
+                }
+            }
+
+            if (jx == pConstraint->count)
+            {
+                pConstraint->tiles[jx] = neighbor;
+                pConstraint->weights[jx] = 0;
+                pConstraint->count++;
+            }
+
+            pConstraint->weights[jx]++;
+            pConstraint->total++;
+        }
+    }
+
+    return;
+}
+
+/**
+    MineSolver_Mark
+*//**
+    Record what the solver found out about a tile, and queue the revealed tiles
+    next to it to be looked at again.
+
+    @param[in] index - Board index of the tile.
+    @param[in] mark  - MINE_SOLVER_MARK_SAFE or MINE_SOLVER_MARK_MINE.
+
+    @return TRUE if the tile was undecided, FALSE otherwise.
+*/
+BOOLEAN
+MineSolver_Mark(LONG index, CHAR mark)
+{
+    UINT    ix = 0;
+    BOOLEAN marked = FALSE;
+    LONG    neighbors[MINE_SOLVER_MAX_NEARBY] = {0};
+    UINT    numNeighbors = 0;
+
+    if (MINE_SOLVER_MARK_NONE != solverData.pMarks[index])
+    {
+        if (mark != solverData.pMarks[index])
+        {
+            solverData.contradiction = TRUE;
+        }
+    }
+    else
+    {
+        solverData.pMarks[index] = mark;
+        if (MINE_SOLVER_MARK_SAFE == mark)
+        {
+            solverData.pSafe[solverData.numSafe++] = index;
+        }
+        else
+        {
+            solverData.pMines[solverData.numMines++] = index;
+        }
+
+        /** Only the numbers next to the tile can have changed. */
+        numNeighbors = MineSolver_Nearby(index, 1, neighbors);
+        for (ix = 0; ix < numNeighbors; ix++)
+        {
+            MineSolver_Queue(neighbors[ix]);
+        }
+
+        marked = TRUE;
+    }
+
+    return marked;
+}
+
+/**
+    MineSolver_Nearby
+*//**
+    List the tiles around a tile, across the edges where the board wraps. Tiles
+    are listed as many times as Mine_AssignNumbers counts them.
+
+    @param[in]  index      - Board index of the tile.
+    @param[in]  reach      - Number of tiles out to go, 1 or 2.
+    @param[out] pNeighbors - Board indexes of the tiles, room for MINE_SOLVER_MAX_NEARBY.
+
+    @return Number of tiles listed.
+*/
+UINT
+MineSolver_Nearby(LONG index, LONG reach, _Out_writes_(MINE_SOLVER_MAX_NEARBY) PLONG pNeighbors)
+{
+    LONG height = (LONG) gameData.height;
+    UINT numNeighbors = 0;
+    LONG width = (LONG) gameData.width;
+    LONG xGrid = index % width;
+    LONG xGridPos = 0;
+    LONG xOffset = 0;
+    LONG yGrid = index / width;
+    LONG yGridPos = 0;
+    LONG yOffset = 0;
+
+    for (yOffset = -reach; yOffset <= reach; yOffset++)
+    {
+        yGridPos = yGrid + yOffset;
+        if ((yGridPos < 0) || (yGridPos >= height))
+        {
+            if (!menuData.wrapVert)
+            {
+                continue;
+            }
+            yGridPos = ((yGridPos % height) + height) % height;
+        }
+
+        for (xOffset = -reach; xOffset <= reach; xOffset++)
+        {
+            xGridPos = xGrid + xOffset;
+            if ((xGridPos < 0) || (xGridPos >= width))
+            {
+                if (!menuData.wrapHorz)
+                {
+                    continue;
+                }
+                xGridPos = ((xGridPos % width) + width) % width;
+            }
+
+            if ((0 != xOffset) || (0 != yOffset))
+            {
+                pNeighbors[numNeighbors++] = xGridPos + yGridPos*width;
+            }
+        }
+    }
+
+    return numNeighbors;
+}
+
+/**
+    MineSolver_Pair
+*//**
+    Apply the pair rule to two overlapping constraints. Tiles next to one more
+    often than the other hold the difference of their mines, so when the
+    difference can only be made one way, those tiles are decided.
+
+    @param[in] pFirst  - Constraint taken from the queue.
+    @param[in] pSecond - Constraint around a revealed tile near it.
+
+    @return Number of tiles decided.
+*/
+UINT
+MineSolver_Pair(_In_ const MINE_SOLVER_CONSTRAINT* pFirst, _In_ const MINE_SOLVER_CONSTRAINT* pSecond)
+{
+    UINT    decided = 0;
+    LONG    difference[2*MINE_SOLVER_MAX_NEIGHBORS] = {0};
+    LONG    fewer = 0;
+    UINT    ix = 0;
+    UINT    jx = 0;
+    LONG    more = 0;
+    BOOLEAN moreAreMines = FALSE;
+    UINT    numTiles = 0;
+    BOOLEAN overlap = FALSE;
+    LONG    tiles[2*MINE_SOLVER_MAX_NEIGHBORS] = {0};
+
+    /** Weigh each tile by how much more often it is next to the first tile. */
+    for (ix = 0; ix < pFirst->count; ix++)
+    {
+        tiles[numTiles] = pFirst->tiles[ix];
+        difference[numTiles] = (LONG) pFirst->weights[ix];
+
+        for (jx = 0; jx < pSecond->count; jx++)
+        {
+            if (pSecond->tiles[jx] == pFirst->tiles[ix])
+            {
+                difference[numTiles] -= (LONG) pSecond->weights[jx];
+                overlap = TRUE;
+                break;
+            }
+        }
+
+        numTiles++;
+    }
+
+    //Constraints that share no tile say nothing more than each one alone
+    if (overlap)
+    {
+        for (jx = 0; jx < pSecond->count; jx++)
+        {
+            for (ix = 0; ix < pFirst->count; ix++)
+            {
+                if (pFirst->tiles[ix] == pSecond->tiles[jx])
+                {
+                    break;
+                }
+            }
+
+            if (ix == pFirst->count)
+            {
+                tiles[numTiles] = pSecond->tiles[jx];
+                difference[numTiles] = -((LONG) pSecond->weights[jx]);
+                numTiles++;
+            }
+        }
+
+        for (ix = 0; ix < numTiles; ix++)
+        {
+            if (0 < difference[ix])
+            {
+                more += difference[ix];
+            }
+            else
+            {
+                fewer -= difference[ix];
+            }
+        }
+
+        /** The difference in mines is at most more and at least minus fewer, either
+            end can only be reached one way. */
+        if ((0 < more + fewer) && ((pFirst->remaining - pSecond->remaining == more) ||
+                                   (pSecond->remaining - pFirst->remaining == fewer)))
+        {
+            //At the top end the tiles next to the first tile more often are all mines
+            moreAreMines = (pFirst->remaining - pSecond->remaining == more) ? (BOOLEAN) TRUE : (BOOLEAN) FALSE;
+
+            for (ix = 0; ix < numTiles; ix++)
+            {
+                if (0 == difference[ix])
+                {
+                    continue;
+                }
+
+                if (MineSolver_Mark(tiles[ix], ((0 < difference[ix]) == moreAreMines) ?
+                                               MINE_SOLVER_MARK_MINE : MINE_SOLVER_MARK_SAFE))
+                {
+                    decided++;
+                }
+            }
+        }
+    }
+
+    return decided;
+}
+
+/**
+    MineSolver_Queue
+*//**
+    Queue the constraint around a revealed tile to be looked at, if there is
+    one and it is not already waiting.
+
+    @param[in] center - Board index of the revealed tile.
+*/
+VOID
+MineSolver_Queue(LONG center)
+{
+    LONG constraint = solverData.pConstraintOf[center];
+
+    if ((0 <= constraint) && !solverData.pConstraints[constraint].queued)
+    {
+        //Each constraint waits at most once, so the ring cannot overflow
+        solverData.pQueue[(solverData.queueHead + solverData.queueCount) % solverData.tileCapacity] = constraint;
+        solverData.queueCount++;
+        solverData.pConstraints[constraint].queued = TRUE;
+    }
+
+    return;
+}
+
+/**
+    MineSolver_Reserve
+*//**
+    Take the last solve's marks and constraints off the solver storage, so the
+    next solve starts with nothing decided.
+
+    @return Mine error code (MINE_ERROR_SUCCESS upon success).
+*/
+MINE_ERROR
+MineSolver_Reserve(VOID)
+{
+    BOOLEAN    bFalse = FALSE;
+    UINT       ix = 0;
+    MINE_ERROR status = MINE_ERROR_SUCCESS;
+    DWORD      tiles = gameData.width*gameData.height;
+
+    do
+    {
+        if ((0 == tiles) || (NULL == gameData.gameBoard) || (NULL == gameData.tileStatus))
+        {
+            MineDebug_PrintError("Board has not been set up\n");
+            status = MINE_ERROR_PARAMETER;
+            break;
+        }
+
+        if ((NULL == frontierData.pSlots) || (arenaData.resets != frontierData.arenaResets) ||
+            (gameData.width != frontierData.width) || (gameData.height != frontierData.height))
+        {
+            MineDebug_PrintError("Frontier has not been set up for the board\n");
+            status = MINE_ERROR_PARAMETER;
+            break;
+        }
+
+        if ((NULL == solverData.pConstraints) || (arenaData.resets != solverData.arenaResets) ||
+            (tiles != solverData.tileCapacity))
+        {
+            MineDebug_PrintError("Solver storage has not been set up for the game\n");
+            status = MINE_ERROR_PARAMETER;
+            break;
+        }
+
+        /** Only undo what the last solve did, so the cost follows the frontier
+            rather than the board. */
+        for (ix = 0; ix < solverData.numSafe; ix++)
+        {
+            solverData.pMarks[solverData.pSafe[ix]] = MINE_SOLVER_MARK_NONE;
+        }
+
+        for (ix = 0; ix < solverData.numMines; ix++)
+        {
+            solverData.pMarks[solverData.pMines[ix]] = MINE_SOLVER_MARK_NONE;
+        }
+
+        for (ix = 0; ix < solverData.numConstraints; ix++)
+        {
+            solverData.pConstraintOf[solverData.pConstraints[ix].center] = -1;
+        }
+
+        solverData.numConstraints = 0;
+        solverData.queueHead = 0;
+        solverData.queueCount = 0;
+        solverData.numSafe = 0;
+        solverData.numMines = 0;
+        solverData.numFlagged = 0;
+        solverData.numUnknown = 0;
+        solverData.contradiction = FALSE;
+
+        __assume(FALSE == bFalse);
+    } while (bFalse);
+
+    return status;
+}
+
+/**
+    MineSolver_Reset
+*//**
+    Carve the solver storage for the board in gameData out of the arena, with
+    nothing decided. Must be called for each new game that is solved, after
+    Mine_AllocBoard was given MineSolver_ArenaBytes more bytes.
+
+    @return Mine error code (MINE_ERROR_SUCCESS upon success).
+*/
+MINE_ERROR
+MineSolver_Reset(VOID)
+{
+    BOOLEAN    bFalse = FALSE;
+    DWORD      ix = 0;
+    MINE_ERROR status = MINE_ERROR_SUCCESS;
+    DWORD      tiles = gameData.width*gameData.height;
+
+    do
+    {
+        //What was carved for the last game went with the arena reset
+        solverData.pConstraints = (MINE_SOLVER_CONSTRAINT*) MineArena_Alloc(((SIZE_T) tiles)*
+                                                                            sizeof(MINE_SOLVER_CONSTRAINT));
+        solverData.pConstraintOf = (LONG*) MineArena_Alloc(((SIZE_T) tiles)*sizeof(LONG));
+        solverData.pQueue = (LONG*) MineArena_Alloc(((SIZE_T) tiles)*sizeof(LONG));
+        solverData.pSafe = (LONG*) MineArena_Alloc(((SIZE_T) tiles)*sizeof(LONG));
+        solverData.pMines = (LONG*) MineArena_Alloc(((SIZE_T) tiles)*sizeof(LONG));
+        solverData.pMarks = (CHAR*) MineArena_Alloc(tiles);
+        solverData.tileCapacity = tiles;
+        solverData.arenaResets = arenaData.resets;
+
+        if ((NULL == solverData.pConstraints) || (NULL == solverData.pConstraintOf) || (NULL == solverData.pQueue) ||
+            (NULL == solverData.pSafe) || (NULL == solverData.pMines) || (NULL == solverData.pMarks))
+        {
+            MineDebug_PrintError("Arena has no room for the solver storage of %u tiles\n", (UINT) tiles);
+            solverData.pConstraints = NULL;
+            status = MINE_ERROR_MEMORY;
+            break;
+        }
+
+        for (ix = 0; ix < tiles; ix++)
+        {
+            solverData.pConstraintOf[ix] = -1;
+        }
+
+        //The marks start zeroed, so there is nothing for the first solve to undo
+        solverData.numConstraints = 0;
+        solverData.numSafe = 0;
+        solverData.numMines = 0;
+
+        __assume(FALSE == bFalse);
+    } while (bFalse);
+
+    return status;
+}
+
+/**
+    MineSolver_Single
+*//**
+    Apply the single point rule: a revealed number with no mines left around it
+    makes every undecided neighbor safe, one with as many mines left as
+    undecided neighbors makes them all mines.
+
+    @param[in] pConstraint - Constraint to apply the rule to.
+
+    @return Number of tiles decided.
+*/
+UINT
+MineSolver_Single(_In_ const MINE_SOLVER_CONSTRAINT* pConstraint)
+{
+    UINT decided = 0;
+    UINT ix = 0;
+    CHAR mark = MINE_SOLVER_MARK_NONE;
+
+    if (0 == pConstraint->remaining)
+    {
+        mark = MINE_SOLVER_MARK_SAFE;
+    }
+    else if (pConstraint->total == pConstraint->remaining)
+    {
+        mark = MINE_SOLVER_MARK_MINE;
+    }
+
+    if (MINE_SOLVER_MARK_NONE != mark)
+    {
+        for (ix = 0; ix < pConstraint->count; ix++)
+        {
+            if (MineSolver_Mark(pConstraint->tiles[ix], mark))
+            {
+                decided++;
+            }
+        }
+    }
+
+    return decided;
+}
+
+/**
+    MineSolver_Solve
+*//**
+    Find every tile that is certainly safe or certainly a mine from what the
+    player can see: revealed numbers, flags and the count of mines. Starts
+    from the numbers in frontierData rather than scanning the board, results
+    are left in solverData.
+
+    @return Mine error code (MINE_ERROR_SUCCESS upon success).
+*/
+MINE_ERROR
+MineSolver_Solve(VOID)
+{
+    BOOLEAN                 bFalse = FALSE;
+    LONG                    center = 0;
+    UINT                    decided = 0;
+    LONG                    ix = 0;
+    UINT                    jx = 0;
+    LONG                    minesLeft = 0;
+    LONG                    nearby[MINE_SOLVER_MAX_NEARBY] = {0};
+    UINT                    numNearby = 0;
+    MINE_SOLVER_CONSTRAINT* pConstraint = NULL;
+    MINE_SOLVER_CONSTRAINT* pOther = NULL;
+    MINE_ERROR              status = MINE_ERROR_SUCCESS;
+    LONG                    tiles = (LONG) (gameData.width*gameData.height);
+    LONG                    undecided = 0;
+
+    do
+    {
+        status = MineSolver_Reserve();
+        if (MINE_ERROR_SUCCESS != status)
+        {
+            MineDebug_PrintError("In function MineSolver_Reserve: %i\n", (int) status);
+            break;
+        }
+
+        solverData.solves++;
+
+        solverData.numFlagged = frontierData.numFlagged;
+        solverData.numUnknown = frontierData.numUnknown;
+
+        /** Every revealed number with hidden tiles around it is a constraint.
+            The frontier already lists them, so the board is not scanned. */
+        for (jx = 0; jx < frontierData.numNumbers; jx++)
+        {
+            center = frontierData.pNumbers[jx];
+            if (MINE_BOMB_VALUE == gameData.gameBoard[center])
+            {
+                continue;
+            }
+
+            pConstraint = &solverData.pConstraints[solverData.numConstraints];
+            MineSolver_Build(center, pConstraint);
+
+            if (0 < pConstraint->count)
+            {
+                pConstraint->queued = FALSE;
+                solverData.pConstraintOf[center] = (LONG) solverData.numConstraints;
+                solverData.numConstraints++;
+                MineSolver_Queue(center);
+            }
+            else if (0 != pConstraint->remaining)
+            {
+                solverData.contradiction = TRUE;
+            }
+        }
+
+        do
+        {
+            /** Look at each constraint again whenever a tile next to it is decided. */
+            while (0 < solverData.queueCount)
+            {
+                pConstraint = &solverData.pConstraints[solverData.pQueue[solverData.queueHead]];
+                solverData.queueHead = (solverData.queueHead + 1) % solverData.tileCapacity;
+                solverData.queueCount--;
+                pConstraint->queued = FALSE;
+
+                MineSolver_Build(pConstraint->center, pConstraint);
+
+                if ((0 > pConstraint->remaining) || (pConstraint->total < pConstraint->remaining))
+                {
+                    solverData.contradiction = TRUE;
+                    continue;
+                }
+
+                if (0 == pConstraint->count)
+                {
+                    continue;
+                }
+
+                decided = MineSolver_Single(pConstraint);
+                solverData.singleDeductions += decided;
+                if (0 < decided)
+                {
+                    continue;
+                }
+
+                //Only numbers within two tiles can share a hidden tile with this one
+                numNearby = MineSolver_Nearby(pConstraint->center, 2, nearby);
+                for (jx = 0; jx < numNearby; jx++)
+                {
+                    if ((nearby[jx] == pConstraint->center) || (0 > solverData.pConstraintOf[nearby[jx]]))
+                    {
+                        continue;
+                    }
+
+                    pOther = &solverData.pConstraints[solverData.pConstraintOf[nearby[jx]]];
+                    MineSolver_Build(pOther->center, pOther);
+                    if (0 == pOther->count)
+                    {
+                        continue;
+                    }
+
+                    decided = MineSolver_Pair(pConstraint, pOther);
+                    solverData.pairDeductions += decided;
+                    if (0 < decided)
+                    {
+                        break;
+                    }
+                }
+            }
+
+            /** Once the numbers say nothing more, the count of mines left may. */
+            minesLeft = (LONG) gameData.mines - (LONG) solverData.numFlagged - (LONG) solverData.numMines;
+            undecided = (LONG) solverData.numUnknown - (LONG) solverData.numSafe - (LONG) solverData.numMines;
+
+            if ((0 > minesLeft) || (minesLeft > undecided))
+            {
+                solverData.contradiction = TRUE;
+            }
+            else if ((0 < undecided) && ((0 == minesLeft) || (undecided == minesLeft)))
+            {
+                for (ix = 0; ix < tiles; ix++)
+                {
+                    if ((MINE_TILE_STATUS_REVEALED != gameData.tileStatus[ix]) &&
+                        (MINE_TILE_STATUS_FLAG != gameData.tileStatus[ix]) &&
+                        (MINE_SOLVER_MARK_NONE == solverData.pMarks[ix]) &&
+                        MineSolver_Mark(ix, (0 == minesLeft) ? MINE_SOLVER_MARK_SAFE : MINE_SOLVER_MARK_MINE))
+                    {
+                        solverData.countDeductions++;
+                    }
+                }
+            }
+        } while (0 < solverData.queueCount);
+
+        __assume(FALSE == bFalse);
+    } while (bFalse);
+
+    return status;
+}
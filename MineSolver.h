@@ -0,0 +1,262 @@
+/**
+    @file MineSolver.h
+
+    @author Craig Burkhart
+
+    @brief Header file for the rule based solver, which finds the tiles that are
+           certainly safe or certainly mines from what the player can see.
+*//*
+    Copyright (C) 2014 - Craig Burkhart
+
+    This file is part of Minesweeper Deluxe.
+
+    Minesweeper Deluxe is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Minesweeper Deluxe is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Minesweeper Deluxe.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#pragma once
+
+#include "Mine.h"
+
+//--------------------------------------------------------------
+//    Macros
+//--------------------------------------------------------------
+
+/** Tile the solver has not decided. */
+#define MINE_SOLVER_MARK_NONE 0
+/** Tile the solver found to be certainly safe. */
+#define MINE_SOLVER_MARK_SAFE 1
+/** Tile the solver found to be certainly a mine. */
+#define MINE_SOLVER_MARK_MINE 2
+
+/** Most tiles next to a tile, also the most tiles in one constraint. */
+#define MINE_SOLVER_MAX_NEIGHBORS 8
+/** Most tiles within two tiles of a tile, where the revealed tiles that can
+    share a neighbor with it are. */
+#define MINE_SOLVER_MAX_NEARBY    24
+
+//--------------------------------------------------------------
+//    Structures
+//--------------------------------------------------------------
+
+struct _MINE_SOLVER_CONSTRAINT
+{
+    /** Board index of the revealed tile. */
+    LONG    center;
+    /** Number of mines among the undecided tiles. */
+    LONG    remaining;
+    /** Board indexes of the undecided tiles around center, each listed once. */
+    LONG    tiles[MINE_SOLVER_MAX_NEIGHBORS];
+    /** Number of times each tile is next to center, more than once only across
+        the wrapped edges of a board one or two tiles wide. */
+    CHAR    weights[MINE_SOLVER_MAX_NEIGHBORS];
+    /** Number of tiles in use. */
+    UINT    count;
+    /** Sum of the weights in use. */
+    LONG    total;
+    /** Flag for if the constraint is waiting in the queue. */
+    BOOLEAN queued;
+};
+
+struct _MINE_SOLVER_DATA
+{
+    /** Revealed tiles with undecided neighbors, as of the last solve. */
+    struct _MINE_SOLVER_CONSTRAINT* pConstraints;
+    /** Index into pConstraints of the constraint around each tile, -1 for none. */
+    LONG*                           pConstraintOf;
+    /** Ring of indexes into pConstraints still to be looked at. */
+    LONG*                           pQueue;
+    /** Board indexes of the tiles found to be safe. */
+    LONG*                           pSafe;
+    /** Board indexes of the tiles found to be mines. */
+    LONG*                           pMines;
+    /** What the solver found out about each tile (MINE_SOLVER_MARK_*). */
+    CHAR*                           pMarks;
+    /** Number of tiles the arrays have room for. */
+    DWORD                           tileCapacity;
+    /** Value of arenaData.resets when the arrays were carved out of the
+        arena, they are gone once it is reset again. */
+    UINT                            arenaResets;
+    /** Number of constraints in use. */
+    UINT                            numConstraints;
+    /** Position in pQueue of the next constraint to look at. */
+    UINT                            queueHead;
+    /** Number of constraints in pQueue. */
+    UINT                            queueCount;
+    /** Number of tiles in pSafe. */
+    UINT                            numSafe;
+    /** Number of tiles in pMines. */
+    UINT                            numMines;
+    /** Number of flagged tiles, all counted as mines. */
+    UINT                            numFlagged;
+    /** Number of tiles neither revealed nor flagged. */
+    UINT                            numUnknown;
+    /** Flag for if the visible board cannot be explained by any mine layout,
+        because of a misplaced flag or a number changed by moving mines. */
+    BOOLEAN                         contradiction;
+    /** Number of solves run. */
+    ULONGLONG                       solves;
+    /** Number of tiles decided by a single revealed number. */
+    ULONGLONG                       singleDeductions;
+    /** Number of tiles decided by a pair of revealed numbers. */
+    ULONGLONG                       pairDeductions;
+    /** Number of tiles decided by the count of mines left. */
+    ULONGLONG                       countDeductions;
+};
+
+//--------------------------------------------------------------
+//    Typedefs
+//--------------------------------------------------------------
+
+/** Undecided tiles around one revealed tile, and how many of them are mines. */
+typedef struct _MINE_SOLVER_CONSTRAINT MINE_SOLVER_CONSTRAINT;
+
+/** Working storage and results of the solver. */
+typedef struct _MINE_SOLVER_DATA MINE_SOLVER_DATA;
+
+//--------------------------------------------------------------
+//    Global Variable Externs
+//--------------------------------------------------------------
+
+extern MINE_SOLVER_DATA solverData;
+
+//--------------------------------------------------------------
+//    Function Prototypes
+//--------------------------------------------------------------
+
+/**
+    MineSolver_ArenaBytes
+*//**
+    Number of bytes the solver storage for the board in gameData takes from
+    the arena, to be added to what Mine_AllocBoard is asked for.
+
+    @return Number of bytes.
+*/
+SIZE_T
+MineSolver_ArenaBytes(VOID);
+
+/**
+    MineSolver_Build
+*//**
+    Fill in the constraint around a revealed tile from the board and what the
+    solver has found so far. Flags count as mines.
+
+    @param[in]  center      - Board index of the revealed tile.
+    @param[out] pConstraint - Constraint to fill in.
+*/
+VOID
+MineSolver_Build(LONG center, _Out_ MINE_SOLVER_CONSTRAINT* pConstraint);
+
+/**
+    MineSolver_Mark
+*//**
+    Record what the solver found out about a tile, and queue the revealed tiles
+    next to it to be looked at again.
+
+    @param[in] index - Board index of the tile.
+    @param[in] mark  - MINE_SOLVER_MARK_SAFE or MINE_SOLVER_MARK_MINE.
+
+    @return TRUE if the tile was undecided, FALSE otherwise.
+*/
+BOOLEAN
+MineSolver_Mark(LONG index, CHAR mark);
+
+/**
+    MineSolver_Nearby
+*//**
+    List the tiles around a tile, across the edges where the board wraps. Tiles
+    are listed as many times as Mine_AssignNumbers counts them.
+
+    @param[in]  index      - Board index of the tile.
+    @param[in]  reach      - Number of tiles out to go, 1 or 2.
+    @param[out] pNeighbors - Board indexes of the tiles, room for MINE_SOLVER_MAX_NEARBY.
+
+    @return Number of tiles listed.
+*/
+UINT
+MineSolver_Nearby(LONG index, LONG reach, _Out_writes_(MINE_SOLVER_MAX_NEARBY) PLONG pNeighbors);
+
+/**
+    MineSolver_Pair
+*//**
+    Apply the pair rule to two overlapping constraints. Tiles next to one more
+    often than the other hold the difference of their mines, so when the
+    difference can only be made one way, those tiles are decided.
+
+    @param[in] pFirst  - Constraint taken from the queue.
+    @param[in] pSecond - Constraint around a revealed tile near it.
+
+    @return Number of tiles decided.
+*/
+UINT
+MineSolver_Pair(_In_ const MINE_SOLVER_CONSTRAINT* pFirst, _In_ const MINE_SOLVER_CONSTRAINT* pSecond);
+
+/**
+    MineSolver_Queue
+*//**
+    Queue the constraint around a revealed tile to be looked at, if there is
+    one and it is not already waiting.
+
+    @param[in] center - Board index of the revealed tile.
+*/
+VOID
+MineSolver_Queue(LONG center);
+
+/**
+    MineSolver_Reserve
+*//**
+    Take the last solve's marks and constraints off the solver storage, so the
+    next solve starts with nothing decided.
+
+    @return Mine error code (MINE_ERROR_SUCCESS upon success).
+*/
+MINE_ERROR
+MineSolver_Reserve(VOID);
+
+/**
+    MineSolver_Reset
+*//**
+    Carve the solver storage for the board in gameData out of the arena, with
+    nothing decided. Must be called for each new game that is solved, after
+    Mine_AllocBoard was given MineSolver_ArenaBytes more bytes.
+
+    @return Mine error code (MINE_ERROR_SUCCESS upon success).
+*/
+MINE_ERROR
+MineSolver_Reset(VOID);
+
+/**
+    MineSolver_Single
+*//**
+    Apply the single point rule: a revealed number with no mines left around it
+    makes every undecided neighbor safe, one with as many mines left as
+    undecided neighbors makes them all mines.
+
+    @param[in] pConstraint - Constraint to apply the rule to.
+
+    @return Number of tiles decided.
+*/
+UINT
+MineSolver_Single(_In_ const MINE_SOLVER_CONSTRAINT* pConstraint);
+
+/**
+    MineSolver_Solve
+*//**
+    Find every tile that is certainly safe or certainly a mine from what the
+    player can see: revealed numbers, flags and the count of mines. Starts
+    from the numbers in frontierData rather than scanning the board, results
+    are left in solverData.
+
+    @return Mine error code (MINE_ERROR_SUCCESS upon success).
+*/
+MINE_ERROR
+MineSolver_Solve(VOID);
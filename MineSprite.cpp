@@ -0,0 +1,122 @@
+/**
+    @file MineSprite.cpp
+
+    @author Craig Burkhart
+
+    @brief Layout of the sprite atlas shared by every number image set.
+*//*
+    Copyright (C) 2014 - Craig Burkhart
+
+    This file is part of Minesweeper Deluxe.
+
+    Minesweeper Deluxe is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Minesweeper Deluxe is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Minesweeper Deluxe.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#include "stdafx.h"
+#include "MineSprite.h"
+#include "MineDebug.h"
+
+/** Atlas row holding the unclicked, held, flag and mine tiles. */
+#define MINE_ATLAS_ROW_TILES    0
+/** Atlas row holding the normal number tiles. */
+#define MINE_ATLAS_ROW_CLICKED 16
+/** Atlas row holding the solid color number tiles. */
+#define MINE_ATLAS_ROW_SOLID   32
+/** Atlas row holding the random symbol tiles. */
+#define MINE_ATLAS_ROW_RANDOM  48
+/** Atlas row holding the timer digits and dash. */
+#define MINE_ATLAS_ROW_TIMER   64
+/** Atlas row holding the smiley faces. */
+#define MINE_ATLAS_ROW_FACE    87
+
+/** Location of every sprite in the atlas, indexed by MINE_SPRITE_* identifier. */
+static const MINE_SPRITE_INFO spriteTable[MINE_SPRITE_COUNT] =
+{
+    {"Unclicked.bmp",     0, MINE_ATLAS_ROW_TILES,   MINE_TILE_PIXELS, MINE_TILE_PIXELS},
+    {"Held.bmp",         16, MINE_ATLAS_ROW_TILES,   MINE_TILE_PIXELS, MINE_TILE_PIXELS},
+    {"Flag.bmp",         32, MINE_ATLAS_ROW_TILES,   MINE_TILE_PIXELS, MINE_TILE_PIXELS},
+    {"FalseFlag.bmp",    48, MINE_ATLAS_ROW_TILES,   MINE_TILE_PIXELS, MINE_TILE_PIXELS},
+    {"Mine.bmp",         64, MINE_ATLAS_ROW_TILES,   MINE_TILE_PIXELS, MINE_TILE_PIXELS},
+    {"MineHit.bmp",      80, MINE_ATLAS_ROW_TILES,   MINE_TILE_PIXELS, MINE_TILE_PIXELS},
+    {"Clicked0.bmp",      0, MINE_ATLAS_ROW_CLICKED, MINE_TILE_PIXELS, MINE_TILE_PIXELS},
+    {"Clicked1.bmp",     16, MINE_ATLAS_ROW_CLICKED, MINE_TILE_PIXELS, MINE_TILE_PIXELS},
+    {"Clicked2.bmp",     32, MINE_ATLAS_ROW_CLICKED, MINE_TILE_PIXELS, MINE_TILE_PIXELS},
+    {"Clicked3.bmp",     48, MINE_ATLAS_ROW_CLICKED, MINE_TILE_PIXELS, MINE_TILE_PIXELS},
+    {"Clicked4.bmp",     64, MINE_ATLAS_ROW_CLICKED, MINE_TILE_PIXELS, MINE_TILE_PIXELS},
+    {"Clicked5.bmp",     80, MINE_ATLAS_ROW_CLICKED, MINE_TILE_PIXELS, MINE_TILE_PIXELS},
+    {"Clicked6.bmp",     96, MINE_ATLAS_ROW_CLICKED, MINE_TILE_PIXELS, MINE_TILE_PIXELS},
+    {"Clicked7.bmp",    112, MINE_ATLAS_ROW_CLICKED, MINE_TILE_PIXELS, MINE_TILE_PIXELS},
+    {"Clicked8.bmp",    128, MINE_ATLAS_ROW_CLICKED, MINE_TILE_PIXELS, MINE_TILE_PIXELS},
+    {"Solid0.bmp",        0, MINE_ATLAS_ROW_SOLID,   MINE_TILE_PIXELS, MINE_TILE_PIXELS},
+    {"Solid1.bmp",       16, MINE_ATLAS_ROW_SOLID,   MINE_TILE_PIXELS, MINE_TILE_PIXELS},
+    {"Solid2.bmp",       32, MINE_ATLAS_ROW_SOLID,   MINE_TILE_PIXELS, MINE_TILE_PIXELS},
+    {"Solid3.bmp",       48, MINE_ATLAS_ROW_SOLID,   MINE_TILE_PIXELS, MINE_TILE_PIXELS},
+    {"Solid4.bmp",       64, MINE_ATLAS_ROW_SOLID,   MINE_TILE_PIXELS, MINE_TILE_PIXELS},
+    {"Solid5.bmp",       80, MINE_ATLAS_ROW_SOLID,   MINE_TILE_PIXELS, MINE_TILE_PIXELS},
+    {"Solid6.bmp",       96, MINE_ATLAS_ROW_SOLID,   MINE_TILE_PIXELS, MINE_TILE_PIXELS},
+    {"Solid7.bmp",      112, MINE_ATLAS_ROW_SOLID,   MINE_TILE_PIXELS, MINE_TILE_PIXELS},
+    {"Solid8.bmp",      128, MINE_ATLAS_ROW_SOLID,   MINE_TILE_PIXELS, MINE_TILE_PIXELS},
+    {"Random0.bmp",       0, MINE_ATLAS_ROW_RANDOM,  MINE_TILE_PIXELS, MINE_TILE_PIXELS},
+    {"Random1.bmp",      16, MINE_ATLAS_ROW_RANDOM,  MINE_TILE_PIXELS, MINE_TILE_PIXELS},
+    {"Random2.bmp",      32, MINE_ATLAS_ROW_RANDOM,  MINE_TILE_PIXELS, MINE_TILE_PIXELS},
+    {"Random3.bmp",      48, MINE_ATLAS_ROW_RANDOM,  MINE_TILE_PIXELS, MINE_TILE_PIXELS},
+    {"Random4.bmp",      64, MINE_ATLAS_ROW_RANDOM,  MINE_TILE_PIXELS, MINE_TILE_PIXELS},
+    {"Random5.bmp",      80, MINE_ATLAS_ROW_RANDOM,  MINE_TILE_PIXELS, MINE_TILE_PIXELS},
+    {"Random6.bmp",      96, MINE_ATLAS_ROW_RANDOM,  MINE_TILE_PIXELS, MINE_TILE_PIXELS},
+    {"Random7.bmp",     112, MINE_ATLAS_ROW_RANDOM,  MINE_TILE_PIXELS, MINE_TILE_PIXELS},
+    {"Random8.bmp",     128, MINE_ATLAS_ROW_RANDOM,  MINE_TILE_PIXELS, MINE_TILE_PIXELS},
+    {"Random9.bmp",     144, MINE_ATLAS_ROW_RANDOM,  MINE_TILE_PIXELS, MINE_TILE_PIXELS},
+    {"Random10.bmp",    160, MINE_ATLAS_ROW_RANDOM,  MINE_TILE_PIXELS, MINE_TILE_PIXELS},
+    {"Random11.bmp",    176, MINE_ATLAS_ROW_RANDOM,  MINE_TILE_PIXELS, MINE_TILE_PIXELS},
+    {"Random12.bmp",    192, MINE_ATLAS_ROW_RANDOM,  MINE_TILE_PIXELS, MINE_TILE_PIXELS},
+    {"Random13.bmp",    208, MINE_ATLAS_ROW_RANDOM,  MINE_TILE_PIXELS, MINE_TILE_PIXELS},
+    {"Random14.bmp",    224, MINE_ATLAS_ROW_RANDOM,  MINE_TILE_PIXELS, MINE_TILE_PIXELS},
+    {"Random15.bmp",    240, MINE_ATLAS_ROW_RANDOM,  MINE_TILE_PIXELS, MINE_TILE_PIXELS},
+    {"Timer0.bmp",        0, MINE_ATLAS_ROW_TIMER,   MINE_TIMER_WIDTH, MINE_TIMER_HEIGHT},
+    {"Timer1.bmp",       13, MINE_ATLAS_ROW_TIMER,   MINE_TIMER_WIDTH, MINE_TIMER_HEIGHT},
+    {"Timer2.bmp",       26, MINE_ATLAS_ROW_TIMER,   MINE_TIMER_WIDTH, MINE_TIMER_HEIGHT},
+    {"Timer3.bmp",       39, MINE_ATLAS_ROW_TIMER,   MINE_TIMER_WIDTH, MINE_TIMER_HEIGHT},
+    {"Timer4.bmp",       52, MINE_ATLAS_ROW_TIMER,   MINE_TIMER_WIDTH, MINE_TIMER_HEIGHT},
+    {"Timer5.bmp",       65, MINE_ATLAS_ROW_TIMER,   MINE_TIMER_WIDTH, MINE_TIMER_HEIGHT},
+    {"Timer6.bmp",       78, MINE_ATLAS_ROW_TIMER,   MINE_TIMER_WIDTH, MINE_TIMER_HEIGHT},
+    {"Timer7.bmp",       91, MINE_ATLAS_ROW_TIMER,   MINE_TIMER_WIDTH, MINE_TIMER_HEIGHT},
+    {"Timer8.bmp",      104, MINE_ATLAS_ROW_TIMER,   MINE_TIMER_WIDTH, MINE_TIMER_HEIGHT},
+    {"Timer9.bmp",      117, MINE_ATLAS_ROW_TIMER,   MINE_TIMER_WIDTH, MINE_TIMER_HEIGHT},
+    {"TimerDash.bmp",   130, MINE_ATLAS_ROW_TIMER,   MINE_TIMER_WIDTH, MINE_TIMER_HEIGHT},
+    {"FaceNormal.bmp",    0, MINE_ATLAS_ROW_FACE,    MINE_FACE_WIDTH,  MINE_FACE_HEIGHT},
+    {"FaceClicked.bmp",  26, MINE_ATLAS_ROW_FACE,    MINE_FACE_WIDTH,  MINE_FACE_HEIGHT},
+    {"FaceWon.bmp",      52, MINE_ATLAS_ROW_FACE,    MINE_FACE_WIDTH,  MINE_FACE_HEIGHT},
+    {"FaceLost.bmp",     78, MINE_ATLAS_ROW_FACE,    MINE_FACE_WIDTH,  MINE_FACE_HEIGHT}
+};
+
+/**
+    MineSprite_GetInfo
+*//**
+    Look up the location of a sprite in the atlas.
+
+    @param[in] sprite - Sprite identifier (MINE_SPRITE_*).
+
+    @return Pointer to sprite location, or NULL for an invalid identifier.
+*/
+const MINE_SPRITE_INFO*
+MineSprite_GetInfo(UINT sprite)
+{
+    const MINE_SPRITE_INFO* pInfo = NULL;
+
+    if (MINE_SPRITE_COUNT > sprite)
+    {
+        pInfo = &spriteTable[sprite];
+    }
+
+    return pInfo;
+}
@@ -0,0 +1,112 @@
+/**
+    @file MineSprite.h
+
+    @author Craig Burkhart
+
+    @brief Header file for the sprite atlas.
+*//*
+    Copyright (C) 2014 - Craig Burkhart
+
+    This file is part of Minesweeper Deluxe.
+
+    Minesweeper Deluxe is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Minesweeper Deluxe is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Minesweeper Deluxe.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#pragma once
+
+#include "Mine.h"
+
+//--------------------------------------------------------------
+//    Macros
+//--------------------------------------------------------------
+
+/** Width (in pixels) of the sprite atlas. */
+#define MINE_ATLAS_WIDTH  256
+/** Height (in pixels) of the sprite atlas. */
+#define MINE_ATLAS_HEIGHT 113
+
+/** Sprite for an unclicked tile. */
+#define MINE_SPRITE_UNCLICKED   0
+/** Sprite for a tile that is being held. */
+#define MINE_SPRITE_HELD        1
+/** Sprite for a flagged tile. */
+#define MINE_SPRITE_FLAG        2
+/** Sprite for a flag that was incorrectly placed. */
+#define MINE_SPRITE_FALSEFLAG   3
+/** Sprite for a mine when a game is lost. */
+#define MINE_SPRITE_MINE        4
+/** Sprite for a mine that was clicked. */
+#define MINE_SPRITE_MINEHIT     5
+/** First of nine sprites for normal numbers. */
+#define MINE_SPRITE_CLICKED0    6
+/** First of nine sprites for solid color numbers. */
+#define MINE_SPRITE_SOLID0      15
+/** First of MINE_NUM_RANDOM_TILES sprites for random symbols. */
+#define MINE_SPRITE_RANDOM0     24
+/** First of ten sprites for timer digits. */
+#define MINE_SPRITE_TIMER0      40
+/** Sprite for dash of negative remaining mine count. */
+#define MINE_SPRITE_TIMERDASH   50
+/** Sprite for normal smiley face. */
+#define MINE_SPRITE_FACENORMAL  51
+/** Sprite for face when left mouse button is clicked. */
+#define MINE_SPRITE_FACECLICKED 52
+/** Sprite for face when game has been won. */
+#define MINE_SPRITE_FACEWON     53
+/** Sprite for face when game has been lost. */
+#define MINE_SPRITE_FACELOST    54
+/** Number of sprites, from the first, that are drawn as board tiles. */
+#define MINE_SPRITE_TILES       MINE_SPRITE_TIMER0
+/** Number of sprites in the atlas. */
+#define MINE_SPRITE_COUNT       55
+
+//--------------------------------------------------------------
+//    Structures
+//--------------------------------------------------------------
+
+struct _MINE_SPRITE_INFO
+{
+    /** Name of the bitmap file mineatlasgen packs into the atlas. */
+    LPCSTR fileName;
+    /** X coordinate (in pixels) of the sprite in the atlas. */
+    LONG   x;
+    /** Y coordinate (in pixels) of the sprite in the atlas. */
+    LONG   y;
+    /** Width (in pixels) of the sprite. */
+    LONG   width;
+    /** Height (in pixels) of the sprite. */
+    LONG   height;
+};
+
+//--------------------------------------------------------------
+//    Typedefs
+//--------------------------------------------------------------
+
+/** Location of a sprite in the atlas. */
+typedef struct _MINE_SPRITE_INFO MINE_SPRITE_INFO;
+
+//--------------------------------------------------------------
+//    Function Prototypes
+//--------------------------------------------------------------
+
+/**
+    MineSprite_GetInfo
+*//**
+    Look up the location of a sprite in the atlas.
+
+    @param[in] sprite - Sprite identifier (MINE_SPRITE_*).
+
+    @return Pointer to sprite location, or NULL for an invalid identifier.
+*/
+const MINE_SPRITE_INFO*
+MineSprite_GetInfo(UINT sprite);
@@ -0,0 +1,921 @@
+/**
+    @file MineTerm.cpp
+
+    @author Craig Burkhart
+
+    @brief Terminal frontend that plays the game in a Linux terminal. The board
+           is drawn with ANSI escapes and only tiles the game reports as
+           changed are looked at, so a game can be watched over a slow link.
+*//*
+    Copyright (C) 2014 - Craig Burkhart
+
+    This file is part of Minesweeper Deluxe.
+
+    Minesweeper Deluxe is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Minesweeper Deluxe is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Minesweeper Deluxe.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#include "stdafx.h"
+#include "MineTerm.h"
+#include "MineArena.h"
+#include "MineDebug.h"
+#include "MineFrontier.h"
+#include "MineMinimap.h"
+#include "MineMouse.h"
+#include "MineRender.h"
+
+/** How each tile sprite is drawn, indexed by MINE_SPRITE_*. */
+static const MINE_TERM_GLYPH termGlyphs[MINE_SPRITE_TILES] =
+{
+    {"  ", "0;47"},    {"  ", "0;100"},   {" F", "1;31;47"}, {" X", "1;31;40"}, {" *", "1;37;40"},
+    {" *", "1;37;41"}, {"  ", "0"},       {" 1", "1;34"},    {" 2", "1;32"},    {" 3", "1;31"},
+    {" 4", "0;34"},    {" 5", "0;31"},    {" 6", "0;36"},    {" 7", "1;35"},    {" 8", "0;37"},
+    {"  ", "0"},       {"  ", "0;44"},    {"  ", "0;42"},    {"  ", "0;41"},    {"  ", "0;45"},
+    {"  ", "0;43"},    {"  ", "0;46"},    {"  ", "0;100"},   {"  ", "0;107"},   {" !", "1;31"},
+    {" @", "1;32"},    {" #", "1;33"},    {" $", "1;34"},    {" %", "1;35"},    {" &", "1;36"},
+    {" +", "0;31"},    {" =", "0;32"},    {" ?", "0;33"},    {" ~", "0;34"},    {" ^", "0;35"},
+    {" <", "0;36"},    {" >", "1;31"},    {" o", "1;32"},    {" x", "1;33"},    {" s", "1;34"}
+};
+
+// Global Variables:
+MINE_TERM_DATA termData = {0};
+
+/**
+    main
+*//**
+    Play games in the terminal until the player quits.
+
+    Usage: mineterm [-l beginner|intermediate|expert] [-s seed]
+
+    @param[in] argc - Number of command line arguments.
+    @param[in] argv - Command line arguments.
+
+    @return 0 if the game ran until the player quit, 1 otherwise.
+*/
+int
+main(int argc, char* argv[])
+{
+    BOOLEAN       bFalse = FALSE;
+    CHAR          input[MINE_TERM_INPUT_BYTES] = {0};
+    ssize_t       inputBytes = 0;
+    INT           ix = 0;
+    struct pollfd pollInput = {0};
+    INT           ready = 0;
+    ULONGLONG     seed = (ULONGLONG) time(NULL) ^ ((ULONGLONG) getpid() << 32);
+    MINE_ERROR    status = MINE_ERROR_SUCCESS;
+
+    menuData.gameLevel = MINE_LEVEL_BEGINNER;
+    menuData.numberImages = MINE_NUMBER_IMAGE_NORMAL;
+
+    do
+    {
+        for (ix = 1; ix < argc; ix++)
+        {
+            if ((0 == strcmp(argv[ix], "-l")) && (ix + 1 < argc))
+            {
+                ix++;
+                if (0 == strcmp(argv[ix], "beginner"))
+                {
+                    menuData.gameLevel = MINE_LEVEL_BEGINNER;
+                }
+                else if (0 == strcmp(argv[ix], "intermediate"))
+                {
+                    menuData.gameLevel = MINE_LEVEL_INTERMEDIATE;
+                }
+                else if (0 == strcmp(argv[ix], "expert"))
+                {
+                    menuData.gameLevel = MINE_LEVEL_EXPERT;
+                }
+                else
+                {
+                    status = MINE_ERROR_PARAMETER;
+                    break;
+                }
+            }
+            else if ((0 == strcmp(argv[ix], "-s")) && (ix + 1 < argc))
+            {
+                seed = (ULONGLONG) strtoull(argv[++ix], NULL, 0);
+            }
+            else
+            {
+                status = MINE_ERROR_PARAMETER;
+                break;
+            }
+        }
+        if (MINE_ERROR_SUCCESS != status)
+        {
+            (void) fprintf(stderr, "Usage: %s [-l beginner|intermediate|expert] [-s seed]\n", argv[0]);
+            break;
+        }
+
+        if ((!isatty(STDIN_FILENO)) || (!isatty(STDOUT_FILENO)))
+        {
+            (void) fprintf(stderr, "%s has to be run in a terminal\n", argv[0]);
+            status = MINE_ERROR_PARAMETER;
+            break;
+        }
+
+        Mine_SeedRandom(seed);
+
+        //Changed tiles are drawn one by one instead of as pixels
+        damageData.trackTiles = TRUE;
+
+        status = MineTerm_SetupTerminal();
+        if (MINE_ERROR_SUCCESS != status)
+        {
+            MineDebug_PrintError("In function MineTerm_SetupTerminal: %i\n", (int) status);
+            break;
+        }
+
+        status = MineTerm_NewGame();
+        if (MINE_ERROR_SUCCESS != status)
+        {
+            MineDebug_PrintError("In function MineTerm_NewGame: %i\n", (int) status);
+            break;
+        }
+
+        pollInput.fd = STDIN_FILENO;
+        pollInput.events = POLLIN;
+
+        /** Draw whatever changed, then wait for input or for the timer to tick over. */
+        while (!termData.quit)
+        {
+            status = MineTerm_DrawFrame();
+            if (MINE_ERROR_SUCCESS != status)
+            {
+                MineDebug_PrintError("In function MineTerm_DrawFrame: %i\n", (int) status);
+                break;
+            }
+
+            ready = poll(&pollInput, 1, MINE_TERM_POLL_MS);
+            if (0 > ready)
+            {
+                if (EINTR == errno)
+                {
+                    continue;
+                }
+
+                MineDebug_PrintError("Waiting for input: %lu\n", GetLastError());
+                status = MINE_ERROR_PARAMETER;
+                break;
+            }
+
+            if (0 < ready)
+            {
+                inputBytes = read(STDIN_FILENO, input, sizeof(input));
+                if (0 >= inputBytes)
+                {
+                    //The terminal went away
+                    break;
+                }
+
+                status = MineTerm_HandleInput(input, (SIZE_T) inputBytes);
+                if (MINE_ERROR_SUCCESS != status)
+                {
+                    MineDebug_PrintError("In function MineTerm_HandleInput: %i\n", (int) status);
+                    break;
+                }
+            }
+        }
+
+        __assume(FALSE == bFalse);
+    } while (bFalse);
+
+    //Clean up
+    MineTerm_RestoreTerminal();
+    MineRender_Cleanup();
+    MineMinimap_Cleanup();
+    termData.shownTiles = NULL;
+    Mine_FreeBoard();
+
+    return (MINE_ERROR_SUCCESS == status) ? 0 : 1;
+}
+
+/**
+    Mine_GameWon
+*//**
+    Process a win of the game.
+*/
+VOID
+Mine_GameWon(VOID)
+{
+    /** Timer is updated for final game time. */
+    MineTerm_UpdateTimer();
+
+    //All mines will be set to flags, update remaining mine counter to match
+    gameData.numFlagged = gameData.mines;
+    gameData.gameOver = TRUE;
+    gameData.gameWon = TRUE;
+    MineDamage_AddAll();
+
+    return;
+}
+
+/**
+    MineTerm_DrawFrame
+*//**
+    Bring the terminal up to date with the game. Only the tiles listed as
+    changed since the last frame are looked at, and of those only the ones
+    that now look different are drawn.
+
+    @return Mine error code (MINE_ERROR_SUCCESS upon success).
+*/
+MINE_ERROR
+MineTerm_DrawFrame(VOID)
+{
+    BOOLEAN allTiles = FALSE;
+    UINT    ix = 0;
+    UINT    numTiles = 0;
+    RECT    rects[MINE_DAMAGE_MAX_RECTS];
+    LONG    xGrid = 0;
+    LONG    yGrid = 0;
+
+    MineTerm_LayoutView();
+
+    //Nothing here draws pixels, so the damaged rectangles are thrown away
+    (void) MineDamage_Take(rects);
+    numTiles = MineDamage_TakeTiles(termData.changedTiles, &allTiles);
+
+    if (termData.redrawAll)
+    {
+        MineTerm_Print("\x1b[0m\x1b[2J");
+        termData.outputRow = 0;
+        termData.outputColumn = 0;
+        termData.outputColors = MINE_TERM_TILE_UNKNOWN;
+        termData.shownStatus[0] = '\0';
+
+        (void) memset(termData.shownTiles, MINE_TERM_TILE_UNKNOWN, gameData.width*gameData.height);
+
+        MineTerm_MoveTo(MINE_TERM_BOARD_ROW + termData.viewHeight + 1, 1);
+        MineTerm_Print("arrows move, space reveal, f flag, d reveal around, n new game, 1-3 level, q quit");
+        termData.outputColumn = 0;
+
+        allTiles = TRUE;
+        termData.redrawAll = FALSE;
+    }
+
+    if (allTiles)
+    {
+        for (yGrid = termData.viewY; yGrid < termData.viewY + termData.viewHeight; yGrid++)
+        {
+            for (xGrid = termData.viewX; xGrid < termData.viewX + termData.viewWidth; xGrid++)
+            {
+                MineTerm_DrawTile(xGrid, yGrid);
+            }
+        }
+    }
+    else
+    {
+        for (ix = 0; ix < numTiles; ix++)
+        {
+            MineTerm_DrawTile(termData.changedTiles[ix] % (LONG) gameData.width,
+                              termData.changedTiles[ix] / (LONG) gameData.width);
+        }
+
+        /** The cursor is not part of the game, so its old and new tiles are checked here. */
+        MineTerm_DrawTile(termData.shownCursorX, termData.shownCursorY);
+        MineTerm_DrawTile(termData.cursorX, termData.cursorY);
+    }
+
+    termData.shownCursorX = termData.cursorX;
+    termData.shownCursorY = termData.cursorY;
+
+    MineTerm_DrawStatus();
+
+    return MineTerm_Flush();
+}
+
+/**
+    MineTerm_DrawStatus
+*//**
+    Draw the remaining mine count, face and timer if any of them changed.
+*/
+VOID
+MineTerm_DrawStatus(VOID)
+{
+    LPCSTR pFace = ":)";
+    CHAR   status[MINE_TERM_STATUS_CHARS] = {0};
+
+    if (gameData.gameStarted && (!gameData.gameOver))
+    {
+        MineTerm_UpdateTimer();
+    }
+
+    if (gameData.gameOver)
+    {
+        pFace = gameData.gameWon ? "B)" : "X(";
+    }
+
+    (void) snprintf(status, sizeof(status), "%4i   %s   %3u", (int) gameData.mines - (int) gameData.numFlagged,
+                    pFace, gameData.time);
+
+    if (0 != strcmp(status, termData.shownStatus))
+    {
+        MineTerm_MoveTo(MINE_TERM_STATUS_ROW, MINE_TERM_BOARD_COLUMN);
+        MineTerm_Print("\x1b[0m%s", status);
+        termData.outputColumn += (LONG) strlen(status);
+        termData.outputColors = MINE_TERM_TILE_UNKNOWN;
+
+        (void) memcpy(termData.shownStatus, status, sizeof(status));
+    }
+
+    return;
+}
+
+/**
+    MineTerm_DrawTile
+*//**
+    Draw a tile in view if it looks different from when it was last drawn.
+
+    @param[in] xGrid - X coordinate of tile in grid.
+    @param[in] yGrid - Y coordinate of tile in grid.
+*/
+VOID
+MineTerm_DrawTile(LONG xGrid, LONG yGrid)
+{
+    UINT                   shown = 0;
+    const MINE_TERM_GLYPH* pGlyph = NULL;
+
+    if ((xGrid >= termData.viewX) && (xGrid < termData.viewX + termData.viewWidth) &&
+        (yGrid >= termData.viewY) && (yGrid < termData.viewY + termData.viewHeight))
+    {
+        shown = MineRender_GetTileSprite(MINE_INDEX(xGrid, yGrid));
+        pGlyph = &(termGlyphs[shown]);
+
+        if ((termData.cursorX == xGrid) && (termData.cursorY == yGrid))
+        {
+            shown |= MINE_TERM_TILE_CURSOR;
+        }
+
+        if (termData.shownTiles[MINE_INDEX(xGrid, yGrid)] != (BYTE) shown)
+        {
+            MineTerm_MoveTo(MINE_TERM_BOARD_ROW + yGrid - termData.viewY,
+                            MINE_TERM_BOARD_COLUMN + (xGrid - termData.viewX)*MINE_TERM_TILE_COLUMNS);
+
+            /** Runs of tiles drawn the same way share one color change. */
+            if (termData.outputColors != shown)
+            {
+                MineTerm_Print("\x1b[%s%sm", pGlyph->pColors, (shown & MINE_TERM_TILE_CURSOR) ? ";7" : "");
+                termData.outputColors = shown;
+            }
+
+            MineTerm_Print("%s", pGlyph->pText);
+            termData.outputColumn += MINE_TERM_TILE_COLUMNS;
+
+            termData.shownTiles[MINE_INDEX(xGrid, yGrid)] = (BYTE) shown;
+        }
+    }
+
+    return;
+}
+
+/**
+    MineTerm_Flush
+*//**
+    Write every collected escape and text out to the terminal.
+
+    @return Mine error code (MINE_ERROR_SUCCESS upon success).
+*/
+MINE_ERROR
+MineTerm_Flush(VOID)
+{
+    SIZE_T     offset = 0;
+    MINE_ERROR status = MINE_ERROR_SUCCESS;
+    ssize_t    written = 0;
+
+    while (offset < termData.outputBytes)
+    {
+        written = write(STDOUT_FILENO, termData.output + offset, termData.outputBytes - offset);
+        if (0 > written)
+        {
+            if (EINTR == errno)
+            {
+                continue;
+            }
+
+            MineDebug_PrintError("Writing to terminal: %lu\n", GetLastError());
+            status = MINE_ERROR_PARAMETER;
+            break;
+        }
+
+        offset += (SIZE_T) written;
+    }
+
+    termData.outputBytes = 0;
+
+    return status;
+}
+
+/**
+    MineTerm_HandleInput
+*//**
+    Act on a block of keyboard and mouse input read from the terminal.
+
+    @param[in] pInput     - Bytes read from the terminal.
+    @param[in] inputBytes - Number of bytes in pInput.
+
+    @return Mine error code (MINE_ERROR_SUCCESS upon success).
+*/
+MINE_ERROR
+MineTerm_HandleInput(_In_reads_(inputBytes) const CHAR* pInput, SIZE_T inputBytes)
+{
+    LONG       button = 0;
+    LONG       column = 0;
+    SIZE_T     ix = 0;
+    LONG       row = 0;
+    MINE_ERROR status = MINE_ERROR_SUCCESS;
+    LONG       xGrid = termData.cursorX;
+    LONG       yGrid = termData.cursorY;
+
+    while ((ix < inputBytes) && (MINE_ERROR_SUCCESS == status) && (!termData.quit))
+    {
+        /** SGR mouse reports look like ESC [ < button ; column ; row M, or m on release. */
+        if ((ix + 2 < inputBytes) && ('\x1b' == pInput[ix]) && ('[' == pInput[ix + 1]) && ('<' == pInput[ix + 2]))
+        {
+            ix += 3;
+            button = 0;
+            column = 0;
+            row = 0;
+
+            while ((ix < inputBytes) && isdigit((unsigned char) pInput[ix]))
+            {
+                button = button*10 + (pInput[ix++] - '0');
+            }
+            if ((ix < inputBytes) && (';' == pInput[ix]))
+            {
+                ix++;
+            }
+            while ((ix < inputBytes) && isdigit((unsigned char) pInput[ix]))
+            {
+                column = column*10 + (pInput[ix++] - '0');
+            }
+            if ((ix < inputBytes) && (';' == pInput[ix]))
+            {
+                ix++;
+            }
+            while ((ix < inputBytes) && isdigit((unsigned char) pInput[ix]))
+            {
+                row = row*10 + (pInput[ix++] - '0');
+            }
+
+            //A report cut off by the end of the read is dropped
+            if ((ix < inputBytes) && (('M' == pInput[ix]) || ('m' == pInput[ix])))
+            {
+                status = MineTerm_HandleMouse(button, column, row, ('m' == pInput[ix]) ? TRUE : FALSE);
+                ix++;
+            }
+            continue;
+        }
+
+        /** Arrow keys look like ESC [ A to D. */
+        if ((ix + 2 < inputBytes) && ('\x1b' == pInput[ix]) && ('[' == pInput[ix + 1]))
+        {
+            switch (pInput[ix + 2])
+            {
+            case 'A':
+                termData.cursorY = max(0, termData.cursorY - 1);
+                break;
+            case 'B':
+                termData.cursorY = min((LONG) gameData.height - 1, termData.cursorY + 1);
+                break;
+            case 'C':
+                termData.cursorX = min((LONG) gameData.width - 1, termData.cursorX + 1);
+                break;
+            case 'D':
+                termData.cursorX = max(0, termData.cursorX - 1);
+                break;
+            default:
+                break;
+            }
+
+            ix += 3;
+            continue;
+        }
+
+        xGrid = termData.cursorX;
+        yGrid = termData.cursorY;
+
+        switch (pInput[ix])
+        {
+        case 'q':    /* Fall through */
+        case 'Q':    /* Fall through */
+        case '\x03':
+            termData.quit = TRUE;
+            break;
+        case 'n':
+            status = MineTerm_NewGame();
+            break;
+        case '1':    /* Fall through */
+        case '2':    /* Fall through */
+        case '3':
+            menuData.gameLevel = MINE_LEVEL_BEGINNER + (DWORD) (pInput[ix] - '1');
+            status = MineTerm_NewGame();
+            break;
+        case 'h':
+            termData.cursorX = max(0, termData.cursorX - 1);
+            break;
+        case 'j':
+            termData.cursorY = min((LONG) gameData.height - 1, termData.cursorY + 1);
+            break;
+        case 'k':
+            termData.cursorY = max(0, termData.cursorY - 1);
+            break;
+        case 'l':
+            termData.cursorX = min((LONG) gameData.width - 1, termData.cursorX + 1);
+            break;
+        case ' ':    /* Fall through */
+        case '\r':
+            /** Revealing a number that is already showing reveals around it instead. */
+            if (!gameData.gameOver)
+            {
+                if (MINE_TILE_STATUS_REVEALED == gameData.tileStatus[MINE_INDEX(xGrid, yGrid)])
+                {
+                    status = MineMouse_RevealAround(xGrid, yGrid);
+                }
+                else
+                {
+                    status = MineMouse_RevealTile(xGrid, yGrid);
+                }
+            }
+            break;
+        case 'f':
+            if (!gameData.gameOver)
+            {
+                MineMouse_ToggleFlag(xGrid, yGrid);
+            }
+            break;
+        case 'd':
+            if (!gameData.gameOver)
+            {
+                status = MineMouse_RevealAround(xGrid, yGrid);
+            }
+            break;
+        default:
+            break;
+        }
+
+        ix++;
+    }
+
+    return status;
+}
+
+/**
+    MineTerm_HandleMouse
+*//**
+    Act on one SGR mouse report.
+
+    @param[in] button  - SGR button number, with MINE_TERM_MOUSE_MOTION set while moving.
+    @param[in] column  - Terminal column (counting from 1) of the mouse.
+    @param[in] row     - Terminal row (counting from 1) of the mouse.
+    @param[in] release - TRUE if the button was released, FALSE if it was pressed.
+
+    @return Mine error code (MINE_ERROR_SUCCESS upon success).
+*/
+MINE_ERROR
+MineTerm_HandleMouse(LONG button, LONG column, LONG row, BOOLEAN release)
+{
+    MINE_ERROR status = MINE_ERROR_SUCCESS;
+    LONG       xGrid = 0;
+    LONG       yGrid = 0;
+
+    xGrid = termData.viewX + (column - MINE_TERM_BOARD_COLUMN) / MINE_TERM_TILE_COLUMNS;
+    yGrid = termData.viewY + row - MINE_TERM_BOARD_ROW;
+
+    /** Clicking the status line starts a new game, like clicking the face. */
+    if (MINE_TERM_STATUS_ROW == row)
+    {
+        if ((MINE_TERM_MOUSE_LEFT == button) && release)
+        {
+            status = MineTerm_NewGame();
+        }
+    }
+    else if ((column >= MINE_TERM_BOARD_COLUMN) && (xGrid < termData.viewX + termData.viewWidth) &&
+             (row >= MINE_TERM_BOARD_ROW) && (yGrid < termData.viewY + termData.viewHeight))
+    {
+        //The cursor follows the mouse so the tile about to be clicked is shown
+        termData.cursorX = xGrid;
+        termData.cursorY = yGrid;
+
+        if (!gameData.gameOver)
+        {
+            if ((MINE_TERM_MOUSE_LEFT == button) && release)
+            {
+                status = MineMouse_RevealTile(xGrid, yGrid);
+            }
+            else if ((MINE_TERM_MOUSE_RIGHT == button) && (!release))
+            {
+                MineMouse_ToggleFlag(xGrid, yGrid);
+            }
+            else if ((MINE_TERM_MOUSE_MIDDLE == button) && release)
+            {
+                status = MineMouse_RevealAround(xGrid, yGrid);
+            }
+        }
+    }
+
+    return status;
+}
+
+/**
+    MineTerm_LayoutView
+*//**
+    Size the view to the terminal and scroll it so the cursor is in view. Every
+    tile is drawn again if the view moved or changed size.
+*/
+VOID
+MineTerm_LayoutView(VOID)
+{
+    LONG           columns = 80;
+    LONG           rows = 24;
+    LONG           viewHeight = 0;
+    LONG           viewWidth = 0;
+    LONG           viewX = termData.viewX;
+    LONG           viewY = termData.viewY;
+    struct winsize windowSize = {0};
+
+    if ((0 == ioctl(STDOUT_FILENO, TIOCGWINSZ, &windowSize)) && (0 < windowSize.ws_row) && (0 < windowSize.ws_col))
+    {
+        rows = (LONG) windowSize.ws_row;
+        columns = (LONG) windowSize.ws_col;
+    }
+
+    viewWidth = max(1, min((LONG) gameData.width,
+                           (columns - MINE_TERM_BOARD_COLUMN + 1) / MINE_TERM_TILE_COLUMNS));
+    viewHeight = max(1, min((LONG) gameData.height, rows - MINE_TERM_BOARD_ROW + 1 - MINE_TERM_HELP_ROWS));
+
+    /** Scroll as little as possible to bring the cursor into view. */
+    viewX = max(min(viewX, termData.cursorX), termData.cursorX - viewWidth + 1);
+    viewX = max(0, min(viewX, (LONG) gameData.width - viewWidth));
+    viewY = max(min(viewY, termData.cursorY), termData.cursorY - viewHeight + 1);
+    viewY = max(0, min(viewY, (LONG) gameData.height - viewHeight));
+
+    if ((rows != termData.rows) || (columns != termData.columns) || (viewWidth != termData.viewWidth) ||
+        (viewHeight != termData.viewHeight) || (viewX != termData.viewX) || (viewY != termData.viewY))
+    {
+        termData.rows = rows;
+        termData.columns = columns;
+        termData.viewWidth = viewWidth;
+        termData.viewHeight = viewHeight;
+        termData.viewX = viewX;
+        termData.viewY = viewY;
+        termData.redrawAll = TRUE;
+    }
+
+    return;
+}
+
+/**
+    MineTerm_MoveTo
+*//**
+    Move the terminal cursor, unless it is already there.
+
+    @param[in] row    - Terminal row counting from 1.
+    @param[in] column - Terminal column counting from 1.
+*/
+VOID
+MineTerm_MoveTo(LONG row, LONG column)
+{
+    if ((row != termData.outputRow) || (column != termData.outputColumn))
+    {
+        MineTerm_Print("\x1b[%i;%iH", (int) row, (int) column);
+        termData.outputRow = row;
+        termData.outputColumn = column;
+    }
+
+    return;
+}
+
+/**
+    MineTerm_NewGame
+*//**
+    Start a new game at the level stored in menuData.
+
+    @return Mine error code (MINE_ERROR_SUCCESS upon success).
+*/
+MINE_ERROR
+MineTerm_NewGame(VOID)
+{
+    BOOLEAN    bFalse = FALSE;
+    MINE_ERROR status = MINE_ERROR_SUCCESS;
+
+    do
+    {
+        gameData.gameStarted = FALSE;
+        gameData.gameOver = FALSE;
+        gameData.gameWon = FALSE;
+
+        //Fill in board size and number of mines based on level
+        switch (menuData.gameLevel)
+        {
+        case MINE_LEVEL_INTERMEDIATE:
+            gameData.height = MINE_INTERMEDIATE_HEIGHT;
+            gameData.width = MINE_INTERMEDIATE_WIDTH;
+            gameData.mines = MINE_INTERMEDIATE_MINES;
+            break;
+        case MINE_LEVEL_EXPERT:
+            gameData.height = MINE_EXPERT_HEIGHT;
+            gameData.width = MINE_EXPERT_WIDTH;
+            gameData.mines = MINE_EXPERT_MINES;
+            break;
+        default:
+            gameData.height = MINE_BEGINNER_HEIGHT;
+            gameData.width = MINE_BEGINNER_WIDTH;
+            gameData.mines = MINE_BEGINNER_MINES;
+            break;
+        }
+
+        gameData.numFlagged = 0;
+        gameData.numUncovered = 0;
+        gameData.time = 0;
+        gameData.prevGridX = -1;
+        gameData.prevGridY = -1;
+
+        //The tiles as last drawn share the arena with the board arrays
+        termData.shownTiles = NULL;
+
+        status = Mine_AllocBoard(gameData.width*gameData.height + MineFrontier_ArenaBytes());
+        if (MINE_ERROR_SUCCESS != status)
+        {
+            MineDebug_PrintError("In function Mine_AllocBoard: %i\n", (int) status);
+            break;
+        }
+
+        termData.shownTiles = (BYTE*) MineArena_Alloc(gameData.width*gameData.height);
+
+        status = MineMinimap_Reset();
+        if (MINE_ERROR_SUCCESS != status)
+        {
+            MineDebug_PrintError("In function MineMinimap_Reset: %i\n", (int) status);
+            break;
+        }
+
+        status = MineFrontier_Reset();
+        if (MINE_ERROR_SUCCESS != status)
+        {
+            MineDebug_PrintError("In function MineFrontier_Reset: %i\n", (int) status);
+            break;
+        }
+
+        status = Mine_NewRandomBoard();
+        if (MINE_ERROR_SUCCESS != status)
+        {
+            MineDebug_PrintError("In function Mine_NewRandomBoard: %i\n", (int) status);
+            break;
+        }
+
+        status = Mine_SetupNumberImageData();
+        if (MINE_ERROR_SUCCESS != status)
+        {
+            MineDebug_PrintError("In function Mine_SetupNumberImageData: %i\n", (int) status);
+            break;
+        }
+
+        //Tile changes are still marked on the pixel layout, which has to match the board
+        Mine_SetupWindow();
+
+        termData.cursorX = min(termData.cursorX, (LONG) gameData.width - 1);
+        termData.cursorY = min(termData.cursorY, (LONG) gameData.height - 1);
+        termData.redrawAll = TRUE;
+
+        __assume(FALSE == bFalse);
+    } while (bFalse);
+
+    return status;
+}
+
+/**
+    MineTerm_Print
+*//**
+    Collect formatted text to be written out on the next flush.
+
+    @param[in] pFormat - printf style format string.
+*/
+VOID
+MineTerm_Print(_In_z_ _Printf_format_string_ LPCSTR pFormat, ...)
+{
+    va_list args;
+    INT     length = 0;
+
+    va_start(args, pFormat);
+    length = vsnprintf(termData.output + termData.outputBytes, MINE_TERM_OUTPUT_BYTES - termData.outputBytes,
+                       pFormat, args);
+    va_end(args);
+
+    /** Write out what has been collected to make room, then try again. */
+    if ((0 <= length) && ((SIZE_T) length >= MINE_TERM_OUTPUT_BYTES - termData.outputBytes))
+    {
+        (void) MineTerm_Flush();
+
+        va_start(args, pFormat);
+        length = vsnprintf(termData.output, MINE_TERM_OUTPUT_BYTES, pFormat, args);
+        va_end(args);
+    }
+
+    if (0 < length)
+    {
+        termData.outputBytes += min((SIZE_T) length, MINE_TERM_OUTPUT_BYTES - termData.outputBytes - 1);
+    }
+
+    return;
+}
+
+/**
+    MineTerm_RestoreTerminal
+*//**
+    Put the terminal back the way it was before the game started.
+*/
+VOID
+MineTerm_RestoreTerminal(VOID)
+{
+    if (termData.rawMode)
+    {
+        MineTerm_Print("\x1b[0m\x1b[?1006l\x1b[?1003l\x1b[?1000l\x1b[?25h\x1b[?1049l");
+        (void) MineTerm_Flush();
+
+        if (0 != tcsetattr(STDIN_FILENO, TCSAFLUSH, &termData.savedMode))
+        {
+            MineDebug_PrintWarning("Restoring terminal mode: %lu\n", GetLastError());
+        }
+
+        termData.rawMode = FALSE;
+    }
+
+    return;
+}
+
+/**
+    MineTerm_SetupTerminal
+*//**
+    Switch the terminal into raw mode on the alternate screen, with the cursor
+    hidden and mouse reports turned on.
+
+    @return Mine error code (MINE_ERROR_SUCCESS upon success).
+*/
+MINE_ERROR
+MineTerm_SetupTerminal(VOID)
+{
+    BOOLEAN        bFalse = FALSE;
+    struct termios rawMode;
+    MINE_ERROR     status = MINE_ERROR_SUCCESS;
+
+    do
+    {
+        if (0 != tcgetattr(STDIN_FILENO, &termData.savedMode))
+        {
+            MineDebug_PrintError("Reading terminal mode: %lu\n", GetLastError());
+            status = MINE_ERROR_PARAMETER;
+            break;
+        }
+
+        //Keys arrive one at a time without echo, Ctrl-C included
+        rawMode = termData.savedMode;
+        cfmakeraw(&rawMode);
+
+        if (0 != tcsetattr(STDIN_FILENO, TCSAFLUSH, &rawMode))
+        {
+            MineDebug_PrintError("Setting terminal mode: %lu\n", GetLastError());
+            status = MINE_ERROR_PARAMETER;
+            break;
+        }
+
+        termData.rawMode = TRUE;
+
+        /** Alternate screen, hidden cursor, button and motion mouse reports in SGR form. */
+        MineTerm_Print("\x1b[?1049h\x1b[?25l\x1b[?1000h\x1b[?1003h\x1b[?1006h");
+
+        termData.outputColors = MINE_TERM_TILE_UNKNOWN;
+        termData.redrawAll = TRUE;
+
+        __assume(FALSE == bFalse);
+    } while (bFalse);
+
+    return status;
+}
+
+/**
+    MineTerm_UpdateTimer
+*//**
+    Set the game time from the time since the first tile was revealed.
+*/
+VOID
+MineTerm_UpdateTimer(VOID)
+{
+    ULONGLONG currentTime = GetTickCount64();
+
+    //Convert time to seconds
+    currentTime = (currentTime - gameData.gameStartTime) / 1000;
+
+    gameData.time = (UINT) min(currentTime, (ULONGLONG) MINE_MAX_TIME);
+
+    return;
+}
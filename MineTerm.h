@@ -0,0 +1,292 @@
+/**
+    @file MineTerm.h
+
+    @author Craig Burkhart
+
+    @brief Header file for the terminal frontend, which plays the game in a
+           Linux terminal with ANSI escapes and redraws only changed tiles.
+*//*
+    Copyright (C) 2014 - Craig Burkhart
+
+    This file is part of Minesweeper Deluxe.
+
+    Minesweeper Deluxe is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Minesweeper Deluxe is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Minesweeper Deluxe.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#pragma once
+
+#include <ctype.h>
+#include <poll.h>
+#include <sys/ioctl.h>
+#include <termios.h>
+#include <unistd.h>
+
+#include "Mine.h"
+#include "MineDamage.h"
+
+//--------------------------------------------------------------
+//    Macros
+//--------------------------------------------------------------
+
+/** Number of terminal columns taken up by one tile. */
+#define MINE_TERM_TILE_COLUMNS 2
+/** Terminal row (counting from 1) of the mine counter, face and timer. */
+#define MINE_TERM_STATUS_ROW   1
+/** Terminal row (counting from 1) of the top row of tiles. */
+#define MINE_TERM_BOARD_ROW    3
+/** Terminal column (counting from 1) of the leftmost tile. */
+#define MINE_TERM_BOARD_COLUMN 1
+/** Number of terminal rows below the board kept for the key help line. */
+#define MINE_TERM_HELP_ROWS    2
+
+/** Most bytes of escapes and text collected before they are written out. */
+#define MINE_TERM_OUTPUT_BYTES 65536
+/** Most bytes of input read from the terminal at once. */
+#define MINE_TERM_INPUT_BYTES  256
+/** Most characters in the status line, including the terminating null. */
+#define MINE_TERM_STATUS_CHARS 64
+
+/** Longest time (in milliseconds) to wait for input before the timer is checked. */
+#define MINE_TERM_POLL_MS 100
+
+/** Value in shownTiles for a tile that has to be drawn whatever it shows. */
+#define MINE_TERM_TILE_UNKNOWN 0xFF
+/** Bit set in shownTiles for the tile under the keyboard cursor. */
+#define MINE_TERM_TILE_CURSOR  0x80
+
+/** SGR mouse button number of the left button. */
+#define MINE_TERM_MOUSE_LEFT   0
+/** SGR mouse button number of the middle button. */
+#define MINE_TERM_MOUSE_MIDDLE 1
+/** SGR mouse button number of the right button. */
+#define MINE_TERM_MOUSE_RIGHT  2
+/** Bit set in the SGR mouse button number while the mouse is moving. */
+#define MINE_TERM_MOUSE_MOTION 32
+
+//--------------------------------------------------------------
+//    Structures
+//--------------------------------------------------------------
+
+struct _MINE_TERM_GLYPH
+{
+    /** Text drawn for the sprite, MINE_TERM_TILE_COLUMNS characters wide. */
+    LPCSTR pText;
+    /** SGR parameters for the colors of the text. */
+    LPCSTR pColors;
+};
+
+struct _MINE_TERM_DATA
+{
+    /** Terminal settings to put back when the game exits. */
+    struct termios savedMode;
+    /** Flag for if the terminal has been switched into raw mode. */
+    BOOLEAN        rawMode;
+    /** Flag for if the player asked to quit. */
+    BOOLEAN        quit;
+    /** Flag for if every part of the screen has to be drawn on the next frame. */
+    BOOLEAN        redrawAll;
+    /** Number of rows in the terminal. */
+    LONG           rows;
+    /** Number of columns in the terminal. */
+    LONG           columns;
+    /** X coordinate (in grid) of the keyboard cursor. */
+    LONG           cursorX;
+    /** Y coordinate (in grid) of the keyboard cursor. */
+    LONG           cursorY;
+    /** X coordinate (in grid) of the leftmost tile in view. */
+    LONG           viewX;
+    /** Y coordinate (in grid) of the top tile in view. */
+    LONG           viewY;
+    /** Number of tiles across the view. */
+    LONG           viewWidth;
+    /** Number of tiles down the view. */
+    LONG           viewHeight;
+    /** X coordinate (in grid) of the keyboard cursor as last drawn. */
+    LONG           shownCursorX;
+    /** Y coordinate (in grid) of the keyboard cursor as last drawn. */
+    LONG           shownCursorY;
+    /** Sprite each tile was last drawn with, MINE_TERM_TILE_CURSOR added under
+        the cursor, MINE_TERM_TILE_UNKNOWN if not drawn since the view changed. */
+    BYTE*          shownTiles;
+    /** Text of the status line as last drawn. */
+    CHAR           shownStatus[MINE_TERM_STATUS_CHARS];
+    /** Escapes and text waiting to be written out. */
+    CHAR           output[MINE_TERM_OUTPUT_BYTES];
+    /** Number of bytes in output. */
+    SIZE_T         outputBytes;
+    /** Row (counting from 1) the terminal cursor is known to be on, 0 if unknown. */
+    LONG           outputRow;
+    /** Column (counting from 1) the terminal cursor is known to be on, 0 if unknown. */
+    LONG           outputColumn;
+    /** Sprite, plus MINE_TERM_TILE_CURSOR under the cursor, whose colors the
+        terminal is drawing with, MINE_TERM_TILE_UNKNOWN if unknown. */
+    UINT           outputColors;
+    /** Changed tiles handed over by MineDamage_TakeTiles. */
+    LONG           changedTiles[MINE_DAMAGE_MAX_TILES];
+};
+
+//--------------------------------------------------------------
+//    Typedefs
+//--------------------------------------------------------------
+
+/** How a tile sprite is drawn in the terminal. */
+typedef struct _MINE_TERM_GLYPH MINE_TERM_GLYPH;
+
+/** State of the terminal frontend. */
+typedef struct _MINE_TERM_DATA MINE_TERM_DATA;
+
+//--------------------------------------------------------------
+//    Global Variable Externs
+//--------------------------------------------------------------
+
+extern MINE_TERM_DATA termData;
+
+//--------------------------------------------------------------
+//    Function Prototypes
+//--------------------------------------------------------------
+
+/**
+    MineTerm_DrawFrame
+*//**
+    Bring the terminal up to date with the game. Only the tiles listed as
+    changed since the last frame are looked at, and of those only the ones
+    that now look different are drawn.
+
+    @return Mine error code (MINE_ERROR_SUCCESS upon success).
+*/
+MINE_ERROR
+MineTerm_DrawFrame(VOID);
+
+/**
+    MineTerm_DrawStatus
+*//**
+    Draw the remaining mine count, face and timer if any of them changed.
+*/
+VOID
+MineTerm_DrawStatus(VOID);
+
+/**
+    MineTerm_DrawTile
+*//**
+    Draw a tile in view if it looks different from when it was last drawn.
+
+    @param[in] xGrid - X coordinate of tile in grid.
+    @param[in] yGrid - Y coordinate of tile in grid.
+*/
+VOID
+MineTerm_DrawTile(LONG xGrid, LONG yGrid);
+
+/**
+    MineTerm_Flush
+*//**
+    Write every collected escape and text out to the terminal.
+
+    @return Mine error code (MINE_ERROR_SUCCESS upon success).
+*/
+MINE_ERROR
+MineTerm_Flush(VOID);
+
+/**
+    MineTerm_HandleInput
+*//**
+    Act on a block of keyboard and mouse input read from the terminal.
+
+    @param[in] pInput     - Bytes read from the terminal.
+    @param[in] inputBytes - Number of bytes in pInput.
+
+    @return Mine error code (MINE_ERROR_SUCCESS upon success).
+*/
+MINE_ERROR
+MineTerm_HandleInput(_In_reads_(inputBytes) const CHAR* pInput, SIZE_T inputBytes);
+
+/**
+    MineTerm_HandleMouse
+*//**
+    Act on one SGR mouse report.
+
+    @param[in] button  - SGR button number, with MINE_TERM_MOUSE_MOTION set while moving.
+    @param[in] column  - Terminal column (counting from 1) of the mouse.
+    @param[in] row     - Terminal row (counting from 1) of the mouse.
+    @param[in] release - TRUE if the button was released, FALSE if it was pressed.
+
+    @return Mine error code (MINE_ERROR_SUCCESS upon success).
+*/
+MINE_ERROR
+MineTerm_HandleMouse(LONG button, LONG column, LONG row, BOOLEAN release);
+
+/**
+    MineTerm_LayoutView
+*//**
+    Size the view to the terminal and scroll it so the cursor is in view. Every
+    tile is drawn again if the view moved or changed size.
+*/
+VOID
+MineTerm_LayoutView(VOID);
+
+/**
+    MineTerm_MoveTo
+*//**
+    Move the terminal cursor, unless it is already there.
+
+    @param[in] row    - Terminal row counting from 1.
+    @param[in] column - Terminal column counting from 1.
+*/
+VOID
+MineTerm_MoveTo(LONG row, LONG column);
+
+/**
+    MineTerm_NewGame
+*//**
+    Start a new game at the level stored in menuData.
+
+    @return Mine error code (MINE_ERROR_SUCCESS upon success).
+*/
+MINE_ERROR
+MineTerm_NewGame(VOID);
+
+/**
+    MineTerm_Print
+*//**
+    Collect formatted text to be written out on the next flush.
+
+    @param[in] pFormat - printf style format string.
+*/
+VOID
+MineTerm_Print(_In_z_ _Printf_format_string_ LPCSTR pFormat, ...);
+
+/**
+    MineTerm_RestoreTerminal
+*//**
+    Put the terminal back the way it was before the game started.
+*/
+VOID
+MineTerm_RestoreTerminal(VOID);
+
+/**
+    MineTerm_SetupTerminal
+*//**
+    Switch the terminal into raw mode on the alternate screen, with the cursor
+    hidden and mouse reports turned on.
+
+    @return Mine error code (MINE_ERROR_SUCCESS upon success).
+*/
+MINE_ERROR
+MineTerm_SetupTerminal(VOID);
+
+/**
+    MineTerm_UpdateTimer
+*//**
+    Set the game time from the time since the first tile was revealed.
+*/
+VOID
+MineTerm_UpdateTimer(VOID);
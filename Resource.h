@@ -38,73 +38,8 @@
 
 #define IDR_MAINFRAME           128
 
-#define IDB_RANDOM0             131
-#define IDB_RANDOM1             132
-#define IDB_RANDOM2             133
-#define IDB_RANDOM3             134
-#define IDB_RANDOM4             135
-#define IDB_RANDOM5             136
-#define IDB_RANDOM6             137
-#define IDB_RANDOM7             138
-#define IDB_RANDOM8             139
-#define IDB_RANDOM9             140
-#define IDB_RANDOM10            141
-#define IDB_RANDOM11            142
-#define IDB_RANDOM12            143
-#define IDB_RANDOM13            144
-#define IDB_RANDOM14            145
-#define IDB_RANDOM15            146
-
 #define IDS_APP_TITLE           150
 
-#define IDB_TIMERDASH           159
-#define IDB_TIMER0              160
-#define IDB_TIMER1              161
-#define IDB_TIMER2              162
-#define IDB_TIMER3              163
-#define IDB_TIMER4              164
-#define IDB_TIMER5              165
-#define IDB_TIMER6              166
-#define IDB_TIMER7              167
-#define IDB_TIMER8              168
-#define IDB_TIMER9              169
-
-#define IDB_CLICKED0            170
-#define IDB_CLICKED1            171
-#define IDB_CLICKED2            172
-#define IDB_CLICKED3            173
-#define IDB_CLICKED4            174
-#define IDB_CLICKED5            175
-#define IDB_CLICKED6            176
-#define IDB_CLICKED7            177
-#define IDB_CLICKED8            178
-
-#define IDB_UNCLICKED           179
-#define IDB_HELD                180
-#define IDB_FLAG                181
-#define IDB_FALSEFLAG           182
-#define IDB_MINE                183
-#define IDB_MINEHIT             184
-
-#define IDB_FACENORMAL          185
-#define IDB_FACECLICKED         186
-#define IDB_FACEWON             187
-#define IDB_FACELOST            188
-
-#define IDB_SOLID0              190
-#define IDB_SOLID1              191
-#define IDB_SOLID2              192
-#define IDB_SOLID3              193
-#define IDB_SOLID4              194
-#define IDB_SOLID5              195
-#define IDB_SOLID6              196
-#define IDB_SOLID7              197
-#define IDB_SOLID8              198
-
-
-
-
-
 #define IDM_NEW                 1000
 #define IDM_BEGINNER            1001
 #define IDM_INTERMEDIATE        1002
@@ -142,6 +77,10 @@
 #define IDC_MOVEMENT_CHECK      101
 #define IDC_MOVEMENT_FREQ       102
 #define IDC_MOVEMENT_AGGRESSIVE 103
+#define IDC_MOVEMENT_BATCH      104
+#define IDC_MOVEMENT_PERCENT    105
+#define IDC_MOVEMENT_POLICY     106
+#define IDC_MOVEMENT_CONSISTENT 107
 
 #define IDC_ABOUT_LICENSE 101
 #define IDC_ABOUT_LINK1 102
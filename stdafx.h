@@ -24,6 +24,8 @@
 */
 #pragma once
 
+#ifdef _WIN32
+
 #include "targetver.h"
 
 //Windows header files
@@ -49,8 +51,18 @@
 #ifdef _DEBUG
 #include <errno.h>
 #endif /* _DEBUG */
+#include <intrin.h>
 #include <limits.h>
+#include <math.h>
 #include <stdarg.h>
+#include <stdio.h>
 #include <strsafe.h>
 
-#pragma warning(pop)
\ No newline at end of file
+#pragma warning(pop)
+
+#else /* _WIN32 */
+
+//Headless builds only use the C runtime
+#include "MinePortable.h"
+
+#endif /* _WIN32 */